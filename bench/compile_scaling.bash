@@ -0,0 +1,111 @@
+#!/bin/bash
+# Compile-time scaling benchmark.
+# Sweeps one axis of the synthetic program generator at a time (the others stay at their defaults),
+# compiles every program with every combination of --optim-* flags and records the --stats output
+# of each stage. Finally estimates how each stage grows along each axis.
+#
+# usage: compile_scaling.bash <mxcompiler> <bench_gen_program> <outdir>
+# environment:
+#   AXES       axes to sweep (default: all of them)
+#   FLAGSETS   "all" for every flag combination (default), "full" for only -O with every optimization
+#   TIMEOUT    seconds allowed for one compile (default 300)
+#
+# <outdir>/compile_scaling.tsv has one row per (program, flags, stage); rows from runs of different
+# compiler versions can be appended to the same file and compared by the version column.
+set -u
+
+if [ $# -lt 3 ]; then
+	echo "usage: $0 <mxcompiler> <bench_gen_program> <outdir>" >&2
+	exit 1
+fi
+COMPILER=$(readlink -f "$1")
+GEN=$(readlink -f "$2")
+OUT=$3
+AXES=${AXES:-"functions blocks loop-depth live calls classes"}
+FLAGSETS=${FLAGSETS:-all}
+TIMEOUT=${TIMEOUT:-300}
+
+declare -A SIZES=(
+	[functions]="4 8 16 32 64"
+	[blocks]="16 32 64 128 256"
+	[loop-depth]="1 2 4 8"
+	[live]="4 8 16 32 64"
+	[calls]="5 10 25 50 100"
+	[classes]="1 2 8 32 128"
+)
+
+VERSION=$(git -C "$(dirname "$0")" describe --always --dirty 2>/dev/null || echo unknown)
+
+# every combination of the flags; the mid-end passes only run together with --optim-reg-alloc
+flag_combinations()
+{
+	if [ "$FLAGSETS" = "full" ]; then
+		echo "--optim-reg-alloc --optim-inline --optim-gvn --optim-dead-code --optim-loop-invariant"
+		return
+	fi
+	local inline gvn dce licm
+	for inline in "" "--optim-inline"; do
+		echo "$inline"
+		for gvn in "" "--optim-gvn"; do
+			for dce in "" "--optim-dead-code"; do
+				for licm in "" "--optim-loop-invariant"; do
+					echo "--optim-reg-alloc $inline $gvn $dce $licm"
+				done
+			done
+		done
+	done
+}
+
+flag_tag()
+{
+	local tag
+	tag=$(echo "$1" | sed -e 's/--optim-//g' -e 's/  */+/g' -e 's/^+//' -e 's/+$//')
+	echo "${tag:-basic}"
+}
+
+mkdir -p "$OUT/programs" "$OUT/stats"
+TSV="$OUT/compile_scaling.tsv"
+[ -f "$TSV" ] || printf "version\taxis\tvalue\tflags\tstage\truns\twall_ms\tpeak_rss_delta_kb\n" > "$TSV"
+
+for axis in $AXES; do
+	for value in ${SIZES[$axis]}; do
+		prog="$OUT/programs/$axis-$value.mx"
+		"$GEN" "$axis=$value" > "$prog" || exit 1
+		while read -r flags; do
+			tag=$(flag_tag "$flags")
+			json="$OUT/stats/$axis-$value-$tag.json"
+			# shellcheck disable=SC2086
+			if ! timeout "$TIMEOUT" "$COMPILER" --fdisable-access-protect $flags --stats="$json" "$prog" -o /dev/null; then
+				printf "%s\t%s\t%s\t%s\t%s\t\t\t\n" "$VERSION" "$axis" "$value" "$tag" "FAILED" >> "$TSV"
+				echo "$axis=$value [$tag]: compile failed or timed out" >&2
+				continue
+			fi
+			sed -n 's/.*"name": "\([^"]*\)", "runs": \([0-9]*\), "wall_ms": \([0-9.]*\), "peak_rss_delta_kb": \(-\{0,1\}[0-9]*\).*/\1\t\2\t\3\t\4/p' "$json" |
+				while IFS=$'\t' read -r stage runs ms rss; do
+					printf "%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n" "$VERSION" "$axis" "$value" "$tag" "$stage" "$runs" "$ms" "$rss"
+				done >> "$TSV"
+			peak=$(sed -n 's/.*"peak_rss_kb": \([0-9]*\).*/\1/p' "$json")
+			printf "%s\t%s\t%s\t%s\t%s\t1\t\t%s\n" "$VERSION" "$axis" "$value" "$tag" "PeakRSS" "$peak" >> "$TSV"
+		done < <(flag_combinations)
+		echo "$axis=$value done" >&2
+	done
+done
+
+# growth exponent k of time ~ value^k between the smallest and the largest size of each axis,
+# for the flag combination with every optimization; stages that stay under 5 ms are skipped as noise
+echo "Growth of each stage with every optimization enabled (version $VERSION):"
+awk -F'\t' -v version="$VERSION" '
+	$1 == version && $4 == "reg-alloc+inline+gvn+dead-code+loop-invariant" && $7 != "" {
+		key = $2 SUBSEP $5
+		if (!(key in minv) || $3 + 0 < minv[key]) { minv[key] = $3 + 0; tmin[key] = $7 + 0 }
+		if (!(key in maxv) || $3 + 0 > maxv[key]) { maxv[key] = $3 + 0; tmax[key] = $7 + 0 }
+	}
+	END {
+		for (key in minv) {
+			split(key, part, SUBSEP)
+			if (maxv[key] <= minv[key] || tmax[key] < 5 || tmin[key] <= 0)
+				continue
+			k = log(tmax[key] / tmin[key]) / log(maxv[key] / minv[key])
+			printf "%-12s %-36s %9.2f ms -> %9.2f ms  k = %5.2f%s\n", part[1], part[2], tmin[key], tmax[key], k, (k > 1.2 ? "  super-linear" : "")
+		}
+	}' "$TSV" | sort
@@ -0,0 +1,166 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+
+//Generates a synthetic Mx program for compile-time benchmarks. Every axis is a knob:
+//  functions=N     number of functions besides main
+//  blocks=N        if/else statements per function, each adds three basic blocks
+//  loop-depth=N    the statements of a function are spread over loops nested N deep
+//  live=N          values that stay live through the whole function body (register pressure)
+//  calls=N         percentage of statements that call an earlier function (call-graph density)
+//  classes=N       number of classes; statements create objects and call their methods
+//  seed=N
+//usage: bench_gen_program [knob=value]... > program.mx
+//The output only depends on the knobs, so the same program can be compiled by different versions.
+
+struct Config
+{
+	int functions = 16;
+	int blocks = 32;
+	int loopDepth = 2;
+	int live = 8;
+	int calls = 10;
+	int classes = 2;
+	std::uint64_t seed = 1;
+};
+
+class Random
+{
+public:
+	explicit Random(std::uint64_t seed) : state(seed * 0x9e3779b97f4a7c15ULL + 1) {}
+	//xorshift64*, so that the sequence does not depend on the standard library
+	std::uint64_t next()
+	{
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		return state * 0x2545f4914f6cdd1dULL;
+	}
+	int below(int n) { return n <= 0 ? 0 : int(next() % std::uint64_t(n)); }
+
+protected:
+	std::uint64_t state;
+};
+
+static void genClasses(const Config &config, std::ostream &out)
+{
+	for (int c = 0; c < config.classes; c++)
+	{
+		out << "class C" << c << " {\n";
+		out << "    int f0;\n    int f1;\n";
+		out << "    int get(int x) { f0 = f0 + x; return f0 * " << c + 2 << " + f1; }\n";
+		out << "}\n";
+	}
+}
+
+static void genFunction(const Config &config, int idx, Random &rnd, std::ostream &out)
+{
+	const int live = config.live < 1 ? 1 : config.live;
+	auto var = [&rnd, live]() { return "v" + std::to_string(rnd.below(live)); };
+
+	out << "int func" << idx << "(int p0, int p1) {\n";
+	for (int i = 0; i < live; i++)
+		out << "    int v" << i << " = p0 * " << i + 1 << " + p1;\n";
+	for (int d = 0; d < config.loopDepth; d++)
+		out << "    int i" << d << ";\n";
+
+	//statements are split evenly over loop nests of depth loopDepth
+	int stmtsPerNest = config.loopDepth > 0 ? 4 : config.blocks;
+	if (stmtsPerNest < 1)
+		stmtsPerNest = 1;
+	for (int stmt = 0; stmt < config.blocks; )
+	{
+		std::string indent = "    ";
+		for (int d = 0; d < config.loopDepth; d++)
+		{
+			out << indent << "for (i" << d << " = 0; i" << d << " < p1 % " << d + 3 << "; i" << d << "++) {\n";
+			indent += "    ";
+		}
+		for (int k = 0; k < stmtsPerNest && stmt < config.blocks; k++, stmt++)
+		{
+			//draw every random number in its own statement, the evaluation order inside an expression is unspecified
+			std::string dst = var(), cond1 = var(), cond2 = var();
+			std::string a1 = var(), a2 = var(), b1 = var(), b2 = var();
+			int mul = rnd.below(97) + 1, div = rnd.below(13) + 1;
+			out << indent << "if (" << cond1 << " > " << cond2 << ") {\n";
+			out << indent << "    " << dst << " = " << a1 << " + " << a2 << " * " << mul << ";\n";
+			out << indent << "} else {\n";
+			out << indent << "    " << dst << " = " << b1 << " - " << b2 << " / " << div << ";\n";
+			out << indent << "}\n";
+			if (idx > 0 && rnd.below(100) < config.calls)
+			{
+				std::string lhs = var(), rhs = var(), arg1 = var(), arg2 = var();
+				int callee = rnd.below(idx);
+				out << indent << lhs << " = " << rhs << " + func" << callee << "(" << arg1 << ", " << arg2 << ");\n";
+			}
+			if (config.classes > 0 && rnd.below(8) == 0)
+			{
+				int c = rnd.below(config.classes);
+				std::string obj = "o" + std::to_string(stmt);
+				std::string field = var(), lhs = var(), arg = var();
+				out << indent << "C" << c << " " << obj << " = new C" << c << ";\n";
+				out << indent << obj << ".f1 = " << field << ";\n";
+				out << indent << lhs << " = " << obj << ".get(" << arg << ");\n";
+			}
+		}
+		for (int d = config.loopDepth - 1; d >= 0; d--)
+		{
+			indent.resize(indent.size() - 4);
+			out << indent << "}\n";
+		}
+	}
+
+	out << "    return";
+	for (int i = 0; i < live; i++)
+		out << (i ? " + v" : " v") << i;
+	out << ";\n}\n";
+}
+
+int main(int argc, char *argv[])
+{
+	Config config;
+	for (int i = 1; i < argc; i++)
+	{
+		const char *eq = std::strchr(argv[i], '=');
+		if (!eq)
+		{
+			std::cerr << "usage: " << argv[0] << " [functions|blocks|loop-depth|live|calls|classes|seed=N]..." << std::endl;
+			return 1;
+		}
+		std::string key(argv[i], eq - argv[i]);
+		long long value = std::atoll(eq + 1);
+		if (key == "functions")
+			config.functions = int(value);
+		else if (key == "blocks")
+			config.blocks = int(value);
+		else if (key == "loop-depth")
+			config.loopDepth = int(value);
+		else if (key == "live")
+			config.live = int(value);
+		else if (key == "calls")
+			config.calls = int(value);
+		else if (key == "classes")
+			config.classes = int(value);
+		else if (key == "seed")
+			config.seed = std::uint64_t(value);
+		else
+		{
+			std::cerr << argv[0] << ": unknown knob " << key << std::endl;
+			return 1;
+		}
+	}
+
+	Random rnd(config.seed);
+	std::ostream &out = std::cout;
+	genClasses(config, out);
+	for (int f = 0; f < config.functions; f++)
+		genFunction(config, f, rnd, out);
+
+	out << "int main() {\n    int n = getInt();\n    int sum = 0;\n";
+	for (int f = 0; f < config.functions; f++)
+		out << "    sum = sum + func" << f << "(n, " << f + 1 << ");\n";
+	out << "    println(toString(sum));\n    return 0;\n}\n";
+	return 0;
+}
@@ -0,0 +1,110 @@
+#include "../src/common_headers.h"
+#include "../src/IR.h"
+#include <chrono>
+#include <atomic>
+#include <new>
+#include <cstdlib>
+
+//Micro-benchmark for operand visiting: counts heap allocations and time per instruction visit
+//for the vector-returning getInputReg / getOutputReg against the in-place inputRegs / outputRegs.
+
+static std::atomic<size_t> cntAlloc(0);
+
+void * operator new(size_t size)
+{
+	cntAlloc++;
+	if (void *ptr = std::malloc(size ? size : 1))
+		return ptr;
+	throw std::bad_alloc();
+}
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+using namespace MxIR;
+
+struct Sample
+{
+	std::vector<Instruction> ins;
+	std::vector<Block::PhiIns> phi;
+	std::vector<Block::SigmaIns> sigma;
+
+	Sample()
+	{
+		ins.push_back(IR(Reg64(1).setVer(1), Add, Reg64(2).setVer(1), Reg64(3).setVer(1)));
+		ins.push_back(IR(Reg64(4).setVer(1), Add, Reg64(1).setVer(1), Imm64(1)));
+		ins.push_back(IR(Reg64(5).setVer(1), Load, Reg64(4).setVer(1)));
+		ins.push_back(IRStore(Reg64(5).setVer(1), Reg64(1).setVer(1)));
+		ins.push_back(IRStoreA(Reg32(6).setVer(1), Reg64(1).setVer(1), Imm64(8)));
+		ins.push_back(IRCall(Reg64(7).setVer(1), IDFunc(0), { Reg64(1).setVer(1), Reg64(2).setVer(1), Imm64(3), Reg64(4).setVer(1) }));
+		ins.push_back(IRParallelMove({ Reg64(8).setVer(1), Reg64(9).setVer(1) }, { Reg64(1).setVer(1), Reg64(2).setVer(1) }));
+		ins.push_back(IRBranch(Reg8(10).setVer(1)));
+		ins.push_back(IRReturn(Reg64(7).setVer(1)));
+
+		phi.emplace_back(Reg64(11).setVer(2));
+		phi.back().srcs.emplace_back(Reg64(11).setVer(1), std::weak_ptr<Block>());
+		phi.back().srcs.emplace_back(Reg64(11).setVer(3), std::weak_ptr<Block>());
+		phi.back().srcs.emplace_back(Imm64(0), std::weak_ptr<Block>());
+
+		sigma.emplace_back(Reg64(12).setVer(1));
+		sigma.back().dstTrue = Reg64(12).setVer(2);
+		sigma.back().dstFalse = Reg64(12).setVer(3);
+	}
+
+	template<typename Visitor>
+	std::uint64_t visitAll(Visitor visitor)
+	{
+		std::uint64_t sum = 0;
+		for (auto &p : phi)
+			sum += visitor(p);
+		for (auto &i : ins)
+			sum += visitor(i);
+		for (auto &s : sigma)
+			sum += visitor(s);
+		return sum;
+	}
+	size_t size() const { return ins.size() + phi.size() + sigma.size(); }
+};
+
+template<typename Visitor>
+void run(const char *name, Sample &sample, size_t rounds, Visitor visitor)
+{
+	std::uint64_t checksum = 0;
+	size_t allocBefore = cntAlloc;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < rounds; i++)
+		checksum += sample.visitAll(visitor);
+	auto finish = std::chrono::steady_clock::now();
+	size_t nAlloc = cntAlloc - allocBefore;
+	size_t nVisit = rounds * sample.size();
+	double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+	std::cout << std::left << std::setw(24) << name
+		<< std::fixed << std::setprecision(3)
+		<< " allocs/visit " << std::setw(8) << double(nAlloc) / nVisit
+		<< " ns/visit " << std::setw(8) << ns / nVisit
+		<< " checksum " << checksum << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t rounds = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+	Sample sample;
+
+	std::cout << "sizeof(Operand) = " << sizeof(Operand) << ", sizeof(Instruction) = " << sizeof(Instruction) << std::endl;
+	std::cout << sample.size() << " instructions, " << rounds << " rounds" << std::endl;
+
+	run("getInputReg/OutputReg", sample, rounds, [](InstructionBase &ins)
+	{
+		std::uint64_t sum = 0;
+		for (Operand *operand : join<Operand *>(ins.getInputReg(), ins.getOutputReg()))
+			sum += operand->val;
+		return sum;
+	});
+	run("inputRegs/outputRegs", sample, rounds, [](InstructionBase &ins)
+	{
+		std::uint64_t sum = 0;
+		for (Operand *operand : join<Operand *>(ins.inputRegs(), ins.outputRegs()))
+			sum += operand->val;
+		return sum;
+	});
+	return 0;
+}
@@ -0,0 +1,127 @@
+#include "../src/common_headers.h"
+#include <MxLexer.h>
+#include <MxParser.h>
+#include <chrono>
+#include "../src/AST.h"
+#include "../src/ASTConstructor.h"
+#include "../src/IssueCollector.h"
+#include "../src/StaticTypeChecker.h"
+#include "../src/MxBuiltin.h"
+#include "../src/ConstantFold.h"
+#include "../src/IRGenerator.h"
+#include "../src/SSAConstructor.h"
+#include "../src/InstructionSelect.h"
+#include "../src/ModRefAnalysis.h"
+#include "../src/LoopInvariantOptimizer.h"
+#include "../src/DeadCodeElimination.h"
+#include "../src/GVN.h"
+#include "../src/LoadCombine.h"
+#include "../src/FunctionAnalysis.h"
+
+//Times the per-function mid-end passes on every function of an Mx program.
+//Each round runs the pipeline of main.cpp on a fresh clone of the SSA form; the best round is reported.
+//usage: bench_pass_time <file.mx> [rounds]
+
+using namespace MxIR;
+
+static size_t countInstructions(Function &func)
+{
+	size_t ret = 0;
+	func.inBlock->traverse([&ret](Block *block) -> bool
+	{
+		ret += block->phi.size() + block->ins.size();
+		return true;
+	});
+	return ret;
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 2)
+	{
+		std::cerr << "usage: " << argv[0] << " <file.mx> [rounds]" << std::endl;
+		return 1;
+	}
+	std::string fileName = argv[1];
+	size_t rounds = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 3;
+
+	antlr4::ANTLRFileStream fin(fileName);
+	MxLexer lexer(&fin);
+	antlr4::CommonTokenStream tokens(&lexer);
+	MxParser parser(&tokens);
+	auto prog = parser.prog();
+	if (lexer.getNumberOfSyntaxErrors() > 0 || parser.getNumberOfSyntaxErrors() > 0)
+		return 1;
+
+	IssueCollector ic(IssueCollector::NOTICE, &std::cerr, &tokens, fileName);
+	ic.setDefault();
+	ASTConstructor constructor(&ic);
+	GlobalSymbol symbol;
+	symbol.setDefault();
+
+	MxProgram program;
+	program.setDefault();
+	MxBuiltin builtin;
+	builtin.setDefault();
+	builtin.init();
+
+	std::unique_ptr<MxAST::ASTRoot> root(constructor.constructAST(prog, &symbol));
+	StaticTypeChecker checker(&program, &symbol, &ic);
+	if (!checker.preCheck(root.get()))
+		return 2;
+	root->recursiveAccess(&checker);
+	if (ic.cntError > 0)
+		return 2;
+	ASTOptimizer::ConstantFold cfold;
+	root->recursiveAccess(&cfold);
+	IRGenerator irgen;
+	irgen.generateProgram(root.get());
+	ModRefAnalysis(&program).work();
+	SSAConstructor::constructSSA(&program);
+
+	static const char *passName[] = { "GVN", "LoadCombine", "GVN (2nd)", "DeadCodeElimination", "LoopInvariantOptimizer", "InstructionSelect" };
+	const size_t nPass = sizeof(passName) / sizeof(passName[0]);
+	std::vector<double> best(nPass, 1e30);
+
+	size_t maxIns = 0;
+	for (auto &finfo : program.vFuncs)
+		maxIns = std::max(maxIns, countInstructions(finfo.content));
+
+	for (size_t round = 0; round < rounds; round++)
+	{
+		std::vector<double> cur(nPass, 0);
+		for (auto &finfo : program.vFuncs)
+		{
+			Function func = finfo.content.clone();
+			IRArena::Scope scope(func.arena);
+			FunctionAnalysis analysis(func);
+
+			size_t idx = 0;
+			auto timed = [&cur, &idx](auto &&pass)
+			{
+				auto start = std::chrono::steady_clock::now();
+				pass.work();
+				cur[idx++] += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			};
+			timed(GVN(func, analysis));
+			timed(LoadCombine(func));
+			timed(GVN(func, analysis));
+			timed(DeadCodeElimination(func, analysis));
+			analysis.invalidate();
+			timed(LoopInvariantOptimizer(func, analysis));
+			timed(InstructionSelect(func));
+		}
+		for (size_t i = 0; i < nPass; i++)
+			best[i] = std::min(best[i], cur[i]);
+	}
+
+	std::cout << fileName << ": largest function has " << maxIns << " instructions, best of " << rounds << " rounds" << std::endl;
+	double total = 0;
+	for (size_t i = 0; i < nPass; i++)
+	{
+		std::cout << std::left << std::setw(24) << passName[i] << std::right << std::fixed << std::setprecision(2) << std::setw(10) << best[i] << " ms" << std::endl;
+		total += best[i];
+	}
+	std::cout << std::left << std::setw(24) << "total" << std::right << std::setw(10) << total << " ms" << std::endl;
+	return 0;
+}
@@ -0,0 +1,69 @@
+#!/bin/bash
+# Register allocator benchmark on functions with thousands of virtual registers.
+# Generates programs whose time is spent in one big function, compiles each of them with -O and every
+# optimization, and reports the number of virtual registers and the time of CodeGenerator.RegisterAllocator
+# from the --stats output.
+#
+# usage: regalloc_scaling.bash <mxcompiler> <bench_gen_program> <outdir>
+# environment:
+#   SIZES      values of the blocks knob (default "125 250 500 1000")
+#   LIVE       value of the live knob (default 32)
+#   TIMEOUT    seconds allowed for one compile (default 600)
+#
+# <outdir>/regalloc.tsv has one row per program; rows of different compiler versions can be
+# appended to the same file and compared by the version column.
+set -u
+
+if [ $# -lt 3 ]; then
+	echo "usage: $0 <mxcompiler> <bench_gen_program> <outdir>" >&2
+	exit 1
+fi
+COMPILER=$(readlink -f "$1")
+GEN=$(readlink -f "$2")
+OUT=$3
+SIZES=${SIZES:-"125 250 500 1000"}
+LIVE=${LIVE:-32}
+TIMEOUT=${TIMEOUT:-600}
+FLAGS="--fdisable-access-protect --optim-reg-alloc --optim-inline --optim-gvn --optim-dead-code --optim-loop-invariant"
+
+VERSION=$(git -C "$(dirname "$0")" describe --always --dirty 2>/dev/null || echo unknown)
+
+mkdir -p "$OUT"
+TSV="$OUT/regalloc.tsv"
+[ -f "$TSV" ] || printf "version\tblocks\tlive\tvregs\tspills\tregalloc_ms\ttotal_ms\tpeak_rss_kb\n" > "$TSV"
+
+# value of a counter of a stage in the --stats output
+counter()
+{
+	grep "\"name\": \"$2\"" "$1" | sed -n "s/.*\"$3\": \(-\{0,1\}[0-9.]*\).*/\1/p"
+}
+
+for blocks in $SIZES; do
+	prog="$OUT/blocks-$blocks-live-$LIVE.mx"
+	json="$OUT/blocks-$blocks-live-$LIVE.json"
+	"$GEN" functions=1 calls=0 classes=0 "blocks=$blocks" "live=$LIVE" > "$prog" || exit 1
+	# shellcheck disable=SC2086
+	if ! timeout "$TIMEOUT" "$COMPILER" $FLAGS --stats="$json" "$prog" -o /dev/null; then
+		echo "blocks=$blocks: compile failed or timed out" >&2
+		continue
+	fi
+	printf "%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n" "$VERSION" "$blocks" "$LIVE" \
+		"$(counter "$json" CodeGenerator.RegisterAllocator vregs)" \
+		"$(counter "$json" CodeGenerator.RegisterAllocator spills)" \
+		"$(counter "$json" CodeGenerator.RegisterAllocator wall_ms)" \
+		"$(counter "$json" Total wall_ms)" \
+		"$(sed -n 's/.*"peak_rss_kb": \([0-9]*\).*/\1/p' "$json")" >> "$TSV"
+done
+
+column -t -s $'\t' "$TSV" 2>/dev/null || cat "$TSV"
+
+# growth exponent k of the allocator time ~ vregs^k between the smallest and the largest program
+awk -F'\t' -v version="$VERSION" -v live="$LIVE" '
+	$1 == version && $3 == live && $4 != "" {
+		if (minv == "" || $4 + 0 < minv) { minv = $4 + 0; tmin = $6 + 0 }
+		if (maxv == "" || $4 + 0 > maxv) { maxv = $4 + 0; tmax = $6 + 0 }
+	}
+	END {
+		if (maxv > minv && tmin > 0)
+			printf "\nRegisterAllocator: %d vregs %.2f ms -> %d vregs %.2f ms  k = %.2f\n", minv, tmin, maxv, tmax, log(tmax / tmin) / log(maxv / minv)
+	}' "$TSV"
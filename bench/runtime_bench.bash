@@ -0,0 +1,105 @@
+#!/bin/bash
+# Runtime benchmark of the code generated by mxcompiler.
+# Every bench/runtime/<name>.mx is compiled with the flags of optim.bash, assembled with nasm,
+# linked with gcc, run on <name>.in and checked against <name>.ans.
+#
+# usage: runtime_bench.bash <mxcompiler> <outdir> [baseline.tsv]
+# environment:
+#   REPEAT     runs per program, the fastest one is reported (default 5)
+#   FLAGS      compiler flags (default: the flags of optim.bash)
+#
+# <outdir>/runtime.tsv gets one row per program:
+#   version program status runtime_ms instructions max_rss_kb text_bytes
+# instructions come from `perf stat` and max_rss_kb from /usr/bin/time; they are empty when the tool is missing.
+# Pass an earlier runtime.tsv as the third argument to print the ratio of every number against it;
+# bench/runtime/baseline.tsv is the one `make bench_runtime` compares with.
+set -u
+
+if [ $# -lt 2 ]; then
+	echo "usage: $0 <mxcompiler> <outdir> [baseline.tsv]" >&2
+	exit 1
+fi
+COMPILER=$(readlink -f "$1")
+OUT=$2
+BASELINE=${3:-}
+REPEAT=${REPEAT:-5}
+FLAGS=${FLAGS:-"--fdisable-access-protect --optim-reg-alloc --optim-inline --optim-loop-invariant --optim-dead-code --optim-gvn"}
+CORPUS=$(dirname "$(readlink -f "$0")")/runtime
+
+for tool in nasm gcc; do
+	if ! command -v $tool > /dev/null; then
+		echo "$0: $tool is required" >&2
+		exit 1
+	fi
+done
+HAVE_PERF=0
+perf stat -x, -e instructions:u true > /dev/null 2>&1 && HAVE_PERF=1
+HAVE_TIME=0
+[ -x /usr/bin/time ] && HAVE_TIME=1
+
+VERSION=$(git -C "$CORPUS" describe --always --dirty 2>/dev/null || echo unknown)
+mkdir -p "$OUT"
+TSV="$OUT/runtime.tsv"
+printf "version\tprogram\tstatus\truntime_ms\tinstructions\tmax_rss_kb\ttext_bytes\n" > "$TSV"
+
+for src in "$CORPUS"/*.mx; do
+	name=$(basename "$src" .mx)
+	exe="$OUT/$name"
+	status=ok
+	best= insns= rss= text=
+	# shellcheck disable=SC2086
+	if ! "$COMPILER" $FLAGS "$src" -o "$exe.asm" || ! nasm -felf64 "$exe.asm" -o "$exe.o" || ! gcc -no-pie "$exe.o" -o "$exe"; then
+		status=compile-error
+	else
+		text=$(size -A "$exe.o" | awk '$1 == ".text" { print $2 }')
+		for ((i = 0; i < REPEAT; i++)); do
+			start=$(date +%s%N)
+			"$exe" < "$CORPUS/$name.in" > "$exe.out"
+			ret=$?
+			end=$(date +%s%N)
+			if [ $ret -ne 0 ]; then
+				status=runtime-error
+				break
+			fi
+			if ! cmp -s "$exe.out" "$CORPUS/$name.ans"; then
+				status=wrong-answer
+				break
+			fi
+			ms=$(( (end - start) / 1000000 ))
+			if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then
+				best=$ms
+			fi
+		done
+		if [ $status = ok ] && [ $HAVE_PERF = 1 ]; then
+			insns=$(perf stat -x, -e instructions:u "$exe" < "$CORPUS/$name.in" 2>&1 > /dev/null | awk -F, '/instructions/ { print $1 }')
+		fi
+		if [ $status = ok ] && [ $HAVE_TIME = 1 ]; then
+			rss=$( { /usr/bin/time -f %M "$exe" < "$CORPUS/$name.in" > /dev/null; } 2>&1 | tail -n 1)
+		fi
+	fi
+	printf "%s\t%s\t%s\t%s\t%s\t%s\t%s\n" "$VERSION" "$name" "$status" "$best" "$insns" "$rss" "$text" >> "$TSV"
+done
+
+column -t -s $'\t' "$TSV" 2>/dev/null || cat "$TSV"
+
+if [ -n "$BASELINE" ] && [ ! -r "$BASELINE" ]; then
+	echo "$0: no baseline at $BASELINE" >&2
+elif [ -n "$BASELINE" ]; then
+	echo
+	echo "Ratio against $BASELINE (below 1 is better):"
+	awk -F'\t' '
+		FNR == 1 { next }
+		NR == FNR { for (i = 4; i <= 7; i++) base[$2, i] = $i; next }
+		{
+			line = sprintf("%-12s %-14s", $2, $3)
+			for (i = 4; i <= 7; i++) {
+				if ($i != "" && base[$2, i] != "" && base[$2, i] + 0 > 0)
+					line = line sprintf("  %8.3f", $i / base[$2, i])
+				else
+					line = line sprintf("  %8s", "-")
+			}
+			print line
+		}' "$BASELINE" "$TSV" | (echo "program      status          runtime     insns    maxrss      text"; cat)
+fi
+
+! grep -q -P '\t(compile-error|runtime-error|wrong-answer)\t' "$TSV"
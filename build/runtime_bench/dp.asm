@@ -0,0 +1,1471 @@
+extern strcmp, malloc, free, scanf, puts, printf, putchar, getchar, snprintf, strlen, memcpy, sscanf, fputs, stderr, exit, memset, mmap
+global main
+	section .text
+__runtime_error:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 16
+.L0:
+	mov qword [rbp-16], r12
+	mov qword [rbp-8], r15
+	mov r15, qword [stderr]
+	mov r10, _C_1
+	mov rsi, r15
+	mov r12, rdi
+	mov rdi, r10
+	call fputs
+	mov rsi, r15
+	mov rdi, r12
+	call fputs
+	mov rdi, _C_5
+	mov rsi, r15
+	call fputs
+	mov edi, -1
+	call exit
+	mov r12, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+__release_array_internal:
+.L0:
+	cmp rdi, 0
+	je .L4
+.L1:
+	mov rax, qword [rdi-16]
+	sub rax, 1
+	mov qword [rdi-16], rax
+	cmp rax, 0
+	jne .L4
+.L2:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 128
+	cmp esi, 1
+	jg .L5
+.L3:
+	sub rdi, 16
+	call __dealloc
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+.L4:
+	xor rax, rax
+	ret
+.L5:
+	sub esi, 1
+	mov r8, qword [rdi]
+	sal r8, 3
+	add r8, 8
+	add r8, rdi
+	mov rcx, rdi
+	add rcx, 8
+	mov r9d, esi
+	sub r9d, 1
+	mov eax, r9d
+	sub eax, 1
+	mov r10d, eax
+	sub r10d, 1
+	mov qword [rbp-104], rdi
+	mov qword [rbp-96], rbx
+	mov qword [rbp-88], r12
+	mov qword [rbp-80], r13
+	mov qword [rbp-72], r14
+	mov qword [rbp-64], r15
+.L6:
+	cmp rcx, r8
+	je .L12
+.L7:
+	mov rdi, qword [rcx]
+	cmp rdi, 0
+	je .L13
+.L8:
+	mov rdx, qword [rdi-16]
+	sub rdx, 1
+	mov qword [rdi-16], rdx
+	cmp rdx, 0
+	jne .L13
+.L9:
+	cmp esi, 1
+	jg .L14
+.L10:
+	mov dword [rbp-8], r10d
+	sub rdi, 16
+	mov rbx, rcx
+	mov r12, rsi
+	mov r13, r9
+	mov r14, rax
+	mov r15, r8
+	call __dealloc
+	mov r10d, dword [rbp-8]
+	mov rax, r14
+	mov rsi, r12
+	mov r8, r15
+	mov r9, r13
+.L11:
+	mov rcx, rbx
+	add rcx, 8
+	jmp .L6
+.L12:
+	mov rdi, qword [rbp-104]
+	mov rbx, qword [rbp-96]
+	mov r12, qword [rbp-88]
+	mov r13, qword [rbp-80]
+	mov r14, qword [rbp-72]
+	mov r15, qword [rbp-64]
+	jmp .L3
+.L13:
+	mov rbx, rcx
+	jmp .L11
+.L14:
+	mov r12, qword [rdi]
+	sal r12, 3
+	add r12, 8
+	add r12, rdi
+	mov r15, rdi
+	add r15, 8
+	mov dword [rbp-116], esi
+	mov qword [rbp-56], r8
+	mov qword [rbp-48], rcx
+	mov qword [rbp-40], rdi
+.L15:
+	cmp r15, r12
+	je .L21
+.L16:
+	mov rdi, qword [r15]
+	cmp rdi, 0
+	je .L20
+.L17:
+	mov rbx, qword [rdi-16]
+	sub rbx, 1
+	mov qword [rdi-16], rbx
+	cmp rbx, 0
+	jne .L20
+.L18:
+	cmp r9d, 1
+	jg .L22
+.L19:
+	sub rdi, 16
+	mov rbx, r9
+	mov r13, rax
+	mov r14, r10
+	call __dealloc
+	mov rax, r13
+	mov r9, rbx
+	mov r10, r14
+.L20:
+	add r15, 8
+	jmp .L15
+.L21:
+	mov esi, dword [rbp-116]
+	mov r8, qword [rbp-56]
+	mov rcx, qword [rbp-48]
+	mov rdi, qword [rbp-40]
+	jmp .L10
+.L22:
+	mov r14, qword [rdi]
+	sal r14, 3
+	add r14, 8
+	add r14, rdi
+	mov r13, rdi
+	add r13, 8
+	mov dword [rbp-112], r9d
+	mov qword [rbp-32], r12
+	mov qword [rbp-24], r15
+	mov qword [rbp-16], rdi
+.L23:
+	cmp r13, r14
+	je .L29
+.L24:
+	mov rbx, qword [r13]
+	cmp rbx, 0
+	je .L28
+.L25:
+	mov rcx, qword [rbx-16]
+	sub rcx, 1
+	mov qword [rbx-16], rcx
+	cmp rcx, 0
+	jne .L28
+.L26:
+	cmp eax, 1
+	jg .L30
+.L27:
+	sub rbx, 16
+	mov rdi, rbx
+	mov r12, rax
+	mov rbx, r10
+	call __dealloc
+	mov rax, r12
+	mov r10, rbx
+.L28:
+	add r13, 8
+	jmp .L23
+.L29:
+	mov r9d, dword [rbp-112]
+	mov r12, qword [rbp-32]
+	mov r15, qword [rbp-24]
+	mov rdi, qword [rbp-16]
+	jmp .L19
+.L30:
+	mov r12, qword [rbx]
+	sal r12, 3
+	add r12, 8
+	add r12, rbx
+	mov r15, rbx
+	add r15, 8
+	mov dword [rbp-108], eax
+	mov qword [rbp-8], r14
+.L31:
+	cmp r15, r12
+	je .L33
+.L32:
+	mov rdi, qword [r15]
+	mov esi, r10d
+	mov r14, r10
+	call __release_array_internal
+	add r15, 8
+	mov r10, r14
+	jmp .L31
+.L33:
+	mov eax, dword [rbp-108]
+	mov r14, qword [rbp-8]
+	jmp .L27
+
+__alloc:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 32
+.L0:
+	mov r10, qword [_GV___heap]
+	cmp r10, 0
+	je .L7
+.L1:
+	mov r11, r12
+	mov r12, rdi
+.L2:
+	mov r8, r12
+	add r8, 23
+	shr r8, 4
+	cmp r8, 32
+	ja .L11
+.L3:
+	mov rdi, r8
+	sal rdi, 3
+	add rdi, r10
+	mov rax, qword [rdi+8]
+	cmp rax, 0
+	jne .L13
+.L4:
+	mov r12, r8
+	sal r12, 4
+	mov qword [rbp-32], r11
+	mov qword [rbp-24], r13
+	mov qword [rbp-16], r14
+	mov qword [rbp-8], r15
+	mov r13, r10
+.L5:
+	mov rax, qword [r13]
+	mov rcx, rax
+	add rcx, r12
+	mov rdi, qword [r13+8]
+	cmp rcx, rdi
+	ja .L14
+.L6:
+	mov qword [r13], rcx
+	mov qword [rax], r8
+	add rax, 8
+	mov r12, qword [rbp-32]
+	mov r13, qword [rbp-24]
+	mov r14, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L7:
+	mov qword [rbp-32], r12
+	mov r10, 0
+	mov rsi, 1048576
+	mov edx, 3
+	mov ecx, 34
+	mov r8d, -1
+	mov r9, 0
+	mov r12, rdi
+	mov rdi, r10
+	call mmap
+	cmp rax, -1
+	je .L9
+.L8:
+	mov qword [_GV___heap], rax
+	mov r10, rax
+	mov rdi, rax
+	add rdi, 272
+	mov qword [rax], rdi
+	mov rsi, rax
+	add rsi, 1048576
+	mov qword [rax+8], rsi
+	mov r11, qword [rbp-32]
+	jmp .L2
+.L9:
+	mov r12, qword [rbp-32]
+.L10:
+	mov rdi, _C_4
+	call __runtime_error
+	mov rax, 0
+	mov rsp, rbp
+	pop rbp
+	ret
+.L11:
+	add r12, 8
+	mov rdi, r12
+	mov r12, r11
+	call malloc
+	cmp rax, 0
+	je .L10
+.L12:
+	mov qword [rax], 0
+	add rax, 8
+	mov rsp, rbp
+	pop rbp
+	ret
+.L13:
+	mov r10, qword [rax]
+	mov qword [rdi+8], r10
+	mov r12, r11
+	mov rsp, rbp
+	pop rbp
+	ret
+.L14:
+	mov rdi, 0
+	mov rsi, 1048576
+	mov edx, 3
+	mov ecx, 34
+	mov r15d, -1
+	mov r9, 0
+	mov r14, r8
+	mov r8, r15
+	call mmap
+	cmp rax, -1
+	je .L16
+.L15:
+	mov qword [r13], rax
+	add rax, 1048576
+	mov qword [r13+8], rax
+	mov r8, r14
+	jmp .L5
+.L16:
+	mov r12, qword [rbp-32]
+	mov r13, qword [rbp-24]
+	mov r14, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	jmp .L10
+
+__dealloc:
+.L0:
+	mov rax, rdi
+	sub rax, 8
+	mov r10, qword [rax]
+	cmp r10, 0
+	je .L2
+.L1:
+	mov rax, qword [_GV___heap]
+	sal r10, 3
+	add r10, rax
+	mov r11, qword [r10+8]
+	mov qword [rdi], r11
+	mov qword [r10+8], rdi
+	xor rax, rax
+	ret
+.L2:
+	push rbp
+	mov rbp, rsp
+	mov rdi, rax
+	call free
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+_G_lcs_i1i1i:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 64
+.L0:
+	mov qword [rbp-64], rsi
+	mov qword [rbp-56], r15
+	mov qword [rbp-48], r12
+	mov qword [rbp-40], r14
+	mov qword [rbp-32], r13
+	mov qword [rbp-24], rbx
+	mov eax, edx
+	add eax, 1
+	movsx r12, eax
+	mov r15, r12
+	imul r15, 4
+	add r15, 8
+	mov r14, r15
+	add r14, 16
+	mov rcx, r14
+	mov rbx, rdi
+	mov r13, rdx
+	mov rdi, rcx
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L13
+.L1:
+	mov qword [rbp-16], rbx
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r15
+	mov rbx, rax
+	call memset
+	mov rax, qword [rbp-16]
+	mov r10, rbx
+	mov rbx, rax
+.L2:
+	mov qword [r10], r12
+	cmp r10, 0
+	je .L5
+.L3:
+	mov r11, qword [r10-16]
+	cmp r11, -1
+	je .L5
+.L4:
+	add r11, 1
+	mov qword [r10-16], r11
+.L5:
+	mov qword [rbp-16], rbx
+	mov rdi, r10
+	mov esi, 1
+	mov rbx, r10
+	call __release_array_internal
+	mov rdi, r14
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L14
+.L6:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r15
+	mov r15, rax
+	call memset
+.L7:
+	mov qword [r15], r12
+	cmp r15, 0
+	je .L10
+.L8:
+	mov r11, qword [r15-16]
+	cmp r11, -1
+	je .L10
+.L9:
+	add r11, 1
+	mov qword [r15-16], r11
+.L10:
+	mov rdi, r15
+	mov esi, 1
+	call __release_array_internal
+	mov r12, rbx
+	add r12, 8
+	mov eax, 0
+	mov rdi, qword [rbp-16]
+	mov r14, qword [rbp-64]
+	mov r10, qword [rbp-24]
+	mov rsi, qword [rbp-48]
+	mov rdx, qword [rbp-32]
+	mov rcx, qword [rbp-40]
+	mov r8, qword [rbp-56]
+.L11:
+	cmp eax, r13d
+	jg .L15
+.L12:
+	movsx r10, eax
+	imul r10, 4
+	add r10, r12
+	mov dword [r10], 0
+	add eax, 1
+	jmp .L11
+.L13:
+	mov r10, 0
+	jmp .L2
+.L14:
+	mov r15, 0
+	jmp .L7
+.L15:
+	add rdi, 8
+	add r14, 8
+	mov r10d, 1
+.L16:
+	cmp r10d, r13d
+	jg .L22
+.L17:
+	mov rsi, r15
+	add rsi, 8
+	mov dword [rsi], 0
+	mov rdx, rbx
+	add rdx, 8
+	mov ecx, r10d
+	sub ecx, 1
+	mov r8, rbx
+	add r8, 8
+	movsx r9, ecx
+	imul r9, 4
+	add r9, rdi
+	mov r11d, 1
+	mov qword [rbp-16], rdi
+	mov dword [rbp-8], r10d
+.L18:
+	cmp r11d, r13d
+	jg .L23
+.L19:
+	mov r12d, dword [r9]
+	mov eax, r11d
+	sub eax, 1
+	movsx r10, eax
+	imul r10, 4
+	mov rdi, r14
+	add rdi, r10
+	mov ecx, dword [rdi]
+	cmp r12d, ecx
+	jne .L33
+.L20:
+	add r10, rdx
+	mov edi, dword [r10]
+	add edi, 1
+	movsx rcx, r11d
+	imul rcx, 4
+	add rcx, rsi
+	mov dword [rcx], edi
+.L21:
+	add r11d, 1
+	jmp .L18
+.L22:
+	mov rdi, rbx
+	add rdi, 8
+	movsx rsi, r13d
+	imul rsi, 4
+	add rdi, rsi
+	mov r12d, dword [rdi]
+	mov esi, 1
+	mov rdi, rbx
+	call __release_array_internal
+	mov esi, 1
+	mov rdi, r15
+	call __release_array_internal
+	mov rdi, qword [rbp-8]
+	mov esi, 1
+	call __release_array_internal
+	mov rax, r12
+	mov rbx, qword [rbp-24]
+	mov r12, qword [rbp-48]
+	mov r13, qword [rbp-32]
+	mov r14, qword [rbp-40]
+	mov r15, qword [rbp-56]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L23:
+	cmp rbx, 0
+	setne r12b
+	test r12b, r12b
+	jz .L26
+.L24:
+	mov rax, qword [rbx-16]
+	cmp rax, -1
+	je .L26
+.L25:
+	add rax, 1
+	mov qword [rbx-16], rax
+.L26:
+	mov rdi, rbx
+	mov esi, 1
+	call __release_array_internal
+	mov rax, r15
+	cmp r15, 0
+	je .L29
+.L27:
+	mov r10, qword [r15-16]
+	cmp r10, -1
+	je .L29
+.L28:
+	add r10, 1
+	mov qword [r15-16], r10
+.L29:
+	mov esi, 1
+	mov rdi, r15
+	mov r15, r12
+	mov r12, rbx
+	mov rbx, rax
+	call __release_array_internal
+	test r15b, r15b
+	jz .L32
+.L30:
+	mov rax, qword [r12-16]
+	cmp rax, -1
+	je .L32
+.L31:
+	add rax, 1
+	mov qword [r12-16], rax
+.L32:
+	mov r10d, dword [rbp-8]
+	add r10d, 1
+	mov r15, r12
+	mov qword [rbp-8], r12
+	mov rdi, qword [rbp-16]
+	jmp .L16
+.L33:
+	movsx r12, r11d
+	imul r12, 4
+	mov rax, r8
+	add rax, r12
+	mov edi, dword [rax]
+	add r10, rsi
+	mov ecx, dword [r10]
+	cmp edi, ecx
+	jle .L35
+.L34:
+	mov eax, dword [rax]
+	add r12, rsi
+	mov dword [r12], eax
+	jmp .L21
+.L35:
+	mov eax, dword [r10]
+	add r12, rsi
+	mov dword [r12], eax
+	jmp .L21
+
+_G_gridPaths_i:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 80
+.L0:
+	mov qword [rbp-72], r14
+	mov qword [rbp-64], r12
+	mov qword [rbp-56], r15
+	movsx r12, edi
+	mov r14, r12
+	imul r14, 8
+	add r14, 8
+	mov r11, r14
+	add r11, 16
+	mov r15, rdi
+	mov rdi, r11
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L13
+.L1:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r14
+	mov r14, rax
+	call memset
+.L2:
+	mov qword [r14], r12
+	cmp r14, 0
+	je .L5
+.L3:
+	mov r11, qword [r14-16]
+	cmp r11, -1
+	je .L5
+.L4:
+	add r11, 1
+	mov qword [r14-16], r11
+.L5:
+	mov rdi, r14
+	mov esi, 2
+	call __release_array_internal
+	mov rax, r12
+	imul rax, 4
+	mov r11, r14
+	add r11, 8
+	add rax, 8
+	mov rsi, rax
+	add rsi, 16
+	mov r10d, 0
+	mov qword [rbp-48], rbx
+	mov qword [rbp-40], r13
+	mov qword [rbp-32], r14
+	mov rbx, rax
+.L6:
+	cmp r10d, r15d
+	jge .L14
+.L7:
+	mov rdi, rsi
+	mov qword [rbp-24], rsi
+	mov r13, r10
+	mov r14, r11
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L23
+.L8:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, rbx
+	mov qword [rbp-8], rbx
+	mov rbx, rax
+	call memset
+	mov rax, qword [rbp-8]
+	mov r10, rbx
+	mov rbx, rax
+.L9:
+	mov qword [r10], r12
+	mov qword [rbp-16], r12
+	movsx r12, r13d
+	imul r12, 8
+	add r12, r14
+	mov qword [rbp-8], r14
+	mov rdi, qword [r12]
+	mov esi, 1
+	mov r14, r10
+	call __release_array_internal
+	mov qword [r12], r14
+	cmp r14, 0
+	je .L12
+.L10:
+	mov rax, qword [r14-16]
+	cmp rax, -1
+	je .L12
+.L11:
+	add rax, 1
+	mov qword [r14-16], rax
+.L12:
+	mov esi, 1
+	mov rdi, r14
+	call __release_array_internal
+	mov r10d, r13d
+	add r10d, 1
+	mov r12, qword [rbp-16]
+	mov r11, qword [rbp-8]
+	mov rsi, qword [rbp-24]
+	jmp .L6
+.L13:
+	mov r14, 0
+	jmp .L2
+.L14:
+	mov rdi, qword [rbp-32]
+	mov rcx, rdi
+	add rcx, 8
+	mov rsi, rdi
+	add rsi, 8
+	mov r8d, 0
+.L15:
+	cmp r8d, r15d
+	jge .L24
+.L16:
+	movsx rbx, r8d
+	mov r9d, r8d
+	sub r9d, 1
+	movsx r12, r8d
+	imul rbx, 8
+	movsx r9, r9d
+	imul r12, 8
+	add rbx, rcx
+	imul r9, 8
+	add r12, rsi
+	add r9, rsi
+	mov r13d, 0
+.L17:
+	cmp r13d, r15d
+	jge .L25
+.L18:
+	cmp r8d, 0
+	jne .L26
+.L19:
+	mov dl, 1
+.L20:
+	test dl, dl
+	jz .L27
+.L21:
+	mov r14, qword [rbx]
+	add r14, 8
+	movsx rax, r13d
+	imul rax, 4
+	add r14, rax
+	mov dword [r14], 1
+.L22:
+	add r13d, 1
+	jmp .L17
+.L23:
+	mov r10, 0
+	jmp .L9
+.L24:
+	sub r15d, 1
+	mov r13, rdi
+	add r13, 8
+	movsx r14, r15d
+	mov r15, r14
+	imul r15, 8
+	add r13, r15
+	mov r15, qword [r13]
+	add r15, 8
+	imul r14, 4
+	add r15, r14
+	mov ebx, dword [r15]
+	mov esi, 2
+	call __release_array_internal
+	mov rax, rbx
+	mov rbx, qword [rbp-48]
+	mov r12, qword [rbp-64]
+	mov r13, qword [rbp-40]
+	mov r14, qword [rbp-72]
+	mov r15, qword [rbp-56]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L25:
+	add r8d, 1
+	jmp .L15
+.L26:
+	cmp r13d, 0
+	sete dl
+	jmp .L20
+.L27:
+	mov rax, qword [r9]
+	add rax, 8
+	movsx r10, r13d
+	imul r10, 4
+	add rax, r10
+	mov r11d, dword [rax]
+	mov rdx, qword [r12]
+	mov r14d, r13d
+	sub r14d, 1
+	add rdx, 8
+	movsx r14, r14d
+	imul r14, 4
+	add rdx, r14
+	mov r14d, dword [rdx]
+	add r11d, r14d
+	mov eax, dword [_GV_seed]
+	imul eax, 1103
+	add eax, 12345
+	mov r14d, 65536
+	cdq
+	idiv r14d
+	mov dword [_GV_seed], edx
+	mov eax, dword [_GV_seed]
+	mov r14d, 3
+	cdq
+	idiv r14d
+	add r11d, edx
+	mov r14d, 1000003
+	mov rax, r11
+	cdq
+	idiv r14d
+	mov r14, qword [r12]
+	add r14, 8
+	add r14, r10
+	mov dword [r14], edx
+	jmp .L22
+
+main:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 112
+.L0:
+	mov qword [rbp-96], r14
+	mov qword [rbp-88], r12
+	mov qword [rbp-80], r15
+	mov qword [rbp-72], rbx
+	mov qword [rbp-64], r13
+	lea rbx, [rbp-4]
+	lea r15, [rbp-8]
+	lea r14, [rbp-12]
+	lea r12, [rbp-16]
+	lea r13, [rbp-20]
+	mov rdi, _C_0
+	mov rsi, r13
+	call scanf
+	mov r13d, dword [r13]
+	mov rdi, _C_0
+	mov rsi, r12
+	call scanf
+	mov r12d, dword [r12]
+	mov rdi, _C_0
+	mov rsi, r14
+	call scanf
+	mov r14d, dword [r14]
+	mov rdi, _C_0
+	mov rsi, r15
+	call scanf
+	mov r15d, dword [r15]
+	mov rdi, _C_0
+	mov rsi, rbx
+	mov dword [rbp-104], r14d
+	mov dword [rbp-100], r15d
+	call scanf
+	mov eax, dword [rbx]
+	mov dword [_GV_seed], eax
+	movsx r14, r13d
+	mov rbx, r14
+	imul rbx, 4
+	add rbx, 8
+	mov r15, rbx
+	add r15, 16
+	mov rdi, r15
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L13
+.L1:
+	mov dword [rbp-40], r12d
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, rbx
+	mov r12, rax
+	call memset
+	mov eax, dword [rbp-40]
+	mov r10, r12
+	mov r12, rax
+.L2:
+	mov qword [r10], r14
+	cmp r10, 0
+	je .L5
+.L3:
+	mov r11, qword [r10-16]
+	cmp r11, -1
+	je .L5
+.L4:
+	add r11, 1
+	mov qword [r10-16], r11
+.L5:
+	mov dword [rbp-40], r12d
+	mov rdi, r10
+	mov esi, 1
+	mov r12, r10
+	call __release_array_internal
+	mov rdi, r15
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L14
+.L6:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, rbx
+	mov r15, rax
+	call memset
+.L7:
+	mov qword [r15], r14
+	cmp r15, 0
+	je .L10
+.L8:
+	mov r11, qword [r15-16]
+	cmp r11, -1
+	je .L10
+.L9:
+	add r11, 1
+	mov qword [r15-16], r11
+.L10:
+	mov rdi, r15
+	mov esi, 1
+	call __release_array_internal
+	mov r10, r12
+	add r10, 8
+	mov r14d, 0
+	mov rsi, qword [rbp-72]
+	mov r11, qword [rbp-88]
+	mov rdi, qword [rbp-64]
+	mov ebx, dword [rbp-40]
+	mov r9d, dword [rbp-104]
+	mov r8d, dword [rbp-100]
+.L11:
+	cmp r14d, r13d
+	jge .L15
+.L12:
+	mov eax, dword [_GV_seed]
+	imul eax, 1103
+	add eax, 12345
+	mov ecx, 65536
+	cdq
+	idiv ecx
+	mov dword [_GV_seed], edx
+	mov eax, dword [_GV_seed]
+	mov ecx, 4096
+	cdq
+	idiv ecx
+	movsx rdx, r14d
+	imul rdx, 4
+	add rdx, r10
+	mov dword [rdx], eax
+	add r14d, 1
+	jmp .L11
+.L13:
+	mov r10, 0
+	jmp .L2
+.L14:
+	mov r15, 0
+	jmp .L7
+.L15:
+	mov r10, r15
+	add r10, 8
+	mov ecx, 0
+.L16:
+	cmp ecx, r13d
+	jge .L18
+.L17:
+	mov eax, dword [_GV_seed]
+	imul eax, 1103
+	add eax, 12345
+	mov r14d, 65536
+	cdq
+	idiv r14d
+	mov dword [_GV_seed], edx
+	mov eax, dword [_GV_seed]
+	mov r14d, 4096
+	cdq
+	idiv r14d
+	movsx rdx, ecx
+	imul rdx, 4
+	add rdx, r10
+	mov dword [rdx], eax
+	add ecx, 1
+	jmp .L16
+.L18:
+	mov qword [rbp-56], r15
+	mov dword [rbp-32], r13d
+	movsx r13, ebx
+	mov r14, r13
+	imul r14, 4
+	add r14, 8
+	mov r15, r14
+	add r15, 16
+	mov rdi, r15
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L31
+.L19:
+	mov qword [rbp-48], r12
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r14
+	mov r12, rax
+	call memset
+	mov rax, qword [rbp-48]
+	mov r10, r12
+	mov r12, rax
+.L20:
+	mov qword [r10], r13
+	cmp r10, 0
+	je .L23
+.L21:
+	mov r11, qword [r10-16]
+	cmp r11, -1
+	je .L23
+.L22:
+	add r11, 1
+	mov qword [r10-16], r11
+.L23:
+	mov qword [rbp-48], r12
+	mov rdi, r10
+	mov esi, 1
+	mov r12, r10
+	call __release_array_internal
+	mov rdi, r15
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L32
+.L24:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r14
+	mov r14, rax
+	call memset
+.L25:
+	mov qword [r14], r13
+	cmp r14, 0
+	je .L28
+.L26:
+	mov r11, qword [r14-16]
+	cmp r11, -1
+	je .L28
+.L27:
+	add r11, 1
+	mov qword [r14-16], r11
+.L28:
+	mov rdi, r14
+	mov esi, 1
+	call __release_array_internal
+	mov r11, r12
+	add r11, 8
+	mov rdi, r14
+	add rdi, 8
+	mov ecx, 0
+	mov r10d, dword [rbp-32]
+	mov r15d, dword [rbp-104]
+	mov r13, qword [rbp-48]
+	mov rsi, qword [rbp-56]
+.L29:
+	cmp ecx, ebx
+	jge .L33
+.L30:
+	mov eax, dword [_GV_seed]
+	imul eax, 1103
+	add eax, 12345
+	mov r8d, 65536
+	cdq
+	idiv r8d
+	mov dword [_GV_seed], edx
+	mov eax, dword [_GV_seed]
+	mov r9d, 100
+	cdq
+	idiv r9d
+	add edx, 1
+	movsx r9, ecx
+	imul r9, 4
+	mov r8, r11
+	add r8, r9
+	mov dword [r8], edx
+	mov eax, dword [_GV_seed]
+	imul eax, 1103
+	add eax, 12345
+	mov r8d, 65536
+	cdq
+	idiv r8d
+	mov dword [_GV_seed], edx
+	mov eax, dword [_GV_seed]
+	mov r8d, 1000
+	cdq
+	idiv r8d
+	add r9, rdi
+	mov dword [r9], edx
+	add ecx, 1
+	jmp .L29
+.L31:
+	mov r10, 0
+	jmp .L20
+.L32:
+	mov r14, 0
+	jmp .L25
+.L33:
+	mov rdi, r13
+	mov rdx, r10
+	call _G_lcs_i1i1i
+	mov rdi, 36
+	mov r13, rax
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov rbx, rax
+	add rbx, 8
+	mov rdi, rbx
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r13
+	mov r13, rax
+	call snprintf
+	mov rdi, rbx
+	call strlen
+	mov qword [r13], rax
+	cmp r13, 0
+	je .L47
+.L34:
+	mov rdi, rbx
+	call puts
+.L35:
+	cmp r13, 0
+	je .L39
+.L36:
+	sub r13, 16
+	mov rbx, qword [r13]
+	cmp rbx, -1
+	je .L39
+.L37:
+	sub rbx, 1
+	mov qword [r13], rbx
+	cmp rbx, 0
+	jne .L39
+.L38:
+	mov rdi, r13
+	call __dealloc
+.L39:
+	mov eax, r15d
+	add eax, 1
+	movsx rbx, eax
+	mov r13, rbx
+	imul r13, 4
+	add r13, 8
+	mov rdi, r13
+	add rdi, 16
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L48
+.L40:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r13
+	mov r13, rax
+	call memset
+.L41:
+	mov qword [r13], rbx
+	cmp r13, 0
+	je .L44
+.L42:
+	mov r11, qword [r13-16]
+	cmp r11, -1
+	je .L44
+.L43:
+	add r11, 1
+	mov qword [r13-16], r11
+.L44:
+	mov rdi, r13
+	mov esi, 1
+	call __release_array_internal
+	mov rdx, r13
+	add rdx, 8
+	mov r10d, 0
+	mov rax, qword [rbp-72]
+	mov r11, qword [rbp-88]
+	mov rdi, qword [rbp-64]
+	mov esi, dword [rbp-40]
+	mov ebx, dword [rbp-100]
+	mov rcx, qword [rbp-48]
+	mov r8, qword [rbp-56]
+.L45:
+	cmp r10d, r15d
+	jg .L49
+.L46:
+	movsx rax, r10d
+	imul rax, 4
+	add rax, rdx
+	mov dword [rax], 0
+	add r10d, 1
+	jmp .L45
+.L47:
+	mov edi, 10
+	call putchar
+	jmp .L35
+.L48:
+	mov r13, 0
+	jmp .L41
+.L49:
+	mov rcx, r12
+	add rcx, 8
+	mov r11, r13
+	add r11, 8
+	mov rdi, r14
+	add rdi, 8
+	mov r10d, 0
+	mov qword [rbp-40], r12
+	mov qword [rbp-32], r14
+.L50:
+	cmp r10d, esi
+	jge .L56
+.L51:
+	movsx r8, r10d
+	imul r8, 4
+	mov r9, rcx
+	add r9, r8
+	add r8, rdi
+	mov r12d, r15d
+.L52:
+	mov r14d, dword [r9]
+	cmp r12d, r14d
+	jl .L70
+.L53:
+	mov edx, dword [r9]
+	mov eax, r12d
+	sub eax, edx
+	movsx r14, eax
+	imul r14, 4
+	add r14, r11
+	mov edx, dword [r14]
+	mov eax, dword [r8]
+	add edx, eax
+	movsx rax, r12d
+	imul rax, 4
+	add rax, r11
+	mov r14d, dword [rax]
+	cmp edx, r14d
+	jle .L55
+.L54:
+	mov edx, dword [r9]
+	mov r14d, r12d
+	sub r14d, edx
+	movsx rdx, r14d
+	imul rdx, 4
+	add rdx, r11
+	mov r14d, dword [rdx]
+	mov edx, dword [r8]
+	add r14d, edx
+	mov dword [rax], r14d
+.L55:
+	sub r12d, 1
+	jmp .L52
+.L56:
+	mov r8, r13
+	add r8, 8
+	movsx r9, r15d
+	imul r9, 4
+	add r8, r9
+	mov r12d, dword [r8]
+	mov esi, 1
+	mov rdi, r13
+	call __release_array_internal
+	mov rdi, 36
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r13, rax
+	add r13, 8
+	mov rdi, r13
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r12
+	mov r12, rax
+	call snprintf
+	mov rdi, r13
+	call strlen
+	mov qword [r12], rax
+	cmp r12, 0
+	je .L69
+.L57:
+	mov rdi, r13
+	call puts
+.L58:
+	cmp r12, 0
+	je .L62
+.L59:
+	sub r12, 16
+	mov r13, qword [r12]
+	cmp r13, -1
+	je .L62
+.L60:
+	sub r13, 1
+	mov qword [r12], r13
+	cmp r13, 0
+	jne .L62
+.L61:
+	mov rdi, r12
+	call __dealloc
+.L62:
+	mov rdi, rbx
+	call _G_gridPaths_i
+	mov rdi, 36
+	mov r13, rax
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r12, rax
+	add r12, 8
+	mov rdi, r12
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r13
+	mov rbx, rax
+	call snprintf
+	mov rdi, r12
+	call strlen
+	mov qword [rbx], rax
+	cmp rbx, 0
+	je .L71
+.L63:
+	mov rdi, r12
+	call puts
+.L64:
+	cmp rbx, 0
+	je .L68
+.L65:
+	sub rbx, 16
+	mov r12, qword [rbx]
+	cmp r12, -1
+	je .L68
+.L66:
+	sub r12, 1
+	mov qword [rbx], r12
+	cmp r12, 0
+	jne .L68
+.L67:
+	mov rdi, rbx
+	call __dealloc
+.L68:
+	mov rdi, qword [rbp-48]
+	mov esi, 1
+	call __release_array_internal
+	mov rdi, qword [rbp-56]
+	mov esi, 1
+	call __release_array_internal
+	mov rdi, qword [rbp-40]
+	mov esi, 1
+	call __release_array_internal
+	mov rdi, qword [rbp-32]
+	mov esi, 1
+	call __release_array_internal
+	mov eax, 0
+	mov rbx, qword [rbp-72]
+	mov r12, qword [rbp-88]
+	mov r13, qword [rbp-64]
+	mov r14, qword [rbp-96]
+	mov r15, qword [rbp-80]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L69:
+	mov edi, 10
+	call putchar
+	jmp .L58
+.L70:
+	add r10d, 1
+	jmp .L50
+.L71:
+	mov edi, 10
+	call putchar
+	jmp .L64
+
+_C_0:
+	db '%d', 0
+
+_C_1:
+	db 'Runtime Error: ', 0
+
+_C_2:
+	db 'Subscript out of range', 0
+
+_C_3:
+	db 'Null pointer', 0
+
+_C_4:
+	db 'Bad allocation', 0
+
+_C_5:
+	db 10, 0
+
+_C_6:
+	db '%s', 0
+
+	section .bss
+	align 16
+_GV___heap:
+	resb 8
+
+_GV_seed:
+	resb 4
+
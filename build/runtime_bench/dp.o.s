@@ -0,0 +1,1455 @@
+.intel_syntax noprefix
+.globl main
+.section .text
+__runtime_error:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+__runtime_error..L0:
+mov qword ptr [rbp-16], r12
+mov qword ptr [rbp-8], r15
+mov r15, qword ptr [stderr]
+mov r10, offset _C_1
+mov rsi, r15
+mov r12, rdi
+mov rdi, r10
+call fputs
+mov rsi, r15
+mov rdi, r12
+call fputs
+mov rdi, offset _C_5
+mov rsi, r15
+call fputs
+mov edi, -1
+call exit
+mov r12, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+__release_array_internal:
+__release_array_internal..L0:
+cmp rdi, 0
+je __release_array_internal..L4
+__release_array_internal..L1:
+mov rax, qword ptr [rdi-16]
+sub rax, 1
+mov qword ptr [rdi-16], rax
+cmp rax, 0
+jne __release_array_internal..L4
+__release_array_internal..L2:
+push rbp
+mov rbp, rsp
+sub rsp, 128
+cmp esi, 1
+jg __release_array_internal..L5
+__release_array_internal..L3:
+sub rdi, 16
+call __dealloc
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+__release_array_internal..L4:
+xor rax, rax
+ret
+__release_array_internal..L5:
+sub esi, 1
+mov r8, qword ptr [rdi]
+sal r8, 3
+add r8, 8
+add r8, rdi
+mov rcx, rdi
+add rcx, 8
+mov r9d, esi
+sub r9d, 1
+mov eax, r9d
+sub eax, 1
+mov r10d, eax
+sub r10d, 1
+mov qword ptr [rbp-104], rdi
+mov qword ptr [rbp-96], rbx
+mov qword ptr [rbp-88], r12
+mov qword ptr [rbp-80], r13
+mov qword ptr [rbp-72], r14
+mov qword ptr [rbp-64], r15
+__release_array_internal..L6:
+cmp rcx, r8
+je __release_array_internal..L12
+__release_array_internal..L7:
+mov rdi, qword ptr [rcx]
+cmp rdi, 0
+je __release_array_internal..L13
+__release_array_internal..L8:
+mov rdx, qword ptr [rdi-16]
+sub rdx, 1
+mov qword ptr [rdi-16], rdx
+cmp rdx, 0
+jne __release_array_internal..L13
+__release_array_internal..L9:
+cmp esi, 1
+jg __release_array_internal..L14
+__release_array_internal..L10:
+mov dword ptr [rbp-8], r10d
+sub rdi, 16
+mov rbx, rcx
+mov r12, rsi
+mov r13, r9
+mov r14, rax
+mov r15, r8
+call __dealloc
+mov r10d, dword ptr [rbp-8]
+mov rax, r14
+mov rsi, r12
+mov r8, r15
+mov r9, r13
+__release_array_internal..L11:
+mov rcx, rbx
+add rcx, 8
+jmp __release_array_internal..L6
+__release_array_internal..L12:
+mov rdi, qword ptr [rbp-104]
+mov rbx, qword ptr [rbp-96]
+mov r12, qword ptr [rbp-88]
+mov r13, qword ptr [rbp-80]
+mov r14, qword ptr [rbp-72]
+mov r15, qword ptr [rbp-64]
+jmp __release_array_internal..L3
+__release_array_internal..L13:
+mov rbx, rcx
+jmp __release_array_internal..L11
+__release_array_internal..L14:
+mov r12, qword ptr [rdi]
+sal r12, 3
+add r12, 8
+add r12, rdi
+mov r15, rdi
+add r15, 8
+mov dword ptr [rbp-116], esi
+mov qword ptr [rbp-56], r8
+mov qword ptr [rbp-48], rcx
+mov qword ptr [rbp-40], rdi
+__release_array_internal..L15:
+cmp r15, r12
+je __release_array_internal..L21
+__release_array_internal..L16:
+mov rdi, qword ptr [r15]
+cmp rdi, 0
+je __release_array_internal..L20
+__release_array_internal..L17:
+mov rbx, qword ptr [rdi-16]
+sub rbx, 1
+mov qword ptr [rdi-16], rbx
+cmp rbx, 0
+jne __release_array_internal..L20
+__release_array_internal..L18:
+cmp r9d, 1
+jg __release_array_internal..L22
+__release_array_internal..L19:
+sub rdi, 16
+mov rbx, r9
+mov r13, rax
+mov r14, r10
+call __dealloc
+mov rax, r13
+mov r9, rbx
+mov r10, r14
+__release_array_internal..L20:
+add r15, 8
+jmp __release_array_internal..L15
+__release_array_internal..L21:
+mov esi, dword ptr [rbp-116]
+mov r8, qword ptr [rbp-56]
+mov rcx, qword ptr [rbp-48]
+mov rdi, qword ptr [rbp-40]
+jmp __release_array_internal..L10
+__release_array_internal..L22:
+mov r14, qword ptr [rdi]
+sal r14, 3
+add r14, 8
+add r14, rdi
+mov r13, rdi
+add r13, 8
+mov dword ptr [rbp-112], r9d
+mov qword ptr [rbp-32], r12
+mov qword ptr [rbp-24], r15
+mov qword ptr [rbp-16], rdi
+__release_array_internal..L23:
+cmp r13, r14
+je __release_array_internal..L29
+__release_array_internal..L24:
+mov rbx, qword ptr [r13]
+cmp rbx, 0
+je __release_array_internal..L28
+__release_array_internal..L25:
+mov rcx, qword ptr [rbx-16]
+sub rcx, 1
+mov qword ptr [rbx-16], rcx
+cmp rcx, 0
+jne __release_array_internal..L28
+__release_array_internal..L26:
+cmp eax, 1
+jg __release_array_internal..L30
+__release_array_internal..L27:
+sub rbx, 16
+mov rdi, rbx
+mov r12, rax
+mov rbx, r10
+call __dealloc
+mov rax, r12
+mov r10, rbx
+__release_array_internal..L28:
+add r13, 8
+jmp __release_array_internal..L23
+__release_array_internal..L29:
+mov r9d, dword ptr [rbp-112]
+mov r12, qword ptr [rbp-32]
+mov r15, qword ptr [rbp-24]
+mov rdi, qword ptr [rbp-16]
+jmp __release_array_internal..L19
+__release_array_internal..L30:
+mov r12, qword ptr [rbx]
+sal r12, 3
+add r12, 8
+add r12, rbx
+mov r15, rbx
+add r15, 8
+mov dword ptr [rbp-108], eax
+mov qword ptr [rbp-8], r14
+__release_array_internal..L31:
+cmp r15, r12
+je __release_array_internal..L33
+__release_array_internal..L32:
+mov rdi, qword ptr [r15]
+mov esi, r10d
+mov r14, r10
+call __release_array_internal
+add r15, 8
+mov r10, r14
+jmp __release_array_internal..L31
+__release_array_internal..L33:
+mov eax, dword ptr [rbp-108]
+mov r14, qword ptr [rbp-8]
+jmp __release_array_internal..L27
+__alloc:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+__alloc..L0:
+mov r10, qword ptr [_GV___heap]
+cmp r10, 0
+je __alloc..L7
+__alloc..L1:
+mov r11, r12
+mov r12, rdi
+__alloc..L2:
+mov r8, r12
+add r8, 23
+shr r8, 4
+cmp r8, 32
+ja __alloc..L11
+__alloc..L3:
+mov rdi, r8
+sal rdi, 3
+add rdi, r10
+mov rax, qword ptr [rdi+8]
+cmp rax, 0
+jne __alloc..L13
+__alloc..L4:
+mov r12, r8
+sal r12, 4
+mov qword ptr [rbp-32], r11
+mov qword ptr [rbp-24], r13
+mov qword ptr [rbp-16], r14
+mov qword ptr [rbp-8], r15
+mov r13, r10
+__alloc..L5:
+mov rax, qword ptr [r13]
+mov rcx, rax
+add rcx, r12
+mov rdi, qword ptr [r13+8]
+cmp rcx, rdi
+ja __alloc..L14
+__alloc..L6:
+mov qword ptr [r13], rcx
+mov qword ptr [rax], r8
+add rax, 8
+mov r12, qword ptr [rbp-32]
+mov r13, qword ptr [rbp-24]
+mov r14, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L7:
+mov qword ptr [rbp-32], r12
+mov r10, 0
+mov rsi, 1048576
+mov edx, 3
+mov ecx, 34
+mov r8d, -1
+mov r9, 0
+mov r12, rdi
+mov rdi, r10
+call mmap
+cmp rax, -1
+je __alloc..L9
+__alloc..L8:
+mov qword ptr [_GV___heap], rax
+mov r10, rax
+mov rdi, rax
+add rdi, 272
+mov qword ptr [rax], rdi
+mov rsi, rax
+add rsi, 1048576
+mov qword ptr [rax+8], rsi
+mov r11, qword ptr [rbp-32]
+jmp __alloc..L2
+__alloc..L9:
+mov r12, qword ptr [rbp-32]
+__alloc..L10:
+mov rdi, offset _C_4
+call __runtime_error
+mov rax, 0
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L11:
+add r12, 8
+mov rdi, r12
+mov r12, r11
+call malloc
+cmp rax, 0
+je __alloc..L10
+__alloc..L12:
+mov qword ptr [rax], 0
+add rax, 8
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L13:
+mov r10, qword ptr [rax]
+mov qword ptr [rdi+8], r10
+mov r12, r11
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L14:
+mov rdi, 0
+mov rsi, 1048576
+mov edx, 3
+mov ecx, 34
+mov r15d, -1
+mov r9, 0
+mov r14, r8
+mov r8, r15
+call mmap
+cmp rax, -1
+je __alloc..L16
+__alloc..L15:
+mov qword ptr [r13], rax
+add rax, 1048576
+mov qword ptr [r13+8], rax
+mov r8, r14
+jmp __alloc..L5
+__alloc..L16:
+mov r12, qword ptr [rbp-32]
+mov r13, qword ptr [rbp-24]
+mov r14, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+jmp __alloc..L10
+__dealloc:
+__dealloc..L0:
+mov rax, rdi
+sub rax, 8
+mov r10, qword ptr [rax]
+cmp r10, 0
+je __dealloc..L2
+__dealloc..L1:
+mov rax, qword ptr [_GV___heap]
+sal r10, 3
+add r10, rax
+mov r11, qword ptr [r10+8]
+mov qword ptr [rdi], r11
+mov qword ptr [r10+8], rdi
+xor rax, rax
+ret
+__dealloc..L2:
+push rbp
+mov rbp, rsp
+mov rdi, rax
+call free
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+_G_lcs_i1i1i:
+push rbp
+mov rbp, rsp
+sub rsp, 64
+_G_lcs_i1i1i..L0:
+mov qword ptr [rbp-64], rsi
+mov qword ptr [rbp-56], r15
+mov qword ptr [rbp-48], r12
+mov qword ptr [rbp-40], r14
+mov qword ptr [rbp-32], r13
+mov qword ptr [rbp-24], rbx
+mov eax, edx
+add eax, 1
+movsx r12, eax
+mov r15, r12
+imul r15, 4
+add r15, 8
+mov r14, r15
+add r14, 16
+mov rcx, r14
+mov rbx, rdi
+mov r13, rdx
+mov rdi, rcx
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je _G_lcs_i1i1i..L13
+_G_lcs_i1i1i..L1:
+mov qword ptr [rbp-16], rbx
+mov rdi, rax
+mov esi, 0
+mov rdx, r15
+mov rbx, rax
+call memset
+mov rax, qword ptr [rbp-16]
+mov r10, rbx
+mov rbx, rax
+_G_lcs_i1i1i..L2:
+mov qword ptr [r10], r12
+cmp r10, 0
+je _G_lcs_i1i1i..L5
+_G_lcs_i1i1i..L3:
+mov r11, qword ptr [r10-16]
+cmp r11, -1
+je _G_lcs_i1i1i..L5
+_G_lcs_i1i1i..L4:
+add r11, 1
+mov qword ptr [r10-16], r11
+_G_lcs_i1i1i..L5:
+mov qword ptr [rbp-16], rbx
+mov rdi, r10
+mov esi, 1
+mov rbx, r10
+call __release_array_internal
+mov rdi, r14
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je _G_lcs_i1i1i..L14
+_G_lcs_i1i1i..L6:
+mov rdi, rax
+mov esi, 0
+mov rdx, r15
+mov r15, rax
+call memset
+_G_lcs_i1i1i..L7:
+mov qword ptr [r15], r12
+cmp r15, 0
+je _G_lcs_i1i1i..L10
+_G_lcs_i1i1i..L8:
+mov r11, qword ptr [r15-16]
+cmp r11, -1
+je _G_lcs_i1i1i..L10
+_G_lcs_i1i1i..L9:
+add r11, 1
+mov qword ptr [r15-16], r11
+_G_lcs_i1i1i..L10:
+mov rdi, r15
+mov esi, 1
+call __release_array_internal
+mov r12, rbx
+add r12, 8
+mov eax, 0
+mov rdi, qword ptr [rbp-16]
+mov r14, qword ptr [rbp-64]
+mov r10, qword ptr [rbp-24]
+mov rsi, qword ptr [rbp-48]
+mov rdx, qword ptr [rbp-32]
+mov rcx, qword ptr [rbp-40]
+mov r8, qword ptr [rbp-56]
+_G_lcs_i1i1i..L11:
+cmp eax, r13d
+jg _G_lcs_i1i1i..L15
+_G_lcs_i1i1i..L12:
+movsx r10, eax
+imul r10, 4
+add r10, r12
+mov dword ptr [r10], 0
+add eax, 1
+jmp _G_lcs_i1i1i..L11
+_G_lcs_i1i1i..L13:
+mov r10, 0
+jmp _G_lcs_i1i1i..L2
+_G_lcs_i1i1i..L14:
+mov r15, 0
+jmp _G_lcs_i1i1i..L7
+_G_lcs_i1i1i..L15:
+add rdi, 8
+add r14, 8
+mov r10d, 1
+_G_lcs_i1i1i..L16:
+cmp r10d, r13d
+jg _G_lcs_i1i1i..L22
+_G_lcs_i1i1i..L17:
+mov rsi, r15
+add rsi, 8
+mov dword ptr [rsi], 0
+mov rdx, rbx
+add rdx, 8
+mov ecx, r10d
+sub ecx, 1
+mov r8, rbx
+add r8, 8
+movsx r9, ecx
+imul r9, 4
+add r9, rdi
+mov r11d, 1
+mov qword ptr [rbp-16], rdi
+mov dword ptr [rbp-8], r10d
+_G_lcs_i1i1i..L18:
+cmp r11d, r13d
+jg _G_lcs_i1i1i..L23
+_G_lcs_i1i1i..L19:
+mov r12d, dword ptr [r9]
+mov eax, r11d
+sub eax, 1
+movsx r10, eax
+imul r10, 4
+mov rdi, r14
+add rdi, r10
+mov ecx, dword ptr [rdi]
+cmp r12d, ecx
+jne _G_lcs_i1i1i..L33
+_G_lcs_i1i1i..L20:
+add r10, rdx
+mov edi, dword ptr [r10]
+add edi, 1
+movsx rcx, r11d
+imul rcx, 4
+add rcx, rsi
+mov dword ptr [rcx], edi
+_G_lcs_i1i1i..L21:
+add r11d, 1
+jmp _G_lcs_i1i1i..L18
+_G_lcs_i1i1i..L22:
+mov rdi, rbx
+add rdi, 8
+movsx rsi, r13d
+imul rsi, 4
+add rdi, rsi
+mov r12d, dword ptr [rdi]
+mov esi, 1
+mov rdi, rbx
+call __release_array_internal
+mov esi, 1
+mov rdi, r15
+call __release_array_internal
+mov rdi, qword ptr [rbp-8]
+mov esi, 1
+call __release_array_internal
+mov rax, r12
+mov rbx, qword ptr [rbp-24]
+mov r12, qword ptr [rbp-48]
+mov r13, qword ptr [rbp-32]
+mov r14, qword ptr [rbp-40]
+mov r15, qword ptr [rbp-56]
+mov rsp, rbp
+pop rbp
+ret
+_G_lcs_i1i1i..L23:
+cmp rbx, 0
+setne r12b
+test r12b, r12b
+jz _G_lcs_i1i1i..L26
+_G_lcs_i1i1i..L24:
+mov rax, qword ptr [rbx-16]
+cmp rax, -1
+je _G_lcs_i1i1i..L26
+_G_lcs_i1i1i..L25:
+add rax, 1
+mov qword ptr [rbx-16], rax
+_G_lcs_i1i1i..L26:
+mov rdi, rbx
+mov esi, 1
+call __release_array_internal
+mov rax, r15
+cmp r15, 0
+je _G_lcs_i1i1i..L29
+_G_lcs_i1i1i..L27:
+mov r10, qword ptr [r15-16]
+cmp r10, -1
+je _G_lcs_i1i1i..L29
+_G_lcs_i1i1i..L28:
+add r10, 1
+mov qword ptr [r15-16], r10
+_G_lcs_i1i1i..L29:
+mov esi, 1
+mov rdi, r15
+mov r15, r12
+mov r12, rbx
+mov rbx, rax
+call __release_array_internal
+test r15b, r15b
+jz _G_lcs_i1i1i..L32
+_G_lcs_i1i1i..L30:
+mov rax, qword ptr [r12-16]
+cmp rax, -1
+je _G_lcs_i1i1i..L32
+_G_lcs_i1i1i..L31:
+add rax, 1
+mov qword ptr [r12-16], rax
+_G_lcs_i1i1i..L32:
+mov r10d, dword ptr [rbp-8]
+add r10d, 1
+mov r15, r12
+mov qword ptr [rbp-8], r12
+mov rdi, qword ptr [rbp-16]
+jmp _G_lcs_i1i1i..L16
+_G_lcs_i1i1i..L33:
+movsx r12, r11d
+imul r12, 4
+mov rax, r8
+add rax, r12
+mov edi, dword ptr [rax]
+add r10, rsi
+mov ecx, dword ptr [r10]
+cmp edi, ecx
+jle _G_lcs_i1i1i..L35
+_G_lcs_i1i1i..L34:
+mov eax, dword ptr [rax]
+add r12, rsi
+mov dword ptr [r12], eax
+jmp _G_lcs_i1i1i..L21
+_G_lcs_i1i1i..L35:
+mov eax, dword ptr [r10]
+add r12, rsi
+mov dword ptr [r12], eax
+jmp _G_lcs_i1i1i..L21
+_G_gridPaths_i:
+push rbp
+mov rbp, rsp
+sub rsp, 80
+_G_gridPaths_i..L0:
+mov qword ptr [rbp-72], r14
+mov qword ptr [rbp-64], r12
+mov qword ptr [rbp-56], r15
+movsx r12, edi
+mov r14, r12
+imul r14, 8
+add r14, 8
+mov r11, r14
+add r11, 16
+mov r15, rdi
+mov rdi, r11
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je _G_gridPaths_i..L13
+_G_gridPaths_i..L1:
+mov rdi, rax
+mov esi, 0
+mov rdx, r14
+mov r14, rax
+call memset
+_G_gridPaths_i..L2:
+mov qword ptr [r14], r12
+cmp r14, 0
+je _G_gridPaths_i..L5
+_G_gridPaths_i..L3:
+mov r11, qword ptr [r14-16]
+cmp r11, -1
+je _G_gridPaths_i..L5
+_G_gridPaths_i..L4:
+add r11, 1
+mov qword ptr [r14-16], r11
+_G_gridPaths_i..L5:
+mov rdi, r14
+mov esi, 2
+call __release_array_internal
+mov rax, r12
+imul rax, 4
+mov r11, r14
+add r11, 8
+add rax, 8
+mov rsi, rax
+add rsi, 16
+mov r10d, 0
+mov qword ptr [rbp-48], rbx
+mov qword ptr [rbp-40], r13
+mov qword ptr [rbp-32], r14
+mov rbx, rax
+_G_gridPaths_i..L6:
+cmp r10d, r15d
+jge _G_gridPaths_i..L14
+_G_gridPaths_i..L7:
+mov rdi, rsi
+mov qword ptr [rbp-24], rsi
+mov r13, r10
+mov r14, r11
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je _G_gridPaths_i..L23
+_G_gridPaths_i..L8:
+mov rdi, rax
+mov esi, 0
+mov rdx, rbx
+mov qword ptr [rbp-8], rbx
+mov rbx, rax
+call memset
+mov rax, qword ptr [rbp-8]
+mov r10, rbx
+mov rbx, rax
+_G_gridPaths_i..L9:
+mov qword ptr [r10], r12
+mov qword ptr [rbp-16], r12
+movsx r12, r13d
+imul r12, 8
+add r12, r14
+mov qword ptr [rbp-8], r14
+mov rdi, qword ptr [r12]
+mov esi, 1
+mov r14, r10
+call __release_array_internal
+mov qword ptr [r12], r14
+cmp r14, 0
+je _G_gridPaths_i..L12
+_G_gridPaths_i..L10:
+mov rax, qword ptr [r14-16]
+cmp rax, -1
+je _G_gridPaths_i..L12
+_G_gridPaths_i..L11:
+add rax, 1
+mov qword ptr [r14-16], rax
+_G_gridPaths_i..L12:
+mov esi, 1
+mov rdi, r14
+call __release_array_internal
+mov r10d, r13d
+add r10d, 1
+mov r12, qword ptr [rbp-16]
+mov r11, qword ptr [rbp-8]
+mov rsi, qword ptr [rbp-24]
+jmp _G_gridPaths_i..L6
+_G_gridPaths_i..L13:
+mov r14, 0
+jmp _G_gridPaths_i..L2
+_G_gridPaths_i..L14:
+mov rdi, qword ptr [rbp-32]
+mov rcx, rdi
+add rcx, 8
+mov rsi, rdi
+add rsi, 8
+mov r8d, 0
+_G_gridPaths_i..L15:
+cmp r8d, r15d
+jge _G_gridPaths_i..L24
+_G_gridPaths_i..L16:
+movsx rbx, r8d
+mov r9d, r8d
+sub r9d, 1
+movsx r12, r8d
+imul rbx, 8
+movsx r9, r9d
+imul r12, 8
+add rbx, rcx
+imul r9, 8
+add r12, rsi
+add r9, rsi
+mov r13d, 0
+_G_gridPaths_i..L17:
+cmp r13d, r15d
+jge _G_gridPaths_i..L25
+_G_gridPaths_i..L18:
+cmp r8d, 0
+jne _G_gridPaths_i..L26
+_G_gridPaths_i..L19:
+mov dl, 1
+_G_gridPaths_i..L20:
+test dl, dl
+jz _G_gridPaths_i..L27
+_G_gridPaths_i..L21:
+mov r14, qword ptr [rbx]
+add r14, 8
+movsx rax, r13d
+imul rax, 4
+add r14, rax
+mov dword ptr [r14], 1
+_G_gridPaths_i..L22:
+add r13d, 1
+jmp _G_gridPaths_i..L17
+_G_gridPaths_i..L23:
+mov r10, 0
+jmp _G_gridPaths_i..L9
+_G_gridPaths_i..L24:
+sub r15d, 1
+mov r13, rdi
+add r13, 8
+movsx r14, r15d
+mov r15, r14
+imul r15, 8
+add r13, r15
+mov r15, qword ptr [r13]
+add r15, 8
+imul r14, 4
+add r15, r14
+mov ebx, dword ptr [r15]
+mov esi, 2
+call __release_array_internal
+mov rax, rbx
+mov rbx, qword ptr [rbp-48]
+mov r12, qword ptr [rbp-64]
+mov r13, qword ptr [rbp-40]
+mov r14, qword ptr [rbp-72]
+mov r15, qword ptr [rbp-56]
+mov rsp, rbp
+pop rbp
+ret
+_G_gridPaths_i..L25:
+add r8d, 1
+jmp _G_gridPaths_i..L15
+_G_gridPaths_i..L26:
+cmp r13d, 0
+sete dl
+jmp _G_gridPaths_i..L20
+_G_gridPaths_i..L27:
+mov rax, qword ptr [r9]
+add rax, 8
+movsx r10, r13d
+imul r10, 4
+add rax, r10
+mov r11d, dword ptr [rax]
+mov rdx, qword ptr [r12]
+mov r14d, r13d
+sub r14d, 1
+add rdx, 8
+movsx r14, r14d
+imul r14, 4
+add rdx, r14
+mov r14d, dword ptr [rdx]
+add r11d, r14d
+mov eax, dword ptr [_GV_seed]
+imul eax, 1103
+add eax, 12345
+mov r14d, 65536
+cdq
+idiv r14d
+mov dword ptr [_GV_seed], edx
+mov eax, dword ptr [_GV_seed]
+mov r14d, 3
+cdq
+idiv r14d
+add r11d, edx
+mov r14d, 1000003
+mov rax, r11
+cdq
+idiv r14d
+mov r14, qword ptr [r12]
+add r14, 8
+add r14, r10
+mov dword ptr [r14], edx
+jmp _G_gridPaths_i..L22
+main:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+main..L0:
+mov qword ptr [rbp-96], r14
+mov qword ptr [rbp-88], r12
+mov qword ptr [rbp-80], r15
+mov qword ptr [rbp-72], rbx
+mov qword ptr [rbp-64], r13
+lea rbx, [rbp-4]
+lea r15, [rbp-8]
+lea r14, [rbp-12]
+lea r12, [rbp-16]
+lea r13, [rbp-20]
+mov rdi, offset _C_0
+mov rsi, r13
+call scanf
+mov r13d, dword ptr [r13]
+mov rdi, offset _C_0
+mov rsi, r12
+call scanf
+mov r12d, dword ptr [r12]
+mov rdi, offset _C_0
+mov rsi, r14
+call scanf
+mov r14d, dword ptr [r14]
+mov rdi, offset _C_0
+mov rsi, r15
+call scanf
+mov r15d, dword ptr [r15]
+mov rdi, offset _C_0
+mov rsi, rbx
+mov dword ptr [rbp-104], r14d
+mov dword ptr [rbp-100], r15d
+call scanf
+mov eax, dword ptr [rbx]
+mov dword ptr [_GV_seed], eax
+movsx r14, r13d
+mov rbx, r14
+imul rbx, 4
+add rbx, 8
+mov r15, rbx
+add r15, 16
+mov rdi, r15
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L13
+main..L1:
+mov dword ptr [rbp-40], r12d
+mov rdi, rax
+mov esi, 0
+mov rdx, rbx
+mov r12, rax
+call memset
+mov eax, dword ptr [rbp-40]
+mov r10, r12
+mov r12, rax
+main..L2:
+mov qword ptr [r10], r14
+cmp r10, 0
+je main..L5
+main..L3:
+mov r11, qword ptr [r10-16]
+cmp r11, -1
+je main..L5
+main..L4:
+add r11, 1
+mov qword ptr [r10-16], r11
+main..L5:
+mov dword ptr [rbp-40], r12d
+mov rdi, r10
+mov esi, 1
+mov r12, r10
+call __release_array_internal
+mov rdi, r15
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L14
+main..L6:
+mov rdi, rax
+mov esi, 0
+mov rdx, rbx
+mov r15, rax
+call memset
+main..L7:
+mov qword ptr [r15], r14
+cmp r15, 0
+je main..L10
+main..L8:
+mov r11, qword ptr [r15-16]
+cmp r11, -1
+je main..L10
+main..L9:
+add r11, 1
+mov qword ptr [r15-16], r11
+main..L10:
+mov rdi, r15
+mov esi, 1
+call __release_array_internal
+mov r10, r12
+add r10, 8
+mov r14d, 0
+mov rsi, qword ptr [rbp-72]
+mov r11, qword ptr [rbp-88]
+mov rdi, qword ptr [rbp-64]
+mov ebx, dword ptr [rbp-40]
+mov r9d, dword ptr [rbp-104]
+mov r8d, dword ptr [rbp-100]
+main..L11:
+cmp r14d, r13d
+jge main..L15
+main..L12:
+mov eax, dword ptr [_GV_seed]
+imul eax, 1103
+add eax, 12345
+mov ecx, 65536
+cdq
+idiv ecx
+mov dword ptr [_GV_seed], edx
+mov eax, dword ptr [_GV_seed]
+mov ecx, 4096
+cdq
+idiv ecx
+movsx rdx, r14d
+imul rdx, 4
+add rdx, r10
+mov dword ptr [rdx], eax
+add r14d, 1
+jmp main..L11
+main..L13:
+mov r10, 0
+jmp main..L2
+main..L14:
+mov r15, 0
+jmp main..L7
+main..L15:
+mov r10, r15
+add r10, 8
+mov ecx, 0
+main..L16:
+cmp ecx, r13d
+jge main..L18
+main..L17:
+mov eax, dword ptr [_GV_seed]
+imul eax, 1103
+add eax, 12345
+mov r14d, 65536
+cdq
+idiv r14d
+mov dword ptr [_GV_seed], edx
+mov eax, dword ptr [_GV_seed]
+mov r14d, 4096
+cdq
+idiv r14d
+movsx rdx, ecx
+imul rdx, 4
+add rdx, r10
+mov dword ptr [rdx], eax
+add ecx, 1
+jmp main..L16
+main..L18:
+mov qword ptr [rbp-56], r15
+mov dword ptr [rbp-32], r13d
+movsx r13, ebx
+mov r14, r13
+imul r14, 4
+add r14, 8
+mov r15, r14
+add r15, 16
+mov rdi, r15
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L31
+main..L19:
+mov qword ptr [rbp-48], r12
+mov rdi, rax
+mov esi, 0
+mov rdx, r14
+mov r12, rax
+call memset
+mov rax, qword ptr [rbp-48]
+mov r10, r12
+mov r12, rax
+main..L20:
+mov qword ptr [r10], r13
+cmp r10, 0
+je main..L23
+main..L21:
+mov r11, qword ptr [r10-16]
+cmp r11, -1
+je main..L23
+main..L22:
+add r11, 1
+mov qword ptr [r10-16], r11
+main..L23:
+mov qword ptr [rbp-48], r12
+mov rdi, r10
+mov esi, 1
+mov r12, r10
+call __release_array_internal
+mov rdi, r15
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L32
+main..L24:
+mov rdi, rax
+mov esi, 0
+mov rdx, r14
+mov r14, rax
+call memset
+main..L25:
+mov qword ptr [r14], r13
+cmp r14, 0
+je main..L28
+main..L26:
+mov r11, qword ptr [r14-16]
+cmp r11, -1
+je main..L28
+main..L27:
+add r11, 1
+mov qword ptr [r14-16], r11
+main..L28:
+mov rdi, r14
+mov esi, 1
+call __release_array_internal
+mov r11, r12
+add r11, 8
+mov rdi, r14
+add rdi, 8
+mov ecx, 0
+mov r10d, dword ptr [rbp-32]
+mov r15d, dword ptr [rbp-104]
+mov r13, qword ptr [rbp-48]
+mov rsi, qword ptr [rbp-56]
+main..L29:
+cmp ecx, ebx
+jge main..L33
+main..L30:
+mov eax, dword ptr [_GV_seed]
+imul eax, 1103
+add eax, 12345
+mov r8d, 65536
+cdq
+idiv r8d
+mov dword ptr [_GV_seed], edx
+mov eax, dword ptr [_GV_seed]
+mov r9d, 100
+cdq
+idiv r9d
+add edx, 1
+movsx r9, ecx
+imul r9, 4
+mov r8, r11
+add r8, r9
+mov dword ptr [r8], edx
+mov eax, dword ptr [_GV_seed]
+imul eax, 1103
+add eax, 12345
+mov r8d, 65536
+cdq
+idiv r8d
+mov dword ptr [_GV_seed], edx
+mov eax, dword ptr [_GV_seed]
+mov r8d, 1000
+cdq
+idiv r8d
+add r9, rdi
+mov dword ptr [r9], edx
+add ecx, 1
+jmp main..L29
+main..L31:
+mov r10, 0
+jmp main..L20
+main..L32:
+mov r14, 0
+jmp main..L25
+main..L33:
+mov rdi, r13
+mov rdx, r10
+call _G_lcs_i1i1i
+mov rdi, 36
+mov r13, rax
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov rbx, rax
+add rbx, 8
+mov rdi, rbx
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r13
+mov r13, rax
+call snprintf
+mov rdi, rbx
+call strlen
+mov qword ptr [r13], rax
+cmp r13, 0
+je main..L47
+main..L34:
+mov rdi, rbx
+call puts
+main..L35:
+cmp r13, 0
+je main..L39
+main..L36:
+sub r13, 16
+mov rbx, qword ptr [r13]
+cmp rbx, -1
+je main..L39
+main..L37:
+sub rbx, 1
+mov qword ptr [r13], rbx
+cmp rbx, 0
+jne main..L39
+main..L38:
+mov rdi, r13
+call __dealloc
+main..L39:
+mov eax, r15d
+add eax, 1
+movsx rbx, eax
+mov r13, rbx
+imul r13, 4
+add r13, 8
+mov rdi, r13
+add rdi, 16
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L48
+main..L40:
+mov rdi, rax
+mov esi, 0
+mov rdx, r13
+mov r13, rax
+call memset
+main..L41:
+mov qword ptr [r13], rbx
+cmp r13, 0
+je main..L44
+main..L42:
+mov r11, qword ptr [r13-16]
+cmp r11, -1
+je main..L44
+main..L43:
+add r11, 1
+mov qword ptr [r13-16], r11
+main..L44:
+mov rdi, r13
+mov esi, 1
+call __release_array_internal
+mov rdx, r13
+add rdx, 8
+mov r10d, 0
+mov rax, qword ptr [rbp-72]
+mov r11, qword ptr [rbp-88]
+mov rdi, qword ptr [rbp-64]
+mov esi, dword ptr [rbp-40]
+mov ebx, dword ptr [rbp-100]
+mov rcx, qword ptr [rbp-48]
+mov r8, qword ptr [rbp-56]
+main..L45:
+cmp r10d, r15d
+jg main..L49
+main..L46:
+movsx rax, r10d
+imul rax, 4
+add rax, rdx
+mov dword ptr [rax], 0
+add r10d, 1
+jmp main..L45
+main..L47:
+mov edi, 10
+call putchar
+jmp main..L35
+main..L48:
+mov r13, 0
+jmp main..L41
+main..L49:
+mov rcx, r12
+add rcx, 8
+mov r11, r13
+add r11, 8
+mov rdi, r14
+add rdi, 8
+mov r10d, 0
+mov qword ptr [rbp-40], r12
+mov qword ptr [rbp-32], r14
+main..L50:
+cmp r10d, esi
+jge main..L56
+main..L51:
+movsx r8, r10d
+imul r8, 4
+mov r9, rcx
+add r9, r8
+add r8, rdi
+mov r12d, r15d
+main..L52:
+mov r14d, dword ptr [r9]
+cmp r12d, r14d
+jl main..L70
+main..L53:
+mov edx, dword ptr [r9]
+mov eax, r12d
+sub eax, edx
+movsx r14, eax
+imul r14, 4
+add r14, r11
+mov edx, dword ptr [r14]
+mov eax, dword ptr [r8]
+add edx, eax
+movsx rax, r12d
+imul rax, 4
+add rax, r11
+mov r14d, dword ptr [rax]
+cmp edx, r14d
+jle main..L55
+main..L54:
+mov edx, dword ptr [r9]
+mov r14d, r12d
+sub r14d, edx
+movsx rdx, r14d
+imul rdx, 4
+add rdx, r11
+mov r14d, dword ptr [rdx]
+mov edx, dword ptr [r8]
+add r14d, edx
+mov dword ptr [rax], r14d
+main..L55:
+sub r12d, 1
+jmp main..L52
+main..L56:
+mov r8, r13
+add r8, 8
+movsx r9, r15d
+imul r9, 4
+add r8, r9
+mov r12d, dword ptr [r8]
+mov esi, 1
+mov rdi, r13
+call __release_array_internal
+mov rdi, 36
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r13, rax
+add r13, 8
+mov rdi, r13
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r12
+mov r12, rax
+call snprintf
+mov rdi, r13
+call strlen
+mov qword ptr [r12], rax
+cmp r12, 0
+je main..L69
+main..L57:
+mov rdi, r13
+call puts
+main..L58:
+cmp r12, 0
+je main..L62
+main..L59:
+sub r12, 16
+mov r13, qword ptr [r12]
+cmp r13, -1
+je main..L62
+main..L60:
+sub r13, 1
+mov qword ptr [r12], r13
+cmp r13, 0
+jne main..L62
+main..L61:
+mov rdi, r12
+call __dealloc
+main..L62:
+mov rdi, rbx
+call _G_gridPaths_i
+mov rdi, 36
+mov r13, rax
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r12, rax
+add r12, 8
+mov rdi, r12
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r13
+mov rbx, rax
+call snprintf
+mov rdi, r12
+call strlen
+mov qword ptr [rbx], rax
+cmp rbx, 0
+je main..L71
+main..L63:
+mov rdi, r12
+call puts
+main..L64:
+cmp rbx, 0
+je main..L68
+main..L65:
+sub rbx, 16
+mov r12, qword ptr [rbx]
+cmp r12, -1
+je main..L68
+main..L66:
+sub r12, 1
+mov qword ptr [rbx], r12
+cmp r12, 0
+jne main..L68
+main..L67:
+mov rdi, rbx
+call __dealloc
+main..L68:
+mov rdi, qword ptr [rbp-48]
+mov esi, 1
+call __release_array_internal
+mov rdi, qword ptr [rbp-56]
+mov esi, 1
+call __release_array_internal
+mov rdi, qword ptr [rbp-40]
+mov esi, 1
+call __release_array_internal
+mov rdi, qword ptr [rbp-32]
+mov esi, 1
+call __release_array_internal
+mov eax, 0
+mov rbx, qword ptr [rbp-72]
+mov r12, qword ptr [rbp-88]
+mov r13, qword ptr [rbp-64]
+mov r14, qword ptr [rbp-96]
+mov r15, qword ptr [rbp-80]
+mov rsp, rbp
+pop rbp
+ret
+main..L69:
+mov edi, 10
+call putchar
+jmp main..L58
+main..L70:
+add r10d, 1
+jmp main..L50
+main..L71:
+mov edi, 10
+call putchar
+jmp main..L64
+_C_0:
+.byte 37, 100, 0
+_C_1:
+.byte 82, 117, 110, 116, 105, 109, 101, 32, 69, 114, 114, 111, 114, 58, 32, 0
+_C_2:
+.byte 83, 117, 98, 115, 99, 114, 105, 112, 116, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 0
+_C_3:
+.byte 78, 117, 108, 108, 32, 112, 111, 105, 110, 116, 101, 114, 0
+_C_4:
+.byte 66, 97, 100, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 0
+_C_5:
+.byte 10, 0
+_C_6:
+.byte 37, 115, 0
+.section .bss
+.balign 16
+_GV___heap:
+.zero 8
+_GV_seed:
+.zero 4
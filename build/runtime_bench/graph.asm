@@ -0,0 +1,1110 @@
+extern strcmp, malloc, free, scanf, puts, printf, putchar, getchar, snprintf, strlen, memcpy, sscanf, fputs, stderr, exit, memset, mmap
+global main
+	section .text
+__runtime_error:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 16
+.L0:
+	mov qword [rbp-16], r12
+	mov qword [rbp-8], r15
+	mov r15, qword [stderr]
+	mov r10, _C_1
+	mov rsi, r15
+	mov r12, rdi
+	mov rdi, r10
+	call fputs
+	mov rsi, r15
+	mov rdi, r12
+	call fputs
+	mov rdi, _C_5
+	mov rsi, r15
+	call fputs
+	mov edi, -1
+	call exit
+	mov r12, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+__release_array_object:
+.L0:
+	cmp rdi, 0
+	je .L4
+.L1:
+	mov rax, qword [rdi-16]
+	sub rax, 1
+	mov qword [rdi-16], rax
+	cmp rax, 0
+	jne .L4
+.L2:
+	cmp esi, 0
+	jg .L5
+.L3:
+	xor rax, rax
+	ret
+.L4:
+	xor rax, rax
+	ret
+.L5:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 128
+	sub esi, 1
+	mov r10, qword [rdi]
+	sal r10, 3
+	add r10, 8
+	add r10, rdi
+	mov r8, rdi
+	add r8, 8
+	mov r9d, esi
+	sub r9d, 1
+	mov ecx, r9d
+	sub ecx, 1
+	mov eax, ecx
+	sub eax, 1
+	mov qword [rbp-104], rdi
+	mov qword [rbp-96], rbx
+	mov qword [rbp-88], r12
+	mov qword [rbp-80], r13
+	mov qword [rbp-72], r14
+	mov qword [rbp-64], r15
+.L6:
+	cmp r8, r10
+	je .L11
+.L7:
+	mov r13, qword [r8]
+	cmp r13, 0
+	je .L10
+.L8:
+	mov r12, qword [r13-16]
+	sub r12, 1
+	mov qword [r13-16], r12
+	cmp r12, 0
+	jne .L10
+.L9:
+	cmp esi, 0
+	jg .L12
+.L10:
+	add r8, 8
+	jmp .L6
+.L11:
+	mov rdi, qword [rbp-104]
+	sub rdi, 16
+	call __dealloc
+	mov rbx, qword [rbp-96]
+	mov r12, qword [rbp-88]
+	mov r13, qword [rbp-80]
+	mov r14, qword [rbp-72]
+	mov r15, qword [rbp-64]
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+.L12:
+	mov r15, qword [r13]
+	sal r15, 3
+	add r15, 8
+	add r15, r13
+	mov rdi, r13
+	add rdi, 8
+	mov dword [rbp-116], esi
+	mov qword [rbp-56], r10
+	mov qword [rbp-48], r8
+	mov qword [rbp-40], r13
+.L13:
+	cmp rdi, r15
+	je .L18
+.L14:
+	mov r8, qword [rdi]
+	cmp r8, 0
+	je .L17
+.L15:
+	mov r11, qword [r8-16]
+	sub r11, 1
+	mov qword [r8-16], r11
+	cmp r11, 0
+	jne .L17
+.L16:
+	cmp r9d, 0
+	jg .L19
+.L17:
+	add rdi, 8
+	jmp .L13
+.L18:
+	mov rdi, qword [rbp-40]
+	sub rdi, 16
+	mov rbx, rax
+	mov r12, rcx
+	mov r13, r9
+	call __dealloc
+	mov esi, dword [rbp-116]
+	mov r10, qword [rbp-56]
+	mov r8, qword [rbp-48]
+	mov rax, rbx
+	mov rcx, r12
+	mov r9, r13
+	jmp .L10
+.L19:
+	mov rdx, qword [r8]
+	sal rdx, 3
+	add rdx, 8
+	add rdx, r8
+	mov r13, r8
+	add r13, 8
+	mov dword [rbp-112], r9d
+	mov qword [rbp-32], r15
+	mov qword [rbp-24], rdi
+	mov qword [rbp-16], r8
+.L20:
+	cmp r13, rdx
+	je .L25
+.L21:
+	mov r15, qword [r13]
+	cmp r15, 0
+	je .L24
+.L22:
+	mov r11, qword [r15-16]
+	sub r11, 1
+	mov qword [r15-16], r11
+	cmp r11, 0
+	jne .L24
+.L23:
+	cmp ecx, 0
+	jg .L26
+.L24:
+	add r13, 8
+	jmp .L20
+.L25:
+	mov rdi, qword [rbp-16]
+	sub rdi, 16
+	mov r12, rcx
+	mov r14, rax
+	call __dealloc
+	mov r9d, dword [rbp-112]
+	mov r15, qword [rbp-32]
+	mov rdi, qword [rbp-24]
+	mov rax, r14
+	mov rcx, r12
+	jmp .L17
+.L26:
+	mov r12, qword [r15]
+	sal r12, 3
+	add r12, 8
+	add r12, r15
+	mov rbx, r15
+	add rbx, 8
+	mov dword [rbp-108], ecx
+	mov qword [rbp-8], rdx
+	mov r14, rax
+.L27:
+	cmp rbx, r12
+	je .L29
+.L28:
+	mov rdi, qword [rbx]
+	mov esi, r14d
+	call __release_array_object
+	add rbx, 8
+	jmp .L27
+.L29:
+	sub r15, 16
+	mov rdi, r15
+	call __dealloc
+	mov ecx, dword [rbp-108]
+	mov rdx, qword [rbp-8]
+	mov rax, r14
+	jmp .L24
+
+__alloc:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 32
+.L0:
+	mov r10, qword [_GV___heap]
+	cmp r10, 0
+	je .L7
+.L1:
+	mov r11, r12
+	mov r12, rdi
+.L2:
+	mov r8, r12
+	add r8, 23
+	shr r8, 4
+	cmp r8, 32
+	ja .L11
+.L3:
+	mov rdi, r8
+	sal rdi, 3
+	add rdi, r10
+	mov rax, qword [rdi+8]
+	cmp rax, 0
+	jne .L13
+.L4:
+	mov r12, r8
+	sal r12, 4
+	mov qword [rbp-32], r11
+	mov qword [rbp-24], r13
+	mov qword [rbp-16], r14
+	mov qword [rbp-8], r15
+	mov r13, r10
+.L5:
+	mov rax, qword [r13]
+	mov rcx, rax
+	add rcx, r12
+	mov rdi, qword [r13+8]
+	cmp rcx, rdi
+	ja .L14
+.L6:
+	mov qword [r13], rcx
+	mov qword [rax], r8
+	add rax, 8
+	mov r12, qword [rbp-32]
+	mov r13, qword [rbp-24]
+	mov r14, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L7:
+	mov qword [rbp-32], r12
+	mov r10, 0
+	mov rsi, 1048576
+	mov edx, 3
+	mov ecx, 34
+	mov r8d, -1
+	mov r9, 0
+	mov r12, rdi
+	mov rdi, r10
+	call mmap
+	cmp rax, -1
+	je .L9
+.L8:
+	mov qword [_GV___heap], rax
+	mov r10, rax
+	mov rdi, rax
+	add rdi, 272
+	mov qword [rax], rdi
+	mov rsi, rax
+	add rsi, 1048576
+	mov qword [rax+8], rsi
+	mov r11, qword [rbp-32]
+	jmp .L2
+.L9:
+	mov r12, qword [rbp-32]
+.L10:
+	mov rdi, _C_4
+	call __runtime_error
+	mov rax, 0
+	mov rsp, rbp
+	pop rbp
+	ret
+.L11:
+	add r12, 8
+	mov rdi, r12
+	mov r12, r11
+	call malloc
+	cmp rax, 0
+	je .L10
+.L12:
+	mov qword [rax], 0
+	add rax, 8
+	mov rsp, rbp
+	pop rbp
+	ret
+.L13:
+	mov r10, qword [rax]
+	mov qword [rdi+8], r10
+	mov r12, r11
+	mov rsp, rbp
+	pop rbp
+	ret
+.L14:
+	mov rdi, 0
+	mov rsi, 1048576
+	mov edx, 3
+	mov ecx, 34
+	mov r15d, -1
+	mov r9, 0
+	mov r14, r8
+	mov r8, r15
+	call mmap
+	cmp rax, -1
+	je .L16
+.L15:
+	mov qword [r13], rax
+	add rax, 1048576
+	mov qword [r13+8], rax
+	mov r8, r14
+	jmp .L5
+.L16:
+	mov r12, qword [rbp-32]
+	mov r13, qword [rbp-24]
+	mov r14, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	jmp .L10
+
+__dealloc:
+.L0:
+	mov rax, rdi
+	sub rax, 8
+	mov r10, qword [rax]
+	cmp r10, 0
+	je .L2
+.L1:
+	mov rax, qword [_GV___heap]
+	sal r10, 3
+	add r10, rax
+	mov r11, qword [r10+8]
+	mov qword [rdi], r11
+	mov qword [r10+8], rdi
+	xor rax, rax
+	ret
+.L2:
+	push rbp
+	mov rbp, rsp
+	mov rdi, rax
+	call free
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+main:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 128
+.L0:
+	mov qword [rbp-104], r15
+	mov qword [rbp-96], r12
+	mov qword [rbp-88], r13
+	mov qword [rbp-80], rbx
+	lea rbx, [rbp-4]
+	lea r12, [rbp-8]
+	lea r15, [rbp-12]
+	lea r13, [rbp-16]
+	mov rdi, _C_0
+	mov rsi, r13
+	call scanf
+	mov r13d, dword [r13]
+	mov rdi, _C_0
+	mov rsi, r15
+	call scanf
+	mov r15d, dword [r15]
+	mov rdi, _C_0
+	mov rsi, r12
+	call scanf
+	mov r12d, dword [r12]
+	mov rdi, _C_0
+	mov rsi, rbx
+	mov qword [rbp-72], r14
+	call scanf
+	mov r14d, dword [rbx]
+	mov dword [_GV_seed], r14d
+	movsx r14, r13d
+	mov rbx, r14
+	imul rbx, 8
+	add rbx, 8
+	mov r11, rbx
+	add r11, 16
+	mov rdi, r11
+	mov qword [rbp-64], r11
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov qword [rax], r14
+	mov r10, 8
+	mov dword [rbp-108], r15d
+	mov dword [rbp-124], r12d
+	mov qword [rbp-56], r14
+.L1:
+	cmp r10, rbx
+	jae .L5
+.L2:
+	mov rdi, 32
+	mov r14, rax
+	mov r15, r10
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L19
+.L3:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, 16
+	mov r12, rax
+	call memset
+	mov rax, r14
+.L4:
+	mov qword [rax+r15], r12
+	mov r10, r15
+	add r10, 8
+	jmp .L1
+.L5:
+	cmp rax, 0
+	je .L8
+.L6:
+	mov r10, qword [rax-16]
+	cmp r10, -1
+	je .L8
+.L7:
+	add r10, 1
+	mov qword [rax-16], r10
+.L8:
+	mov rdi, rax
+	mov esi, 1
+	mov r15, rax
+	call __release_array_object
+	mov r12, r15
+	add r12, 8
+	mov r14d, 0
+	mov qword [rbp-48], rbx
+.L9:
+	cmp r14d, r13d
+	jge .L20
+.L10:
+	mov rdi, 32
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L51
+.L11:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, 16
+	mov rbx, rax
+	call memset
+.L12:
+	movsx r11, r14d
+	imul r11, 8
+	add r11, r12
+	mov qword [r11], rbx
+	cmp rbx, 0
+	je .L15
+.L13:
+	mov rdi, qword [rbx-16]
+	cmp rdi, -1
+	je .L15
+.L14:
+	add rdi, 1
+	mov qword [rbx-16], rdi
+.L15:
+	mov rsi, qword [r11]
+	add rsi, 0
+	mov dword [rsi], r14d
+	mov rdx, qword [r11]
+	add rdx, 8
+	mov qword [rdx], 0
+	mov rcx, 0
+	cmp rcx, 0
+	je .L18
+.L16:
+	mov r8, 0
+	mov r9, qword [r8-16]
+	cmp r9, -1
+	je .L18
+.L17:
+	add r9, 1
+	mov rbx, 0
+	mov qword [rbx-16], r9
+.L18:
+	add r14d, 1
+	jmp .L9
+.L19:
+	mov r12, 0
+	mov rax, r14
+	jmp .L4
+.L20:
+	mov rdi, r15
+	add rdi, 8
+	mov ebx, 0
+	mov qword [rbp-40], r15
+	mov r11d, dword [rbp-108]
+.L21:
+	cmp ebx, r11d
+	jge .L52
+.L22:
+	mov eax, dword [_GV_seed]
+	imul eax, 1103
+	add eax, 12345
+	mov esi, 65536
+	cdq
+	idiv esi
+	mov dword [_GV_seed], edx
+	mov ecx, dword [_GV_seed]
+	mov eax, ecx
+	cdq
+	idiv r13d
+	imul ecx, 1103
+	add ecx, 12345
+	mov r8d, 65536
+	mov rax, rcx
+	mov r9, rdx
+	cdq
+	idiv r8d
+	mov dword [_GV_seed], edx
+	mov eax, dword [_GV_seed]
+	cdq
+	idiv r13d
+	mov dword [rbp-120], r13d
+	movsx r15, r9d
+	imul r15, 8
+	add r15, rdi
+	mov r12, qword [r15]
+	movsx r13, edx
+	imul r13, 8
+	add r13, rdi
+	mov qword [rbp-24], rdi
+	mov r14, qword [r13]
+	mov rdi, 32
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L57
+.L23:
+	mov dword [rbp-32], ebx
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, 16
+	mov rbx, rax
+	call memset
+	mov eax, dword [rbp-32]
+	mov r10, rbx
+.L24:
+	cmp r10, 0
+	setne r11b
+	test r11b, r11b
+	jz .L27
+.L25:
+	mov rdi, qword [r10-16]
+	cmp rdi, -1
+	je .L27
+.L26:
+	add rdi, 1
+	mov qword [r10-16], rdi
+.L27:
+	mov rsi, r10
+	add rsi, 0
+	mov qword [rsi], r14
+	cmp r14, 0
+	je .L30
+.L28:
+	mov rdx, qword [r14-16]
+	cmp rdx, -1
+	je .L30
+.L29:
+	add rdx, 1
+	mov qword [r14-16], rdx
+.L30:
+	add r12, 8
+	mov rdi, qword [r12]
+	mov rsi, r10
+	add rsi, 8
+	mov qword [rsi], rdi
+	cmp rdi, 0
+	je .L33
+.L31:
+	mov rdx, qword [rdi-16]
+	cmp rdx, -1
+	je .L33
+.L32:
+	add rdx, 1
+	mov qword [rdi-16], rdx
+.L33:
+	mov qword [r12], r10
+	test r11b, r11b
+	jz .L36
+.L34:
+	mov rcx, qword [r10-16]
+	cmp rcx, -1
+	je .L36
+.L35:
+	add rcx, 1
+	mov qword [r10-16], rcx
+.L36:
+	mov r12, qword [r13]
+	mov r13, qword [r15]
+	mov rdi, 32
+	mov rbx, rax
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L77
+.L37:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, 16
+	mov r15, rax
+	call memset
+.L38:
+	cmp r15, 0
+	setne r11b
+	test r11b, r11b
+	jz .L41
+.L39:
+	mov rdi, qword [r15-16]
+	cmp rdi, -1
+	je .L41
+.L40:
+	add rdi, 1
+	mov qword [r15-16], rdi
+.L41:
+	mov rsi, r15
+	add rsi, 0
+	mov qword [rsi], r13
+	cmp r13, 0
+	je .L44
+.L42:
+	mov rdx, qword [r13-16]
+	cmp rdx, -1
+	je .L44
+.L43:
+	add rdx, 1
+	mov qword [r13-16], rdx
+.L44:
+	add r12, 8
+	mov r13, qword [r12]
+	mov r14, r15
+	add r14, 8
+	mov qword [r14], r13
+	cmp r13, 0
+	je .L47
+.L45:
+	mov r10, qword [r13-16]
+	cmp r10, -1
+	je .L47
+.L46:
+	add r10, 1
+	mov qword [r13-16], r10
+.L47:
+	mov qword [r12], r15
+	test r11b, r11b
+	jz .L50
+.L48:
+	mov rax, qword [r15-16]
+	cmp rax, -1
+	je .L50
+.L49:
+	add rax, 1
+	mov qword [r15-16], rax
+.L50:
+	add ebx, 1
+	mov r13d, dword [rbp-120]
+	mov r11d, dword [rbp-108]
+	mov rdi, qword [rbp-24]
+	jmp .L21
+.L51:
+	mov rbx, 0
+	jmp .L12
+.L52:
+	mov r12, qword [rbp-40]
+	mov rsi, r12
+	add rsi, 8
+	add r12, 8
+	mov r14d, 0
+	mov r10d, 0
+	mov edi, dword [rbp-124]
+	mov r15, qword [rbp-56]
+	mov rbx, qword [rbp-48]
+	mov r8, qword [rbp-64]
+.L53:
+	cmp r10d, edi
+	jge .L58
+.L54:
+	mov eax, dword [_GV_seed]
+	imul eax, 1103
+	add eax, 12345
+	mov r11d, 65536
+	cdq
+	idiv r11d
+	mov dword [_GV_seed], edx
+	mov eax, dword [_GV_seed]
+	cdq
+	idiv r13d
+	mov edi, 0
+	mov rcx, qword [rbp-80]
+	mov r9, qword [rbp-40]
+.L55:
+	cmp edi, r13d
+	jge .L66
+.L56:
+	movsx rcx, edi
+	imul rcx, 8
+	add rcx, rsi
+	mov r9, qword [rcx]
+	add r9, 4
+	mov dword [r9], -1
+	add edi, 1
+	jmp .L55
+.L57:
+	mov r10, 0
+	mov rax, rbx
+	jmp .L24
+.L58:
+	mov rdi, 36
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r12, rax
+	add r12, 8
+	mov rdi, r12
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r14
+	mov rbx, rax
+	call snprintf
+	mov rdi, r12
+	call strlen
+	mov qword [rbx], rax
+	cmp rbx, 0
+	je .L65
+.L59:
+	mov rdi, r12
+	call puts
+.L60:
+	cmp rbx, 0
+	je .L64
+.L61:
+	sub rbx, 16
+	mov r12, qword [rbx]
+	cmp r12, -1
+	je .L64
+.L62:
+	sub r12, 1
+	mov qword [rbx], r12
+	cmp r12, 0
+	jne .L64
+.L63:
+	mov rdi, rbx
+	call __dealloc
+.L64:
+	mov rdi, qword [rbp-40]
+	mov esi, 1
+	call __release_array_object
+	mov eax, 0
+	mov rbx, qword [rbp-80]
+	mov r12, qword [rbp-96]
+	mov r13, qword [rbp-88]
+	mov r14, qword [rbp-72]
+	mov r15, qword [rbp-104]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L65:
+	mov edi, 10
+	call putchar
+	jmp .L60
+.L66:
+	mov dword [rbp-116], r14d
+	mov dword [rbp-112], r10d
+	mov dword [rbp-120], r13d
+	mov qword [rbp-32], rsi
+	mov rdi, 56
+	mov r13, rdx
+	mov r14, r8
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L76
+.L67:
+	mov qword [rbp-24], r12
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, 40
+	mov r12, rax
+	call memset
+	mov rax, qword [rbp-24]
+	mov r10, r12
+	mov r12, rax
+.L68:
+	cmp r10, 0
+	je .L71
+.L69:
+	mov r11, qword [r10-16]
+	cmp r11, -1
+	je .L71
+.L70:
+	add r11, 1
+	mov qword [r10-16], r11
+.L71:
+	mov rdi, r14
+	mov r14, r10
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov qword [rax], r15
+	mov r15, 8
+	mov qword [rbp-24], r12
+	mov dword [rbp-108], r13d
+.L72:
+	cmp r15, rbx
+	jae .L78
+.L73:
+	mov rdi, 32
+	mov r13, rax
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L107
+.L74:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, 16
+	mov r12, rax
+	call memset
+	mov rax, r13
+.L75:
+	mov qword [rax+r15], r12
+	add r15, 8
+	jmp .L72
+.L76:
+	mov r10, 0
+	jmp .L68
+.L77:
+	mov r15, 0
+	jmp .L38
+.L78:
+	mov r12, r14
+	add r12, 24
+	mov rdi, qword [r12]
+	mov esi, 1
+	mov r15, rax
+	call __release_array_object
+	mov qword [r12], r15
+	cmp r15, 0
+	je .L81
+.L79:
+	mov r13, qword [r15-16]
+	cmp r13, -1
+	je .L81
+.L80:
+	add r13, 1
+	mov qword [r15-16], r13
+.L81:
+	mov esi, 1
+	mov rdi, r15
+	call __release_array_object
+	mov r15, r14
+	add r15, 32
+	mov dword [r15], 0
+	add r14, 36
+	mov dword [r14], 0
+	mov eax, dword [rbp-108]
+	movsx r10, eax
+	imul r10, 8
+	mov r11, qword [rbp-24]
+	add r11, r10
+	mov rdi, qword [r11]
+	add rdi, 4
+	mov dword [rdi], 0
+	mov rsi, qword [r11]
+	mov rdx, qword [r12]
+	mov ecx, dword [r14]
+	add rdx, 8
+	movsx rcx, ecx
+	imul rcx, 8
+	add rdx, rcx
+	mov qword [rdx], rsi
+	cmp rsi, 0
+	je .L84
+.L82:
+	mov rcx, qword [rsi-16]
+	cmp rcx, -1
+	je .L84
+.L83:
+	add rcx, 1
+	mov qword [rsi-16], rcx
+.L84:
+	mov r8d, dword [r14]
+	add r8d, 1
+	mov dword [r14], r8d
+	mov r9d, 0
+	mov r11d, 0
+	mov r13d, dword [rbp-120]
+	mov edi, dword [rbp-124]
+	mov eax, dword [rbp-116]
+	mov r10d, dword [rbp-112]
+.L85:
+	mov ebx, dword [r15]
+	mov esi, dword [r14]
+	cmp ebx, esi
+	sete dl
+	cmp dl, 0
+	jne .L108
+.L86:
+	mov rcx, qword [r12]
+	mov r8d, dword [r15]
+	add rcx, 8
+	movsx r8, r8d
+	imul r8, 8
+	add rcx, r8
+	mov r8, qword [rcx]
+	cmp r8, 0
+	setne bl
+	test bl, bl
+	jz .L89
+.L87:
+	mov rsi, qword [r8-16]
+	cmp rsi, -1
+	je .L89
+.L88:
+	add rsi, 1
+	mov qword [r8-16], rsi
+.L89:
+	mov edx, dword [r15]
+	add edx, 1
+	mov dword [r15], edx
+	test bl, bl
+	jz .L92
+.L90:
+	mov rcx, qword [r8-16]
+	cmp rcx, -1
+	je .L92
+.L91:
+	add rcx, 1
+	mov qword [r8-16], rcx
+.L92:
+	test bl, bl
+	jz .L95
+.L93:
+	mov rbx, qword [r8-16]
+	cmp rbx, -1
+	je .L95
+.L94:
+	add rbx, 1
+	mov qword [r8-16], rbx
+.L95:
+	add r9d, 1
+	mov rsi, r8
+	add rsi, 4
+	mov ebx, dword [rsi]
+	add r11d, ebx
+	add r8, 8
+	mov rbx, qword [r8]
+	cmp rbx, 0
+	je .L98
+.L96:
+	mov rdx, qword [rbx-16]
+	cmp rdx, -1
+	je .L98
+.L97:
+	add rdx, 1
+	mov qword [rbx-16], rdx
+.L98:
+	cmp rbx, 0
+	je .L85
+.L99:
+	mov rdx, rbx
+	add rdx, 0
+	mov rcx, qword [rdx]
+	add rcx, 4
+	mov r8d, dword [rcx]
+	cmp r8d, -1
+	jne .L104
+.L100:
+	mov ecx, dword [rsi]
+	add ecx, 1
+	mov r8, qword [rdx]
+	add r8, 4
+	mov dword [r8], ecx
+	mov rdx, qword [rdx]
+	mov rcx, qword [r12]
+	mov r8d, dword [r14]
+	add rcx, 8
+	movsx r8, r8d
+	imul r8, 8
+	add rcx, r8
+	mov qword [rcx], rdx
+	cmp rdx, 0
+	je .L103
+.L101:
+	mov r8, qword [rdx-16]
+	cmp r8, -1
+	je .L103
+.L102:
+	add r8, 1
+	mov qword [rdx-16], r8
+.L103:
+	mov edx, dword [r14]
+	add edx, 1
+	mov dword [r14], edx
+.L104:
+	add rbx, 8
+	mov rdx, qword [rbx]
+	mov rbx, rdx
+	cmp rdx, 0
+	je .L98
+.L105:
+	mov r8, qword [rdx-16]
+	cmp r8, -1
+	je .L98
+.L106:
+	add r8, 1
+	mov qword [rdx-16], r8
+	jmp .L98
+.L107:
+	mov r12, 0
+	mov rax, r13
+	jmp .L75
+.L108:
+	imul eax, 31
+	imul r9d, 7
+	add eax, r9d
+	add eax, r11d
+	mov ebx, 1000003
+	cdq
+	idiv ebx
+	mov r14d, edx
+	add r10d, 1
+	mov r15, qword [rbp-56]
+	mov rbx, qword [rbp-48]
+	mov r8, qword [rbp-64]
+	mov rsi, qword [rbp-32]
+	mov r12, qword [rbp-24]
+	jmp .L53
+
+_C_0:
+	db '%d', 0
+
+_C_1:
+	db 'Runtime Error: ', 0
+
+_C_2:
+	db 'Subscript out of range', 0
+
+_C_3:
+	db 'Null pointer', 0
+
+_C_4:
+	db 'Bad allocation', 0
+
+_C_5:
+	db 10, 0
+
+_C_6:
+	db '%s', 0
+
+	section .bss
+	align 16
+_GV___heap:
+	resb 8
+
+_GV_seed:
+	resb 4
+
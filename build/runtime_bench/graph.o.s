@@ -0,0 +1,1096 @@
+.intel_syntax noprefix
+.globl main
+.section .text
+__runtime_error:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+__runtime_error..L0:
+mov qword ptr [rbp-16], r12
+mov qword ptr [rbp-8], r15
+mov r15, qword ptr [stderr]
+mov r10, offset _C_1
+mov rsi, r15
+mov r12, rdi
+mov rdi, r10
+call fputs
+mov rsi, r15
+mov rdi, r12
+call fputs
+mov rdi, offset _C_5
+mov rsi, r15
+call fputs
+mov edi, -1
+call exit
+mov r12, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+__release_array_object:
+__release_array_object..L0:
+cmp rdi, 0
+je __release_array_object..L4
+__release_array_object..L1:
+mov rax, qword ptr [rdi-16]
+sub rax, 1
+mov qword ptr [rdi-16], rax
+cmp rax, 0
+jne __release_array_object..L4
+__release_array_object..L2:
+cmp esi, 0
+jg __release_array_object..L5
+__release_array_object..L3:
+xor rax, rax
+ret
+__release_array_object..L4:
+xor rax, rax
+ret
+__release_array_object..L5:
+push rbp
+mov rbp, rsp
+sub rsp, 128
+sub esi, 1
+mov r10, qword ptr [rdi]
+sal r10, 3
+add r10, 8
+add r10, rdi
+mov r8, rdi
+add r8, 8
+mov r9d, esi
+sub r9d, 1
+mov ecx, r9d
+sub ecx, 1
+mov eax, ecx
+sub eax, 1
+mov qword ptr [rbp-104], rdi
+mov qword ptr [rbp-96], rbx
+mov qword ptr [rbp-88], r12
+mov qword ptr [rbp-80], r13
+mov qword ptr [rbp-72], r14
+mov qword ptr [rbp-64], r15
+__release_array_object..L6:
+cmp r8, r10
+je __release_array_object..L11
+__release_array_object..L7:
+mov r13, qword ptr [r8]
+cmp r13, 0
+je __release_array_object..L10
+__release_array_object..L8:
+mov r12, qword ptr [r13-16]
+sub r12, 1
+mov qword ptr [r13-16], r12
+cmp r12, 0
+jne __release_array_object..L10
+__release_array_object..L9:
+cmp esi, 0
+jg __release_array_object..L12
+__release_array_object..L10:
+add r8, 8
+jmp __release_array_object..L6
+__release_array_object..L11:
+mov rdi, qword ptr [rbp-104]
+sub rdi, 16
+call __dealloc
+mov rbx, qword ptr [rbp-96]
+mov r12, qword ptr [rbp-88]
+mov r13, qword ptr [rbp-80]
+mov r14, qword ptr [rbp-72]
+mov r15, qword ptr [rbp-64]
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+__release_array_object..L12:
+mov r15, qword ptr [r13]
+sal r15, 3
+add r15, 8
+add r15, r13
+mov rdi, r13
+add rdi, 8
+mov dword ptr [rbp-116], esi
+mov qword ptr [rbp-56], r10
+mov qword ptr [rbp-48], r8
+mov qword ptr [rbp-40], r13
+__release_array_object..L13:
+cmp rdi, r15
+je __release_array_object..L18
+__release_array_object..L14:
+mov r8, qword ptr [rdi]
+cmp r8, 0
+je __release_array_object..L17
+__release_array_object..L15:
+mov r11, qword ptr [r8-16]
+sub r11, 1
+mov qword ptr [r8-16], r11
+cmp r11, 0
+jne __release_array_object..L17
+__release_array_object..L16:
+cmp r9d, 0
+jg __release_array_object..L19
+__release_array_object..L17:
+add rdi, 8
+jmp __release_array_object..L13
+__release_array_object..L18:
+mov rdi, qword ptr [rbp-40]
+sub rdi, 16
+mov rbx, rax
+mov r12, rcx
+mov r13, r9
+call __dealloc
+mov esi, dword ptr [rbp-116]
+mov r10, qword ptr [rbp-56]
+mov r8, qword ptr [rbp-48]
+mov rax, rbx
+mov rcx, r12
+mov r9, r13
+jmp __release_array_object..L10
+__release_array_object..L19:
+mov rdx, qword ptr [r8]
+sal rdx, 3
+add rdx, 8
+add rdx, r8
+mov r13, r8
+add r13, 8
+mov dword ptr [rbp-112], r9d
+mov qword ptr [rbp-32], r15
+mov qword ptr [rbp-24], rdi
+mov qword ptr [rbp-16], r8
+__release_array_object..L20:
+cmp r13, rdx
+je __release_array_object..L25
+__release_array_object..L21:
+mov r15, qword ptr [r13]
+cmp r15, 0
+je __release_array_object..L24
+__release_array_object..L22:
+mov r11, qword ptr [r15-16]
+sub r11, 1
+mov qword ptr [r15-16], r11
+cmp r11, 0
+jne __release_array_object..L24
+__release_array_object..L23:
+cmp ecx, 0
+jg __release_array_object..L26
+__release_array_object..L24:
+add r13, 8
+jmp __release_array_object..L20
+__release_array_object..L25:
+mov rdi, qword ptr [rbp-16]
+sub rdi, 16
+mov r12, rcx
+mov r14, rax
+call __dealloc
+mov r9d, dword ptr [rbp-112]
+mov r15, qword ptr [rbp-32]
+mov rdi, qword ptr [rbp-24]
+mov rax, r14
+mov rcx, r12
+jmp __release_array_object..L17
+__release_array_object..L26:
+mov r12, qword ptr [r15]
+sal r12, 3
+add r12, 8
+add r12, r15
+mov rbx, r15
+add rbx, 8
+mov dword ptr [rbp-108], ecx
+mov qword ptr [rbp-8], rdx
+mov r14, rax
+__release_array_object..L27:
+cmp rbx, r12
+je __release_array_object..L29
+__release_array_object..L28:
+mov rdi, qword ptr [rbx]
+mov esi, r14d
+call __release_array_object
+add rbx, 8
+jmp __release_array_object..L27
+__release_array_object..L29:
+sub r15, 16
+mov rdi, r15
+call __dealloc
+mov ecx, dword ptr [rbp-108]
+mov rdx, qword ptr [rbp-8]
+mov rax, r14
+jmp __release_array_object..L24
+__alloc:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+__alloc..L0:
+mov r10, qword ptr [_GV___heap]
+cmp r10, 0
+je __alloc..L7
+__alloc..L1:
+mov r11, r12
+mov r12, rdi
+__alloc..L2:
+mov r8, r12
+add r8, 23
+shr r8, 4
+cmp r8, 32
+ja __alloc..L11
+__alloc..L3:
+mov rdi, r8
+sal rdi, 3
+add rdi, r10
+mov rax, qword ptr [rdi+8]
+cmp rax, 0
+jne __alloc..L13
+__alloc..L4:
+mov r12, r8
+sal r12, 4
+mov qword ptr [rbp-32], r11
+mov qword ptr [rbp-24], r13
+mov qword ptr [rbp-16], r14
+mov qword ptr [rbp-8], r15
+mov r13, r10
+__alloc..L5:
+mov rax, qword ptr [r13]
+mov rcx, rax
+add rcx, r12
+mov rdi, qword ptr [r13+8]
+cmp rcx, rdi
+ja __alloc..L14
+__alloc..L6:
+mov qword ptr [r13], rcx
+mov qword ptr [rax], r8
+add rax, 8
+mov r12, qword ptr [rbp-32]
+mov r13, qword ptr [rbp-24]
+mov r14, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L7:
+mov qword ptr [rbp-32], r12
+mov r10, 0
+mov rsi, 1048576
+mov edx, 3
+mov ecx, 34
+mov r8d, -1
+mov r9, 0
+mov r12, rdi
+mov rdi, r10
+call mmap
+cmp rax, -1
+je __alloc..L9
+__alloc..L8:
+mov qword ptr [_GV___heap], rax
+mov r10, rax
+mov rdi, rax
+add rdi, 272
+mov qword ptr [rax], rdi
+mov rsi, rax
+add rsi, 1048576
+mov qword ptr [rax+8], rsi
+mov r11, qword ptr [rbp-32]
+jmp __alloc..L2
+__alloc..L9:
+mov r12, qword ptr [rbp-32]
+__alloc..L10:
+mov rdi, offset _C_4
+call __runtime_error
+mov rax, 0
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L11:
+add r12, 8
+mov rdi, r12
+mov r12, r11
+call malloc
+cmp rax, 0
+je __alloc..L10
+__alloc..L12:
+mov qword ptr [rax], 0
+add rax, 8
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L13:
+mov r10, qword ptr [rax]
+mov qword ptr [rdi+8], r10
+mov r12, r11
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L14:
+mov rdi, 0
+mov rsi, 1048576
+mov edx, 3
+mov ecx, 34
+mov r15d, -1
+mov r9, 0
+mov r14, r8
+mov r8, r15
+call mmap
+cmp rax, -1
+je __alloc..L16
+__alloc..L15:
+mov qword ptr [r13], rax
+add rax, 1048576
+mov qword ptr [r13+8], rax
+mov r8, r14
+jmp __alloc..L5
+__alloc..L16:
+mov r12, qword ptr [rbp-32]
+mov r13, qword ptr [rbp-24]
+mov r14, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+jmp __alloc..L10
+__dealloc:
+__dealloc..L0:
+mov rax, rdi
+sub rax, 8
+mov r10, qword ptr [rax]
+cmp r10, 0
+je __dealloc..L2
+__dealloc..L1:
+mov rax, qword ptr [_GV___heap]
+sal r10, 3
+add r10, rax
+mov r11, qword ptr [r10+8]
+mov qword ptr [rdi], r11
+mov qword ptr [r10+8], rdi
+xor rax, rax
+ret
+__dealloc..L2:
+push rbp
+mov rbp, rsp
+mov rdi, rax
+call free
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+main:
+push rbp
+mov rbp, rsp
+sub rsp, 128
+main..L0:
+mov qword ptr [rbp-104], r15
+mov qword ptr [rbp-96], r12
+mov qword ptr [rbp-88], r13
+mov qword ptr [rbp-80], rbx
+lea rbx, [rbp-4]
+lea r12, [rbp-8]
+lea r15, [rbp-12]
+lea r13, [rbp-16]
+mov rdi, offset _C_0
+mov rsi, r13
+call scanf
+mov r13d, dword ptr [r13]
+mov rdi, offset _C_0
+mov rsi, r15
+call scanf
+mov r15d, dword ptr [r15]
+mov rdi, offset _C_0
+mov rsi, r12
+call scanf
+mov r12d, dword ptr [r12]
+mov rdi, offset _C_0
+mov rsi, rbx
+mov qword ptr [rbp-72], r14
+call scanf
+mov r14d, dword ptr [rbx]
+mov dword ptr [_GV_seed], r14d
+movsx r14, r13d
+mov rbx, r14
+imul rbx, 8
+add rbx, 8
+mov r11, rbx
+add r11, 16
+mov rdi, r11
+mov qword ptr [rbp-64], r11
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov qword ptr [rax], r14
+mov r10, 8
+mov dword ptr [rbp-108], r15d
+mov dword ptr [rbp-124], r12d
+mov qword ptr [rbp-56], r14
+main..L1:
+cmp r10, rbx
+jae main..L5
+main..L2:
+mov rdi, 32
+mov r14, rax
+mov r15, r10
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L19
+main..L3:
+mov rdi, rax
+mov esi, 0
+mov rdx, 16
+mov r12, rax
+call memset
+mov rax, r14
+main..L4:
+mov qword ptr [rax+r15], r12
+mov r10, r15
+add r10, 8
+jmp main..L1
+main..L5:
+cmp rax, 0
+je main..L8
+main..L6:
+mov r10, qword ptr [rax-16]
+cmp r10, -1
+je main..L8
+main..L7:
+add r10, 1
+mov qword ptr [rax-16], r10
+main..L8:
+mov rdi, rax
+mov esi, 1
+mov r15, rax
+call __release_array_object
+mov r12, r15
+add r12, 8
+mov r14d, 0
+mov qword ptr [rbp-48], rbx
+main..L9:
+cmp r14d, r13d
+jge main..L20
+main..L10:
+mov rdi, 32
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L51
+main..L11:
+mov rdi, rax
+mov esi, 0
+mov rdx, 16
+mov rbx, rax
+call memset
+main..L12:
+movsx r11, r14d
+imul r11, 8
+add r11, r12
+mov qword ptr [r11], rbx
+cmp rbx, 0
+je main..L15
+main..L13:
+mov rdi, qword ptr [rbx-16]
+cmp rdi, -1
+je main..L15
+main..L14:
+add rdi, 1
+mov qword ptr [rbx-16], rdi
+main..L15:
+mov rsi, qword ptr [r11]
+add rsi, 0
+mov dword ptr [rsi], r14d
+mov rdx, qword ptr [r11]
+add rdx, 8
+mov qword ptr [rdx], 0
+mov rcx, 0
+cmp rcx, 0
+je main..L18
+main..L16:
+mov r8, 0
+mov r9, qword ptr [r8-16]
+cmp r9, -1
+je main..L18
+main..L17:
+add r9, 1
+mov rbx, 0
+mov qword ptr [rbx-16], r9
+main..L18:
+add r14d, 1
+jmp main..L9
+main..L19:
+mov r12, 0
+mov rax, r14
+jmp main..L4
+main..L20:
+mov rdi, r15
+add rdi, 8
+mov ebx, 0
+mov qword ptr [rbp-40], r15
+mov r11d, dword ptr [rbp-108]
+main..L21:
+cmp ebx, r11d
+jge main..L52
+main..L22:
+mov eax, dword ptr [_GV_seed]
+imul eax, 1103
+add eax, 12345
+mov esi, 65536
+cdq
+idiv esi
+mov dword ptr [_GV_seed], edx
+mov ecx, dword ptr [_GV_seed]
+mov eax, ecx
+cdq
+idiv r13d
+imul ecx, 1103
+add ecx, 12345
+mov r8d, 65536
+mov rax, rcx
+mov r9, rdx
+cdq
+idiv r8d
+mov dword ptr [_GV_seed], edx
+mov eax, dword ptr [_GV_seed]
+cdq
+idiv r13d
+mov dword ptr [rbp-120], r13d
+movsx r15, r9d
+imul r15, 8
+add r15, rdi
+mov r12, qword ptr [r15]
+movsx r13, edx
+imul r13, 8
+add r13, rdi
+mov qword ptr [rbp-24], rdi
+mov r14, qword ptr [r13]
+mov rdi, 32
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L57
+main..L23:
+mov dword ptr [rbp-32], ebx
+mov rdi, rax
+mov esi, 0
+mov rdx, 16
+mov rbx, rax
+call memset
+mov eax, dword ptr [rbp-32]
+mov r10, rbx
+main..L24:
+cmp r10, 0
+setne r11b
+test r11b, r11b
+jz main..L27
+main..L25:
+mov rdi, qword ptr [r10-16]
+cmp rdi, -1
+je main..L27
+main..L26:
+add rdi, 1
+mov qword ptr [r10-16], rdi
+main..L27:
+mov rsi, r10
+add rsi, 0
+mov qword ptr [rsi], r14
+cmp r14, 0
+je main..L30
+main..L28:
+mov rdx, qword ptr [r14-16]
+cmp rdx, -1
+je main..L30
+main..L29:
+add rdx, 1
+mov qword ptr [r14-16], rdx
+main..L30:
+add r12, 8
+mov rdi, qword ptr [r12]
+mov rsi, r10
+add rsi, 8
+mov qword ptr [rsi], rdi
+cmp rdi, 0
+je main..L33
+main..L31:
+mov rdx, qword ptr [rdi-16]
+cmp rdx, -1
+je main..L33
+main..L32:
+add rdx, 1
+mov qword ptr [rdi-16], rdx
+main..L33:
+mov qword ptr [r12], r10
+test r11b, r11b
+jz main..L36
+main..L34:
+mov rcx, qword ptr [r10-16]
+cmp rcx, -1
+je main..L36
+main..L35:
+add rcx, 1
+mov qword ptr [r10-16], rcx
+main..L36:
+mov r12, qword ptr [r13]
+mov r13, qword ptr [r15]
+mov rdi, 32
+mov rbx, rax
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L77
+main..L37:
+mov rdi, rax
+mov esi, 0
+mov rdx, 16
+mov r15, rax
+call memset
+main..L38:
+cmp r15, 0
+setne r11b
+test r11b, r11b
+jz main..L41
+main..L39:
+mov rdi, qword ptr [r15-16]
+cmp rdi, -1
+je main..L41
+main..L40:
+add rdi, 1
+mov qword ptr [r15-16], rdi
+main..L41:
+mov rsi, r15
+add rsi, 0
+mov qword ptr [rsi], r13
+cmp r13, 0
+je main..L44
+main..L42:
+mov rdx, qword ptr [r13-16]
+cmp rdx, -1
+je main..L44
+main..L43:
+add rdx, 1
+mov qword ptr [r13-16], rdx
+main..L44:
+add r12, 8
+mov r13, qword ptr [r12]
+mov r14, r15
+add r14, 8
+mov qword ptr [r14], r13
+cmp r13, 0
+je main..L47
+main..L45:
+mov r10, qword ptr [r13-16]
+cmp r10, -1
+je main..L47
+main..L46:
+add r10, 1
+mov qword ptr [r13-16], r10
+main..L47:
+mov qword ptr [r12], r15
+test r11b, r11b
+jz main..L50
+main..L48:
+mov rax, qword ptr [r15-16]
+cmp rax, -1
+je main..L50
+main..L49:
+add rax, 1
+mov qword ptr [r15-16], rax
+main..L50:
+add ebx, 1
+mov r13d, dword ptr [rbp-120]
+mov r11d, dword ptr [rbp-108]
+mov rdi, qword ptr [rbp-24]
+jmp main..L21
+main..L51:
+mov rbx, 0
+jmp main..L12
+main..L52:
+mov r12, qword ptr [rbp-40]
+mov rsi, r12
+add rsi, 8
+add r12, 8
+mov r14d, 0
+mov r10d, 0
+mov edi, dword ptr [rbp-124]
+mov r15, qword ptr [rbp-56]
+mov rbx, qword ptr [rbp-48]
+mov r8, qword ptr [rbp-64]
+main..L53:
+cmp r10d, edi
+jge main..L58
+main..L54:
+mov eax, dword ptr [_GV_seed]
+imul eax, 1103
+add eax, 12345
+mov r11d, 65536
+cdq
+idiv r11d
+mov dword ptr [_GV_seed], edx
+mov eax, dword ptr [_GV_seed]
+cdq
+idiv r13d
+mov edi, 0
+mov rcx, qword ptr [rbp-80]
+mov r9, qword ptr [rbp-40]
+main..L55:
+cmp edi, r13d
+jge main..L66
+main..L56:
+movsx rcx, edi
+imul rcx, 8
+add rcx, rsi
+mov r9, qword ptr [rcx]
+add r9, 4
+mov dword ptr [r9], -1
+add edi, 1
+jmp main..L55
+main..L57:
+mov r10, 0
+mov rax, rbx
+jmp main..L24
+main..L58:
+mov rdi, 36
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r12, rax
+add r12, 8
+mov rdi, r12
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r14
+mov rbx, rax
+call snprintf
+mov rdi, r12
+call strlen
+mov qword ptr [rbx], rax
+cmp rbx, 0
+je main..L65
+main..L59:
+mov rdi, r12
+call puts
+main..L60:
+cmp rbx, 0
+je main..L64
+main..L61:
+sub rbx, 16
+mov r12, qword ptr [rbx]
+cmp r12, -1
+je main..L64
+main..L62:
+sub r12, 1
+mov qword ptr [rbx], r12
+cmp r12, 0
+jne main..L64
+main..L63:
+mov rdi, rbx
+call __dealloc
+main..L64:
+mov rdi, qword ptr [rbp-40]
+mov esi, 1
+call __release_array_object
+mov eax, 0
+mov rbx, qword ptr [rbp-80]
+mov r12, qword ptr [rbp-96]
+mov r13, qword ptr [rbp-88]
+mov r14, qword ptr [rbp-72]
+mov r15, qword ptr [rbp-104]
+mov rsp, rbp
+pop rbp
+ret
+main..L65:
+mov edi, 10
+call putchar
+jmp main..L60
+main..L66:
+mov dword ptr [rbp-116], r14d
+mov dword ptr [rbp-112], r10d
+mov dword ptr [rbp-120], r13d
+mov qword ptr [rbp-32], rsi
+mov rdi, 56
+mov r13, rdx
+mov r14, r8
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L76
+main..L67:
+mov qword ptr [rbp-24], r12
+mov rdi, rax
+mov esi, 0
+mov rdx, 40
+mov r12, rax
+call memset
+mov rax, qword ptr [rbp-24]
+mov r10, r12
+mov r12, rax
+main..L68:
+cmp r10, 0
+je main..L71
+main..L69:
+mov r11, qword ptr [r10-16]
+cmp r11, -1
+je main..L71
+main..L70:
+add r11, 1
+mov qword ptr [r10-16], r11
+main..L71:
+mov rdi, r14
+mov r14, r10
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov qword ptr [rax], r15
+mov r15, 8
+mov qword ptr [rbp-24], r12
+mov dword ptr [rbp-108], r13d
+main..L72:
+cmp r15, rbx
+jae main..L78
+main..L73:
+mov rdi, 32
+mov r13, rax
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L107
+main..L74:
+mov rdi, rax
+mov esi, 0
+mov rdx, 16
+mov r12, rax
+call memset
+mov rax, r13
+main..L75:
+mov qword ptr [rax+r15], r12
+add r15, 8
+jmp main..L72
+main..L76:
+mov r10, 0
+jmp main..L68
+main..L77:
+mov r15, 0
+jmp main..L38
+main..L78:
+mov r12, r14
+add r12, 24
+mov rdi, qword ptr [r12]
+mov esi, 1
+mov r15, rax
+call __release_array_object
+mov qword ptr [r12], r15
+cmp r15, 0
+je main..L81
+main..L79:
+mov r13, qword ptr [r15-16]
+cmp r13, -1
+je main..L81
+main..L80:
+add r13, 1
+mov qword ptr [r15-16], r13
+main..L81:
+mov esi, 1
+mov rdi, r15
+call __release_array_object
+mov r15, r14
+add r15, 32
+mov dword ptr [r15], 0
+add r14, 36
+mov dword ptr [r14], 0
+mov eax, dword ptr [rbp-108]
+movsx r10, eax
+imul r10, 8
+mov r11, qword ptr [rbp-24]
+add r11, r10
+mov rdi, qword ptr [r11]
+add rdi, 4
+mov dword ptr [rdi], 0
+mov rsi, qword ptr [r11]
+mov rdx, qword ptr [r12]
+mov ecx, dword ptr [r14]
+add rdx, 8
+movsx rcx, ecx
+imul rcx, 8
+add rdx, rcx
+mov qword ptr [rdx], rsi
+cmp rsi, 0
+je main..L84
+main..L82:
+mov rcx, qword ptr [rsi-16]
+cmp rcx, -1
+je main..L84
+main..L83:
+add rcx, 1
+mov qword ptr [rsi-16], rcx
+main..L84:
+mov r8d, dword ptr [r14]
+add r8d, 1
+mov dword ptr [r14], r8d
+mov r9d, 0
+mov r11d, 0
+mov r13d, dword ptr [rbp-120]
+mov edi, dword ptr [rbp-124]
+mov eax, dword ptr [rbp-116]
+mov r10d, dword ptr [rbp-112]
+main..L85:
+mov ebx, dword ptr [r15]
+mov esi, dword ptr [r14]
+cmp ebx, esi
+sete dl
+cmp dl, 0
+jne main..L108
+main..L86:
+mov rcx, qword ptr [r12]
+mov r8d, dword ptr [r15]
+add rcx, 8
+movsx r8, r8d
+imul r8, 8
+add rcx, r8
+mov r8, qword ptr [rcx]
+cmp r8, 0
+setne bl
+test bl, bl
+jz main..L89
+main..L87:
+mov rsi, qword ptr [r8-16]
+cmp rsi, -1
+je main..L89
+main..L88:
+add rsi, 1
+mov qword ptr [r8-16], rsi
+main..L89:
+mov edx, dword ptr [r15]
+add edx, 1
+mov dword ptr [r15], edx
+test bl, bl
+jz main..L92
+main..L90:
+mov rcx, qword ptr [r8-16]
+cmp rcx, -1
+je main..L92
+main..L91:
+add rcx, 1
+mov qword ptr [r8-16], rcx
+main..L92:
+test bl, bl
+jz main..L95
+main..L93:
+mov rbx, qword ptr [r8-16]
+cmp rbx, -1
+je main..L95
+main..L94:
+add rbx, 1
+mov qword ptr [r8-16], rbx
+main..L95:
+add r9d, 1
+mov rsi, r8
+add rsi, 4
+mov ebx, dword ptr [rsi]
+add r11d, ebx
+add r8, 8
+mov rbx, qword ptr [r8]
+cmp rbx, 0
+je main..L98
+main..L96:
+mov rdx, qword ptr [rbx-16]
+cmp rdx, -1
+je main..L98
+main..L97:
+add rdx, 1
+mov qword ptr [rbx-16], rdx
+main..L98:
+cmp rbx, 0
+je main..L85
+main..L99:
+mov rdx, rbx
+add rdx, 0
+mov rcx, qword ptr [rdx]
+add rcx, 4
+mov r8d, dword ptr [rcx]
+cmp r8d, -1
+jne main..L104
+main..L100:
+mov ecx, dword ptr [rsi]
+add ecx, 1
+mov r8, qword ptr [rdx]
+add r8, 4
+mov dword ptr [r8], ecx
+mov rdx, qword ptr [rdx]
+mov rcx, qword ptr [r12]
+mov r8d, dword ptr [r14]
+add rcx, 8
+movsx r8, r8d
+imul r8, 8
+add rcx, r8
+mov qword ptr [rcx], rdx
+cmp rdx, 0
+je main..L103
+main..L101:
+mov r8, qword ptr [rdx-16]
+cmp r8, -1
+je main..L103
+main..L102:
+add r8, 1
+mov qword ptr [rdx-16], r8
+main..L103:
+mov edx, dword ptr [r14]
+add edx, 1
+mov dword ptr [r14], edx
+main..L104:
+add rbx, 8
+mov rdx, qword ptr [rbx]
+mov rbx, rdx
+cmp rdx, 0
+je main..L98
+main..L105:
+mov r8, qword ptr [rdx-16]
+cmp r8, -1
+je main..L98
+main..L106:
+add r8, 1
+mov qword ptr [rdx-16], r8
+jmp main..L98
+main..L107:
+mov r12, 0
+mov rax, r13
+jmp main..L75
+main..L108:
+imul eax, 31
+imul r9d, 7
+add eax, r9d
+add eax, r11d
+mov ebx, 1000003
+cdq
+idiv ebx
+mov r14d, edx
+add r10d, 1
+mov r15, qword ptr [rbp-56]
+mov rbx, qword ptr [rbp-48]
+mov r8, qword ptr [rbp-64]
+mov rsi, qword ptr [rbp-32]
+mov r12, qword ptr [rbp-24]
+jmp main..L53
+_C_0:
+.byte 37, 100, 0
+_C_1:
+.byte 82, 117, 110, 116, 105, 109, 101, 32, 69, 114, 114, 111, 114, 58, 32, 0
+_C_2:
+.byte 83, 117, 98, 115, 99, 114, 105, 112, 116, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 0
+_C_3:
+.byte 78, 117, 108, 108, 32, 112, 111, 105, 110, 116, 101, 114, 0
+_C_4:
+.byte 66, 97, 100, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 0
+_C_5:
+.byte 10, 0
+_C_6:
+.byte 37, 115, 0
+.section .bss
+.balign 16
+_GV___heap:
+.zero 8
+_GV_seed:
+.zero 4
@@ -0,0 +1,1648 @@
+extern strcmp, malloc, free, scanf, puts, printf, putchar, getchar, snprintf, strlen, memcpy, sscanf, fputs, stderr, exit, memset, mmap
+global main
+	section .text
+__runtime_error:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 16
+.L0:
+	mov qword [rbp-16], r12
+	mov qword [rbp-8], r15
+	mov r15, qword [stderr]
+	mov r10, _C_1
+	mov rsi, r15
+	mov r12, rdi
+	mov rdi, r10
+	call fputs
+	mov rsi, r15
+	mov rdi, r12
+	call fputs
+	mov rdi, _C_5
+	mov rsi, r15
+	call fputs
+	mov edi, -1
+	call exit
+	mov r12, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+__release_array_internal:
+.L0:
+	cmp rdi, 0
+	je .L4
+.L1:
+	mov rax, qword [rdi-16]
+	sub rax, 1
+	mov qword [rdi-16], rax
+	cmp rax, 0
+	jne .L4
+.L2:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 128
+	cmp esi, 1
+	jg .L5
+.L3:
+	sub rdi, 16
+	call __dealloc
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+.L4:
+	xor rax, rax
+	ret
+.L5:
+	sub esi, 1
+	mov r8, qword [rdi]
+	sal r8, 3
+	add r8, 8
+	add r8, rdi
+	mov rcx, rdi
+	add rcx, 8
+	mov r9d, esi
+	sub r9d, 1
+	mov eax, r9d
+	sub eax, 1
+	mov r10d, eax
+	sub r10d, 1
+	mov qword [rbp-104], rdi
+	mov qword [rbp-96], rbx
+	mov qword [rbp-88], r12
+	mov qword [rbp-80], r13
+	mov qword [rbp-72], r14
+	mov qword [rbp-64], r15
+.L6:
+	cmp rcx, r8
+	je .L12
+.L7:
+	mov rdi, qword [rcx]
+	cmp rdi, 0
+	je .L13
+.L8:
+	mov rdx, qword [rdi-16]
+	sub rdx, 1
+	mov qword [rdi-16], rdx
+	cmp rdx, 0
+	jne .L13
+.L9:
+	cmp esi, 1
+	jg .L14
+.L10:
+	mov dword [rbp-8], r10d
+	sub rdi, 16
+	mov rbx, rcx
+	mov r12, rsi
+	mov r13, r9
+	mov r14, rax
+	mov r15, r8
+	call __dealloc
+	mov r10d, dword [rbp-8]
+	mov rax, r14
+	mov rsi, r12
+	mov r8, r15
+	mov r9, r13
+.L11:
+	mov rcx, rbx
+	add rcx, 8
+	jmp .L6
+.L12:
+	mov rdi, qword [rbp-104]
+	mov rbx, qword [rbp-96]
+	mov r12, qword [rbp-88]
+	mov r13, qword [rbp-80]
+	mov r14, qword [rbp-72]
+	mov r15, qword [rbp-64]
+	jmp .L3
+.L13:
+	mov rbx, rcx
+	jmp .L11
+.L14:
+	mov r12, qword [rdi]
+	sal r12, 3
+	add r12, 8
+	add r12, rdi
+	mov r15, rdi
+	add r15, 8
+	mov dword [rbp-116], esi
+	mov qword [rbp-56], r8
+	mov qword [rbp-48], rcx
+	mov qword [rbp-40], rdi
+.L15:
+	cmp r15, r12
+	je .L21
+.L16:
+	mov rdi, qword [r15]
+	cmp rdi, 0
+	je .L20
+.L17:
+	mov rbx, qword [rdi-16]
+	sub rbx, 1
+	mov qword [rdi-16], rbx
+	cmp rbx, 0
+	jne .L20
+.L18:
+	cmp r9d, 1
+	jg .L22
+.L19:
+	sub rdi, 16
+	mov rbx, r9
+	mov r13, rax
+	mov r14, r10
+	call __dealloc
+	mov rax, r13
+	mov r9, rbx
+	mov r10, r14
+.L20:
+	add r15, 8
+	jmp .L15
+.L21:
+	mov esi, dword [rbp-116]
+	mov r8, qword [rbp-56]
+	mov rcx, qword [rbp-48]
+	mov rdi, qword [rbp-40]
+	jmp .L10
+.L22:
+	mov r14, qword [rdi]
+	sal r14, 3
+	add r14, 8
+	add r14, rdi
+	mov r13, rdi
+	add r13, 8
+	mov dword [rbp-112], r9d
+	mov qword [rbp-32], r12
+	mov qword [rbp-24], r15
+	mov qword [rbp-16], rdi
+.L23:
+	cmp r13, r14
+	je .L29
+.L24:
+	mov rbx, qword [r13]
+	cmp rbx, 0
+	je .L28
+.L25:
+	mov rcx, qword [rbx-16]
+	sub rcx, 1
+	mov qword [rbx-16], rcx
+	cmp rcx, 0
+	jne .L28
+.L26:
+	cmp eax, 1
+	jg .L30
+.L27:
+	sub rbx, 16
+	mov rdi, rbx
+	mov r12, rax
+	mov rbx, r10
+	call __dealloc
+	mov rax, r12
+	mov r10, rbx
+.L28:
+	add r13, 8
+	jmp .L23
+.L29:
+	mov r9d, dword [rbp-112]
+	mov r12, qword [rbp-32]
+	mov r15, qword [rbp-24]
+	mov rdi, qword [rbp-16]
+	jmp .L19
+.L30:
+	mov r12, qword [rbx]
+	sal r12, 3
+	add r12, 8
+	add r12, rbx
+	mov r15, rbx
+	add r15, 8
+	mov dword [rbp-108], eax
+	mov qword [rbp-8], r14
+.L31:
+	cmp r15, r12
+	je .L33
+.L32:
+	mov rdi, qword [r15]
+	mov esi, r10d
+	mov r14, r10
+	call __release_array_internal
+	add r15, 8
+	mov r10, r14
+	jmp .L31
+.L33:
+	mov eax, dword [rbp-108]
+	mov r14, qword [rbp-8]
+	jmp .L27
+
+__alloc:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 32
+.L0:
+	mov r10, qword [_GV___heap]
+	cmp r10, 0
+	je .L7
+.L1:
+	mov r11, r12
+	mov r12, rdi
+.L2:
+	mov r8, r12
+	add r8, 23
+	shr r8, 4
+	cmp r8, 32
+	ja .L11
+.L3:
+	mov rdi, r8
+	sal rdi, 3
+	add rdi, r10
+	mov rax, qword [rdi+8]
+	cmp rax, 0
+	jne .L13
+.L4:
+	mov r12, r8
+	sal r12, 4
+	mov qword [rbp-32], r11
+	mov qword [rbp-24], r13
+	mov qword [rbp-16], r14
+	mov qword [rbp-8], r15
+	mov r13, r10
+.L5:
+	mov rax, qword [r13]
+	mov rcx, rax
+	add rcx, r12
+	mov rdi, qword [r13+8]
+	cmp rcx, rdi
+	ja .L14
+.L6:
+	mov qword [r13], rcx
+	mov qword [rax], r8
+	add rax, 8
+	mov r12, qword [rbp-32]
+	mov r13, qword [rbp-24]
+	mov r14, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L7:
+	mov qword [rbp-32], r12
+	mov r10, 0
+	mov rsi, 1048576
+	mov edx, 3
+	mov ecx, 34
+	mov r8d, -1
+	mov r9, 0
+	mov r12, rdi
+	mov rdi, r10
+	call mmap
+	cmp rax, -1
+	je .L9
+.L8:
+	mov qword [_GV___heap], rax
+	mov r10, rax
+	mov rdi, rax
+	add rdi, 272
+	mov qword [rax], rdi
+	mov rsi, rax
+	add rsi, 1048576
+	mov qword [rax+8], rsi
+	mov r11, qword [rbp-32]
+	jmp .L2
+.L9:
+	mov r12, qword [rbp-32]
+.L10:
+	mov rdi, _C_4
+	call __runtime_error
+	mov rax, 0
+	mov rsp, rbp
+	pop rbp
+	ret
+.L11:
+	add r12, 8
+	mov rdi, r12
+	mov r12, r11
+	call malloc
+	cmp rax, 0
+	je .L10
+.L12:
+	mov qword [rax], 0
+	add rax, 8
+	mov rsp, rbp
+	pop rbp
+	ret
+.L13:
+	mov r10, qword [rax]
+	mov qword [rdi+8], r10
+	mov r12, r11
+	mov rsp, rbp
+	pop rbp
+	ret
+.L14:
+	mov rdi, 0
+	mov rsi, 1048576
+	mov edx, 3
+	mov ecx, 34
+	mov r15d, -1
+	mov r9, 0
+	mov r14, r8
+	mov r8, r15
+	call mmap
+	cmp rax, -1
+	je .L16
+.L15:
+	mov qword [r13], rax
+	add rax, 1048576
+	mov qword [r13+8], rax
+	mov r8, r14
+	jmp .L5
+.L16:
+	mov r12, qword [rbp-32]
+	mov r13, qword [rbp-24]
+	mov r14, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	jmp .L10
+
+__dealloc:
+.L0:
+	mov rax, rdi
+	sub rax, 8
+	mov r10, qword [rax]
+	cmp r10, 0
+	je .L2
+.L1:
+	mov rax, qword [_GV___heap]
+	sal r10, 3
+	add r10, rax
+	mov r11, qword [r10+8]
+	mov qword [rdi], r11
+	mov qword [r10+8], rdi
+	xor rax, rax
+	ret
+.L2:
+	push rbp
+	mov rbp, rsp
+	mov rdi, rax
+	call free
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+_G_fib_i:
+.L0:
+	cmp edi, 2
+	jge .L2
+.L1:
+	mov rax, rdi
+	ret
+.L2:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 32
+	mov eax, edi
+	sub eax, 1
+	cmp eax, 2
+	jge .L6
+.L3:
+	mov rsi, rdi
+.L4:
+	sub esi, 2
+	cmp esi, 2
+	jge .L16
+.L5:
+	add eax, esi
+	mov rsp, rbp
+	pop rbp
+	ret
+.L6:
+	mov r11d, eax
+	sub r11d, 1
+	cmp r11d, 2
+	jge .L11
+.L7:
+	mov rdx, r15
+	mov rsi, rdi
+	mov r8, r12
+	mov r9, rbx
+	mov r10, r14
+.L8:
+	sub eax, 2
+	cmp eax, 2
+	jge .L27
+.L9:
+	mov rcx, rax
+	mov rbx, r9
+	mov r12, r8
+	mov r14, r10
+	mov r15, rdx
+.L10:
+	add r11d, ecx
+	mov eax, r11d
+	jmp .L4
+.L11:
+	mov r10d, r11d
+	sub r10d, 1
+	cmp r10d, 2
+	jge .L21
+.L12:
+	mov rdx, r15
+	mov r8, r12
+	mov r9, rbx
+	mov r15, r10
+	mov r12, rdi
+	mov rbx, r11
+	mov r10, r14
+	mov r14, rax
+.L13:
+	sub ebx, 2
+	cmp ebx, 2
+	jge .L34
+.L14:
+	mov rax, r14
+	mov rsi, r12
+.L15:
+	add ebx, r15d
+	mov r11d, ebx
+	jmp .L8
+.L16:
+	mov r11d, esi
+	sub r11d, 1
+	cmp r11d, 2
+	jge .L22
+.L17:
+	mov r8, r13
+	mov r9, rbx
+	mov r10, r15
+	mov r15, rax
+	mov rax, r12
+.L18:
+	sub esi, 2
+	cmp esi, 2
+	jge .L35
+.L19:
+	mov rbx, r9
+	mov r12, rax
+	mov r13, r8
+	mov rax, r15
+	mov r15, r10
+.L20:
+	add r11d, esi
+	mov esi, r11d
+	jmp .L5
+.L21:
+	mov qword [rbp-32], r12
+	mov qword [rbp-24], rbx
+	mov qword [rbp-8], r14
+	mov qword [rbp-16], r15
+	mov esi, r10d
+	sub esi, 1
+	mov rbx, r11
+	mov r12, rdi
+	mov r14, rax
+	mov r15, r10
+	mov rdi, rsi
+	call _G_fib_i
+	sub r15d, 2
+	mov rdi, r15
+	mov r15, rax
+	call _G_fib_i
+	add r15d, eax
+	mov r9, qword [rbp-24]
+	mov r8, qword [rbp-32]
+	mov r10, qword [rbp-8]
+	mov rdx, qword [rbp-16]
+	jmp .L13
+.L22:
+	mov ecx, r11d
+	sub ecx, 1
+	cmp ecx, 2
+	jge .L32
+.L23:
+	mov r8, r13
+	mov r9, rbx
+	mov r10, r15
+	mov rbx, rsi
+	mov r15, rax
+	mov rax, r12
+	mov r12, r11
+.L24:
+	sub r12d, 2
+	cmp r12d, 2
+	jge .L41
+.L25:
+	mov rsi, rbx
+.L26:
+	add ecx, r12d
+	mov r11d, ecx
+	jmp .L18
+.L27:
+	mov ebx, eax
+	sub ebx, 1
+	cmp ebx, 2
+	jge .L33
+.L28:
+	mov r12, r11
+	mov r14, rax
+	mov r15, rsi
+.L29:
+	sub r14d, 2
+	cmp r14d, 2
+	jge .L42
+.L30:
+	mov rsi, r15
+	mov r11, r12
+.L31:
+	add ebx, r14d
+	mov ecx, ebx
+	mov rbx, r9
+	mov r12, r8
+	mov r14, r10
+	mov r15, rdx
+	jmp .L10
+.L32:
+	mov qword [rbp-24], rbx
+	mov qword [rbp-32], r12
+	mov qword [rbp-16], r15
+	mov qword [rbp-8], r13
+	mov edi, ecx
+	sub edi, 1
+	mov rbx, rsi
+	mov r12, r11
+	mov r13, rcx
+	mov r15, rax
+	call _G_fib_i
+	sub r13d, 2
+	mov rdi, r13
+	mov r13, rax
+	call _G_fib_i
+	add r13d, eax
+	mov r9, qword [rbp-24]
+	mov rax, qword [rbp-32]
+	mov r8, qword [rbp-8]
+	mov r10, qword [rbp-16]
+	mov rcx, r13
+	jmp .L24
+.L33:
+	mov qword [rbp-32], r8
+	mov qword [rbp-24], r9
+	mov qword [rbp-8], r10
+	mov qword [rbp-16], rdx
+	mov edi, ebx
+	sub edi, 1
+	mov r12, r11
+	mov r14, rax
+	mov r15, rsi
+	call _G_fib_i
+	sub ebx, 2
+	mov rdi, rbx
+	mov rbx, rax
+	call _G_fib_i
+	add ebx, eax
+	mov r9, qword [rbp-24]
+	mov r8, qword [rbp-32]
+	mov r10, qword [rbp-8]
+	mov rdx, qword [rbp-16]
+	jmp .L29
+.L34:
+	mov qword [rbp-32], r8
+	mov qword [rbp-24], r9
+	mov qword [rbp-8], r10
+	mov qword [rbp-16], rdx
+	mov edi, ebx
+	sub edi, 1
+	call _G_fib_i
+	sub ebx, 2
+	mov rdi, rbx
+	mov rbx, rax
+	call _G_fib_i
+	add ebx, eax
+	mov r9, qword [rbp-24]
+	mov r8, qword [rbp-32]
+	mov r10, qword [rbp-8]
+	mov rdx, qword [rbp-16]
+	mov rax, r14
+	mov rsi, r12
+	jmp .L15
+.L35:
+	mov r13d, esi
+	sub r13d, 1
+	cmp r13d, 2
+	jge .L40
+.L36:
+	mov rbx, rsi
+	mov r12, r11
+.L37:
+	sub ebx, 2
+	cmp ebx, 2
+	jge .L43
+.L38:
+	mov r11, r12
+.L39:
+	add r13d, ebx
+	mov esi, r13d
+	mov rbx, r9
+	mov r12, rax
+	mov r13, r8
+	mov rax, r15
+	mov r15, r10
+	jmp .L20
+.L40:
+	mov qword [rbp-24], r9
+	mov qword [rbp-32], rax
+	mov qword [rbp-16], r10
+	mov qword [rbp-8], r8
+	mov edi, r13d
+	sub edi, 1
+	mov rbx, rsi
+	mov r12, r11
+	call _G_fib_i
+	sub r13d, 2
+	mov rdi, r13
+	mov r13, rax
+	call _G_fib_i
+	add r13d, eax
+	mov r9, qword [rbp-24]
+	mov rax, qword [rbp-32]
+	mov r8, qword [rbp-8]
+	mov r10, qword [rbp-16]
+	jmp .L37
+.L41:
+	mov qword [rbp-24], r9
+	mov qword [rbp-32], rax
+	mov qword [rbp-16], r10
+	mov qword [rbp-8], r8
+	mov edi, r12d
+	sub edi, 1
+	mov r13, rcx
+	call _G_fib_i
+	sub r12d, 2
+	mov rdi, r12
+	mov r12, rax
+	call _G_fib_i
+	add r12d, eax
+	mov r9, qword [rbp-24]
+	mov rax, qword [rbp-32]
+	mov r8, qword [rbp-8]
+	mov r10, qword [rbp-16]
+	mov rcx, r13
+	mov rsi, rbx
+	jmp .L26
+.L42:
+	mov qword [rbp-32], r8
+	mov qword [rbp-24], r9
+	mov qword [rbp-8], r10
+	mov qword [rbp-16], rdx
+	mov edi, r14d
+	sub edi, 1
+	call _G_fib_i
+	sub r14d, 2
+	mov rdi, r14
+	mov r14, rax
+	call _G_fib_i
+	add r14d, eax
+	mov r9, qword [rbp-24]
+	mov r8, qword [rbp-32]
+	mov r10, qword [rbp-8]
+	mov rdx, qword [rbp-16]
+	mov rsi, r15
+	mov r11, r12
+	jmp .L31
+.L43:
+	mov qword [rbp-24], r9
+	mov qword [rbp-32], rax
+	mov qword [rbp-16], r10
+	mov qword [rbp-8], r8
+	mov edi, ebx
+	sub edi, 1
+	call _G_fib_i
+	sub ebx, 2
+	mov rdi, rbx
+	mov rbx, rax
+	call _G_fib_i
+	add ebx, eax
+	mov r9, qword [rbp-24]
+	mov rax, qword [rbp-32]
+	mov r8, qword [rbp-8]
+	mov r10, qword [rbp-16]
+	mov r11, r12
+	jmp .L39
+
+_G_ack_ii:
+.L0:
+	cmp edi, 0
+	sete al
+	test al, al
+	jz .L2
+.L1:
+	add esi, 1
+	mov rax, rsi
+	ret
+.L2:
+	cmp esi, 0
+	jne .L6
+.L3:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 16
+	sub edi, 1
+	cmp edi, 0
+	jne .L11
+.L4:
+	mov eax, 2
+.L5:
+	mov rsp, rbp
+	pop rbp
+	ret
+.L6:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 16
+	mov r10d, edi
+	sub r10d, 1
+	sub esi, 1
+	test al, al
+	jz .L13
+.L7:
+	add esi, 1
+	mov rax, rsi
+.L8:
+	cmp r10d, 0
+	jne .L17
+.L9:
+	add eax, 1
+.L10:
+	mov rsp, rbp
+	pop rbp
+	ret
+.L11:
+	mov dl, 0
+	test dl, dl
+	jz .L15
+.L12:
+	sub edi, 1
+	mov esi, 1
+	call _G_ack_ii
+	jmp .L5
+.L13:
+	cmp esi, 0
+	jne .L16
+.L14:
+	mov qword [rbp-8], r15
+	mov edi, r10d
+	mov esi, 1
+	mov r15, r10
+	call _G_ack_ii
+	mov r10, qword [rbp-8]
+	xchg r15, r10
+	jmp .L8
+.L15:
+	mov qword [rbp-8], rbx
+	mov ebx, edi
+	sub ebx, 1
+	mov esi, 0
+	call _G_ack_ii
+	mov rsi, rax
+	mov rdi, rbx
+	call _G_ack_ii
+	mov rbx, qword [rbp-8]
+	jmp .L5
+.L16:
+	mov qword [rbp-8], r12
+	sub esi, 1
+	mov r12, r10
+	call _G_ack_ii
+	mov edi, r12d
+	mov rsi, rax
+	call _G_ack_ii
+	mov r10, qword [rbp-8]
+	xchg r12, r10
+	jmp .L8
+.L17:
+	cmp eax, 0
+	jne .L19
+.L18:
+	sub r10d, 1
+	mov esi, 1
+	mov rdi, r10
+	call _G_ack_ii
+	jmp .L10
+.L19:
+	mov qword [rbp-8], rbx
+	mov ebx, r10d
+	sub ebx, 1
+	sub eax, 1
+	mov rsi, rax
+	mov rdi, r10
+	call _G_ack_ii
+	mov rsi, rax
+	mov rdi, rbx
+	call _G_ack_ii
+	mov rbx, qword [rbp-8]
+	jmp .L10
+
+_G_queens_iib1b1b1:
+.L0:
+	cmp edi, esi
+	jne .L2
+.L1:
+	mov eax, 1
+	ret
+.L2:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 160
+	mov qword [rbp-128], r15
+	mov qword [rbp-120], r14
+	mov qword [rbp-112], rbx
+	mov qword [rbp-104], r13
+	mov qword [rbp-96], r12
+	mov rbx, rdx
+	add rbx, 8
+	mov r11, rcx
+	add r11, 8
+	mov r10, r8
+	add r10, 8
+	mov r13d, edi
+	add r13d, 1
+	mov r14, r8
+	add r14, 8
+	mov r15, rcx
+	add r15, 8
+	mov r12d, r13d
+	add r12d, 1
+	mov r9d, 0
+	mov eax, 0
+	xchg rdi, rsi
+	xchg rsi, rdx
+	xchg rdx, rcx
+.L3:
+	cmp r9d, edi
+	jge .L13
+.L4:
+	mov qword [rbp-88], rdx
+	mov qword [rbp-80], r8
+	movsx r8, r9d
+	imul r8, 1
+	add r8, rbx
+	mov dl, byte [r8]
+	cmp dl, 0
+	jne .L14
+.L5:
+	mov edx, ecx
+	add edx, r9d
+	movsx rdx, edx
+	imul rdx, 1
+	add rdx, r15
+	mov dl, byte [rdx]
+	cmp dl, 0
+	sete dl
+.L6:
+	test dl, dl
+	jz .L15
+.L7:
+	mov edx, ecx
+	sub edx, r9d
+	add edx, edi
+	sub edx, 1
+	movsx rdx, edx
+	imul rdx, 1
+	add rdx, r14
+	mov dl, byte [rdx]
+	cmp dl, 0
+	sete dl
+.L8:
+	test dl, dl
+	jz .L12
+.L9:
+	mov qword [rbp-72], rsi
+	mov byte [r8], 1
+	mov edx, ecx
+	add edx, r9d
+	movsx rsi, edx
+	imul rsi, 1
+	add rsi, r11
+	mov byte [rsi], 1
+	mov edx, ecx
+	sub edx, r9d
+	add edx, edi
+	sub edx, 1
+	movsx rdx, edx
+	imul rdx, 1
+	add rdx, r10
+	mov byte [rdx], 1
+	cmp r13d, edi
+	jne .L16
+.L10:
+	mov dword [rbp-152], r12d
+	mov r12d, 1
+	xchg rdx, rax
+.L11:
+	add edx, r12d
+	mov byte [r8], 0
+	mov byte [rsi], 0
+	mov byte [rax], 0
+	mov rsi, qword [rbp-72]
+	mov r12d, dword [rbp-152]
+	mov rax, rdx
+.L12:
+	add r9d, 1
+	mov rdx, qword [rbp-88]
+	mov r8, qword [rbp-80]
+	jmp .L3
+.L13:
+	mov rbx, qword [rbp-112]
+	mov r12, qword [rbp-96]
+	mov r13, qword [rbp-104]
+	mov r14, qword [rbp-120]
+	mov r15, qword [rbp-128]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L14:
+	mov dl, 0
+	jmp .L6
+.L15:
+	mov dl, 0
+	jmp .L8
+.L16:
+	mov qword [rbp-64], r15
+	mov qword [rbp-56], r14
+	mov r15d, 0
+	mov r14d, 0
+	mov dword [rbp-148], ecx
+	mov dword [rbp-144], r9d
+	mov dword [rbp-140], eax
+	mov qword [rbp-48], r8
+	mov qword [rbp-40], rsi
+	mov qword [rbp-32], rdx
+	mov rdx, qword [rbp-72]
+	mov rcx, qword [rbp-88]
+	mov r8, qword [rbp-80]
+	mov r9, r12
+.L17:
+	cmp r15d, edi
+	jge .L25
+.L18:
+	movsx r12, r15d
+	imul r12, 1
+	add r12, rbx
+	mov al, byte [r12]
+	cmp al, 0
+	jne .L26
+.L19:
+	mov esi, r13d
+	add esi, r15d
+	movsx rax, esi
+	imul rax, 1
+	add rax, r11
+	mov sil, byte [rax]
+	cmp sil, 0
+	sete al
+.L20:
+	test al, al
+	jz .L27
+.L21:
+	mov esi, r13d
+	sub esi, r15d
+	add esi, edi
+	sub esi, 1
+	movsx rax, esi
+	imul rax, 1
+	add rax, r10
+	mov sil, byte [rax]
+	cmp sil, 0
+	sete al
+.L22:
+	test al, al
+	jz .L24
+.L23:
+	mov qword [rbp-24], rbx
+	mov byte [r12], 1
+	mov esi, r13d
+	add esi, r15d
+	movsx rbx, esi
+	imul rbx, 1
+	add rbx, r11
+	mov qword [rbp-16], r11
+	mov byte [rbx], 1
+	mov r11d, r13d
+	sub r11d, r15d
+	mov dword [rbp-136], r13d
+	add r11d, edi
+	sub r11d, 1
+	movsx r13, r11d
+	imul r13, 1
+	add r13, r10
+	mov qword [rbp-8], r10
+	mov byte [r13], 1
+	mov r10d, r9d
+	mov dword [rbp-152], r9d
+	mov esi, edi
+	mov dword [rbp-132], edi
+	mov rdi, r10
+	call _G_queens_iib1b1b1
+	add r14d, eax
+	mov byte [r12], 0
+	mov byte [rbx], 0
+	mov byte [r13], 0
+	mov edi, dword [rbp-132]
+	mov rax, qword [rbp-72]
+	mov rcx, qword [rbp-88]
+	mov rdx, qword [rbp-80]
+	mov rbx, qword [rbp-24]
+	mov r11, qword [rbp-16]
+	mov r10, qword [rbp-8]
+	mov r13d, dword [rbp-136]
+	mov r9d, dword [rbp-152]
+	mov r8, rdx
+	mov rdx, rax
+.L24:
+	add r15d, 1
+	jmp .L17
+.L25:
+	mov r12d, r14d
+	mov dword [rbp-152], r9d
+	mov ecx, dword [rbp-148]
+	mov r14, qword [rbp-56]
+	mov r15, qword [rbp-64]
+	mov r9d, dword [rbp-144]
+	mov edx, dword [rbp-140]
+	mov r8, qword [rbp-48]
+	mov rsi, qword [rbp-40]
+	mov rax, qword [rbp-32]
+	jmp .L11
+.L26:
+	mov al, 0
+	jmp .L20
+.L27:
+	mov al, 0
+	jmp .L22
+
+_G_gcd_ii:
+.L0:
+	cmp esi, 0
+	jne .L2
+.L1:
+	mov rax, rdi
+	ret
+.L2:
+	push rbp
+	mov rbp, rsp
+	mov rax, rdi
+	cdq
+	idiv esi
+	cmp edx, 0
+	jne .L4
+.L3:
+	mov rax, rsi
+	mov rsp, rbp
+	pop rbp
+	ret
+.L4:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L5:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L6:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L7:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L8:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L9:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L10:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L11:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L12:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L13:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L14:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L15:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L16:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L17:
+	mov rax, rsi
+	mov rsi, rdx
+	cdq
+	idiv esi
+	cmp edx, 0
+	je .L3
+.L18:
+	mov rax, rsi
+	mov rdi, rdx
+	cdq
+	idiv edi
+	mov rsi, rdx
+	call _G_gcd_ii
+	mov rsi, rax
+	jmp .L3
+
+main:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 96
+.L0:
+	mov qword [rbp-80], r15
+	mov qword [rbp-72], r12
+	mov qword [rbp-64], r13
+	mov qword [rbp-56], rbx
+	lea r15, [rbp-4]
+	lea rbx, [rbp-8]
+	lea r12, [rbp-12]
+	lea r13, [rbp-16]
+	mov rdi, _C_0
+	mov rsi, r13
+	call scanf
+	mov r13d, dword [r13]
+	mov rdi, _C_0
+	mov rsi, r12
+	call scanf
+	mov r12d, dword [r12]
+	mov rdi, _C_0
+	mov rsi, rbx
+	call scanf
+	mov ebx, dword [rbx]
+	mov rdi, _C_0
+	mov rsi, r15
+	call scanf
+	mov r15d, dword [r15]
+	mov rdi, r13
+	call _G_fib_i
+	mov rdi, 36
+	mov r13, rax
+	mov qword [rbp-48], r14
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r14, rax
+	add r14, 8
+	mov rdi, r14
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r13
+	mov r13, rax
+	call snprintf
+	mov rdi, r14
+	call strlen
+	mov qword [r13], rax
+	cmp r13, 0
+	je .L30
+.L1:
+	mov rdi, r14
+	call puts
+.L2:
+	cmp r13, 0
+	je .L6
+.L3:
+	sub r13, 16
+	mov rax, qword [r13]
+	cmp rax, -1
+	je .L6
+.L4:
+	sub rax, 1
+	mov qword [r13], rax
+	cmp rax, 0
+	jne .L6
+.L5:
+	mov rdi, r13
+	call __dealloc
+.L6:
+	mov edi, 3
+	mov rsi, r12
+	call _G_ack_ii
+	mov rdi, 36
+	mov r12, rax
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r13, rax
+	add r13, 8
+	mov rdi, r13
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r12
+	mov r12, rax
+	call snprintf
+	mov rdi, r13
+	call strlen
+	mov qword [r12], rax
+	cmp r12, 0
+	je .L31
+.L7:
+	mov rdi, r13
+	call puts
+.L8:
+	cmp r12, 0
+	je .L12
+.L9:
+	sub r12, 16
+	mov r13, qword [r12]
+	cmp r13, -1
+	je .L12
+.L10:
+	sub r13, 1
+	mov qword [r12], r13
+	cmp r13, 0
+	jne .L12
+.L11:
+	mov rdi, r12
+	call __dealloc
+.L12:
+	movsx r14, ebx
+	mov r13, r14
+	imul r13, 1
+	add r13, 8
+	mov rdi, r13
+	add rdi, 16
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L32
+.L13:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r13
+	mov r12, rax
+	call memset
+.L14:
+	mov qword [r12], r14
+	cmp r12, 0
+	je .L17
+.L15:
+	mov r11, qword [r12-16]
+	cmp r11, -1
+	je .L17
+.L16:
+	add r11, 1
+	mov qword [r12-16], r11
+.L17:
+	mov rdi, r12
+	mov esi, 1
+	mov dword [rbp-84], r15d
+	call __release_array_internal
+	mov r13d, ebx
+	imul r13d, 2
+	movsx r14, r13d
+	mov dword [rbp-32], r13d
+	mov r15, r14
+	imul r15, 1
+	add r15, 8
+	mov r13, r15
+	add r13, 16
+	mov rdi, r13
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L33
+.L18:
+	mov dword [rbp-24], ebx
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r15
+	mov rbx, rax
+	call memset
+	mov eax, dword [rbp-24]
+	mov r10, rbx
+	mov rbx, rax
+.L19:
+	mov qword [r10], r14
+	cmp r10, 0
+	je .L22
+.L20:
+	mov r11, qword [r10-16]
+	cmp r11, -1
+	je .L22
+.L21:
+	add r11, 1
+	mov qword [r10-16], r11
+.L22:
+	mov rdi, r10
+	mov qword [rbp-40], r10
+	mov esi, 1
+	call __release_array_internal
+	mov rdi, r13
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L34
+.L23:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r15
+	mov r15, rax
+	call memset
+.L24:
+	mov qword [r15], r14
+	cmp r15, 0
+	je .L27
+.L25:
+	mov r11, qword [r15-16]
+	cmp r11, -1
+	je .L27
+.L26:
+	add r11, 1
+	mov qword [r15-16], r11
+.L27:
+	mov rdi, r15
+	mov esi, 1
+	call __release_array_internal
+	mov rax, r12
+	add rax, 8
+	mov r11d, 0
+	mov r10, qword [rbp-56]
+	mov r14, qword [rbp-72]
+	mov rdi, qword [rbp-64]
+	mov rsi, qword [rbp-48]
+	mov rdx, qword [rbp-80]
+	mov r13d, dword [rbp-84]
+	mov r8d, dword [rbp-32]
+	mov r9, qword [rbp-40]
+.L28:
+	cmp r11d, ebx
+	jge .L35
+.L29:
+	movsx r10, r11d
+	imul r10, 1
+	add r10, rax
+	mov byte [r10], 0
+	add r11d, 1
+	jmp .L28
+.L30:
+	mov edi, 10
+	call putchar
+	jmp .L2
+.L31:
+	mov edi, 10
+	call putchar
+	jmp .L8
+.L32:
+	mov r12, 0
+	jmp .L14
+.L33:
+	mov r10, 0
+	jmp .L19
+.L34:
+	mov r15, 0
+	jmp .L24
+.L35:
+	mov r10, r9
+	add r10, 8
+	mov rdi, r15
+	add rdi, 8
+	mov r11d, 0
+.L36:
+	cmp r11d, r8d
+	jge .L38
+.L37:
+	movsx rdx, r11d
+	imul rdx, 1
+	mov rsi, r10
+	add rsi, rdx
+	mov byte [rsi], 0
+	add rdx, rdi
+	mov byte [rdx], 0
+	add r11d, 1
+	jmp .L36
+.L38:
+	mov edi, 0
+	mov rdx, r12
+	mov rcx, r9
+	mov r8, r15
+	mov rsi, rbx
+	mov rbx, r9
+	call _G_queens_iib1b1b1
+	mov rdi, 36
+	mov r14, rax
+	mov qword [rbp-32], r15
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r15, rax
+	add r15, 8
+	mov rdi, r15
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r14
+	mov r14, rax
+	call snprintf
+	mov rdi, r15
+	call strlen
+	mov qword [r14], rax
+	cmp r14, 0
+	je .L49
+.L39:
+	mov rdi, r15
+	call puts
+.L40:
+	cmp r14, 0
+	je .L44
+.L41:
+	sub r14, 16
+	mov r15, qword [r14]
+	cmp r15, -1
+	je .L44
+.L42:
+	sub r15, 1
+	mov qword [r14], r15
+	cmp r15, 0
+	jne .L44
+.L43:
+	mov rdi, r14
+	call __dealloc
+.L44:
+	mov ebx, 1
+	mov r14d, 0
+	mov qword [rbp-24], r12
+.L45:
+	cmp ebx, r13d
+	jg .L50
+.L46:
+	mov r15d, 1
+.L47:
+	cmp r15d, r13d
+	jg .L58
+.L48:
+	mov edi, ebx
+	mov esi, r15d
+	call _G_gcd_ii
+	add r14d, eax
+	mov r11d, 1000003
+	mov rax, r14
+	cdq
+	idiv r11d
+	mov r14d, edx
+	add r15d, 1
+	jmp .L47
+.L49:
+	mov edi, 10
+	call putchar
+	jmp .L40
+.L50:
+	mov rdi, 36
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r12, rax
+	add r12, 8
+	mov rdi, r12
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r14
+	mov rbx, rax
+	call snprintf
+	mov rdi, r12
+	call strlen
+	mov qword [rbx], rax
+	cmp rbx, 0
+	je .L57
+.L51:
+	mov rdi, r12
+	call puts
+.L52:
+	cmp rbx, 0
+	je .L56
+.L53:
+	sub rbx, 16
+	mov r12, qword [rbx]
+	cmp r12, -1
+	je .L56
+.L54:
+	sub r12, 1
+	mov qword [rbx], r12
+	cmp r12, 0
+	jne .L56
+.L55:
+	mov rdi, rbx
+	call __dealloc
+.L56:
+	mov rdi, qword [rbp-24]
+	mov esi, 1
+	call __release_array_internal
+	mov rdi, qword [rbp-40]
+	mov esi, 1
+	call __release_array_internal
+	mov rdi, qword [rbp-32]
+	mov esi, 1
+	call __release_array_internal
+	mov eax, 0
+	mov rbx, qword [rbp-56]
+	mov r12, qword [rbp-72]
+	mov r13, qword [rbp-64]
+	mov r14, qword [rbp-48]
+	mov r15, qword [rbp-80]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L57:
+	mov edi, 10
+	call putchar
+	jmp .L52
+.L58:
+	add ebx, 1
+	jmp .L45
+
+_C_0:
+	db '%d', 0
+
+_C_1:
+	db 'Runtime Error: ', 0
+
+_C_2:
+	db 'Subscript out of range', 0
+
+_C_3:
+	db 'Null pointer', 0
+
+_C_4:
+	db 'Bad allocation', 0
+
+_C_5:
+	db 10, 0
+
+_C_6:
+	db '%s', 0
+
+	section .bss
+	align 16
+_GV___heap:
+	resb 8
+
@@ -0,0 +1,1631 @@
+.intel_syntax noprefix
+.globl main
+.section .text
+__runtime_error:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+__runtime_error..L0:
+mov qword ptr [rbp-16], r12
+mov qword ptr [rbp-8], r15
+mov r15, qword ptr [stderr]
+mov r10, offset _C_1
+mov rsi, r15
+mov r12, rdi
+mov rdi, r10
+call fputs
+mov rsi, r15
+mov rdi, r12
+call fputs
+mov rdi, offset _C_5
+mov rsi, r15
+call fputs
+mov edi, -1
+call exit
+mov r12, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+__release_array_internal:
+__release_array_internal..L0:
+cmp rdi, 0
+je __release_array_internal..L4
+__release_array_internal..L1:
+mov rax, qword ptr [rdi-16]
+sub rax, 1
+mov qword ptr [rdi-16], rax
+cmp rax, 0
+jne __release_array_internal..L4
+__release_array_internal..L2:
+push rbp
+mov rbp, rsp
+sub rsp, 128
+cmp esi, 1
+jg __release_array_internal..L5
+__release_array_internal..L3:
+sub rdi, 16
+call __dealloc
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+__release_array_internal..L4:
+xor rax, rax
+ret
+__release_array_internal..L5:
+sub esi, 1
+mov r8, qword ptr [rdi]
+sal r8, 3
+add r8, 8
+add r8, rdi
+mov rcx, rdi
+add rcx, 8
+mov r9d, esi
+sub r9d, 1
+mov eax, r9d
+sub eax, 1
+mov r10d, eax
+sub r10d, 1
+mov qword ptr [rbp-104], rdi
+mov qword ptr [rbp-96], rbx
+mov qword ptr [rbp-88], r12
+mov qword ptr [rbp-80], r13
+mov qword ptr [rbp-72], r14
+mov qword ptr [rbp-64], r15
+__release_array_internal..L6:
+cmp rcx, r8
+je __release_array_internal..L12
+__release_array_internal..L7:
+mov rdi, qword ptr [rcx]
+cmp rdi, 0
+je __release_array_internal..L13
+__release_array_internal..L8:
+mov rdx, qword ptr [rdi-16]
+sub rdx, 1
+mov qword ptr [rdi-16], rdx
+cmp rdx, 0
+jne __release_array_internal..L13
+__release_array_internal..L9:
+cmp esi, 1
+jg __release_array_internal..L14
+__release_array_internal..L10:
+mov dword ptr [rbp-8], r10d
+sub rdi, 16
+mov rbx, rcx
+mov r12, rsi
+mov r13, r9
+mov r14, rax
+mov r15, r8
+call __dealloc
+mov r10d, dword ptr [rbp-8]
+mov rax, r14
+mov rsi, r12
+mov r8, r15
+mov r9, r13
+__release_array_internal..L11:
+mov rcx, rbx
+add rcx, 8
+jmp __release_array_internal..L6
+__release_array_internal..L12:
+mov rdi, qword ptr [rbp-104]
+mov rbx, qword ptr [rbp-96]
+mov r12, qword ptr [rbp-88]
+mov r13, qword ptr [rbp-80]
+mov r14, qword ptr [rbp-72]
+mov r15, qword ptr [rbp-64]
+jmp __release_array_internal..L3
+__release_array_internal..L13:
+mov rbx, rcx
+jmp __release_array_internal..L11
+__release_array_internal..L14:
+mov r12, qword ptr [rdi]
+sal r12, 3
+add r12, 8
+add r12, rdi
+mov r15, rdi
+add r15, 8
+mov dword ptr [rbp-116], esi
+mov qword ptr [rbp-56], r8
+mov qword ptr [rbp-48], rcx
+mov qword ptr [rbp-40], rdi
+__release_array_internal..L15:
+cmp r15, r12
+je __release_array_internal..L21
+__release_array_internal..L16:
+mov rdi, qword ptr [r15]
+cmp rdi, 0
+je __release_array_internal..L20
+__release_array_internal..L17:
+mov rbx, qword ptr [rdi-16]
+sub rbx, 1
+mov qword ptr [rdi-16], rbx
+cmp rbx, 0
+jne __release_array_internal..L20
+__release_array_internal..L18:
+cmp r9d, 1
+jg __release_array_internal..L22
+__release_array_internal..L19:
+sub rdi, 16
+mov rbx, r9
+mov r13, rax
+mov r14, r10
+call __dealloc
+mov rax, r13
+mov r9, rbx
+mov r10, r14
+__release_array_internal..L20:
+add r15, 8
+jmp __release_array_internal..L15
+__release_array_internal..L21:
+mov esi, dword ptr [rbp-116]
+mov r8, qword ptr [rbp-56]
+mov rcx, qword ptr [rbp-48]
+mov rdi, qword ptr [rbp-40]
+jmp __release_array_internal..L10
+__release_array_internal..L22:
+mov r14, qword ptr [rdi]
+sal r14, 3
+add r14, 8
+add r14, rdi
+mov r13, rdi
+add r13, 8
+mov dword ptr [rbp-112], r9d
+mov qword ptr [rbp-32], r12
+mov qword ptr [rbp-24], r15
+mov qword ptr [rbp-16], rdi
+__release_array_internal..L23:
+cmp r13, r14
+je __release_array_internal..L29
+__release_array_internal..L24:
+mov rbx, qword ptr [r13]
+cmp rbx, 0
+je __release_array_internal..L28
+__release_array_internal..L25:
+mov rcx, qword ptr [rbx-16]
+sub rcx, 1
+mov qword ptr [rbx-16], rcx
+cmp rcx, 0
+jne __release_array_internal..L28
+__release_array_internal..L26:
+cmp eax, 1
+jg __release_array_internal..L30
+__release_array_internal..L27:
+sub rbx, 16
+mov rdi, rbx
+mov r12, rax
+mov rbx, r10
+call __dealloc
+mov rax, r12
+mov r10, rbx
+__release_array_internal..L28:
+add r13, 8
+jmp __release_array_internal..L23
+__release_array_internal..L29:
+mov r9d, dword ptr [rbp-112]
+mov r12, qword ptr [rbp-32]
+mov r15, qword ptr [rbp-24]
+mov rdi, qword ptr [rbp-16]
+jmp __release_array_internal..L19
+__release_array_internal..L30:
+mov r12, qword ptr [rbx]
+sal r12, 3
+add r12, 8
+add r12, rbx
+mov r15, rbx
+add r15, 8
+mov dword ptr [rbp-108], eax
+mov qword ptr [rbp-8], r14
+__release_array_internal..L31:
+cmp r15, r12
+je __release_array_internal..L33
+__release_array_internal..L32:
+mov rdi, qword ptr [r15]
+mov esi, r10d
+mov r14, r10
+call __release_array_internal
+add r15, 8
+mov r10, r14
+jmp __release_array_internal..L31
+__release_array_internal..L33:
+mov eax, dword ptr [rbp-108]
+mov r14, qword ptr [rbp-8]
+jmp __release_array_internal..L27
+__alloc:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+__alloc..L0:
+mov r10, qword ptr [_GV___heap]
+cmp r10, 0
+je __alloc..L7
+__alloc..L1:
+mov r11, r12
+mov r12, rdi
+__alloc..L2:
+mov r8, r12
+add r8, 23
+shr r8, 4
+cmp r8, 32
+ja __alloc..L11
+__alloc..L3:
+mov rdi, r8
+sal rdi, 3
+add rdi, r10
+mov rax, qword ptr [rdi+8]
+cmp rax, 0
+jne __alloc..L13
+__alloc..L4:
+mov r12, r8
+sal r12, 4
+mov qword ptr [rbp-32], r11
+mov qword ptr [rbp-24], r13
+mov qword ptr [rbp-16], r14
+mov qword ptr [rbp-8], r15
+mov r13, r10
+__alloc..L5:
+mov rax, qword ptr [r13]
+mov rcx, rax
+add rcx, r12
+mov rdi, qword ptr [r13+8]
+cmp rcx, rdi
+ja __alloc..L14
+__alloc..L6:
+mov qword ptr [r13], rcx
+mov qword ptr [rax], r8
+add rax, 8
+mov r12, qword ptr [rbp-32]
+mov r13, qword ptr [rbp-24]
+mov r14, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L7:
+mov qword ptr [rbp-32], r12
+mov r10, 0
+mov rsi, 1048576
+mov edx, 3
+mov ecx, 34
+mov r8d, -1
+mov r9, 0
+mov r12, rdi
+mov rdi, r10
+call mmap
+cmp rax, -1
+je __alloc..L9
+__alloc..L8:
+mov qword ptr [_GV___heap], rax
+mov r10, rax
+mov rdi, rax
+add rdi, 272
+mov qword ptr [rax], rdi
+mov rsi, rax
+add rsi, 1048576
+mov qword ptr [rax+8], rsi
+mov r11, qword ptr [rbp-32]
+jmp __alloc..L2
+__alloc..L9:
+mov r12, qword ptr [rbp-32]
+__alloc..L10:
+mov rdi, offset _C_4
+call __runtime_error
+mov rax, 0
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L11:
+add r12, 8
+mov rdi, r12
+mov r12, r11
+call malloc
+cmp rax, 0
+je __alloc..L10
+__alloc..L12:
+mov qword ptr [rax], 0
+add rax, 8
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L13:
+mov r10, qword ptr [rax]
+mov qword ptr [rdi+8], r10
+mov r12, r11
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L14:
+mov rdi, 0
+mov rsi, 1048576
+mov edx, 3
+mov ecx, 34
+mov r15d, -1
+mov r9, 0
+mov r14, r8
+mov r8, r15
+call mmap
+cmp rax, -1
+je __alloc..L16
+__alloc..L15:
+mov qword ptr [r13], rax
+add rax, 1048576
+mov qword ptr [r13+8], rax
+mov r8, r14
+jmp __alloc..L5
+__alloc..L16:
+mov r12, qword ptr [rbp-32]
+mov r13, qword ptr [rbp-24]
+mov r14, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+jmp __alloc..L10
+__dealloc:
+__dealloc..L0:
+mov rax, rdi
+sub rax, 8
+mov r10, qword ptr [rax]
+cmp r10, 0
+je __dealloc..L2
+__dealloc..L1:
+mov rax, qword ptr [_GV___heap]
+sal r10, 3
+add r10, rax
+mov r11, qword ptr [r10+8]
+mov qword ptr [rdi], r11
+mov qword ptr [r10+8], rdi
+xor rax, rax
+ret
+__dealloc..L2:
+push rbp
+mov rbp, rsp
+mov rdi, rax
+call free
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+_G_fib_i:
+_G_fib_i..L0:
+cmp edi, 2
+jge _G_fib_i..L2
+_G_fib_i..L1:
+mov rax, rdi
+ret
+_G_fib_i..L2:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+mov eax, edi
+sub eax, 1
+cmp eax, 2
+jge _G_fib_i..L6
+_G_fib_i..L3:
+mov rsi, rdi
+_G_fib_i..L4:
+sub esi, 2
+cmp esi, 2
+jge _G_fib_i..L16
+_G_fib_i..L5:
+add eax, esi
+mov rsp, rbp
+pop rbp
+ret
+_G_fib_i..L6:
+mov r11d, eax
+sub r11d, 1
+cmp r11d, 2
+jge _G_fib_i..L11
+_G_fib_i..L7:
+mov rdx, r15
+mov rsi, rdi
+mov r8, r12
+mov r9, rbx
+mov r10, r14
+_G_fib_i..L8:
+sub eax, 2
+cmp eax, 2
+jge _G_fib_i..L27
+_G_fib_i..L9:
+mov rcx, rax
+mov rbx, r9
+mov r12, r8
+mov r14, r10
+mov r15, rdx
+_G_fib_i..L10:
+add r11d, ecx
+mov eax, r11d
+jmp _G_fib_i..L4
+_G_fib_i..L11:
+mov r10d, r11d
+sub r10d, 1
+cmp r10d, 2
+jge _G_fib_i..L21
+_G_fib_i..L12:
+mov rdx, r15
+mov r8, r12
+mov r9, rbx
+mov r15, r10
+mov r12, rdi
+mov rbx, r11
+mov r10, r14
+mov r14, rax
+_G_fib_i..L13:
+sub ebx, 2
+cmp ebx, 2
+jge _G_fib_i..L34
+_G_fib_i..L14:
+mov rax, r14
+mov rsi, r12
+_G_fib_i..L15:
+add ebx, r15d
+mov r11d, ebx
+jmp _G_fib_i..L8
+_G_fib_i..L16:
+mov r11d, esi
+sub r11d, 1
+cmp r11d, 2
+jge _G_fib_i..L22
+_G_fib_i..L17:
+mov r8, r13
+mov r9, rbx
+mov r10, r15
+mov r15, rax
+mov rax, r12
+_G_fib_i..L18:
+sub esi, 2
+cmp esi, 2
+jge _G_fib_i..L35
+_G_fib_i..L19:
+mov rbx, r9
+mov r12, rax
+mov r13, r8
+mov rax, r15
+mov r15, r10
+_G_fib_i..L20:
+add r11d, esi
+mov esi, r11d
+jmp _G_fib_i..L5
+_G_fib_i..L21:
+mov qword ptr [rbp-32], r12
+mov qword ptr [rbp-24], rbx
+mov qword ptr [rbp-8], r14
+mov qword ptr [rbp-16], r15
+mov esi, r10d
+sub esi, 1
+mov rbx, r11
+mov r12, rdi
+mov r14, rax
+mov r15, r10
+mov rdi, rsi
+call _G_fib_i
+sub r15d, 2
+mov rdi, r15
+mov r15, rax
+call _G_fib_i
+add r15d, eax
+mov r9, qword ptr [rbp-24]
+mov r8, qword ptr [rbp-32]
+mov r10, qword ptr [rbp-8]
+mov rdx, qword ptr [rbp-16]
+jmp _G_fib_i..L13
+_G_fib_i..L22:
+mov ecx, r11d
+sub ecx, 1
+cmp ecx, 2
+jge _G_fib_i..L32
+_G_fib_i..L23:
+mov r8, r13
+mov r9, rbx
+mov r10, r15
+mov rbx, rsi
+mov r15, rax
+mov rax, r12
+mov r12, r11
+_G_fib_i..L24:
+sub r12d, 2
+cmp r12d, 2
+jge _G_fib_i..L41
+_G_fib_i..L25:
+mov rsi, rbx
+_G_fib_i..L26:
+add ecx, r12d
+mov r11d, ecx
+jmp _G_fib_i..L18
+_G_fib_i..L27:
+mov ebx, eax
+sub ebx, 1
+cmp ebx, 2
+jge _G_fib_i..L33
+_G_fib_i..L28:
+mov r12, r11
+mov r14, rax
+mov r15, rsi
+_G_fib_i..L29:
+sub r14d, 2
+cmp r14d, 2
+jge _G_fib_i..L42
+_G_fib_i..L30:
+mov rsi, r15
+mov r11, r12
+_G_fib_i..L31:
+add ebx, r14d
+mov ecx, ebx
+mov rbx, r9
+mov r12, r8
+mov r14, r10
+mov r15, rdx
+jmp _G_fib_i..L10
+_G_fib_i..L32:
+mov qword ptr [rbp-24], rbx
+mov qword ptr [rbp-32], r12
+mov qword ptr [rbp-16], r15
+mov qword ptr [rbp-8], r13
+mov edi, ecx
+sub edi, 1
+mov rbx, rsi
+mov r12, r11
+mov r13, rcx
+mov r15, rax
+call _G_fib_i
+sub r13d, 2
+mov rdi, r13
+mov r13, rax
+call _G_fib_i
+add r13d, eax
+mov r9, qword ptr [rbp-24]
+mov rax, qword ptr [rbp-32]
+mov r8, qword ptr [rbp-8]
+mov r10, qword ptr [rbp-16]
+mov rcx, r13
+jmp _G_fib_i..L24
+_G_fib_i..L33:
+mov qword ptr [rbp-32], r8
+mov qword ptr [rbp-24], r9
+mov qword ptr [rbp-8], r10
+mov qword ptr [rbp-16], rdx
+mov edi, ebx
+sub edi, 1
+mov r12, r11
+mov r14, rax
+mov r15, rsi
+call _G_fib_i
+sub ebx, 2
+mov rdi, rbx
+mov rbx, rax
+call _G_fib_i
+add ebx, eax
+mov r9, qword ptr [rbp-24]
+mov r8, qword ptr [rbp-32]
+mov r10, qword ptr [rbp-8]
+mov rdx, qword ptr [rbp-16]
+jmp _G_fib_i..L29
+_G_fib_i..L34:
+mov qword ptr [rbp-32], r8
+mov qword ptr [rbp-24], r9
+mov qword ptr [rbp-8], r10
+mov qword ptr [rbp-16], rdx
+mov edi, ebx
+sub edi, 1
+call _G_fib_i
+sub ebx, 2
+mov rdi, rbx
+mov rbx, rax
+call _G_fib_i
+add ebx, eax
+mov r9, qword ptr [rbp-24]
+mov r8, qword ptr [rbp-32]
+mov r10, qword ptr [rbp-8]
+mov rdx, qword ptr [rbp-16]
+mov rax, r14
+mov rsi, r12
+jmp _G_fib_i..L15
+_G_fib_i..L35:
+mov r13d, esi
+sub r13d, 1
+cmp r13d, 2
+jge _G_fib_i..L40
+_G_fib_i..L36:
+mov rbx, rsi
+mov r12, r11
+_G_fib_i..L37:
+sub ebx, 2
+cmp ebx, 2
+jge _G_fib_i..L43
+_G_fib_i..L38:
+mov r11, r12
+_G_fib_i..L39:
+add r13d, ebx
+mov esi, r13d
+mov rbx, r9
+mov r12, rax
+mov r13, r8
+mov rax, r15
+mov r15, r10
+jmp _G_fib_i..L20
+_G_fib_i..L40:
+mov qword ptr [rbp-24], r9
+mov qword ptr [rbp-32], rax
+mov qword ptr [rbp-16], r10
+mov qword ptr [rbp-8], r8
+mov edi, r13d
+sub edi, 1
+mov rbx, rsi
+mov r12, r11
+call _G_fib_i
+sub r13d, 2
+mov rdi, r13
+mov r13, rax
+call _G_fib_i
+add r13d, eax
+mov r9, qword ptr [rbp-24]
+mov rax, qword ptr [rbp-32]
+mov r8, qword ptr [rbp-8]
+mov r10, qword ptr [rbp-16]
+jmp _G_fib_i..L37
+_G_fib_i..L41:
+mov qword ptr [rbp-24], r9
+mov qword ptr [rbp-32], rax
+mov qword ptr [rbp-16], r10
+mov qword ptr [rbp-8], r8
+mov edi, r12d
+sub edi, 1
+mov r13, rcx
+call _G_fib_i
+sub r12d, 2
+mov rdi, r12
+mov r12, rax
+call _G_fib_i
+add r12d, eax
+mov r9, qword ptr [rbp-24]
+mov rax, qword ptr [rbp-32]
+mov r8, qword ptr [rbp-8]
+mov r10, qword ptr [rbp-16]
+mov rcx, r13
+mov rsi, rbx
+jmp _G_fib_i..L26
+_G_fib_i..L42:
+mov qword ptr [rbp-32], r8
+mov qword ptr [rbp-24], r9
+mov qword ptr [rbp-8], r10
+mov qword ptr [rbp-16], rdx
+mov edi, r14d
+sub edi, 1
+call _G_fib_i
+sub r14d, 2
+mov rdi, r14
+mov r14, rax
+call _G_fib_i
+add r14d, eax
+mov r9, qword ptr [rbp-24]
+mov r8, qword ptr [rbp-32]
+mov r10, qword ptr [rbp-8]
+mov rdx, qword ptr [rbp-16]
+mov rsi, r15
+mov r11, r12
+jmp _G_fib_i..L31
+_G_fib_i..L43:
+mov qword ptr [rbp-24], r9
+mov qword ptr [rbp-32], rax
+mov qword ptr [rbp-16], r10
+mov qword ptr [rbp-8], r8
+mov edi, ebx
+sub edi, 1
+call _G_fib_i
+sub ebx, 2
+mov rdi, rbx
+mov rbx, rax
+call _G_fib_i
+add ebx, eax
+mov r9, qword ptr [rbp-24]
+mov rax, qword ptr [rbp-32]
+mov r8, qword ptr [rbp-8]
+mov r10, qword ptr [rbp-16]
+mov r11, r12
+jmp _G_fib_i..L39
+_G_ack_ii:
+_G_ack_ii..L0:
+cmp edi, 0
+sete al
+test al, al
+jz _G_ack_ii..L2
+_G_ack_ii..L1:
+add esi, 1
+mov rax, rsi
+ret
+_G_ack_ii..L2:
+cmp esi, 0
+jne _G_ack_ii..L6
+_G_ack_ii..L3:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+sub edi, 1
+cmp edi, 0
+jne _G_ack_ii..L11
+_G_ack_ii..L4:
+mov eax, 2
+_G_ack_ii..L5:
+mov rsp, rbp
+pop rbp
+ret
+_G_ack_ii..L6:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+mov r10d, edi
+sub r10d, 1
+sub esi, 1
+test al, al
+jz _G_ack_ii..L13
+_G_ack_ii..L7:
+add esi, 1
+mov rax, rsi
+_G_ack_ii..L8:
+cmp r10d, 0
+jne _G_ack_ii..L17
+_G_ack_ii..L9:
+add eax, 1
+_G_ack_ii..L10:
+mov rsp, rbp
+pop rbp
+ret
+_G_ack_ii..L11:
+mov dl, 0
+test dl, dl
+jz _G_ack_ii..L15
+_G_ack_ii..L12:
+sub edi, 1
+mov esi, 1
+call _G_ack_ii
+jmp _G_ack_ii..L5
+_G_ack_ii..L13:
+cmp esi, 0
+jne _G_ack_ii..L16
+_G_ack_ii..L14:
+mov qword ptr [rbp-8], r15
+mov edi, r10d
+mov esi, 1
+mov r15, r10
+call _G_ack_ii
+mov r10, qword ptr [rbp-8]
+xchg r15, r10
+jmp _G_ack_ii..L8
+_G_ack_ii..L15:
+mov qword ptr [rbp-8], rbx
+mov ebx, edi
+sub ebx, 1
+mov esi, 0
+call _G_ack_ii
+mov rsi, rax
+mov rdi, rbx
+call _G_ack_ii
+mov rbx, qword ptr [rbp-8]
+jmp _G_ack_ii..L5
+_G_ack_ii..L16:
+mov qword ptr [rbp-8], r12
+sub esi, 1
+mov r12, r10
+call _G_ack_ii
+mov edi, r12d
+mov rsi, rax
+call _G_ack_ii
+mov r10, qword ptr [rbp-8]
+xchg r12, r10
+jmp _G_ack_ii..L8
+_G_ack_ii..L17:
+cmp eax, 0
+jne _G_ack_ii..L19
+_G_ack_ii..L18:
+sub r10d, 1
+mov esi, 1
+mov rdi, r10
+call _G_ack_ii
+jmp _G_ack_ii..L10
+_G_ack_ii..L19:
+mov qword ptr [rbp-8], rbx
+mov ebx, r10d
+sub ebx, 1
+sub eax, 1
+mov rsi, rax
+mov rdi, r10
+call _G_ack_ii
+mov rsi, rax
+mov rdi, rbx
+call _G_ack_ii
+mov rbx, qword ptr [rbp-8]
+jmp _G_ack_ii..L10
+_G_queens_iib1b1b1:
+_G_queens_iib1b1b1..L0:
+cmp edi, esi
+jne _G_queens_iib1b1b1..L2
+_G_queens_iib1b1b1..L1:
+mov eax, 1
+ret
+_G_queens_iib1b1b1..L2:
+push rbp
+mov rbp, rsp
+sub rsp, 160
+mov qword ptr [rbp-128], r15
+mov qword ptr [rbp-120], r14
+mov qword ptr [rbp-112], rbx
+mov qword ptr [rbp-104], r13
+mov qword ptr [rbp-96], r12
+mov rbx, rdx
+add rbx, 8
+mov r11, rcx
+add r11, 8
+mov r10, r8
+add r10, 8
+mov r13d, edi
+add r13d, 1
+mov r14, r8
+add r14, 8
+mov r15, rcx
+add r15, 8
+mov r12d, r13d
+add r12d, 1
+mov r9d, 0
+mov eax, 0
+xchg rdi, rsi
+xchg rsi, rdx
+xchg rdx, rcx
+_G_queens_iib1b1b1..L3:
+cmp r9d, edi
+jge _G_queens_iib1b1b1..L13
+_G_queens_iib1b1b1..L4:
+mov qword ptr [rbp-88], rdx
+mov qword ptr [rbp-80], r8
+movsx r8, r9d
+imul r8, 1
+add r8, rbx
+mov dl, byte ptr [r8]
+cmp dl, 0
+jne _G_queens_iib1b1b1..L14
+_G_queens_iib1b1b1..L5:
+mov edx, ecx
+add edx, r9d
+movsx rdx, edx
+imul rdx, 1
+add rdx, r15
+mov dl, byte ptr [rdx]
+cmp dl, 0
+sete dl
+_G_queens_iib1b1b1..L6:
+test dl, dl
+jz _G_queens_iib1b1b1..L15
+_G_queens_iib1b1b1..L7:
+mov edx, ecx
+sub edx, r9d
+add edx, edi
+sub edx, 1
+movsx rdx, edx
+imul rdx, 1
+add rdx, r14
+mov dl, byte ptr [rdx]
+cmp dl, 0
+sete dl
+_G_queens_iib1b1b1..L8:
+test dl, dl
+jz _G_queens_iib1b1b1..L12
+_G_queens_iib1b1b1..L9:
+mov qword ptr [rbp-72], rsi
+mov byte ptr [r8], 1
+mov edx, ecx
+add edx, r9d
+movsx rsi, edx
+imul rsi, 1
+add rsi, r11
+mov byte ptr [rsi], 1
+mov edx, ecx
+sub edx, r9d
+add edx, edi
+sub edx, 1
+movsx rdx, edx
+imul rdx, 1
+add rdx, r10
+mov byte ptr [rdx], 1
+cmp r13d, edi
+jne _G_queens_iib1b1b1..L16
+_G_queens_iib1b1b1..L10:
+mov dword ptr [rbp-152], r12d
+mov r12d, 1
+xchg rdx, rax
+_G_queens_iib1b1b1..L11:
+add edx, r12d
+mov byte ptr [r8], 0
+mov byte ptr [rsi], 0
+mov byte ptr [rax], 0
+mov rsi, qword ptr [rbp-72]
+mov r12d, dword ptr [rbp-152]
+mov rax, rdx
+_G_queens_iib1b1b1..L12:
+add r9d, 1
+mov rdx, qword ptr [rbp-88]
+mov r8, qword ptr [rbp-80]
+jmp _G_queens_iib1b1b1..L3
+_G_queens_iib1b1b1..L13:
+mov rbx, qword ptr [rbp-112]
+mov r12, qword ptr [rbp-96]
+mov r13, qword ptr [rbp-104]
+mov r14, qword ptr [rbp-120]
+mov r15, qword ptr [rbp-128]
+mov rsp, rbp
+pop rbp
+ret
+_G_queens_iib1b1b1..L14:
+mov dl, 0
+jmp _G_queens_iib1b1b1..L6
+_G_queens_iib1b1b1..L15:
+mov dl, 0
+jmp _G_queens_iib1b1b1..L8
+_G_queens_iib1b1b1..L16:
+mov qword ptr [rbp-64], r15
+mov qword ptr [rbp-56], r14
+mov r15d, 0
+mov r14d, 0
+mov dword ptr [rbp-148], ecx
+mov dword ptr [rbp-144], r9d
+mov dword ptr [rbp-140], eax
+mov qword ptr [rbp-48], r8
+mov qword ptr [rbp-40], rsi
+mov qword ptr [rbp-32], rdx
+mov rdx, qword ptr [rbp-72]
+mov rcx, qword ptr [rbp-88]
+mov r8, qword ptr [rbp-80]
+mov r9, r12
+_G_queens_iib1b1b1..L17:
+cmp r15d, edi
+jge _G_queens_iib1b1b1..L25
+_G_queens_iib1b1b1..L18:
+movsx r12, r15d
+imul r12, 1
+add r12, rbx
+mov al, byte ptr [r12]
+cmp al, 0
+jne _G_queens_iib1b1b1..L26
+_G_queens_iib1b1b1..L19:
+mov esi, r13d
+add esi, r15d
+movsx rax, esi
+imul rax, 1
+add rax, r11
+mov sil, byte ptr [rax]
+cmp sil, 0
+sete al
+_G_queens_iib1b1b1..L20:
+test al, al
+jz _G_queens_iib1b1b1..L27
+_G_queens_iib1b1b1..L21:
+mov esi, r13d
+sub esi, r15d
+add esi, edi
+sub esi, 1
+movsx rax, esi
+imul rax, 1
+add rax, r10
+mov sil, byte ptr [rax]
+cmp sil, 0
+sete al
+_G_queens_iib1b1b1..L22:
+test al, al
+jz _G_queens_iib1b1b1..L24
+_G_queens_iib1b1b1..L23:
+mov qword ptr [rbp-24], rbx
+mov byte ptr [r12], 1
+mov esi, r13d
+add esi, r15d
+movsx rbx, esi
+imul rbx, 1
+add rbx, r11
+mov qword ptr [rbp-16], r11
+mov byte ptr [rbx], 1
+mov r11d, r13d
+sub r11d, r15d
+mov dword ptr [rbp-136], r13d
+add r11d, edi
+sub r11d, 1
+movsx r13, r11d
+imul r13, 1
+add r13, r10
+mov qword ptr [rbp-8], r10
+mov byte ptr [r13], 1
+mov r10d, r9d
+mov dword ptr [rbp-152], r9d
+mov esi, edi
+mov dword ptr [rbp-132], edi
+mov rdi, r10
+call _G_queens_iib1b1b1
+add r14d, eax
+mov byte ptr [r12], 0
+mov byte ptr [rbx], 0
+mov byte ptr [r13], 0
+mov edi, dword ptr [rbp-132]
+mov rax, qword ptr [rbp-72]
+mov rcx, qword ptr [rbp-88]
+mov rdx, qword ptr [rbp-80]
+mov rbx, qword ptr [rbp-24]
+mov r11, qword ptr [rbp-16]
+mov r10, qword ptr [rbp-8]
+mov r13d, dword ptr [rbp-136]
+mov r9d, dword ptr [rbp-152]
+mov r8, rdx
+mov rdx, rax
+_G_queens_iib1b1b1..L24:
+add r15d, 1
+jmp _G_queens_iib1b1b1..L17
+_G_queens_iib1b1b1..L25:
+mov r12d, r14d
+mov dword ptr [rbp-152], r9d
+mov ecx, dword ptr [rbp-148]
+mov r14, qword ptr [rbp-56]
+mov r15, qword ptr [rbp-64]
+mov r9d, dword ptr [rbp-144]
+mov edx, dword ptr [rbp-140]
+mov r8, qword ptr [rbp-48]
+mov rsi, qword ptr [rbp-40]
+mov rax, qword ptr [rbp-32]
+jmp _G_queens_iib1b1b1..L11
+_G_queens_iib1b1b1..L26:
+mov al, 0
+jmp _G_queens_iib1b1b1..L20
+_G_queens_iib1b1b1..L27:
+mov al, 0
+jmp _G_queens_iib1b1b1..L22
+_G_gcd_ii:
+_G_gcd_ii..L0:
+cmp esi, 0
+jne _G_gcd_ii..L2
+_G_gcd_ii..L1:
+mov rax, rdi
+ret
+_G_gcd_ii..L2:
+push rbp
+mov rbp, rsp
+mov rax, rdi
+cdq
+idiv esi
+cmp edx, 0
+jne _G_gcd_ii..L4
+_G_gcd_ii..L3:
+mov rax, rsi
+mov rsp, rbp
+pop rbp
+ret
+_G_gcd_ii..L4:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L5:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L6:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L7:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L8:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L9:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L10:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L11:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L12:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L13:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L14:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L15:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L16:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L17:
+mov rax, rsi
+mov rsi, rdx
+cdq
+idiv esi
+cmp edx, 0
+je _G_gcd_ii..L3
+_G_gcd_ii..L18:
+mov rax, rsi
+mov rdi, rdx
+cdq
+idiv edi
+mov rsi, rdx
+call _G_gcd_ii
+mov rsi, rax
+jmp _G_gcd_ii..L3
+main:
+push rbp
+mov rbp, rsp
+sub rsp, 96
+main..L0:
+mov qword ptr [rbp-80], r15
+mov qword ptr [rbp-72], r12
+mov qword ptr [rbp-64], r13
+mov qword ptr [rbp-56], rbx
+lea r15, [rbp-4]
+lea rbx, [rbp-8]
+lea r12, [rbp-12]
+lea r13, [rbp-16]
+mov rdi, offset _C_0
+mov rsi, r13
+call scanf
+mov r13d, dword ptr [r13]
+mov rdi, offset _C_0
+mov rsi, r12
+call scanf
+mov r12d, dword ptr [r12]
+mov rdi, offset _C_0
+mov rsi, rbx
+call scanf
+mov ebx, dword ptr [rbx]
+mov rdi, offset _C_0
+mov rsi, r15
+call scanf
+mov r15d, dword ptr [r15]
+mov rdi, r13
+call _G_fib_i
+mov rdi, 36
+mov r13, rax
+mov qword ptr [rbp-48], r14
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r14, rax
+add r14, 8
+mov rdi, r14
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r13
+mov r13, rax
+call snprintf
+mov rdi, r14
+call strlen
+mov qword ptr [r13], rax
+cmp r13, 0
+je main..L30
+main..L1:
+mov rdi, r14
+call puts
+main..L2:
+cmp r13, 0
+je main..L6
+main..L3:
+sub r13, 16
+mov rax, qword ptr [r13]
+cmp rax, -1
+je main..L6
+main..L4:
+sub rax, 1
+mov qword ptr [r13], rax
+cmp rax, 0
+jne main..L6
+main..L5:
+mov rdi, r13
+call __dealloc
+main..L6:
+mov edi, 3
+mov rsi, r12
+call _G_ack_ii
+mov rdi, 36
+mov r12, rax
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r13, rax
+add r13, 8
+mov rdi, r13
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r12
+mov r12, rax
+call snprintf
+mov rdi, r13
+call strlen
+mov qword ptr [r12], rax
+cmp r12, 0
+je main..L31
+main..L7:
+mov rdi, r13
+call puts
+main..L8:
+cmp r12, 0
+je main..L12
+main..L9:
+sub r12, 16
+mov r13, qword ptr [r12]
+cmp r13, -1
+je main..L12
+main..L10:
+sub r13, 1
+mov qword ptr [r12], r13
+cmp r13, 0
+jne main..L12
+main..L11:
+mov rdi, r12
+call __dealloc
+main..L12:
+movsx r14, ebx
+mov r13, r14
+imul r13, 1
+add r13, 8
+mov rdi, r13
+add rdi, 16
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L32
+main..L13:
+mov rdi, rax
+mov esi, 0
+mov rdx, r13
+mov r12, rax
+call memset
+main..L14:
+mov qword ptr [r12], r14
+cmp r12, 0
+je main..L17
+main..L15:
+mov r11, qword ptr [r12-16]
+cmp r11, -1
+je main..L17
+main..L16:
+add r11, 1
+mov qword ptr [r12-16], r11
+main..L17:
+mov rdi, r12
+mov esi, 1
+mov dword ptr [rbp-84], r15d
+call __release_array_internal
+mov r13d, ebx
+imul r13d, 2
+movsx r14, r13d
+mov dword ptr [rbp-32], r13d
+mov r15, r14
+imul r15, 1
+add r15, 8
+mov r13, r15
+add r13, 16
+mov rdi, r13
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L33
+main..L18:
+mov dword ptr [rbp-24], ebx
+mov rdi, rax
+mov esi, 0
+mov rdx, r15
+mov rbx, rax
+call memset
+mov eax, dword ptr [rbp-24]
+mov r10, rbx
+mov rbx, rax
+main..L19:
+mov qword ptr [r10], r14
+cmp r10, 0
+je main..L22
+main..L20:
+mov r11, qword ptr [r10-16]
+cmp r11, -1
+je main..L22
+main..L21:
+add r11, 1
+mov qword ptr [r10-16], r11
+main..L22:
+mov rdi, r10
+mov qword ptr [rbp-40], r10
+mov esi, 1
+call __release_array_internal
+mov rdi, r13
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L34
+main..L23:
+mov rdi, rax
+mov esi, 0
+mov rdx, r15
+mov r15, rax
+call memset
+main..L24:
+mov qword ptr [r15], r14
+cmp r15, 0
+je main..L27
+main..L25:
+mov r11, qword ptr [r15-16]
+cmp r11, -1
+je main..L27
+main..L26:
+add r11, 1
+mov qword ptr [r15-16], r11
+main..L27:
+mov rdi, r15
+mov esi, 1
+call __release_array_internal
+mov rax, r12
+add rax, 8
+mov r11d, 0
+mov r10, qword ptr [rbp-56]
+mov r14, qword ptr [rbp-72]
+mov rdi, qword ptr [rbp-64]
+mov rsi, qword ptr [rbp-48]
+mov rdx, qword ptr [rbp-80]
+mov r13d, dword ptr [rbp-84]
+mov r8d, dword ptr [rbp-32]
+mov r9, qword ptr [rbp-40]
+main..L28:
+cmp r11d, ebx
+jge main..L35
+main..L29:
+movsx r10, r11d
+imul r10, 1
+add r10, rax
+mov byte ptr [r10], 0
+add r11d, 1
+jmp main..L28
+main..L30:
+mov edi, 10
+call putchar
+jmp main..L2
+main..L31:
+mov edi, 10
+call putchar
+jmp main..L8
+main..L32:
+mov r12, 0
+jmp main..L14
+main..L33:
+mov r10, 0
+jmp main..L19
+main..L34:
+mov r15, 0
+jmp main..L24
+main..L35:
+mov r10, r9
+add r10, 8
+mov rdi, r15
+add rdi, 8
+mov r11d, 0
+main..L36:
+cmp r11d, r8d
+jge main..L38
+main..L37:
+movsx rdx, r11d
+imul rdx, 1
+mov rsi, r10
+add rsi, rdx
+mov byte ptr [rsi], 0
+add rdx, rdi
+mov byte ptr [rdx], 0
+add r11d, 1
+jmp main..L36
+main..L38:
+mov edi, 0
+mov rdx, r12
+mov rcx, r9
+mov r8, r15
+mov rsi, rbx
+mov rbx, r9
+call _G_queens_iib1b1b1
+mov rdi, 36
+mov r14, rax
+mov qword ptr [rbp-32], r15
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r15, rax
+add r15, 8
+mov rdi, r15
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r14
+mov r14, rax
+call snprintf
+mov rdi, r15
+call strlen
+mov qword ptr [r14], rax
+cmp r14, 0
+je main..L49
+main..L39:
+mov rdi, r15
+call puts
+main..L40:
+cmp r14, 0
+je main..L44
+main..L41:
+sub r14, 16
+mov r15, qword ptr [r14]
+cmp r15, -1
+je main..L44
+main..L42:
+sub r15, 1
+mov qword ptr [r14], r15
+cmp r15, 0
+jne main..L44
+main..L43:
+mov rdi, r14
+call __dealloc
+main..L44:
+mov ebx, 1
+mov r14d, 0
+mov qword ptr [rbp-24], r12
+main..L45:
+cmp ebx, r13d
+jg main..L50
+main..L46:
+mov r15d, 1
+main..L47:
+cmp r15d, r13d
+jg main..L58
+main..L48:
+mov edi, ebx
+mov esi, r15d
+call _G_gcd_ii
+add r14d, eax
+mov r11d, 1000003
+mov rax, r14
+cdq
+idiv r11d
+mov r14d, edx
+add r15d, 1
+jmp main..L47
+main..L49:
+mov edi, 10
+call putchar
+jmp main..L40
+main..L50:
+mov rdi, 36
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r12, rax
+add r12, 8
+mov rdi, r12
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r14
+mov rbx, rax
+call snprintf
+mov rdi, r12
+call strlen
+mov qword ptr [rbx], rax
+cmp rbx, 0
+je main..L57
+main..L51:
+mov rdi, r12
+call puts
+main..L52:
+cmp rbx, 0
+je main..L56
+main..L53:
+sub rbx, 16
+mov r12, qword ptr [rbx]
+cmp r12, -1
+je main..L56
+main..L54:
+sub r12, 1
+mov qword ptr [rbx], r12
+cmp r12, 0
+jne main..L56
+main..L55:
+mov rdi, rbx
+call __dealloc
+main..L56:
+mov rdi, qword ptr [rbp-24]
+mov esi, 1
+call __release_array_internal
+mov rdi, qword ptr [rbp-40]
+mov esi, 1
+call __release_array_internal
+mov rdi, qword ptr [rbp-32]
+mov esi, 1
+call __release_array_internal
+mov eax, 0
+mov rbx, qword ptr [rbp-56]
+mov r12, qword ptr [rbp-72]
+mov r13, qword ptr [rbp-64]
+mov r14, qword ptr [rbp-48]
+mov r15, qword ptr [rbp-80]
+mov rsp, rbp
+pop rbp
+ret
+main..L57:
+mov edi, 10
+call putchar
+jmp main..L52
+main..L58:
+add ebx, 1
+jmp main..L45
+_C_0:
+.byte 37, 100, 0
+_C_1:
+.byte 82, 117, 110, 116, 105, 109, 101, 32, 69, 114, 114, 111, 114, 58, 32, 0
+_C_2:
+.byte 83, 117, 98, 115, 99, 114, 105, 112, 116, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 0
+_C_3:
+.byte 78, 117, 108, 108, 32, 112, 111, 105, 110, 116, 101, 114, 0
+_C_4:
+.byte 66, 97, 100, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 0
+_C_5:
+.byte 10, 0
+_C_6:
+.byte 37, 115, 0
+.section .bss
+.balign 16
+_GV___heap:
+.zero 8
@@ -0,0 +1,1504 @@
+extern strcmp, malloc, free, scanf, puts, printf, putchar, getchar, snprintf, strlen, memcpy, sscanf, fputs, stderr, exit, memset, mmap
+global main
+	section .text
+__runtime_error:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 16
+.L0:
+	mov qword [rbp-16], r12
+	mov qword [rbp-8], r15
+	mov r15, qword [stderr]
+	mov r10, _C_1
+	mov rsi, r15
+	mov r12, rdi
+	mov rdi, r10
+	call fputs
+	mov rsi, r15
+	mov rdi, r12
+	call fputs
+	mov rdi, _C_5
+	mov rsi, r15
+	call fputs
+	mov edi, -1
+	call exit
+	mov r12, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+__release_array_internal:
+.L0:
+	cmp rdi, 0
+	je .L4
+.L1:
+	mov rax, qword [rdi-16]
+	sub rax, 1
+	mov qword [rdi-16], rax
+	cmp rax, 0
+	jne .L4
+.L2:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 128
+	cmp esi, 1
+	jg .L5
+.L3:
+	sub rdi, 16
+	call __dealloc
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+.L4:
+	xor rax, rax
+	ret
+.L5:
+	sub esi, 1
+	mov r8, qword [rdi]
+	sal r8, 3
+	add r8, 8
+	add r8, rdi
+	mov rcx, rdi
+	add rcx, 8
+	mov r9d, esi
+	sub r9d, 1
+	mov eax, r9d
+	sub eax, 1
+	mov r10d, eax
+	sub r10d, 1
+	mov qword [rbp-104], rdi
+	mov qword [rbp-96], rbx
+	mov qword [rbp-88], r12
+	mov qword [rbp-80], r13
+	mov qword [rbp-72], r14
+	mov qword [rbp-64], r15
+.L6:
+	cmp rcx, r8
+	je .L12
+.L7:
+	mov rdi, qword [rcx]
+	cmp rdi, 0
+	je .L13
+.L8:
+	mov rdx, qword [rdi-16]
+	sub rdx, 1
+	mov qword [rdi-16], rdx
+	cmp rdx, 0
+	jne .L13
+.L9:
+	cmp esi, 1
+	jg .L14
+.L10:
+	mov dword [rbp-8], r10d
+	sub rdi, 16
+	mov rbx, rcx
+	mov r12, rsi
+	mov r13, r9
+	mov r14, rax
+	mov r15, r8
+	call __dealloc
+	mov r10d, dword [rbp-8]
+	mov rax, r14
+	mov rsi, r12
+	mov r8, r15
+	mov r9, r13
+.L11:
+	mov rcx, rbx
+	add rcx, 8
+	jmp .L6
+.L12:
+	mov rdi, qword [rbp-104]
+	mov rbx, qword [rbp-96]
+	mov r12, qword [rbp-88]
+	mov r13, qword [rbp-80]
+	mov r14, qword [rbp-72]
+	mov r15, qword [rbp-64]
+	jmp .L3
+.L13:
+	mov rbx, rcx
+	jmp .L11
+.L14:
+	mov r12, qword [rdi]
+	sal r12, 3
+	add r12, 8
+	add r12, rdi
+	mov r15, rdi
+	add r15, 8
+	mov dword [rbp-116], esi
+	mov qword [rbp-56], r8
+	mov qword [rbp-48], rcx
+	mov qword [rbp-40], rdi
+.L15:
+	cmp r15, r12
+	je .L21
+.L16:
+	mov rdi, qword [r15]
+	cmp rdi, 0
+	je .L20
+.L17:
+	mov rbx, qword [rdi-16]
+	sub rbx, 1
+	mov qword [rdi-16], rbx
+	cmp rbx, 0
+	jne .L20
+.L18:
+	cmp r9d, 1
+	jg .L22
+.L19:
+	sub rdi, 16
+	mov rbx, r9
+	mov r13, rax
+	mov r14, r10
+	call __dealloc
+	mov rax, r13
+	mov r9, rbx
+	mov r10, r14
+.L20:
+	add r15, 8
+	jmp .L15
+.L21:
+	mov esi, dword [rbp-116]
+	mov r8, qword [rbp-56]
+	mov rcx, qword [rbp-48]
+	mov rdi, qword [rbp-40]
+	jmp .L10
+.L22:
+	mov r14, qword [rdi]
+	sal r14, 3
+	add r14, 8
+	add r14, rdi
+	mov r13, rdi
+	add r13, 8
+	mov dword [rbp-112], r9d
+	mov qword [rbp-32], r12
+	mov qword [rbp-24], r15
+	mov qword [rbp-16], rdi
+.L23:
+	cmp r13, r14
+	je .L29
+.L24:
+	mov rbx, qword [r13]
+	cmp rbx, 0
+	je .L28
+.L25:
+	mov rcx, qword [rbx-16]
+	sub rcx, 1
+	mov qword [rbx-16], rcx
+	cmp rcx, 0
+	jne .L28
+.L26:
+	cmp eax, 1
+	jg .L30
+.L27:
+	sub rbx, 16
+	mov rdi, rbx
+	mov r12, rax
+	mov rbx, r10
+	call __dealloc
+	mov rax, r12
+	mov r10, rbx
+.L28:
+	add r13, 8
+	jmp .L23
+.L29:
+	mov r9d, dword [rbp-112]
+	mov r12, qword [rbp-32]
+	mov r15, qword [rbp-24]
+	mov rdi, qword [rbp-16]
+	jmp .L19
+.L30:
+	mov r12, qword [rbx]
+	sal r12, 3
+	add r12, 8
+	add r12, rbx
+	mov r15, rbx
+	add r15, 8
+	mov dword [rbp-108], eax
+	mov qword [rbp-8], r14
+.L31:
+	cmp r15, r12
+	je .L33
+.L32:
+	mov rdi, qword [r15]
+	mov esi, r10d
+	mov r14, r10
+	call __release_array_internal
+	add r15, 8
+	mov r10, r14
+	jmp .L31
+.L33:
+	mov eax, dword [rbp-108]
+	mov r14, qword [rbp-8]
+	jmp .L27
+
+__alloc:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 32
+.L0:
+	mov r10, qword [_GV___heap]
+	cmp r10, 0
+	je .L7
+.L1:
+	mov r11, r12
+	mov r12, rdi
+.L2:
+	mov r8, r12
+	add r8, 23
+	shr r8, 4
+	cmp r8, 32
+	ja .L11
+.L3:
+	mov rdi, r8
+	sal rdi, 3
+	add rdi, r10
+	mov rax, qword [rdi+8]
+	cmp rax, 0
+	jne .L13
+.L4:
+	mov r12, r8
+	sal r12, 4
+	mov qword [rbp-32], r11
+	mov qword [rbp-24], r13
+	mov qword [rbp-16], r14
+	mov qword [rbp-8], r15
+	mov r13, r10
+.L5:
+	mov rax, qword [r13]
+	mov rcx, rax
+	add rcx, r12
+	mov rdi, qword [r13+8]
+	cmp rcx, rdi
+	ja .L14
+.L6:
+	mov qword [r13], rcx
+	mov qword [rax], r8
+	add rax, 8
+	mov r12, qword [rbp-32]
+	mov r13, qword [rbp-24]
+	mov r14, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L7:
+	mov qword [rbp-32], r12
+	mov r10, 0
+	mov rsi, 1048576
+	mov edx, 3
+	mov ecx, 34
+	mov r8d, -1
+	mov r9, 0
+	mov r12, rdi
+	mov rdi, r10
+	call mmap
+	cmp rax, -1
+	je .L9
+.L8:
+	mov qword [_GV___heap], rax
+	mov r10, rax
+	mov rdi, rax
+	add rdi, 272
+	mov qword [rax], rdi
+	mov rsi, rax
+	add rsi, 1048576
+	mov qword [rax+8], rsi
+	mov r11, qword [rbp-32]
+	jmp .L2
+.L9:
+	mov r12, qword [rbp-32]
+.L10:
+	mov rdi, _C_4
+	call __runtime_error
+	mov rax, 0
+	mov rsp, rbp
+	pop rbp
+	ret
+.L11:
+	add r12, 8
+	mov rdi, r12
+	mov r12, r11
+	call malloc
+	cmp rax, 0
+	je .L10
+.L12:
+	mov qword [rax], 0
+	add rax, 8
+	mov rsp, rbp
+	pop rbp
+	ret
+.L13:
+	mov r10, qword [rax]
+	mov qword [rdi+8], r10
+	mov r12, r11
+	mov rsp, rbp
+	pop rbp
+	ret
+.L14:
+	mov rdi, 0
+	mov rsi, 1048576
+	mov edx, 3
+	mov ecx, 34
+	mov r15d, -1
+	mov r9, 0
+	mov r14, r8
+	mov r8, r15
+	call mmap
+	cmp rax, -1
+	je .L16
+.L15:
+	mov qword [r13], rax
+	add rax, 1048576
+	mov qword [r13+8], rax
+	mov r8, r14
+	jmp .L5
+.L16:
+	mov r12, qword [rbp-32]
+	mov r13, qword [rbp-24]
+	mov r14, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	jmp .L10
+
+__dealloc:
+.L0:
+	mov rax, rdi
+	sub rax, 8
+	mov r10, qword [rax]
+	cmp r10, 0
+	je .L2
+.L1:
+	mov rax, qword [_GV___heap]
+	sal r10, 3
+	add r10, rax
+	mov r11, qword [r10+8]
+	mov qword [rdi], r11
+	mov qword [r10+8], rdi
+	xor rax, rax
+	ret
+.L2:
+	push rbp
+	mov rbp, rsp
+	mov rdi, rax
+	call free
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+_G_quicksort_i1ii:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 48
+.L0:
+	mov eax, esi
+	add eax, edx
+	mov ecx, 2
+	mov r9, rdx
+	cdq
+	idiv ecx
+	mov r11, rdi
+	add r11, 8
+	movsx rdx, eax
+	imul rdx, 4
+	add rdx, r11
+	mov ecx, dword [rdx]
+	mov r8d, esi
+	mov r10d, r9d
+	mov qword [rbp-8], rdi
+	mov qword [rbp-48], r15
+.L1:
+	cmp r8d, r10d
+	jg .L5
+.L2:
+	mov r15, qword [rbp-8]
+	mov rax, qword [rbp-48]
+.L3:
+	movsx r15, r8d
+	imul r15, 4
+	add r15, r11
+	mov eax, dword [r15]
+	cmp eax, ecx
+	jge .L18
+.L4:
+	add r8d, 1
+	jmp .L3
+.L5:
+	cmp esi, r10d
+	jge .L11
+.L6:
+	mov eax, esi
+	add eax, r10d
+	mov r15d, 2
+	cdq
+	idiv r15d
+	movsx rdi, eax
+	imul rdi, 4
+	add rdi, r11
+	mov ecx, dword [rdi]
+	mov r15d, esi
+	mov edx, r10d
+	mov qword [rbp-40], r12
+	mov qword [rbp-32], r13
+	mov qword [rbp-24], r14
+	mov r13, qword [rbp-8]
+.L7:
+	cmp r15d, edx
+	jg .L22
+.L8:
+	mov rdi, qword [rbp-40]
+	mov r12, qword [rbp-32]
+.L9:
+	movsx r12, r15d
+	imul r12, 4
+	add r12, r11
+	mov eax, dword [r12]
+	cmp eax, ecx
+	jge .L29
+.L10:
+	add r15d, 1
+	jmp .L9
+.L11:
+	mov r15, qword [rbp-8]
+.L12:
+	cmp r8d, r9d
+	jge .L27
+.L13:
+	mov eax, r8d
+	add eax, r9d
+	mov esi, 2
+	cdq
+	idiv esi
+	movsx rsi, eax
+	imul rsi, 4
+	add rsi, r11
+	mov ecx, dword [rsi]
+	mov esi, r8d
+	mov edx, r9d
+	mov qword [rbp-24], r14
+.L14:
+	cmp esi, edx
+	jg .L31
+.L15:
+	mov rdi, qword [rbp-24]
+	mov rax, qword [rbp-48]
+.L16:
+	movsx rdi, esi
+	imul rdi, 4
+	add rdi, r11
+	mov eax, dword [rdi]
+	cmp eax, ecx
+	jge .L40
+.L17:
+	add esi, 1
+	jmp .L16
+.L18:
+	movsx rax, r10d
+	imul rax, 4
+	add rax, r11
+	mov edi, dword [rax]
+	cmp edi, ecx
+	jle .L20
+.L19:
+	sub r10d, 1
+	jmp .L18
+.L20:
+	cmp r8d, r10d
+	jg .L1
+.L21:
+	mov qword [rbp-24], r14
+	mov r14d, dword [r15]
+	mov edi, dword [rax]
+	mov dword [r15], edi
+	mov dword [rax], r14d
+	add r8d, 1
+	sub r10d, 1
+	mov r14, qword [rbp-24]
+	jmp .L1
+.L22:
+	cmp esi, edx
+	jge .L28
+.L23:
+	mov qword [rbp-16], rbx
+	mov qword [rbp-8], r11
+	mov rdi, r13
+	mov rbx, r8
+	mov r12, r10
+	mov r14, r9
+	call _G_quicksort_i1ii
+	mov rax, qword [rbp-16]
+	mov r11, qword [rbp-8]
+	mov r10, r12
+.L24:
+	cmp r15d, r10d
+	jge .L38
+.L25:
+	mov rdi, r13
+	mov rdx, r10
+	mov rsi, r15
+	mov r12, r11
+	mov r15, rax
+	call _G_quicksort_i1ii
+	mov r8, rbx
+	mov r9, r14
+	mov r11, r12
+	mov rbx, r15
+	mov r15, r13
+.L26:
+	mov r12, qword [rbp-40]
+	mov r13, qword [rbp-32]
+	mov r14, qword [rbp-24]
+	jmp .L12
+.L27:
+	mov r15, qword [rbp-48]
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+.L28:
+	mov rax, rbx
+	mov r14, r9
+	mov rbx, r8
+	jmp .L24
+.L29:
+	movsx rdi, edx
+	imul rdi, 4
+	add rdi, r11
+	mov eax, dword [rdi]
+	cmp eax, ecx
+	jle .L36
+.L30:
+	sub edx, 1
+	jmp .L29
+.L31:
+	cmp r8d, edx
+	jge .L39
+.L32:
+	mov qword [rbp-40], r12
+	mov rdi, r15
+	mov r12, rsi
+	mov r14, r9
+	mov rsi, r8
+	call _G_quicksort_i1ii
+	mov r8, qword [rbp-40]
+	mov rsi, r12
+	mov r9, r14
+.L33:
+	cmp esi, r9d
+	jge .L44
+.L34:
+	mov rdx, r9
+	mov rdi, r15
+	mov r12, r8
+	call _G_quicksort_i1ii
+.L35:
+	mov r14, qword [rbp-24]
+	jmp .L27
+.L36:
+	cmp r15d, edx
+	jg .L7
+.L37:
+	mov qword [rbp-16], rbx
+	mov ebx, dword [r12]
+	mov eax, dword [rdi]
+	mov dword [r12], eax
+	mov dword [rdi], ebx
+	add r15d, 1
+	sub edx, 1
+	mov rbx, qword [rbp-16]
+	jmp .L7
+.L38:
+	mov r8, rbx
+	mov r9, r14
+	mov r15, r13
+	mov rbx, rax
+	jmp .L26
+.L39:
+	mov r8, r12
+	jmp .L33
+.L40:
+	movsx rax, edx
+	imul rax, 4
+	add rax, r11
+	mov r14d, dword [rax]
+	cmp r14d, ecx
+	jle .L42
+.L41:
+	sub edx, 1
+	jmp .L40
+.L42:
+	cmp esi, edx
+	jg .L14
+.L43:
+	mov qword [rbp-16], rbx
+	mov ebx, dword [rdi]
+	mov r14d, dword [rax]
+	mov dword [rdi], r14d
+	mov dword [rax], ebx
+	add esi, 1
+	sub edx, 1
+	mov rbx, qword [rbp-16]
+	jmp .L14
+.L44:
+	mov r12, r8
+	jmp .L35
+
+_G_mergesort_i1i1ii:
+.L0:
+	mov eax, ecx
+	sub eax, edx
+	cmp eax, 1
+	jg .L2
+.L1:
+	xor rax, rax
+	ret
+.L2:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 48
+	mov eax, edx
+	add eax, ecx
+	mov r11d, 2
+	mov r8, rdx
+	cdq
+	idiv r11d
+	mov r10d, eax
+	sub r10d, r8d
+	cmp r10d, 1
+	jg .L13
+.L3:
+	mov r11, r14
+	mov r14, rax
+	xchg rdi, rbx
+	xchg r13, rsi
+.L4:
+	mov edx, ecx
+	sub edx, r14d
+	cmp edx, 1
+	jg .L20
+.L5:
+	mov rax, r15
+.L6:
+	mov qword [rbp-16], r11
+	mov qword [rbp-8], rsi
+	mov rsi, r13
+	add rsi, 8
+	mov r10, r13
+	add r10, 8
+	mov r15, rbx
+	add r15, 8
+	mov r9d, r8d
+	mov edx, r14d
+	mov r11d, r8d
+	mov dword [rbp-48], r8d
+	mov qword [rbp-40], rdi
+	mov qword [rbp-32], r12
+	mov qword [rbp-24], rax
+.L7:
+	cmp r9d, r14d
+	jge .L32
+.L8:
+	cmp edx, ecx
+	setl al
+.L9:
+	test al, al
+	jz .L40
+.L10:
+	movsx r8, r9d
+	imul r8, 4
+	add r8, r15
+	mov edi, dword [r8]
+	movsx r12, edx
+	imul r12, 4
+	add r12, r15
+	mov eax, dword [r12]
+	cmp edi, eax
+	jg .L44
+.L11:
+	mov r8d, dword [r8]
+	movsx rdi, r11d
+	imul rdi, 4
+	add rdi, rsi
+	mov dword [rdi], r8d
+	add r9d, 1
+.L12:
+	add r11d, 1
+	jmp .L7
+.L13:
+	mov r11d, r8d
+	add r11d, eax
+	mov r9d, 2
+	mov r10, rax
+	mov rax, r11
+	mov dword [rbp-44], ecx
+	mov qword [rbp-40], rbx
+	mov qword [rbp-32], r12
+	mov qword [rbp-24], r15
+	mov qword [rbp-16], r14
+	mov qword [rbp-8], r13
+	cdq
+	idiv r9d
+	mov r9, rdi
+	mov r11, rsi
+	mov edx, r8d
+	mov ecx, eax
+	mov rbx, rdi
+	mov r12, rax
+	mov r13, rsi
+	mov r14, r10
+	mov r15, r8
+	mov rdi, r9
+	mov rsi, r11
+	call _G_mergesort_i1i1ii
+	mov rdi, rbx
+	mov rsi, r13
+	mov edx, r12d
+	mov ecx, r14d
+	call _G_mergesort_i1i1ii
+	mov rax, rbx
+	add rax, 8
+	mov rdi, r13
+	add rdi, 8
+	mov rsi, r13
+	add rsi, 8
+	mov r11d, r15d
+	mov edx, r12d
+	mov r10d, r15d
+	mov dword [rbp-48], r15d
+.L14:
+	cmp r11d, r12d
+	jge .L27
+.L15:
+	cmp edx, r14d
+	setl r9b
+.L16:
+	test r9b, r9b
+	jz .L29
+.L17:
+	movsx r8, r11d
+	imul r8, 4
+	add r8, rax
+	mov r9d, dword [r8]
+	movsx r15, edx
+	imul r15, 4
+	add r15, rax
+	mov ecx, dword [r15]
+	cmp r9d, ecx
+	jg .L33
+.L18:
+	mov r8d, dword [r8]
+	movsx r9, r10d
+	imul r9, 4
+	add r9, rdi
+	mov dword [r9], r8d
+	add r11d, 1
+.L19:
+	add r10d, 1
+	jmp .L14
+.L20:
+	mov eax, r14d
+	add eax, ecx
+	mov r10d, 2
+	mov dword [rbp-48], r8d
+	mov qword [rbp-40], rdi
+	mov qword [rbp-32], r12
+	mov qword [rbp-24], r15
+	mov qword [rbp-16], r11
+	mov qword [rbp-8], rsi
+	cdq
+	idiv r10d
+	mov rdi, rbx
+	mov rsi, r13
+	mov edx, r14d
+	mov r8d, eax
+	mov r12, rax
+	mov r15, rcx
+	mov rcx, r8
+	call _G_mergesort_i1i1ii
+	mov rdi, rbx
+	mov rsi, r13
+	mov edx, r12d
+	mov ecx, r15d
+	call _G_mergesort_i1i1ii
+	mov rax, rbx
+	add rax, 8
+	mov rdi, r13
+	add rdi, 8
+	mov r11, r13
+	add r11, 8
+	mov esi, r14d
+	mov edx, r12d
+	mov r10d, r14d
+	mov dword [rbp-44], r14d
+.L21:
+	cmp esi, r12d
+	jge .L28
+.L22:
+	cmp edx, r15d
+	setl cl
+.L23:
+	test cl, cl
+	jz .L34
+.L24:
+	movsx r8, esi
+	imul r8, 4
+	add r8, rax
+	mov r9d, dword [r8]
+	movsx r14, edx
+	imul r14, 4
+	add r14, rax
+	mov ecx, dword [r14]
+	cmp r9d, ecx
+	jg .L43
+.L25:
+	mov r8d, dword [r8]
+	movsx r9, r10d
+	imul r9, 4
+	add r9, rdi
+	mov dword [r9], r8d
+	add esi, 1
+.L26:
+	add r10d, 1
+	jmp .L21
+.L27:
+	mov r9b, 0
+	jmp .L16
+.L28:
+	mov cl, 0
+	jmp .L23
+.L29:
+	mov r15, rbx
+	add r15, 8
+	mov r9, r13
+	add r9, 8
+	mov r8d, dword [rbp-48]
+	mov ecx, dword [rbp-44]
+	mov rdi, qword [rbp-40]
+.L30:
+	cmp r11d, r12d
+	jge .L37
+.L31:
+	movsx rax, r11d
+	imul rax, 4
+	add rax, r15
+	mov esi, dword [rax]
+	movsx rax, r10d
+	imul rax, 4
+	add rax, r9
+	mov dword [rax], esi
+	add r11d, 1
+	add r10d, 1
+	jmp .L30
+.L32:
+	mov al, 0
+	jmp .L9
+.L33:
+	mov ecx, dword [r15]
+	movsx r8, r10d
+	imul r8, 4
+	add r8, rsi
+	mov dword [r8], ecx
+	add edx, 1
+	jmp .L19
+.L34:
+	mov rcx, rbx
+	add rcx, 8
+	mov r9, r13
+	add r9, 8
+	mov r8d, dword [rbp-48]
+	mov rdi, qword [rbp-40]
+	mov r14d, dword [rbp-44]
+.L35:
+	cmp esi, r12d
+	jge .L45
+.L36:
+	movsx rax, esi
+	imul rax, 4
+	add rax, rcx
+	mov r11d, dword [rax]
+	movsx rax, r10d
+	imul rax, 4
+	add rax, r9
+	mov dword [rax], r11d
+	add esi, 1
+	add r10d, 1
+	jmp .L35
+.L37:
+	mov r15, rbx
+	add r15, 8
+	mov rax, r13
+	add rax, 8
+	mov r12, qword [rbp-32]
+	mov rsi, qword [rbp-8]
+.L38:
+	cmp edx, r14d
+	jge .L48
+.L39:
+	movsx r11, edx
+	imul r11, 4
+	add r11, r15
+	mov r9d, dword [r11]
+	movsx r11, r10d
+	imul r11, 4
+	add r11, rax
+	mov dword [r11], r9d
+	add edx, 1
+	add r10d, 1
+	jmp .L38
+.L40:
+	mov r15, rbx
+	add r15, 8
+	mov r8, r13
+	add r8, 8
+	mov r10d, dword [rbp-48]
+	mov rsi, qword [rbp-40]
+	mov r12, qword [rbp-32]
+.L41:
+	cmp r9d, r14d
+	jge .L51
+.L42:
+	movsx rdi, r9d
+	imul rdi, 4
+	add rdi, r15
+	mov eax, dword [rdi]
+	movsx rdi, r11d
+	imul rdi, 4
+	add rdi, r8
+	mov dword [rdi], eax
+	add r9d, 1
+	add r11d, 1
+	jmp .L41
+.L43:
+	mov ecx, dword [r14]
+	movsx r8, r10d
+	imul r8, 4
+	add r8, r11
+	mov dword [r8], ecx
+	add edx, 1
+	jmp .L26
+.L44:
+	mov edi, dword [r12]
+	movsx r12, r11d
+	imul r12, 4
+	add r12, r10
+	mov dword [r12], edi
+	add edx, 1
+	jmp .L12
+.L45:
+	mov rcx, rbx
+	add rcx, 8
+	mov rax, r13
+	add rax, 8
+	mov r12, qword [rbp-32]
+	mov rsi, qword [rbp-8]
+.L46:
+	cmp edx, r15d
+	jge .L54
+.L47:
+	movsx r11, edx
+	imul r11, 4
+	add r11, rcx
+	mov r9d, dword [r11]
+	movsx r11, r10d
+	imul r11, 4
+	add r11, rax
+	mov dword [r11], r9d
+	add edx, 1
+	add r10d, 1
+	jmp .L46
+.L48:
+	mov r15, r13
+	add r15, 8
+	mov rax, rbx
+	add rax, 8
+	mov r9d, r8d
+	mov r11, qword [rbp-16]
+.L49:
+	cmp r9d, r14d
+	jge .L57
+.L50:
+	movsx rdx, r9d
+	imul rdx, 4
+	mov r10, r15
+	add r10, rdx
+	mov r10d, dword [r10]
+	add rdx, rax
+	mov dword [rdx], r10d
+	add r9d, 1
+	jmp .L49
+.L51:
+	mov r15, rbx
+	add r15, 8
+	mov r8, r13
+	add r8, 8
+	mov r9, qword [rbp-8]
+	mov r14, qword [rbp-16]
+.L52:
+	cmp edx, ecx
+	jge .L58
+.L53:
+	movsx rdi, edx
+	imul rdi, 4
+	add rdi, r15
+	mov eax, dword [rdi]
+	movsx rdi, r11d
+	imul rdi, 4
+	add rdi, r8
+	mov dword [rdi], eax
+	add edx, 1
+	add r11d, 1
+	jmp .L52
+.L54:
+	mov rcx, r13
+	add rcx, 8
+	mov rax, rbx
+	add rax, 8
+	mov r10d, r14d
+	mov r11, qword [rbp-16]
+.L55:
+	cmp r10d, r15d
+	jge .L61
+.L56:
+	movsx r9, r10d
+	imul r9, 4
+	mov rdx, rcx
+	add rdx, r9
+	mov edx, dword [rdx]
+	add r9, rax
+	mov dword [r9], edx
+	add r10d, 1
+	jmp .L55
+.L57:
+	mov r15, qword [rbp-24]
+	jmp .L4
+.L58:
+	add r13, 8
+	add rbx, 8
+	mov r15, qword [rbp-24]
+.L59:
+	cmp r10d, ecx
+	jge .L62
+.L60:
+	movsx rax, r10d
+	imul rax, 4
+	mov rdx, r13
+	add rdx, rax
+	mov r8d, dword [rdx]
+	add rax, rbx
+	mov dword [rax], r8d
+	add r10d, 1
+	jmp .L59
+.L61:
+	mov rax, qword [rbp-24]
+	mov rcx, r15
+	jmp .L6
+.L62:
+	mov rbx, rsi
+	mov r13, r9
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+main:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 112
+.L0:
+	mov qword [rbp-96], r15
+	mov qword [rbp-88], rbx
+	mov qword [rbp-80], r13
+	lea rbx, [rbp-4]
+	lea r13, [rbp-8]
+	lea r15, [rbp-12]
+	mov rdi, _C_0
+	mov rsi, r15
+	call scanf
+	mov r15d, dword [r15]
+	mov rdi, _C_0
+	mov rsi, r13
+	call scanf
+	mov r13d, dword [r13]
+	mov rdi, _C_0
+	mov rsi, rbx
+	mov qword [rbp-72], r12
+	mov qword [rbp-64], r14
+	call scanf
+	mov r14d, dword [rbx]
+	mov dword [_GV_seed], r14d
+	movsx r12, r15d
+	mov r14, r12
+	imul r14, 4
+	add r14, 8
+	mov rbx, r14
+	add rbx, 16
+	mov rdi, rbx
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L20
+.L1:
+	mov dword [rbp-112], r13d
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r14
+	mov r13, rax
+	call memset
+	mov eax, dword [rbp-112]
+	mov r10, r13
+	mov r13, rax
+.L2:
+	mov qword [r10], r12
+	cmp r10, 0
+	je .L5
+.L3:
+	mov r11, qword [r10-16]
+	cmp r11, -1
+	je .L5
+.L4:
+	add r11, 1
+	mov qword [r10-16], r11
+.L5:
+	mov dword [rbp-112], r13d
+	mov rdi, r10
+	mov esi, 1
+	mov r13, r10
+	call __release_array_internal
+	mov rdi, rbx
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L21
+.L6:
+	mov dword [rbp-24], r15d
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r14
+	mov r15, rax
+	call memset
+	mov eax, dword [rbp-24]
+	mov r10, r15
+	mov r15, rax
+.L7:
+	mov qword [r10], r12
+	cmp r10, 0
+	je .L10
+.L8:
+	mov r11, qword [r10-16]
+	cmp r11, -1
+	je .L10
+.L9:
+	add r11, 1
+	mov qword [r10-16], r11
+.L10:
+	mov dword [rbp-24], r15d
+	mov rdi, r10
+	mov esi, 1
+	mov r15, r10
+	call __release_array_internal
+	mov rdi, rbx
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L22
+.L11:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r14
+	mov rbx, rax
+	call memset
+.L12:
+	mov qword [rbx], r12
+	cmp rbx, 0
+	je .L15
+.L13:
+	mov r11, qword [rbx-16]
+	cmp r11, -1
+	je .L15
+.L14:
+	add r11, 1
+	mov qword [rbx-16], r11
+.L15:
+	mov rdi, rbx
+	mov esi, 1
+	call __release_array_internal
+	mov rdi, r13
+	add rdi, 8
+	mov rcx, r15
+	add rcx, 8
+	mov esi, dword [rbp-24]
+	mov r9d, esi
+	sub r9d, 1
+	mov r8, r13
+	add r8, 8
+	mov r14, r15
+	add r14, 8
+	mov r10, r13
+	add r10, 8
+	mov edx, 0
+	mov r12d, 0
+	mov r11d, dword [rbp-112]
+.L16:
+	cmp edx, r11d
+	jge .L23
+.L17:
+	mov r11d, 0
+	mov dword [rbp-108], edx
+	mov dword [rbp-104], r12d
+.L18:
+	cmp r11d, esi
+	jge .L31
+.L19:
+	mov eax, dword [_GV_seed]
+	imul eax, 1103
+	add eax, 12345
+	mov r12d, 65536
+	cdq
+	idiv r12d
+	mov dword [_GV_seed], edx
+	mov r12d, dword [_GV_seed]
+	movsx rax, r11d
+	imul rax, 4
+	mov rdx, rdi
+	add rdx, rax
+	mov dword [rdx], r12d
+	mov r12d, dword [rdx]
+	add rax, rcx
+	mov dword [rax], r12d
+	add r11d, 1
+	jmp .L18
+.L20:
+	mov r10, 0
+	jmp .L2
+.L21:
+	mov r10, 0
+	jmp .L7
+.L22:
+	mov rbx, 0
+	jmp .L12
+.L23:
+	mov rdi, 36
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r14, rax
+	add r14, 8
+	mov rdi, r14
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r12
+	mov r12, rax
+	call snprintf
+	mov rdi, r14
+	call strlen
+	mov qword [r12], rax
+	cmp r12, 0
+	je .L30
+.L24:
+	mov rdi, r14
+	call puts
+.L25:
+	cmp r12, 0
+	je .L29
+.L26:
+	sub r12, 16
+	mov rax, qword [r12]
+	cmp rax, -1
+	je .L29
+.L27:
+	sub rax, 1
+	mov qword [r12], rax
+	cmp rax, 0
+	jne .L29
+.L28:
+	mov rdi, r12
+	call __dealloc
+.L29:
+	mov esi, 1
+	mov rdi, r13
+	call __release_array_internal
+	mov esi, 1
+	mov rdi, r15
+	call __release_array_internal
+	mov esi, 1
+	mov rdi, rbx
+	call __release_array_internal
+	mov eax, 0
+	mov rbx, qword [rbp-88]
+	mov r12, qword [rbp-72]
+	mov r13, qword [rbp-80]
+	mov r14, qword [rbp-64]
+	mov r15, qword [rbp-96]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L30:
+	mov edi, 10
+	call putchar
+	jmp .L25
+.L31:
+	mov qword [rbp-32], r10
+	mov qword [rbp-56], rdi
+	mov qword [rbp-48], rcx
+	mov rdi, r13
+	mov qword [rbp-24], r13
+	mov r12d, 0
+	mov edx, r9d
+	mov dword [rbp-100], r9d
+	mov r13, r8
+	xchg r12, rsi
+	call _G_quicksort_i1ii
+	mov rdi, r15
+	mov rsi, rbx
+	mov edx, 0
+	mov ecx, r12d
+	call _G_mergesort_i1i1ii
+	mov edx, 0
+	mov rax, qword [rbp-88]
+	mov rcx, qword [rbp-72]
+	mov r9, qword [rbp-80]
+	mov r11, qword [rbp-64]
+	mov rsi, qword [rbp-24]
+	mov r10, qword [rbp-32]
+.L32:
+	cmp edx, r12d
+	jge .L37
+.L33:
+	movsx rax, edx
+	imul rax, 4
+	mov r8, r13
+	add r8, rax
+	mov edi, dword [r8]
+	add rax, r14
+	mov r8d, dword [rax]
+	cmp edi, r8d
+	je .L40
+.L34:
+	mov rdi, _C_7
+	cmp rdi, 0
+	je .L41
+.L35:
+	add rdi, 8
+	mov r12, rcx
+	mov r13, r9
+	mov r14, rsi
+	call puts
+	mov r9, qword [rbp-64]
+	mov rax, r13
+.L36:
+	mov esi, 1
+	mov rdi, r14
+	mov r13, rax
+	mov r14, r9
+	call __release_array_internal
+	mov esi, 1
+	mov rdi, r15
+	call __release_array_internal
+	mov esi, 1
+	mov rdi, rbx
+	call __release_array_internal
+	mov eax, 0
+	mov rbx, qword [rbp-88]
+	mov r15, qword [rbp-96]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L37:
+	mov eax, 0
+	mov r8d, 0
+	mov qword [rbp-40], rbx
+	mov qword [rbp-32], r13
+	mov qword [rbp-24], r14
+	mov r11d, dword [rbp-112]
+	mov rdi, qword [rbp-56]
+	mov rcx, qword [rbp-48]
+	mov r9d, dword [rbp-100]
+	mov ebx, dword [rbp-108]
+	mov r13d, dword [rbp-104]
+.L38:
+	cmp r8d, r12d
+	jge .L42
+.L39:
+	imul eax, 31
+	movsx r14, r8d
+	imul r14, 4
+	add r14, r10
+	mov edx, dword [r14]
+	add eax, edx
+	mov r14d, 1000003
+	cdq
+	idiv r14d
+	mov eax, edx
+	add r8d, 1
+	jmp .L38
+.L40:
+	add edx, 1
+	jmp .L32
+.L41:
+	mov edi, 10
+	mov r12, rcx
+	mov r13, r11
+	mov r14, rsi
+	call putchar
+	mov rax, qword [rbp-80]
+	mov r9, r13
+	jmp .L36
+.L42:
+	add r13d, eax
+	mov r14d, 1000003
+	mov rax, r13
+	mov r13, rsi
+	mov rsi, r12
+	cdq
+	idiv r14d
+	mov r12d, edx
+	mov edx, ebx
+	add edx, 1
+	mov rbx, qword [rbp-40]
+	mov r8, qword [rbp-32]
+	mov r14, qword [rbp-24]
+	jmp .L16
+
+_C_0:
+	db '%d', 0
+
+_C_1:
+	db 'Runtime Error: ', 0
+
+_C_2:
+	db 'Subscript out of range', 0
+
+_C_3:
+	db 'Null pointer', 0
+
+_C_4:
+	db 'Bad allocation', 0
+
+_C_5:
+	db 10, 0
+
+_C_6:
+	db '%s', 0
+
+	align 8
+	db 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0
+_C_7:
+	db 8, 0, 0, 0, 0, 0, 0, 0, 'mismatch', 0
+
+	section .bss
+	align 16
+_GV___heap:
+	resb 8
+
+_GV_seed:
+	resb 4
+
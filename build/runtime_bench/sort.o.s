@@ -0,0 +1,1487 @@
+.intel_syntax noprefix
+.globl main
+.section .text
+__runtime_error:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+__runtime_error..L0:
+mov qword ptr [rbp-16], r12
+mov qword ptr [rbp-8], r15
+mov r15, qword ptr [stderr]
+mov r10, offset _C_1
+mov rsi, r15
+mov r12, rdi
+mov rdi, r10
+call fputs
+mov rsi, r15
+mov rdi, r12
+call fputs
+mov rdi, offset _C_5
+mov rsi, r15
+call fputs
+mov edi, -1
+call exit
+mov r12, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+__release_array_internal:
+__release_array_internal..L0:
+cmp rdi, 0
+je __release_array_internal..L4
+__release_array_internal..L1:
+mov rax, qword ptr [rdi-16]
+sub rax, 1
+mov qword ptr [rdi-16], rax
+cmp rax, 0
+jne __release_array_internal..L4
+__release_array_internal..L2:
+push rbp
+mov rbp, rsp
+sub rsp, 128
+cmp esi, 1
+jg __release_array_internal..L5
+__release_array_internal..L3:
+sub rdi, 16
+call __dealloc
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+__release_array_internal..L4:
+xor rax, rax
+ret
+__release_array_internal..L5:
+sub esi, 1
+mov r8, qword ptr [rdi]
+sal r8, 3
+add r8, 8
+add r8, rdi
+mov rcx, rdi
+add rcx, 8
+mov r9d, esi
+sub r9d, 1
+mov eax, r9d
+sub eax, 1
+mov r10d, eax
+sub r10d, 1
+mov qword ptr [rbp-104], rdi
+mov qword ptr [rbp-96], rbx
+mov qword ptr [rbp-88], r12
+mov qword ptr [rbp-80], r13
+mov qword ptr [rbp-72], r14
+mov qword ptr [rbp-64], r15
+__release_array_internal..L6:
+cmp rcx, r8
+je __release_array_internal..L12
+__release_array_internal..L7:
+mov rdi, qword ptr [rcx]
+cmp rdi, 0
+je __release_array_internal..L13
+__release_array_internal..L8:
+mov rdx, qword ptr [rdi-16]
+sub rdx, 1
+mov qword ptr [rdi-16], rdx
+cmp rdx, 0
+jne __release_array_internal..L13
+__release_array_internal..L9:
+cmp esi, 1
+jg __release_array_internal..L14
+__release_array_internal..L10:
+mov dword ptr [rbp-8], r10d
+sub rdi, 16
+mov rbx, rcx
+mov r12, rsi
+mov r13, r9
+mov r14, rax
+mov r15, r8
+call __dealloc
+mov r10d, dword ptr [rbp-8]
+mov rax, r14
+mov rsi, r12
+mov r8, r15
+mov r9, r13
+__release_array_internal..L11:
+mov rcx, rbx
+add rcx, 8
+jmp __release_array_internal..L6
+__release_array_internal..L12:
+mov rdi, qword ptr [rbp-104]
+mov rbx, qword ptr [rbp-96]
+mov r12, qword ptr [rbp-88]
+mov r13, qword ptr [rbp-80]
+mov r14, qword ptr [rbp-72]
+mov r15, qword ptr [rbp-64]
+jmp __release_array_internal..L3
+__release_array_internal..L13:
+mov rbx, rcx
+jmp __release_array_internal..L11
+__release_array_internal..L14:
+mov r12, qword ptr [rdi]
+sal r12, 3
+add r12, 8
+add r12, rdi
+mov r15, rdi
+add r15, 8
+mov dword ptr [rbp-116], esi
+mov qword ptr [rbp-56], r8
+mov qword ptr [rbp-48], rcx
+mov qword ptr [rbp-40], rdi
+__release_array_internal..L15:
+cmp r15, r12
+je __release_array_internal..L21
+__release_array_internal..L16:
+mov rdi, qword ptr [r15]
+cmp rdi, 0
+je __release_array_internal..L20
+__release_array_internal..L17:
+mov rbx, qword ptr [rdi-16]
+sub rbx, 1
+mov qword ptr [rdi-16], rbx
+cmp rbx, 0
+jne __release_array_internal..L20
+__release_array_internal..L18:
+cmp r9d, 1
+jg __release_array_internal..L22
+__release_array_internal..L19:
+sub rdi, 16
+mov rbx, r9
+mov r13, rax
+mov r14, r10
+call __dealloc
+mov rax, r13
+mov r9, rbx
+mov r10, r14
+__release_array_internal..L20:
+add r15, 8
+jmp __release_array_internal..L15
+__release_array_internal..L21:
+mov esi, dword ptr [rbp-116]
+mov r8, qword ptr [rbp-56]
+mov rcx, qword ptr [rbp-48]
+mov rdi, qword ptr [rbp-40]
+jmp __release_array_internal..L10
+__release_array_internal..L22:
+mov r14, qword ptr [rdi]
+sal r14, 3
+add r14, 8
+add r14, rdi
+mov r13, rdi
+add r13, 8
+mov dword ptr [rbp-112], r9d
+mov qword ptr [rbp-32], r12
+mov qword ptr [rbp-24], r15
+mov qword ptr [rbp-16], rdi
+__release_array_internal..L23:
+cmp r13, r14
+je __release_array_internal..L29
+__release_array_internal..L24:
+mov rbx, qword ptr [r13]
+cmp rbx, 0
+je __release_array_internal..L28
+__release_array_internal..L25:
+mov rcx, qword ptr [rbx-16]
+sub rcx, 1
+mov qword ptr [rbx-16], rcx
+cmp rcx, 0
+jne __release_array_internal..L28
+__release_array_internal..L26:
+cmp eax, 1
+jg __release_array_internal..L30
+__release_array_internal..L27:
+sub rbx, 16
+mov rdi, rbx
+mov r12, rax
+mov rbx, r10
+call __dealloc
+mov rax, r12
+mov r10, rbx
+__release_array_internal..L28:
+add r13, 8
+jmp __release_array_internal..L23
+__release_array_internal..L29:
+mov r9d, dword ptr [rbp-112]
+mov r12, qword ptr [rbp-32]
+mov r15, qword ptr [rbp-24]
+mov rdi, qword ptr [rbp-16]
+jmp __release_array_internal..L19
+__release_array_internal..L30:
+mov r12, qword ptr [rbx]
+sal r12, 3
+add r12, 8
+add r12, rbx
+mov r15, rbx
+add r15, 8
+mov dword ptr [rbp-108], eax
+mov qword ptr [rbp-8], r14
+__release_array_internal..L31:
+cmp r15, r12
+je __release_array_internal..L33
+__release_array_internal..L32:
+mov rdi, qword ptr [r15]
+mov esi, r10d
+mov r14, r10
+call __release_array_internal
+add r15, 8
+mov r10, r14
+jmp __release_array_internal..L31
+__release_array_internal..L33:
+mov eax, dword ptr [rbp-108]
+mov r14, qword ptr [rbp-8]
+jmp __release_array_internal..L27
+__alloc:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+__alloc..L0:
+mov r10, qword ptr [_GV___heap]
+cmp r10, 0
+je __alloc..L7
+__alloc..L1:
+mov r11, r12
+mov r12, rdi
+__alloc..L2:
+mov r8, r12
+add r8, 23
+shr r8, 4
+cmp r8, 32
+ja __alloc..L11
+__alloc..L3:
+mov rdi, r8
+sal rdi, 3
+add rdi, r10
+mov rax, qword ptr [rdi+8]
+cmp rax, 0
+jne __alloc..L13
+__alloc..L4:
+mov r12, r8
+sal r12, 4
+mov qword ptr [rbp-32], r11
+mov qword ptr [rbp-24], r13
+mov qword ptr [rbp-16], r14
+mov qword ptr [rbp-8], r15
+mov r13, r10
+__alloc..L5:
+mov rax, qword ptr [r13]
+mov rcx, rax
+add rcx, r12
+mov rdi, qword ptr [r13+8]
+cmp rcx, rdi
+ja __alloc..L14
+__alloc..L6:
+mov qword ptr [r13], rcx
+mov qword ptr [rax], r8
+add rax, 8
+mov r12, qword ptr [rbp-32]
+mov r13, qword ptr [rbp-24]
+mov r14, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L7:
+mov qword ptr [rbp-32], r12
+mov r10, 0
+mov rsi, 1048576
+mov edx, 3
+mov ecx, 34
+mov r8d, -1
+mov r9, 0
+mov r12, rdi
+mov rdi, r10
+call mmap
+cmp rax, -1
+je __alloc..L9
+__alloc..L8:
+mov qword ptr [_GV___heap], rax
+mov r10, rax
+mov rdi, rax
+add rdi, 272
+mov qword ptr [rax], rdi
+mov rsi, rax
+add rsi, 1048576
+mov qword ptr [rax+8], rsi
+mov r11, qword ptr [rbp-32]
+jmp __alloc..L2
+__alloc..L9:
+mov r12, qword ptr [rbp-32]
+__alloc..L10:
+mov rdi, offset _C_4
+call __runtime_error
+mov rax, 0
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L11:
+add r12, 8
+mov rdi, r12
+mov r12, r11
+call malloc
+cmp rax, 0
+je __alloc..L10
+__alloc..L12:
+mov qword ptr [rax], 0
+add rax, 8
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L13:
+mov r10, qword ptr [rax]
+mov qword ptr [rdi+8], r10
+mov r12, r11
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L14:
+mov rdi, 0
+mov rsi, 1048576
+mov edx, 3
+mov ecx, 34
+mov r15d, -1
+mov r9, 0
+mov r14, r8
+mov r8, r15
+call mmap
+cmp rax, -1
+je __alloc..L16
+__alloc..L15:
+mov qword ptr [r13], rax
+add rax, 1048576
+mov qword ptr [r13+8], rax
+mov r8, r14
+jmp __alloc..L5
+__alloc..L16:
+mov r12, qword ptr [rbp-32]
+mov r13, qword ptr [rbp-24]
+mov r14, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+jmp __alloc..L10
+__dealloc:
+__dealloc..L0:
+mov rax, rdi
+sub rax, 8
+mov r10, qword ptr [rax]
+cmp r10, 0
+je __dealloc..L2
+__dealloc..L1:
+mov rax, qword ptr [_GV___heap]
+sal r10, 3
+add r10, rax
+mov r11, qword ptr [r10+8]
+mov qword ptr [rdi], r11
+mov qword ptr [r10+8], rdi
+xor rax, rax
+ret
+__dealloc..L2:
+push rbp
+mov rbp, rsp
+mov rdi, rax
+call free
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+_G_quicksort_i1ii:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+_G_quicksort_i1ii..L0:
+mov eax, esi
+add eax, edx
+mov ecx, 2
+mov r9, rdx
+cdq
+idiv ecx
+mov r11, rdi
+add r11, 8
+movsx rdx, eax
+imul rdx, 4
+add rdx, r11
+mov ecx, dword ptr [rdx]
+mov r8d, esi
+mov r10d, r9d
+mov qword ptr [rbp-8], rdi
+mov qword ptr [rbp-48], r15
+_G_quicksort_i1ii..L1:
+cmp r8d, r10d
+jg _G_quicksort_i1ii..L5
+_G_quicksort_i1ii..L2:
+mov r15, qword ptr [rbp-8]
+mov rax, qword ptr [rbp-48]
+_G_quicksort_i1ii..L3:
+movsx r15, r8d
+imul r15, 4
+add r15, r11
+mov eax, dword ptr [r15]
+cmp eax, ecx
+jge _G_quicksort_i1ii..L18
+_G_quicksort_i1ii..L4:
+add r8d, 1
+jmp _G_quicksort_i1ii..L3
+_G_quicksort_i1ii..L5:
+cmp esi, r10d
+jge _G_quicksort_i1ii..L11
+_G_quicksort_i1ii..L6:
+mov eax, esi
+add eax, r10d
+mov r15d, 2
+cdq
+idiv r15d
+movsx rdi, eax
+imul rdi, 4
+add rdi, r11
+mov ecx, dword ptr [rdi]
+mov r15d, esi
+mov edx, r10d
+mov qword ptr [rbp-40], r12
+mov qword ptr [rbp-32], r13
+mov qword ptr [rbp-24], r14
+mov r13, qword ptr [rbp-8]
+_G_quicksort_i1ii..L7:
+cmp r15d, edx
+jg _G_quicksort_i1ii..L22
+_G_quicksort_i1ii..L8:
+mov rdi, qword ptr [rbp-40]
+mov r12, qword ptr [rbp-32]
+_G_quicksort_i1ii..L9:
+movsx r12, r15d
+imul r12, 4
+add r12, r11
+mov eax, dword ptr [r12]
+cmp eax, ecx
+jge _G_quicksort_i1ii..L29
+_G_quicksort_i1ii..L10:
+add r15d, 1
+jmp _G_quicksort_i1ii..L9
+_G_quicksort_i1ii..L11:
+mov r15, qword ptr [rbp-8]
+_G_quicksort_i1ii..L12:
+cmp r8d, r9d
+jge _G_quicksort_i1ii..L27
+_G_quicksort_i1ii..L13:
+mov eax, r8d
+add eax, r9d
+mov esi, 2
+cdq
+idiv esi
+movsx rsi, eax
+imul rsi, 4
+add rsi, r11
+mov ecx, dword ptr [rsi]
+mov esi, r8d
+mov edx, r9d
+mov qword ptr [rbp-24], r14
+_G_quicksort_i1ii..L14:
+cmp esi, edx
+jg _G_quicksort_i1ii..L31
+_G_quicksort_i1ii..L15:
+mov rdi, qword ptr [rbp-24]
+mov rax, qword ptr [rbp-48]
+_G_quicksort_i1ii..L16:
+movsx rdi, esi
+imul rdi, 4
+add rdi, r11
+mov eax, dword ptr [rdi]
+cmp eax, ecx
+jge _G_quicksort_i1ii..L40
+_G_quicksort_i1ii..L17:
+add esi, 1
+jmp _G_quicksort_i1ii..L16
+_G_quicksort_i1ii..L18:
+movsx rax, r10d
+imul rax, 4
+add rax, r11
+mov edi, dword ptr [rax]
+cmp edi, ecx
+jle _G_quicksort_i1ii..L20
+_G_quicksort_i1ii..L19:
+sub r10d, 1
+jmp _G_quicksort_i1ii..L18
+_G_quicksort_i1ii..L20:
+cmp r8d, r10d
+jg _G_quicksort_i1ii..L1
+_G_quicksort_i1ii..L21:
+mov qword ptr [rbp-24], r14
+mov r14d, dword ptr [r15]
+mov edi, dword ptr [rax]
+mov dword ptr [r15], edi
+mov dword ptr [rax], r14d
+add r8d, 1
+sub r10d, 1
+mov r14, qword ptr [rbp-24]
+jmp _G_quicksort_i1ii..L1
+_G_quicksort_i1ii..L22:
+cmp esi, edx
+jge _G_quicksort_i1ii..L28
+_G_quicksort_i1ii..L23:
+mov qword ptr [rbp-16], rbx
+mov qword ptr [rbp-8], r11
+mov rdi, r13
+mov rbx, r8
+mov r12, r10
+mov r14, r9
+call _G_quicksort_i1ii
+mov rax, qword ptr [rbp-16]
+mov r11, qword ptr [rbp-8]
+mov r10, r12
+_G_quicksort_i1ii..L24:
+cmp r15d, r10d
+jge _G_quicksort_i1ii..L38
+_G_quicksort_i1ii..L25:
+mov rdi, r13
+mov rdx, r10
+mov rsi, r15
+mov r12, r11
+mov r15, rax
+call _G_quicksort_i1ii
+mov r8, rbx
+mov r9, r14
+mov r11, r12
+mov rbx, r15
+mov r15, r13
+_G_quicksort_i1ii..L26:
+mov r12, qword ptr [rbp-40]
+mov r13, qword ptr [rbp-32]
+mov r14, qword ptr [rbp-24]
+jmp _G_quicksort_i1ii..L12
+_G_quicksort_i1ii..L27:
+mov r15, qword ptr [rbp-48]
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+_G_quicksort_i1ii..L28:
+mov rax, rbx
+mov r14, r9
+mov rbx, r8
+jmp _G_quicksort_i1ii..L24
+_G_quicksort_i1ii..L29:
+movsx rdi, edx
+imul rdi, 4
+add rdi, r11
+mov eax, dword ptr [rdi]
+cmp eax, ecx
+jle _G_quicksort_i1ii..L36
+_G_quicksort_i1ii..L30:
+sub edx, 1
+jmp _G_quicksort_i1ii..L29
+_G_quicksort_i1ii..L31:
+cmp r8d, edx
+jge _G_quicksort_i1ii..L39
+_G_quicksort_i1ii..L32:
+mov qword ptr [rbp-40], r12
+mov rdi, r15
+mov r12, rsi
+mov r14, r9
+mov rsi, r8
+call _G_quicksort_i1ii
+mov r8, qword ptr [rbp-40]
+mov rsi, r12
+mov r9, r14
+_G_quicksort_i1ii..L33:
+cmp esi, r9d
+jge _G_quicksort_i1ii..L44
+_G_quicksort_i1ii..L34:
+mov rdx, r9
+mov rdi, r15
+mov r12, r8
+call _G_quicksort_i1ii
+_G_quicksort_i1ii..L35:
+mov r14, qword ptr [rbp-24]
+jmp _G_quicksort_i1ii..L27
+_G_quicksort_i1ii..L36:
+cmp r15d, edx
+jg _G_quicksort_i1ii..L7
+_G_quicksort_i1ii..L37:
+mov qword ptr [rbp-16], rbx
+mov ebx, dword ptr [r12]
+mov eax, dword ptr [rdi]
+mov dword ptr [r12], eax
+mov dword ptr [rdi], ebx
+add r15d, 1
+sub edx, 1
+mov rbx, qword ptr [rbp-16]
+jmp _G_quicksort_i1ii..L7
+_G_quicksort_i1ii..L38:
+mov r8, rbx
+mov r9, r14
+mov r15, r13
+mov rbx, rax
+jmp _G_quicksort_i1ii..L26
+_G_quicksort_i1ii..L39:
+mov r8, r12
+jmp _G_quicksort_i1ii..L33
+_G_quicksort_i1ii..L40:
+movsx rax, edx
+imul rax, 4
+add rax, r11
+mov r14d, dword ptr [rax]
+cmp r14d, ecx
+jle _G_quicksort_i1ii..L42
+_G_quicksort_i1ii..L41:
+sub edx, 1
+jmp _G_quicksort_i1ii..L40
+_G_quicksort_i1ii..L42:
+cmp esi, edx
+jg _G_quicksort_i1ii..L14
+_G_quicksort_i1ii..L43:
+mov qword ptr [rbp-16], rbx
+mov ebx, dword ptr [rdi]
+mov r14d, dword ptr [rax]
+mov dword ptr [rdi], r14d
+mov dword ptr [rax], ebx
+add esi, 1
+sub edx, 1
+mov rbx, qword ptr [rbp-16]
+jmp _G_quicksort_i1ii..L14
+_G_quicksort_i1ii..L44:
+mov r12, r8
+jmp _G_quicksort_i1ii..L35
+_G_mergesort_i1i1ii:
+_G_mergesort_i1i1ii..L0:
+mov eax, ecx
+sub eax, edx
+cmp eax, 1
+jg _G_mergesort_i1i1ii..L2
+_G_mergesort_i1i1ii..L1:
+xor rax, rax
+ret
+_G_mergesort_i1i1ii..L2:
+push rbp
+mov rbp, rsp
+sub rsp, 48
+mov eax, edx
+add eax, ecx
+mov r11d, 2
+mov r8, rdx
+cdq
+idiv r11d
+mov r10d, eax
+sub r10d, r8d
+cmp r10d, 1
+jg _G_mergesort_i1i1ii..L13
+_G_mergesort_i1i1ii..L3:
+mov r11, r14
+mov r14, rax
+xchg rdi, rbx
+xchg r13, rsi
+_G_mergesort_i1i1ii..L4:
+mov edx, ecx
+sub edx, r14d
+cmp edx, 1
+jg _G_mergesort_i1i1ii..L20
+_G_mergesort_i1i1ii..L5:
+mov rax, r15
+_G_mergesort_i1i1ii..L6:
+mov qword ptr [rbp-16], r11
+mov qword ptr [rbp-8], rsi
+mov rsi, r13
+add rsi, 8
+mov r10, r13
+add r10, 8
+mov r15, rbx
+add r15, 8
+mov r9d, r8d
+mov edx, r14d
+mov r11d, r8d
+mov dword ptr [rbp-48], r8d
+mov qword ptr [rbp-40], rdi
+mov qword ptr [rbp-32], r12
+mov qword ptr [rbp-24], rax
+_G_mergesort_i1i1ii..L7:
+cmp r9d, r14d
+jge _G_mergesort_i1i1ii..L32
+_G_mergesort_i1i1ii..L8:
+cmp edx, ecx
+setl al
+_G_mergesort_i1i1ii..L9:
+test al, al
+jz _G_mergesort_i1i1ii..L40
+_G_mergesort_i1i1ii..L10:
+movsx r8, r9d
+imul r8, 4
+add r8, r15
+mov edi, dword ptr [r8]
+movsx r12, edx
+imul r12, 4
+add r12, r15
+mov eax, dword ptr [r12]
+cmp edi, eax
+jg _G_mergesort_i1i1ii..L44
+_G_mergesort_i1i1ii..L11:
+mov r8d, dword ptr [r8]
+movsx rdi, r11d
+imul rdi, 4
+add rdi, rsi
+mov dword ptr [rdi], r8d
+add r9d, 1
+_G_mergesort_i1i1ii..L12:
+add r11d, 1
+jmp _G_mergesort_i1i1ii..L7
+_G_mergesort_i1i1ii..L13:
+mov r11d, r8d
+add r11d, eax
+mov r9d, 2
+mov r10, rax
+mov rax, r11
+mov dword ptr [rbp-44], ecx
+mov qword ptr [rbp-40], rbx
+mov qword ptr [rbp-32], r12
+mov qword ptr [rbp-24], r15
+mov qword ptr [rbp-16], r14
+mov qword ptr [rbp-8], r13
+cdq
+idiv r9d
+mov r9, rdi
+mov r11, rsi
+mov edx, r8d
+mov ecx, eax
+mov rbx, rdi
+mov r12, rax
+mov r13, rsi
+mov r14, r10
+mov r15, r8
+mov rdi, r9
+mov rsi, r11
+call _G_mergesort_i1i1ii
+mov rdi, rbx
+mov rsi, r13
+mov edx, r12d
+mov ecx, r14d
+call _G_mergesort_i1i1ii
+mov rax, rbx
+add rax, 8
+mov rdi, r13
+add rdi, 8
+mov rsi, r13
+add rsi, 8
+mov r11d, r15d
+mov edx, r12d
+mov r10d, r15d
+mov dword ptr [rbp-48], r15d
+_G_mergesort_i1i1ii..L14:
+cmp r11d, r12d
+jge _G_mergesort_i1i1ii..L27
+_G_mergesort_i1i1ii..L15:
+cmp edx, r14d
+setl r9b
+_G_mergesort_i1i1ii..L16:
+test r9b, r9b
+jz _G_mergesort_i1i1ii..L29
+_G_mergesort_i1i1ii..L17:
+movsx r8, r11d
+imul r8, 4
+add r8, rax
+mov r9d, dword ptr [r8]
+movsx r15, edx
+imul r15, 4
+add r15, rax
+mov ecx, dword ptr [r15]
+cmp r9d, ecx
+jg _G_mergesort_i1i1ii..L33
+_G_mergesort_i1i1ii..L18:
+mov r8d, dword ptr [r8]
+movsx r9, r10d
+imul r9, 4
+add r9, rdi
+mov dword ptr [r9], r8d
+add r11d, 1
+_G_mergesort_i1i1ii..L19:
+add r10d, 1
+jmp _G_mergesort_i1i1ii..L14
+_G_mergesort_i1i1ii..L20:
+mov eax, r14d
+add eax, ecx
+mov r10d, 2
+mov dword ptr [rbp-48], r8d
+mov qword ptr [rbp-40], rdi
+mov qword ptr [rbp-32], r12
+mov qword ptr [rbp-24], r15
+mov qword ptr [rbp-16], r11
+mov qword ptr [rbp-8], rsi
+cdq
+idiv r10d
+mov rdi, rbx
+mov rsi, r13
+mov edx, r14d
+mov r8d, eax
+mov r12, rax
+mov r15, rcx
+mov rcx, r8
+call _G_mergesort_i1i1ii
+mov rdi, rbx
+mov rsi, r13
+mov edx, r12d
+mov ecx, r15d
+call _G_mergesort_i1i1ii
+mov rax, rbx
+add rax, 8
+mov rdi, r13
+add rdi, 8
+mov r11, r13
+add r11, 8
+mov esi, r14d
+mov edx, r12d
+mov r10d, r14d
+mov dword ptr [rbp-44], r14d
+_G_mergesort_i1i1ii..L21:
+cmp esi, r12d
+jge _G_mergesort_i1i1ii..L28
+_G_mergesort_i1i1ii..L22:
+cmp edx, r15d
+setl cl
+_G_mergesort_i1i1ii..L23:
+test cl, cl
+jz _G_mergesort_i1i1ii..L34
+_G_mergesort_i1i1ii..L24:
+movsx r8, esi
+imul r8, 4
+add r8, rax
+mov r9d, dword ptr [r8]
+movsx r14, edx
+imul r14, 4
+add r14, rax
+mov ecx, dword ptr [r14]
+cmp r9d, ecx
+jg _G_mergesort_i1i1ii..L43
+_G_mergesort_i1i1ii..L25:
+mov r8d, dword ptr [r8]
+movsx r9, r10d
+imul r9, 4
+add r9, rdi
+mov dword ptr [r9], r8d
+add esi, 1
+_G_mergesort_i1i1ii..L26:
+add r10d, 1
+jmp _G_mergesort_i1i1ii..L21
+_G_mergesort_i1i1ii..L27:
+mov r9b, 0
+jmp _G_mergesort_i1i1ii..L16
+_G_mergesort_i1i1ii..L28:
+mov cl, 0
+jmp _G_mergesort_i1i1ii..L23
+_G_mergesort_i1i1ii..L29:
+mov r15, rbx
+add r15, 8
+mov r9, r13
+add r9, 8
+mov r8d, dword ptr [rbp-48]
+mov ecx, dword ptr [rbp-44]
+mov rdi, qword ptr [rbp-40]
+_G_mergesort_i1i1ii..L30:
+cmp r11d, r12d
+jge _G_mergesort_i1i1ii..L37
+_G_mergesort_i1i1ii..L31:
+movsx rax, r11d
+imul rax, 4
+add rax, r15
+mov esi, dword ptr [rax]
+movsx rax, r10d
+imul rax, 4
+add rax, r9
+mov dword ptr [rax], esi
+add r11d, 1
+add r10d, 1
+jmp _G_mergesort_i1i1ii..L30
+_G_mergesort_i1i1ii..L32:
+mov al, 0
+jmp _G_mergesort_i1i1ii..L9
+_G_mergesort_i1i1ii..L33:
+mov ecx, dword ptr [r15]
+movsx r8, r10d
+imul r8, 4
+add r8, rsi
+mov dword ptr [r8], ecx
+add edx, 1
+jmp _G_mergesort_i1i1ii..L19
+_G_mergesort_i1i1ii..L34:
+mov rcx, rbx
+add rcx, 8
+mov r9, r13
+add r9, 8
+mov r8d, dword ptr [rbp-48]
+mov rdi, qword ptr [rbp-40]
+mov r14d, dword ptr [rbp-44]
+_G_mergesort_i1i1ii..L35:
+cmp esi, r12d
+jge _G_mergesort_i1i1ii..L45
+_G_mergesort_i1i1ii..L36:
+movsx rax, esi
+imul rax, 4
+add rax, rcx
+mov r11d, dword ptr [rax]
+movsx rax, r10d
+imul rax, 4
+add rax, r9
+mov dword ptr [rax], r11d
+add esi, 1
+add r10d, 1
+jmp _G_mergesort_i1i1ii..L35
+_G_mergesort_i1i1ii..L37:
+mov r15, rbx
+add r15, 8
+mov rax, r13
+add rax, 8
+mov r12, qword ptr [rbp-32]
+mov rsi, qword ptr [rbp-8]
+_G_mergesort_i1i1ii..L38:
+cmp edx, r14d
+jge _G_mergesort_i1i1ii..L48
+_G_mergesort_i1i1ii..L39:
+movsx r11, edx
+imul r11, 4
+add r11, r15
+mov r9d, dword ptr [r11]
+movsx r11, r10d
+imul r11, 4
+add r11, rax
+mov dword ptr [r11], r9d
+add edx, 1
+add r10d, 1
+jmp _G_mergesort_i1i1ii..L38
+_G_mergesort_i1i1ii..L40:
+mov r15, rbx
+add r15, 8
+mov r8, r13
+add r8, 8
+mov r10d, dword ptr [rbp-48]
+mov rsi, qword ptr [rbp-40]
+mov r12, qword ptr [rbp-32]
+_G_mergesort_i1i1ii..L41:
+cmp r9d, r14d
+jge _G_mergesort_i1i1ii..L51
+_G_mergesort_i1i1ii..L42:
+movsx rdi, r9d
+imul rdi, 4
+add rdi, r15
+mov eax, dword ptr [rdi]
+movsx rdi, r11d
+imul rdi, 4
+add rdi, r8
+mov dword ptr [rdi], eax
+add r9d, 1
+add r11d, 1
+jmp _G_mergesort_i1i1ii..L41
+_G_mergesort_i1i1ii..L43:
+mov ecx, dword ptr [r14]
+movsx r8, r10d
+imul r8, 4
+add r8, r11
+mov dword ptr [r8], ecx
+add edx, 1
+jmp _G_mergesort_i1i1ii..L26
+_G_mergesort_i1i1ii..L44:
+mov edi, dword ptr [r12]
+movsx r12, r11d
+imul r12, 4
+add r12, r10
+mov dword ptr [r12], edi
+add edx, 1
+jmp _G_mergesort_i1i1ii..L12
+_G_mergesort_i1i1ii..L45:
+mov rcx, rbx
+add rcx, 8
+mov rax, r13
+add rax, 8
+mov r12, qword ptr [rbp-32]
+mov rsi, qword ptr [rbp-8]
+_G_mergesort_i1i1ii..L46:
+cmp edx, r15d
+jge _G_mergesort_i1i1ii..L54
+_G_mergesort_i1i1ii..L47:
+movsx r11, edx
+imul r11, 4
+add r11, rcx
+mov r9d, dword ptr [r11]
+movsx r11, r10d
+imul r11, 4
+add r11, rax
+mov dword ptr [r11], r9d
+add edx, 1
+add r10d, 1
+jmp _G_mergesort_i1i1ii..L46
+_G_mergesort_i1i1ii..L48:
+mov r15, r13
+add r15, 8
+mov rax, rbx
+add rax, 8
+mov r9d, r8d
+mov r11, qword ptr [rbp-16]
+_G_mergesort_i1i1ii..L49:
+cmp r9d, r14d
+jge _G_mergesort_i1i1ii..L57
+_G_mergesort_i1i1ii..L50:
+movsx rdx, r9d
+imul rdx, 4
+mov r10, r15
+add r10, rdx
+mov r10d, dword ptr [r10]
+add rdx, rax
+mov dword ptr [rdx], r10d
+add r9d, 1
+jmp _G_mergesort_i1i1ii..L49
+_G_mergesort_i1i1ii..L51:
+mov r15, rbx
+add r15, 8
+mov r8, r13
+add r8, 8
+mov r9, qword ptr [rbp-8]
+mov r14, qword ptr [rbp-16]
+_G_mergesort_i1i1ii..L52:
+cmp edx, ecx
+jge _G_mergesort_i1i1ii..L58
+_G_mergesort_i1i1ii..L53:
+movsx rdi, edx
+imul rdi, 4
+add rdi, r15
+mov eax, dword ptr [rdi]
+movsx rdi, r11d
+imul rdi, 4
+add rdi, r8
+mov dword ptr [rdi], eax
+add edx, 1
+add r11d, 1
+jmp _G_mergesort_i1i1ii..L52
+_G_mergesort_i1i1ii..L54:
+mov rcx, r13
+add rcx, 8
+mov rax, rbx
+add rax, 8
+mov r10d, r14d
+mov r11, qword ptr [rbp-16]
+_G_mergesort_i1i1ii..L55:
+cmp r10d, r15d
+jge _G_mergesort_i1i1ii..L61
+_G_mergesort_i1i1ii..L56:
+movsx r9, r10d
+imul r9, 4
+mov rdx, rcx
+add rdx, r9
+mov edx, dword ptr [rdx]
+add r9, rax
+mov dword ptr [r9], edx
+add r10d, 1
+jmp _G_mergesort_i1i1ii..L55
+_G_mergesort_i1i1ii..L57:
+mov r15, qword ptr [rbp-24]
+jmp _G_mergesort_i1i1ii..L4
+_G_mergesort_i1i1ii..L58:
+add r13, 8
+add rbx, 8
+mov r15, qword ptr [rbp-24]
+_G_mergesort_i1i1ii..L59:
+cmp r10d, ecx
+jge _G_mergesort_i1i1ii..L62
+_G_mergesort_i1i1ii..L60:
+movsx rax, r10d
+imul rax, 4
+mov rdx, r13
+add rdx, rax
+mov r8d, dword ptr [rdx]
+add rax, rbx
+mov dword ptr [rax], r8d
+add r10d, 1
+jmp _G_mergesort_i1i1ii..L59
+_G_mergesort_i1i1ii..L61:
+mov rax, qword ptr [rbp-24]
+mov rcx, r15
+jmp _G_mergesort_i1i1ii..L6
+_G_mergesort_i1i1ii..L62:
+mov rbx, rsi
+mov r13, r9
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+main:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+main..L0:
+mov qword ptr [rbp-96], r15
+mov qword ptr [rbp-88], rbx
+mov qword ptr [rbp-80], r13
+lea rbx, [rbp-4]
+lea r13, [rbp-8]
+lea r15, [rbp-12]
+mov rdi, offset _C_0
+mov rsi, r15
+call scanf
+mov r15d, dword ptr [r15]
+mov rdi, offset _C_0
+mov rsi, r13
+call scanf
+mov r13d, dword ptr [r13]
+mov rdi, offset _C_0
+mov rsi, rbx
+mov qword ptr [rbp-72], r12
+mov qword ptr [rbp-64], r14
+call scanf
+mov r14d, dword ptr [rbx]
+mov dword ptr [_GV_seed], r14d
+movsx r12, r15d
+mov r14, r12
+imul r14, 4
+add r14, 8
+mov rbx, r14
+add rbx, 16
+mov rdi, rbx
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L20
+main..L1:
+mov dword ptr [rbp-112], r13d
+mov rdi, rax
+mov esi, 0
+mov rdx, r14
+mov r13, rax
+call memset
+mov eax, dword ptr [rbp-112]
+mov r10, r13
+mov r13, rax
+main..L2:
+mov qword ptr [r10], r12
+cmp r10, 0
+je main..L5
+main..L3:
+mov r11, qword ptr [r10-16]
+cmp r11, -1
+je main..L5
+main..L4:
+add r11, 1
+mov qword ptr [r10-16], r11
+main..L5:
+mov dword ptr [rbp-112], r13d
+mov rdi, r10
+mov esi, 1
+mov r13, r10
+call __release_array_internal
+mov rdi, rbx
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L21
+main..L6:
+mov dword ptr [rbp-24], r15d
+mov rdi, rax
+mov esi, 0
+mov rdx, r14
+mov r15, rax
+call memset
+mov eax, dword ptr [rbp-24]
+mov r10, r15
+mov r15, rax
+main..L7:
+mov qword ptr [r10], r12
+cmp r10, 0
+je main..L10
+main..L8:
+mov r11, qword ptr [r10-16]
+cmp r11, -1
+je main..L10
+main..L9:
+add r11, 1
+mov qword ptr [r10-16], r11
+main..L10:
+mov dword ptr [rbp-24], r15d
+mov rdi, r10
+mov esi, 1
+mov r15, r10
+call __release_array_internal
+mov rdi, rbx
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L22
+main..L11:
+mov rdi, rax
+mov esi, 0
+mov rdx, r14
+mov rbx, rax
+call memset
+main..L12:
+mov qword ptr [rbx], r12
+cmp rbx, 0
+je main..L15
+main..L13:
+mov r11, qword ptr [rbx-16]
+cmp r11, -1
+je main..L15
+main..L14:
+add r11, 1
+mov qword ptr [rbx-16], r11
+main..L15:
+mov rdi, rbx
+mov esi, 1
+call __release_array_internal
+mov rdi, r13
+add rdi, 8
+mov rcx, r15
+add rcx, 8
+mov esi, dword ptr [rbp-24]
+mov r9d, esi
+sub r9d, 1
+mov r8, r13
+add r8, 8
+mov r14, r15
+add r14, 8
+mov r10, r13
+add r10, 8
+mov edx, 0
+mov r12d, 0
+mov r11d, dword ptr [rbp-112]
+main..L16:
+cmp edx, r11d
+jge main..L23
+main..L17:
+mov r11d, 0
+mov dword ptr [rbp-108], edx
+mov dword ptr [rbp-104], r12d
+main..L18:
+cmp r11d, esi
+jge main..L31
+main..L19:
+mov eax, dword ptr [_GV_seed]
+imul eax, 1103
+add eax, 12345
+mov r12d, 65536
+cdq
+idiv r12d
+mov dword ptr [_GV_seed], edx
+mov r12d, dword ptr [_GV_seed]
+movsx rax, r11d
+imul rax, 4
+mov rdx, rdi
+add rdx, rax
+mov dword ptr [rdx], r12d
+mov r12d, dword ptr [rdx]
+add rax, rcx
+mov dword ptr [rax], r12d
+add r11d, 1
+jmp main..L18
+main..L20:
+mov r10, 0
+jmp main..L2
+main..L21:
+mov r10, 0
+jmp main..L7
+main..L22:
+mov rbx, 0
+jmp main..L12
+main..L23:
+mov rdi, 36
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r14, rax
+add r14, 8
+mov rdi, r14
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r12
+mov r12, rax
+call snprintf
+mov rdi, r14
+call strlen
+mov qword ptr [r12], rax
+cmp r12, 0
+je main..L30
+main..L24:
+mov rdi, r14
+call puts
+main..L25:
+cmp r12, 0
+je main..L29
+main..L26:
+sub r12, 16
+mov rax, qword ptr [r12]
+cmp rax, -1
+je main..L29
+main..L27:
+sub rax, 1
+mov qword ptr [r12], rax
+cmp rax, 0
+jne main..L29
+main..L28:
+mov rdi, r12
+call __dealloc
+main..L29:
+mov esi, 1
+mov rdi, r13
+call __release_array_internal
+mov esi, 1
+mov rdi, r15
+call __release_array_internal
+mov esi, 1
+mov rdi, rbx
+call __release_array_internal
+mov eax, 0
+mov rbx, qword ptr [rbp-88]
+mov r12, qword ptr [rbp-72]
+mov r13, qword ptr [rbp-80]
+mov r14, qword ptr [rbp-64]
+mov r15, qword ptr [rbp-96]
+mov rsp, rbp
+pop rbp
+ret
+main..L30:
+mov edi, 10
+call putchar
+jmp main..L25
+main..L31:
+mov qword ptr [rbp-32], r10
+mov qword ptr [rbp-56], rdi
+mov qword ptr [rbp-48], rcx
+mov rdi, r13
+mov qword ptr [rbp-24], r13
+mov r12d, 0
+mov edx, r9d
+mov dword ptr [rbp-100], r9d
+mov r13, r8
+xchg r12, rsi
+call _G_quicksort_i1ii
+mov rdi, r15
+mov rsi, rbx
+mov edx, 0
+mov ecx, r12d
+call _G_mergesort_i1i1ii
+mov edx, 0
+mov rax, qword ptr [rbp-88]
+mov rcx, qword ptr [rbp-72]
+mov r9, qword ptr [rbp-80]
+mov r11, qword ptr [rbp-64]
+mov rsi, qword ptr [rbp-24]
+mov r10, qword ptr [rbp-32]
+main..L32:
+cmp edx, r12d
+jge main..L37
+main..L33:
+movsx rax, edx
+imul rax, 4
+mov r8, r13
+add r8, rax
+mov edi, dword ptr [r8]
+add rax, r14
+mov r8d, dword ptr [rax]
+cmp edi, r8d
+je main..L40
+main..L34:
+mov rdi, offset _C_7
+cmp rdi, 0
+je main..L41
+main..L35:
+add rdi, 8
+mov r12, rcx
+mov r13, r9
+mov r14, rsi
+call puts
+mov r9, qword ptr [rbp-64]
+mov rax, r13
+main..L36:
+mov esi, 1
+mov rdi, r14
+mov r13, rax
+mov r14, r9
+call __release_array_internal
+mov esi, 1
+mov rdi, r15
+call __release_array_internal
+mov esi, 1
+mov rdi, rbx
+call __release_array_internal
+mov eax, 0
+mov rbx, qword ptr [rbp-88]
+mov r15, qword ptr [rbp-96]
+mov rsp, rbp
+pop rbp
+ret
+main..L37:
+mov eax, 0
+mov r8d, 0
+mov qword ptr [rbp-40], rbx
+mov qword ptr [rbp-32], r13
+mov qword ptr [rbp-24], r14
+mov r11d, dword ptr [rbp-112]
+mov rdi, qword ptr [rbp-56]
+mov rcx, qword ptr [rbp-48]
+mov r9d, dword ptr [rbp-100]
+mov ebx, dword ptr [rbp-108]
+mov r13d, dword ptr [rbp-104]
+main..L38:
+cmp r8d, r12d
+jge main..L42
+main..L39:
+imul eax, 31
+movsx r14, r8d
+imul r14, 4
+add r14, r10
+mov edx, dword ptr [r14]
+add eax, edx
+mov r14d, 1000003
+cdq
+idiv r14d
+mov eax, edx
+add r8d, 1
+jmp main..L38
+main..L40:
+add edx, 1
+jmp main..L32
+main..L41:
+mov edi, 10
+mov r12, rcx
+mov r13, r11
+mov r14, rsi
+call putchar
+mov rax, qword ptr [rbp-80]
+mov r9, r13
+jmp main..L36
+main..L42:
+add r13d, eax
+mov r14d, 1000003
+mov rax, r13
+mov r13, rsi
+mov rsi, r12
+cdq
+idiv r14d
+mov r12d, edx
+mov edx, ebx
+add edx, 1
+mov rbx, qword ptr [rbp-40]
+mov r8, qword ptr [rbp-32]
+mov r14, qword ptr [rbp-24]
+jmp main..L16
+_C_0:
+.byte 37, 100, 0
+_C_1:
+.byte 82, 117, 110, 116, 105, 109, 101, 32, 69, 114, 114, 111, 114, 58, 32, 0
+_C_2:
+.byte 83, 117, 98, 115, 99, 114, 105, 112, 116, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 0
+_C_3:
+.byte 78, 117, 108, 108, 32, 112, 111, 105, 110, 116, 101, 114, 0
+_C_4:
+.byte 66, 97, 100, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 0
+_C_5:
+.byte 10, 0
+_C_6:
+.byte 37, 115, 0
+.balign 8
+.byte 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0
+_C_7:
+.byte 8, 0, 0, 0, 0, 0, 0, 0, 109, 105, 115, 109, 97, 116, 99, 104, 0
+.section .bss
+.balign 16
+_GV___heap:
+.zero 8
+_GV_seed:
+.zero 4
@@ -0,0 +1,1409 @@
+extern strcmp, malloc, free, scanf, puts, printf, putchar, getchar, snprintf, strlen, memcpy, sscanf, fputs, stderr, exit, memset, mmap
+global main
+	section .text
+__runtime_error:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 16
+.L0:
+	mov qword [rbp-16], r12
+	mov qword [rbp-8], r15
+	mov r15, qword [stderr]
+	mov r10, _C_1
+	mov rsi, r15
+	mov r12, rdi
+	mov rdi, r10
+	call fputs
+	mov rsi, r15
+	mov rdi, r12
+	call fputs
+	mov rdi, _C_5
+	mov rsi, r15
+	call fputs
+	mov edi, -1
+	call exit
+	mov r12, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+__alloc:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 32
+.L0:
+	mov r10, qword [_GV___heap]
+	cmp r10, 0
+	je .L7
+.L1:
+	mov r11, r12
+	mov r12, rdi
+.L2:
+	mov r8, r12
+	add r8, 23
+	shr r8, 4
+	cmp r8, 32
+	ja .L11
+.L3:
+	mov rdi, r8
+	sal rdi, 3
+	add rdi, r10
+	mov rax, qword [rdi+8]
+	cmp rax, 0
+	jne .L13
+.L4:
+	mov r12, r8
+	sal r12, 4
+	mov qword [rbp-32], r11
+	mov qword [rbp-24], r13
+	mov qword [rbp-16], r14
+	mov qword [rbp-8], r15
+	mov r13, r10
+.L5:
+	mov rax, qword [r13]
+	mov rcx, rax
+	add rcx, r12
+	mov rdi, qword [r13+8]
+	cmp rcx, rdi
+	ja .L14
+.L6:
+	mov qword [r13], rcx
+	mov qword [rax], r8
+	add rax, 8
+	mov r12, qword [rbp-32]
+	mov r13, qword [rbp-24]
+	mov r14, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L7:
+	mov qword [rbp-32], r12
+	mov r10, 0
+	mov rsi, 1048576
+	mov edx, 3
+	mov ecx, 34
+	mov r8d, -1
+	mov r9, 0
+	mov r12, rdi
+	mov rdi, r10
+	call mmap
+	cmp rax, -1
+	je .L9
+.L8:
+	mov qword [_GV___heap], rax
+	mov r10, rax
+	mov rdi, rax
+	add rdi, 272
+	mov qword [rax], rdi
+	mov rsi, rax
+	add rsi, 1048576
+	mov qword [rax+8], rsi
+	mov r11, qword [rbp-32]
+	jmp .L2
+.L9:
+	mov r12, qword [rbp-32]
+.L10:
+	mov rdi, _C_4
+	call __runtime_error
+	mov rax, 0
+	mov rsp, rbp
+	pop rbp
+	ret
+.L11:
+	add r12, 8
+	mov rdi, r12
+	mov r12, r11
+	call malloc
+	cmp rax, 0
+	je .L10
+.L12:
+	mov qword [rax], 0
+	add rax, 8
+	mov rsp, rbp
+	pop rbp
+	ret
+.L13:
+	mov r10, qword [rax]
+	mov qword [rdi+8], r10
+	mov r12, r11
+	mov rsp, rbp
+	pop rbp
+	ret
+.L14:
+	mov rdi, 0
+	mov rsi, 1048576
+	mov edx, 3
+	mov ecx, 34
+	mov r15d, -1
+	mov r9, 0
+	mov r14, r8
+	mov r8, r15
+	call mmap
+	cmp rax, -1
+	je .L16
+.L15:
+	mov qword [r13], rax
+	add rax, 1048576
+	mov qword [r13+8], rax
+	mov r8, r14
+	jmp .L5
+.L16:
+	mov r12, qword [rbp-32]
+	mov r13, qword [rbp-24]
+	mov r14, qword [rbp-16]
+	mov r15, qword [rbp-8]
+	jmp .L10
+
+__dealloc:
+.L0:
+	mov rax, rdi
+	sub rax, 8
+	mov r10, qword [rax]
+	cmp r10, 0
+	je .L2
+.L1:
+	mov rax, qword [_GV___heap]
+	sal r10, 3
+	add r10, rax
+	mov r11, qword [r10+8]
+	mov qword [rdi], r11
+	mov qword [r10+8], rdi
+	xor rax, rax
+	ret
+.L2:
+	push rbp
+	mov rbp, rsp
+	mov rdi, rax
+	call free
+	mov rsp, rbp
+	pop rbp
+	xor rax, rax
+	ret
+
+main:
+	push rbp
+	mov rbp, rsp
+	sub rsp, 112
+.L0:
+	mov qword [rbp-96], r13
+	mov qword [rbp-88], rbx
+	lea rbx, [rbp-4]
+	lea r13, [rbp-8]
+	mov rdi, _C_0
+	mov rsi, r13
+	call scanf
+	mov r13d, dword [r13]
+	mov r10, _C_7
+	cmp r10, 0
+	je .L3
+.L1:
+	mov r11, qword [r10-16]
+	cmp r11, -1
+	je .L3
+.L2:
+	add r11, 1
+	mov qword [r10-16], r11
+.L3:
+	mov dil, 0
+	test dil, dil
+	jnz .L61
+.L4:
+	mov rsi, 50
+.L5:
+	mov dl, 0
+	test dl, dl
+	jnz .L62
+.L6:
+	mov r8, 100
+.L7:
+	mov r11d, 0
+	mov r9d, 0
+	mov qword [rbp-80], r12
+	mov qword [rbp-72], r14
+	mov qword [rbp-64], r15
+.L8:
+	cmp r11d, r13d
+	jge .L63
+.L9:
+	mov r12d, 97
+	mov eax, r11d
+	mov qword [rbp-48], rbx
+	mov qword [rbp-40], rsi
+	mov qword [rbp-32], r8
+	cdq
+	idiv r12d
+	mov rdi, 36
+	mov rbx, r10
+	mov r12, r9
+	mov r14, rdx
+	mov r15, r11
+	mov dword [rbp-108], r13d
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r13, rax
+	add r13, 8
+	mov rdi, r13
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r14
+	mov r14, rax
+	call snprintf
+	mov rdi, r13
+	call strlen
+	mov qword [r14], rax
+	cmp rbx, 0
+	je .L68
+.L10:
+	cmp r14, 0
+	je .L72
+.L11:
+	mov dword [rbp-104], r12d
+	mov dword [rbp-100], r15d
+	mov r12, qword [rbx]
+	mov r15, qword [r14]
+	mov qword [rbp-24], r14
+	mov r14, r12
+	add r14, r15
+	mov rdi, r14
+	add rdi, 9
+	add rdi, 16
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r10, rax
+	add r10, 8
+	mov qword [rbp-16], rax
+	mov rsi, rbx
+	add rsi, 8
+	mov qword [rbp-56], rbx
+	mov rdi, r10
+	mov rdx, r12
+	mov rbx, r10
+	call memcpy
+	add rbx, r12
+	mov rdi, rbx
+	mov rdx, r15
+	mov rsi, r13
+	call memcpy
+	mov byte [rbx+r15], 0
+	mov r13, qword [rbp-16]
+	mov qword [r13], r14
+	mov r15d, dword [rbp-100]
+	mov rbx, qword [rbp-56]
+	mov r12d, dword [rbp-104]
+	mov r14, qword [rbp-24]
+.L12:
+	cmp rbx, 0
+	je .L16
+.L13:
+	sub rbx, 16
+	mov r11, qword [rbx]
+	cmp r11, -1
+	je .L16
+.L14:
+	sub r11, 1
+	mov qword [rbx], r11
+	cmp r11, 0
+	jne .L16
+.L15:
+	mov rdi, rbx
+	call __dealloc
+.L16:
+	cmp r13, 0
+	setne bl
+	test bl, bl
+	jz .L19
+.L17:
+	mov r10, qword [r13-16]
+	cmp r10, -1
+	je .L19
+.L18:
+	add r10, 1
+	mov qword [r13-16], r10
+.L19:
+	test bl, bl
+	jz .L23
+.L20:
+	mov rdi, r13
+	sub rdi, 16
+	mov r11, qword [rdi]
+	cmp r11, -1
+	je .L23
+.L21:
+	sub r11, 1
+	mov qword [rdi], r11
+	cmp r11, 0
+	jne .L23
+.L22:
+	call __dealloc
+.L23:
+	cmp r14, 0
+	je .L27
+.L24:
+	sub r14, 16
+	mov rax, qword [r14]
+	cmp rax, -1
+	je .L27
+.L25:
+	sub rax, 1
+	mov qword [r14], rax
+	cmp rax, 0
+	jne .L27
+.L26:
+	mov rdi, r14
+	call __dealloc
+.L27:
+	cmp r13, 0
+	sete r14b
+	test r14b, r14b
+	jnz .L115
+.L28:
+	mov r10d, dword [r13]
+.L29:
+	cmp r10d, 200
+	jle .L117
+.L30:
+	imul r12d, 31
+	mov al, 0
+	test al, al
+	jnz .L119
+.L31:
+	test r14b, r14b
+	jnz .L121
+.L32:
+	mov r11, qword [r13]
+	cmp r11, 54
+	jle .L122
+.L33:
+	mov r11, 54
+.L34:
+	mov rsi, qword [rbp-40]
+	cmp rsi, r11
+	jg .L120
+.L35:
+	mov byte [rbp-24], bl
+	mov dword [rbp-100], r15d
+	sub r11, rsi
+	add r11, 1
+	mov rdi, r11
+	add rdi, 9
+	add rdi, 16
+	mov rbx, rsi
+	mov r15, r11
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov rsi, r13
+	add rsi, 8
+	mov qword [rbp-16], r13
+	add rsi, rbx
+	mov r13, rax
+	add r13, 8
+	mov rdi, r13
+	mov rdx, r15
+	mov rbx, rax
+	call memcpy
+	mov byte [r13+r15], 0
+	mov qword [rbx], r15
+	mov r11, rbx
+	mov rsi, qword [rbp-40]
+	mov r15d, dword [rbp-100]
+	mov r13, qword [rbp-16]
+	mov bl, byte [rbp-24]
+.L36:
+	cmp r11, 0
+	je .L124
+.L37:
+	mov byte [rbp-24], bl
+	mov dword [rbp-100], r15d
+	mov rdi, r11
+	add rdi, 8
+	mov rsi, _C_0
+	mov rbx, qword [rbp-48]
+	mov rdx, rbx
+	mov r15, r11
+	call sscanf
+	mov r8d, dword [rbx]
+	mov rsi, qword [rbp-40]
+	mov edi, dword [rbp-100]
+	mov r9b, byte [rbp-24]
+	mov r11, r15
+.L38:
+	add r12d, r8d
+	mov r15d, 1000003
+	mov rax, r12
+	cdq
+	idiv r15d
+	cmp r11, 0
+	je .L125
+.L39:
+	sub r11, 16
+	mov rax, qword [r11]
+	cmp rax, -1
+	je .L125
+.L40:
+	sub rax, 1
+	mov qword [r11], rax
+	cmp rax, 0
+	jne .L125
+.L41:
+	mov rbx, rdx
+	mov r12, r9
+	mov r15, rdi
+	mov rdi, r11
+	call __dealloc
+	mov rax, qword [rbp-48]
+	mov rsi, qword [rbp-40]
+	mov rdx, rbx
+	mov r9, r12
+	mov rbx, rax
+.L42:
+	test r14b, r14b
+	jnz .L139
+.L43:
+	mov r11d, dword [r13]
+.L44:
+	sub r11d, 1
+	cmp r11d, 100
+	jl .L173
+.L45:
+	test r14b, r14b
+	jnz .L179
+.L46:
+	movsx r14, r11d
+	mov rcx, qword [r13]
+	cmp r14, rcx
+	jge .L184
+.L47:
+	mov r8, qword [rbp-32]
+	cmp r8, r14
+	jg .L174
+.L48:
+	mov dword [rbp-104], edx
+	sub r14, r8
+	add r14, 1
+	mov rdi, r14
+	add rdi, 9
+	add rdi, 16
+	mov rbx, r8
+	mov r12, r9
+	mov dword [rbp-100], r15d
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov rsi, r13
+	add rsi, 8
+	add rsi, rbx
+	mov rbx, rax
+	add rbx, 8
+	mov rdi, rbx
+	mov rdx, r14
+	mov r15, rax
+	call memcpy
+	mov byte [rbx+r14], 0
+	mov qword [r15], r14
+	mov r14, r15
+	mov rbx, qword [rbp-48]
+	mov rsi, qword [rbp-40]
+	mov r8, qword [rbp-32]
+	mov r15d, dword [rbp-100]
+	mov edx, dword [rbp-104]
+.L49:
+	test r12b, r12b
+	jz .L185
+.L50:
+	sub r13, 16
+	mov rdi, qword [r13]
+	cmp rdi, -1
+	je .L185
+.L51:
+	sub rdi, 1
+	mov qword [r13], rdi
+	cmp rdi, 0
+	jne .L185
+.L52:
+	mov rdi, r13
+	mov r12, rdx
+	mov r13, rsi
+	call __dealloc
+	mov r8, qword [rbp-32]
+.L53:
+	mov r10, r14
+	cmp r14, 0
+	setne r11b
+	test r11b, r11b
+	jz .L56
+.L54:
+	mov rdi, qword [r14-16]
+	cmp rdi, -1
+	je .L56
+.L55:
+	add rdi, 1
+	mov qword [r14-16], rdi
+.L56:
+	test r11b, r11b
+	jz .L196
+.L57:
+	sub r14, 16
+	mov r11, qword [r14]
+	cmp r11, -1
+	je .L196
+.L58:
+	sub r11, 1
+	mov qword [r14], r11
+	cmp r11, 0
+	jne .L196
+.L59:
+	mov rdi, r14
+	mov r14, r10
+	call __dealloc
+	mov r8, qword [rbp-32]
+	mov rsi, r13
+	mov r9, r12
+	mov r10, r14
+.L60:
+	mov r11d, r15d
+	add r11d, 1
+	mov r13d, dword [rbp-108]
+	jmp .L8
+.L61:
+	mov rsi, 0
+	jmp .L5
+.L62:
+	mov r8, 0
+	jmp .L7
+.L63:
+	mov rdi, r10
+	add rdi, 8
+	mov ecx, 0
+	mov r11, qword [rbp-88]
+	mov r15, qword [rbp-80]
+	mov r8, qword [rbp-96]
+	mov rsi, qword [rbp-72]
+	mov r14, qword [rbp-64]
+.L64:
+	cmp r10, 0
+	sete r12b
+	test r12b, r12b
+	jnz .L73
+.L65:
+	mov edx, dword [r10]
+.L66:
+	cmp ecx, edx
+	jge .L74
+.L67:
+	imul r9d, 31
+	movsx rax, ecx
+	mov dl, byte [rdi+rax]
+	movzx r12d, dl
+	add r9d, r12d
+	mov ebx, 1000003
+	mov rax, r9
+	cdq
+	idiv ebx
+	mov r9d, edx
+	add ecx, 1
+	jmp .L64
+.L68:
+	cmp r14, 0
+	je .L71
+.L69:
+	mov r13, r14
+.L70:
+	mov dword [rbp-100], r15d
+	mov r15, qword [r13]
+	add r15, 9
+	mov rdi, r15
+	add rdi, 16
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov rdi, rax
+	mov rdx, r15
+	mov rsi, r13
+	mov r13, rax
+	call memcpy
+	mov r15d, dword [rbp-100]
+	jmp .L12
+.L71:
+	mov r13, 0
+	jmp .L12
+.L72:
+	mov r13, rbx
+	jmp .L70
+.L73:
+	mov edx, 0
+	jmp .L66
+.L74:
+	mov rdi, 36
+	mov rbx, r10
+	mov r14, r9
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r15, rax
+	add r15, 8
+	mov rdi, r15
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r14
+	mov r14, rax
+	call snprintf
+	mov rdi, r15
+	call strlen
+	mov qword [r14], rax
+	cmp r14, 0
+	je .L114
+.L75:
+	mov rdi, r15
+	call puts
+.L76:
+	cmp r14, 0
+	je .L80
+.L77:
+	sub r14, 16
+	mov rax, qword [r14]
+	cmp rax, -1
+	je .L80
+.L78:
+	sub rax, 1
+	mov qword [r14], rax
+	cmp rax, 0
+	jne .L80
+.L79:
+	mov rdi, r14
+	call __dealloc
+.L80:
+	test r12b, r12b
+	jnz .L116
+.L81:
+	mov r12d, dword [rbx]
+.L82:
+	mov rdi, 36
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r14, rax
+	add r14, 8
+	mov rdi, r14
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r12
+	mov r15, rax
+	call snprintf
+	mov rdi, r14
+	call strlen
+	mov qword [r15], rax
+	cmp r15, 0
+	je .L118
+.L83:
+	mov rdi, r14
+	call puts
+.L84:
+	cmp r15, 0
+	je .L88
+.L85:
+	sub r15, 16
+	mov r14, qword [r15]
+	cmp r14, -1
+	je .L88
+.L86:
+	sub r14, 1
+	mov qword [r15], r14
+	cmp r14, 0
+	jne .L88
+.L87:
+	mov rdi, r15
+	call __dealloc
+.L88:
+	mov r15d, 10
+	mov rax, r13
+	cdq
+	idiv r15d
+	add eax, 1
+	movsx r15, eax
+	mov r14, r15
+	imul r14, 8
+	add r14, 8
+	mov rdi, r14
+	add rdi, 16
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	cmp rax, 0
+	je .L123
+.L89:
+	mov rdi, rax
+	mov esi, 0
+	mov rdx, r14
+	mov r12, rax
+	call memset
+.L90:
+	mov qword [r12], r15
+	cmp r12, 0
+	je .L93
+.L91:
+	mov r11, qword [r12-16]
+	cmp r11, -1
+	je .L93
+.L92:
+	add r11, 1
+	mov qword [r12-16], r11
+.L93:
+	mov rcx, _C_8
+	mov r14, r12
+	add r14, 8
+	mov r15, rcx
+	add r15, 8
+	mov r13d, 0
+	mov qword [rbp-56], rbx
+.L94:
+	mov rdi, qword [r12]
+	cmp r13d, edi
+	jge .L126
+.L95:
+	mov eax, r13d
+	imul eax, 7
+	mov ebx, 1000
+	mov qword [rbp-48], r12
+	cdq
+	idiv ebx
+	mov rdi, 36
+	mov rbx, rdx
+	mov r12, rcx
+	mov qword [rbp-40], r15
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r15, rax
+	add r15, 8
+	mov rdi, r15
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, rbx
+	mov rbx, rax
+	call snprintf
+	mov rdi, r15
+	call strlen
+	mov qword [rbx], rax
+	cmp r12, 0
+	je .L140
+.L96:
+	cmp rbx, 0
+	je .L142
+.L97:
+	mov qword [rbp-32], r14
+	mov r14, qword [r12]
+	mov r12, qword [rbx]
+	mov qword [rbp-24], rbx
+	mov rbx, r14
+	add rbx, r12
+	mov rdi, rbx
+	add rdi, 9
+	add rdi, 16
+	mov dword [rbp-100], r13d
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r13, rax
+	add r13, 8
+	mov qword [rbp-16], rax
+	mov rdi, r13
+	mov rsi, qword [rbp-40]
+	mov rdx, r14
+	call memcpy
+	add r14, r13
+	mov rdi, r14
+	mov rdx, r12
+	mov rsi, r15
+	call memcpy
+	mov byte [r14+r12], 0
+	mov r15, qword [rbp-16]
+	mov qword [r15], rbx
+	mov r12, _C_8
+	mov r14, qword [rbp-32]
+	mov r13d, dword [rbp-100]
+	mov rbx, qword [rbp-24]
+.L98:
+	movsx r10, r13d
+	imul r10, 8
+	add r10, r14
+	mov rdi, qword [r10]
+	cmp rdi, 0
+	je .L102
+.L99:
+	sub rdi, 16
+	mov rcx, qword [rdi]
+	cmp rcx, -1
+	je .L102
+.L100:
+	sub rcx, 1
+	mov qword [rdi], rcx
+	cmp rcx, 0
+	jne .L102
+.L101:
+	mov qword [rbp-32], r14
+	mov r14, r10
+	call __dealloc
+	mov rax, qword [rbp-32]
+	mov r10, r14
+	mov r14, rax
+.L102:
+	mov qword [r10], r15
+	cmp r15, 0
+	setne r10b
+	test r10b, r10b
+	jz .L105
+.L103:
+	mov r11, qword [r15-16]
+	cmp r11, -1
+	je .L105
+.L104:
+	add r11, 1
+	mov qword [r15-16], r11
+.L105:
+	test r10b, r10b
+	jz .L109
+.L106:
+	sub r15, 16
+	mov r10, qword [r15]
+	cmp r10, -1
+	je .L109
+.L107:
+	sub r10, 1
+	mov qword [r15], r10
+	cmp r10, 0
+	jne .L109
+.L108:
+	mov rdi, r15
+	call __dealloc
+.L109:
+	cmp rbx, 0
+	je .L189
+.L110:
+	sub rbx, 16
+	mov r15, qword [rbx]
+	cmp r15, -1
+	je .L189
+.L111:
+	sub r15, 1
+	mov qword [rbx], r15
+	cmp r15, 0
+	jne .L189
+.L112:
+	mov rdi, rbx
+	call __dealloc
+	mov rcx, r12
+.L113:
+	add r13d, 1
+	mov r12, qword [rbp-48]
+	mov r15, qword [rbp-40]
+	jmp .L94
+.L114:
+	mov edi, 10
+	call putchar
+	jmp .L76
+.L115:
+	mov r10d, 0
+	jmp .L29
+.L116:
+	mov r12d, 0
+	jmp .L82
+.L117:
+	mov rbx, qword [rbp-48]
+	mov rsi, qword [rbp-40]
+	mov r8, qword [rbp-32]
+	mov r9, r12
+	mov r10, r13
+	jmp .L60
+.L118:
+	mov edi, 10
+	call putchar
+	jmp .L84
+.L119:
+	mov rsi, qword [rbp-40]
+.L120:
+	mov r11, 0
+	jmp .L36
+.L121:
+	mov rsi, qword [rbp-40]
+	jmp .L120
+.L122:
+	sub r11, 1
+	jmp .L34
+.L123:
+	mov r12, 0
+	jmp .L90
+.L124:
+	mov r8d, 0
+	mov r10, qword [rbp-48]
+	mov rdi, r15
+	mov r9, rbx
+	mov rbx, r10
+	jmp .L38
+.L125:
+	mov r15, rdi
+	jmp .L42
+.L126:
+	mov r13, r12
+	add r13, 8
+	mov r10d, 1
+	mov r14d, 0
+	mov r15d, 0
+.L127:
+	mov rdx, qword [r12]
+	cmp r10d, edx
+	jge .L144
+.L128:
+	movsx rbx, r10d
+	imul rbx, 8
+	add rbx, r13
+	mov rdi, qword [rbx]
+	mov r9d, r10d
+	sub r9d, 1
+	movsx r11, r9d
+	imul r11, 8
+	add r11, r13
+	mov rsi, qword [r11]
+	cmp rdi, 0
+	je .L175
+.L129:
+	cmp rsi, 0
+	je .L181
+.L130:
+	mov qword [rbp-48], r12
+	add rdi, 8
+	add rsi, 8
+	mov r12, r10
+	call strcmp
+	mov r10, qword [rbp-48]
+	xchg r12, r10
+.L131:
+	cmp eax, 0
+	jge .L133
+.L132:
+	add r14d, 1
+.L133:
+	mov rdi, qword [rbx]
+	mov r9d, 2
+	mov eax, r10d
+	cdq
+	idiv r9d
+	movsx rdx, eax
+	imul rdx, 8
+	add rdx, r13
+	mov rsi, qword [rdx]
+	cmp rdi, 0
+	je .L190
+.L134:
+	cmp rsi, 0
+	je .L195
+.L135:
+	add rdi, 8
+	add rsi, 8
+	mov rbx, r10
+	call strcmp
+	mov r10, rbx
+.L136:
+	cmp eax, 0
+	jne .L138
+.L137:
+	add r15d, 1
+.L138:
+	add r10d, 1
+	jmp .L127
+.L139:
+	mov r11d, 0
+	jmp .L44
+.L140:
+	cmp rbx, 0
+	je .L143
+.L141:
+	mov r12, rbx
+.L142:
+	mov r15, qword [r12]
+	add r15, 9
+	mov rdi, r15
+	add rdi, 16
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov rdi, rax
+	mov rdx, r15
+	mov rsi, r12
+	mov r15, rax
+	call memcpy
+	mov r12, _C_8
+	jmp .L98
+.L143:
+	mov r15, 0
+	jmp .L98
+.L144:
+	mov rdi, 36
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r13, rax
+	add r13, 8
+	mov rdi, r13
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r14
+	mov rbx, rax
+	call snprintf
+	mov rdi, r13
+	call strlen
+	mov qword [rbx], rax
+	mov r14, _C_9
+	cmp rbx, 0
+	je .L177
+.L145:
+	cmp r14, 0
+	je .L183
+.L146:
+	mov dword [rbp-24], r15d
+	mov r15, qword [rbx]
+	mov qword [rbp-40], rbx
+	mov r12, qword [r14]
+	mov rbx, r15
+	add rbx, r12
+	mov rdi, rbx
+	add rdi, 9
+	add rdi, 16
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r10, rax
+	add r10, 8
+	mov qword [rbp-16], rax
+	add r14, 8
+	mov rdi, r10
+	mov rdx, r15
+	mov rsi, r13
+	mov r13, r10
+	call memcpy
+	add r13, r15
+	mov rdi, r13
+	mov rdx, r12
+	mov rsi, r14
+	call memcpy
+	mov byte [r13+r12], 0
+	mov r12, qword [rbp-16]
+	mov qword [r12], rbx
+	mov r15d, dword [rbp-24]
+	mov rbx, qword [rbp-40]
+.L147:
+	mov rdi, 36
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r14, rax
+	add r14, 8
+	mov rdi, r14
+	mov rsi, 12
+	mov rdx, _C_0
+	mov rcx, r15
+	mov r13, rax
+	call snprintf
+	mov rdi, r14
+	call strlen
+	mov qword [r13], rax
+	cmp r12, 0
+	je .L186
+.L148:
+	cmp r13, 0
+	je .L193
+.L149:
+	mov qword [rbp-40], rbx
+	mov rbx, qword [r12]
+	mov r15, qword [r13]
+	mov qword [rbp-32], r13
+	mov r13, rbx
+	add r13, r15
+	mov rdi, r13
+	add rdi, 9
+	add rdi, 16
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov r10, rax
+	add r10, 8
+	mov qword [rbp-24], rax
+	mov rsi, r12
+	add rsi, 8
+	mov qword [rbp-16], r12
+	mov rdi, r10
+	mov rdx, rbx
+	mov r12, r10
+	call memcpy
+	add r12, rbx
+	mov rdi, r12
+	mov rdx, r15
+	mov rsi, r14
+	call memcpy
+	mov byte [r12+r15], 0
+	mov r14, qword [rbp-24]
+	mov qword [r14], r13
+	mov rbx, qword [rbp-40]
+	mov r12, qword [rbp-16]
+	mov r13, qword [rbp-32]
+.L150:
+	cmp r14, 0
+	je .L197
+.L151:
+	mov rdi, r14
+	add rdi, 8
+	call puts
+.L152:
+	cmp r14, 0
+	je .L156
+.L153:
+	sub r14, 16
+	mov r15, qword [r14]
+	cmp r15, -1
+	je .L156
+.L154:
+	sub r15, 1
+	mov qword [r14], r15
+	cmp r15, 0
+	jne .L156
+.L155:
+	mov rdi, r14
+	call __dealloc
+.L156:
+	cmp r13, 0
+	je .L160
+.L157:
+	sub r13, 16
+	mov r14, qword [r13]
+	cmp r14, -1
+	je .L160
+.L158:
+	sub r14, 1
+	mov qword [r13], r14
+	cmp r14, 0
+	jne .L160
+.L159:
+	mov rdi, r13
+	call __dealloc
+.L160:
+	cmp r12, 0
+	je .L164
+.L161:
+	sub r12, 16
+	mov r13, qword [r12]
+	cmp r13, -1
+	je .L164
+.L162:
+	sub r13, 1
+	mov qword [r12], r13
+	cmp r13, 0
+	jne .L164
+.L163:
+	mov rdi, r12
+	call __dealloc
+.L164:
+	cmp rbx, 0
+	je .L168
+.L165:
+	sub rbx, 16
+	mov r12, qword [rbx]
+	cmp r12, -1
+	je .L168
+.L166:
+	sub r12, 1
+	mov qword [rbx], r12
+	cmp r12, 0
+	jne .L168
+.L167:
+	mov rdi, rbx
+	call __dealloc
+.L168:
+	mov rdi, qword [rbp-56]
+	cmp rdi, 0
+	je .L172
+.L169:
+	sub rdi, 16
+	mov rdx, qword [rdi]
+	cmp rdx, -1
+	je .L172
+.L170:
+	sub rdx, 1
+	mov qword [rdi], rdx
+	cmp rdx, 0
+	jne .L172
+.L171:
+	call __dealloc
+.L172:
+	mov eax, 0
+	mov rbx, qword [rbp-88]
+	mov r12, qword [rbp-80]
+	mov r13, qword [rbp-96]
+	mov r14, qword [rbp-72]
+	mov r15, qword [rbp-64]
+	mov rsp, rbp
+	pop rbp
+	ret
+.L173:
+	mov r8, qword [rbp-32]
+.L174:
+	mov r14, 0
+	mov r12, r9
+	jmp .L49
+.L175:
+	cmp rsi, 0
+	je .L180
+.L176:
+	mov eax, -1
+	jmp .L131
+.L177:
+	cmp r14, 0
+	je .L182
+.L178:
+	mov r13, qword [r14]
+	add r13, 9
+	mov rdi, r13
+	add rdi, 16
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov rdi, rax
+	mov rdx, r13
+	mov rsi, r14
+	mov r12, rax
+	call memcpy
+	jmp .L147
+.L179:
+	mov r8, qword [rbp-32]
+	jmp .L174
+.L180:
+	mov eax, 0
+	jmp .L131
+.L181:
+	mov eax, 1
+	jmp .L131
+.L182:
+	mov r12, 0
+	jmp .L147
+.L183:
+	mov r14, rbx
+	jmp .L178
+.L184:
+	sub rcx, 1
+	mov r14, rcx
+	jmp .L47
+.L185:
+	mov r12, rdx
+	mov r13, rsi
+	jmp .L53
+.L186:
+	cmp r13, 0
+	je .L192
+.L187:
+	mov r15, r13
+.L188:
+	mov r14, qword [r15]
+	add r14, 9
+	mov rdi, r14
+	add rdi, 16
+	call __alloc
+	mov qword [rax], 1
+	mov qword [rax+8], 0
+	add rax, 16
+	mov rdi, rax
+	mov rdx, r14
+	mov rsi, r15
+	mov r14, rax
+	call memcpy
+	jmp .L150
+.L189:
+	mov rcx, r12
+	jmp .L113
+.L190:
+	cmp rsi, 0
+	je .L194
+.L191:
+	mov eax, -1
+	jmp .L136
+.L192:
+	mov r14, 0
+	jmp .L150
+.L193:
+	mov r15, r12
+	jmp .L188
+.L194:
+	mov eax, 0
+	jmp .L136
+.L195:
+	mov eax, 1
+	jmp .L136
+.L196:
+	mov rsi, r13
+	mov r9, r12
+	jmp .L60
+.L197:
+	mov edi, 10
+	call putchar
+	jmp .L152
+
+_C_0:
+	db '%d', 0
+
+_C_1:
+	db 'Runtime Error: ', 0
+
+_C_2:
+	db 'Subscript out of range', 0
+
+_C_3:
+	db 'Null pointer', 0
+
+_C_4:
+	db 'Bad allocation', 0
+
+_C_5:
+	db 10, 0
+
+_C_6:
+	db '%s', 0
+
+	align 8
+	db 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0
+_C_7:
+	db 0, 0, 0, 0, 0, 0, 0, 0, 0
+
+	align 8
+	db 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0
+_C_8:
+	db 1, 0, 0, 0, 0, 0, 0, 0, 'w', 0
+
+	align 8
+	db 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0
+_C_9:
+	db 1, 0, 0, 0, 0, 0, 0, 0, ' ', 0
+
+	section .bss
+	align 16
+_GV___heap:
+	resb 8
+
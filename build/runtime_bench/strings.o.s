@@ -0,0 +1,1394 @@
+.intel_syntax noprefix
+.globl main
+.section .text
+__runtime_error:
+push rbp
+mov rbp, rsp
+sub rsp, 16
+__runtime_error..L0:
+mov qword ptr [rbp-16], r12
+mov qword ptr [rbp-8], r15
+mov r15, qword ptr [stderr]
+mov r10, offset _C_1
+mov rsi, r15
+mov r12, rdi
+mov rdi, r10
+call fputs
+mov rsi, r15
+mov rdi, r12
+call fputs
+mov rdi, offset _C_5
+mov rsi, r15
+call fputs
+mov edi, -1
+call exit
+mov r12, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+__alloc:
+push rbp
+mov rbp, rsp
+sub rsp, 32
+__alloc..L0:
+mov r10, qword ptr [_GV___heap]
+cmp r10, 0
+je __alloc..L7
+__alloc..L1:
+mov r11, r12
+mov r12, rdi
+__alloc..L2:
+mov r8, r12
+add r8, 23
+shr r8, 4
+cmp r8, 32
+ja __alloc..L11
+__alloc..L3:
+mov rdi, r8
+sal rdi, 3
+add rdi, r10
+mov rax, qword ptr [rdi+8]
+cmp rax, 0
+jne __alloc..L13
+__alloc..L4:
+mov r12, r8
+sal r12, 4
+mov qword ptr [rbp-32], r11
+mov qword ptr [rbp-24], r13
+mov qword ptr [rbp-16], r14
+mov qword ptr [rbp-8], r15
+mov r13, r10
+__alloc..L5:
+mov rax, qword ptr [r13]
+mov rcx, rax
+add rcx, r12
+mov rdi, qword ptr [r13+8]
+cmp rcx, rdi
+ja __alloc..L14
+__alloc..L6:
+mov qword ptr [r13], rcx
+mov qword ptr [rax], r8
+add rax, 8
+mov r12, qword ptr [rbp-32]
+mov r13, qword ptr [rbp-24]
+mov r14, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L7:
+mov qword ptr [rbp-32], r12
+mov r10, 0
+mov rsi, 1048576
+mov edx, 3
+mov ecx, 34
+mov r8d, -1
+mov r9, 0
+mov r12, rdi
+mov rdi, r10
+call mmap
+cmp rax, -1
+je __alloc..L9
+__alloc..L8:
+mov qword ptr [_GV___heap], rax
+mov r10, rax
+mov rdi, rax
+add rdi, 272
+mov qword ptr [rax], rdi
+mov rsi, rax
+add rsi, 1048576
+mov qword ptr [rax+8], rsi
+mov r11, qword ptr [rbp-32]
+jmp __alloc..L2
+__alloc..L9:
+mov r12, qword ptr [rbp-32]
+__alloc..L10:
+mov rdi, offset _C_4
+call __runtime_error
+mov rax, 0
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L11:
+add r12, 8
+mov rdi, r12
+mov r12, r11
+call malloc
+cmp rax, 0
+je __alloc..L10
+__alloc..L12:
+mov qword ptr [rax], 0
+add rax, 8
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L13:
+mov r10, qword ptr [rax]
+mov qword ptr [rdi+8], r10
+mov r12, r11
+mov rsp, rbp
+pop rbp
+ret
+__alloc..L14:
+mov rdi, 0
+mov rsi, 1048576
+mov edx, 3
+mov ecx, 34
+mov r15d, -1
+mov r9, 0
+mov r14, r8
+mov r8, r15
+call mmap
+cmp rax, -1
+je __alloc..L16
+__alloc..L15:
+mov qword ptr [r13], rax
+add rax, 1048576
+mov qword ptr [r13+8], rax
+mov r8, r14
+jmp __alloc..L5
+__alloc..L16:
+mov r12, qword ptr [rbp-32]
+mov r13, qword ptr [rbp-24]
+mov r14, qword ptr [rbp-16]
+mov r15, qword ptr [rbp-8]
+jmp __alloc..L10
+__dealloc:
+__dealloc..L0:
+mov rax, rdi
+sub rax, 8
+mov r10, qword ptr [rax]
+cmp r10, 0
+je __dealloc..L2
+__dealloc..L1:
+mov rax, qword ptr [_GV___heap]
+sal r10, 3
+add r10, rax
+mov r11, qword ptr [r10+8]
+mov qword ptr [rdi], r11
+mov qword ptr [r10+8], rdi
+xor rax, rax
+ret
+__dealloc..L2:
+push rbp
+mov rbp, rsp
+mov rdi, rax
+call free
+mov rsp, rbp
+pop rbp
+xor rax, rax
+ret
+main:
+push rbp
+mov rbp, rsp
+sub rsp, 112
+main..L0:
+mov qword ptr [rbp-96], r13
+mov qword ptr [rbp-88], rbx
+lea rbx, [rbp-4]
+lea r13, [rbp-8]
+mov rdi, offset _C_0
+mov rsi, r13
+call scanf
+mov r13d, dword ptr [r13]
+mov r10, offset _C_7
+cmp r10, 0
+je main..L3
+main..L1:
+mov r11, qword ptr [r10-16]
+cmp r11, -1
+je main..L3
+main..L2:
+add r11, 1
+mov qword ptr [r10-16], r11
+main..L3:
+mov dil, 0
+test dil, dil
+jnz main..L61
+main..L4:
+mov rsi, 50
+main..L5:
+mov dl, 0
+test dl, dl
+jnz main..L62
+main..L6:
+mov r8, 100
+main..L7:
+mov r11d, 0
+mov r9d, 0
+mov qword ptr [rbp-80], r12
+mov qword ptr [rbp-72], r14
+mov qword ptr [rbp-64], r15
+main..L8:
+cmp r11d, r13d
+jge main..L63
+main..L9:
+mov r12d, 97
+mov eax, r11d
+mov qword ptr [rbp-48], rbx
+mov qword ptr [rbp-40], rsi
+mov qword ptr [rbp-32], r8
+cdq
+idiv r12d
+mov rdi, 36
+mov rbx, r10
+mov r12, r9
+mov r14, rdx
+mov r15, r11
+mov dword ptr [rbp-108], r13d
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r13, rax
+add r13, 8
+mov rdi, r13
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r14
+mov r14, rax
+call snprintf
+mov rdi, r13
+call strlen
+mov qword ptr [r14], rax
+cmp rbx, 0
+je main..L68
+main..L10:
+cmp r14, 0
+je main..L72
+main..L11:
+mov dword ptr [rbp-104], r12d
+mov dword ptr [rbp-100], r15d
+mov r12, qword ptr [rbx]
+mov r15, qword ptr [r14]
+mov qword ptr [rbp-24], r14
+mov r14, r12
+add r14, r15
+mov rdi, r14
+add rdi, 9
+add rdi, 16
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r10, rax
+add r10, 8
+mov qword ptr [rbp-16], rax
+mov rsi, rbx
+add rsi, 8
+mov qword ptr [rbp-56], rbx
+mov rdi, r10
+mov rdx, r12
+mov rbx, r10
+call memcpy
+add rbx, r12
+mov rdi, rbx
+mov rdx, r15
+mov rsi, r13
+call memcpy
+mov byte ptr [rbx+r15], 0
+mov r13, qword ptr [rbp-16]
+mov qword ptr [r13], r14
+mov r15d, dword ptr [rbp-100]
+mov rbx, qword ptr [rbp-56]
+mov r12d, dword ptr [rbp-104]
+mov r14, qword ptr [rbp-24]
+main..L12:
+cmp rbx, 0
+je main..L16
+main..L13:
+sub rbx, 16
+mov r11, qword ptr [rbx]
+cmp r11, -1
+je main..L16
+main..L14:
+sub r11, 1
+mov qword ptr [rbx], r11
+cmp r11, 0
+jne main..L16
+main..L15:
+mov rdi, rbx
+call __dealloc
+main..L16:
+cmp r13, 0
+setne bl
+test bl, bl
+jz main..L19
+main..L17:
+mov r10, qword ptr [r13-16]
+cmp r10, -1
+je main..L19
+main..L18:
+add r10, 1
+mov qword ptr [r13-16], r10
+main..L19:
+test bl, bl
+jz main..L23
+main..L20:
+mov rdi, r13
+sub rdi, 16
+mov r11, qword ptr [rdi]
+cmp r11, -1
+je main..L23
+main..L21:
+sub r11, 1
+mov qword ptr [rdi], r11
+cmp r11, 0
+jne main..L23
+main..L22:
+call __dealloc
+main..L23:
+cmp r14, 0
+je main..L27
+main..L24:
+sub r14, 16
+mov rax, qword ptr [r14]
+cmp rax, -1
+je main..L27
+main..L25:
+sub rax, 1
+mov qword ptr [r14], rax
+cmp rax, 0
+jne main..L27
+main..L26:
+mov rdi, r14
+call __dealloc
+main..L27:
+cmp r13, 0
+sete r14b
+test r14b, r14b
+jnz main..L115
+main..L28:
+mov r10d, dword ptr [r13]
+main..L29:
+cmp r10d, 200
+jle main..L117
+main..L30:
+imul r12d, 31
+mov al, 0
+test al, al
+jnz main..L119
+main..L31:
+test r14b, r14b
+jnz main..L121
+main..L32:
+mov r11, qword ptr [r13]
+cmp r11, 54
+jle main..L122
+main..L33:
+mov r11, 54
+main..L34:
+mov rsi, qword ptr [rbp-40]
+cmp rsi, r11
+jg main..L120
+main..L35:
+mov byte ptr [rbp-24], bl
+mov dword ptr [rbp-100], r15d
+sub r11, rsi
+add r11, 1
+mov rdi, r11
+add rdi, 9
+add rdi, 16
+mov rbx, rsi
+mov r15, r11
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov rsi, r13
+add rsi, 8
+mov qword ptr [rbp-16], r13
+add rsi, rbx
+mov r13, rax
+add r13, 8
+mov rdi, r13
+mov rdx, r15
+mov rbx, rax
+call memcpy
+mov byte ptr [r13+r15], 0
+mov qword ptr [rbx], r15
+mov r11, rbx
+mov rsi, qword ptr [rbp-40]
+mov r15d, dword ptr [rbp-100]
+mov r13, qword ptr [rbp-16]
+mov bl, byte ptr [rbp-24]
+main..L36:
+cmp r11, 0
+je main..L124
+main..L37:
+mov byte ptr [rbp-24], bl
+mov dword ptr [rbp-100], r15d
+mov rdi, r11
+add rdi, 8
+mov rsi, offset _C_0
+mov rbx, qword ptr [rbp-48]
+mov rdx, rbx
+mov r15, r11
+call sscanf
+mov r8d, dword ptr [rbx]
+mov rsi, qword ptr [rbp-40]
+mov edi, dword ptr [rbp-100]
+mov r9b, byte ptr [rbp-24]
+mov r11, r15
+main..L38:
+add r12d, r8d
+mov r15d, 1000003
+mov rax, r12
+cdq
+idiv r15d
+cmp r11, 0
+je main..L125
+main..L39:
+sub r11, 16
+mov rax, qword ptr [r11]
+cmp rax, -1
+je main..L125
+main..L40:
+sub rax, 1
+mov qword ptr [r11], rax
+cmp rax, 0
+jne main..L125
+main..L41:
+mov rbx, rdx
+mov r12, r9
+mov r15, rdi
+mov rdi, r11
+call __dealloc
+mov rax, qword ptr [rbp-48]
+mov rsi, qword ptr [rbp-40]
+mov rdx, rbx
+mov r9, r12
+mov rbx, rax
+main..L42:
+test r14b, r14b
+jnz main..L139
+main..L43:
+mov r11d, dword ptr [r13]
+main..L44:
+sub r11d, 1
+cmp r11d, 100
+jl main..L173
+main..L45:
+test r14b, r14b
+jnz main..L179
+main..L46:
+movsx r14, r11d
+mov rcx, qword ptr [r13]
+cmp r14, rcx
+jge main..L184
+main..L47:
+mov r8, qword ptr [rbp-32]
+cmp r8, r14
+jg main..L174
+main..L48:
+mov dword ptr [rbp-104], edx
+sub r14, r8
+add r14, 1
+mov rdi, r14
+add rdi, 9
+add rdi, 16
+mov rbx, r8
+mov r12, r9
+mov dword ptr [rbp-100], r15d
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov rsi, r13
+add rsi, 8
+add rsi, rbx
+mov rbx, rax
+add rbx, 8
+mov rdi, rbx
+mov rdx, r14
+mov r15, rax
+call memcpy
+mov byte ptr [rbx+r14], 0
+mov qword ptr [r15], r14
+mov r14, r15
+mov rbx, qword ptr [rbp-48]
+mov rsi, qword ptr [rbp-40]
+mov r8, qword ptr [rbp-32]
+mov r15d, dword ptr [rbp-100]
+mov edx, dword ptr [rbp-104]
+main..L49:
+test r12b, r12b
+jz main..L185
+main..L50:
+sub r13, 16
+mov rdi, qword ptr [r13]
+cmp rdi, -1
+je main..L185
+main..L51:
+sub rdi, 1
+mov qword ptr [r13], rdi
+cmp rdi, 0
+jne main..L185
+main..L52:
+mov rdi, r13
+mov r12, rdx
+mov r13, rsi
+call __dealloc
+mov r8, qword ptr [rbp-32]
+main..L53:
+mov r10, r14
+cmp r14, 0
+setne r11b
+test r11b, r11b
+jz main..L56
+main..L54:
+mov rdi, qword ptr [r14-16]
+cmp rdi, -1
+je main..L56
+main..L55:
+add rdi, 1
+mov qword ptr [r14-16], rdi
+main..L56:
+test r11b, r11b
+jz main..L196
+main..L57:
+sub r14, 16
+mov r11, qword ptr [r14]
+cmp r11, -1
+je main..L196
+main..L58:
+sub r11, 1
+mov qword ptr [r14], r11
+cmp r11, 0
+jne main..L196
+main..L59:
+mov rdi, r14
+mov r14, r10
+call __dealloc
+mov r8, qword ptr [rbp-32]
+mov rsi, r13
+mov r9, r12
+mov r10, r14
+main..L60:
+mov r11d, r15d
+add r11d, 1
+mov r13d, dword ptr [rbp-108]
+jmp main..L8
+main..L61:
+mov rsi, 0
+jmp main..L5
+main..L62:
+mov r8, 0
+jmp main..L7
+main..L63:
+mov rdi, r10
+add rdi, 8
+mov ecx, 0
+mov r11, qword ptr [rbp-88]
+mov r15, qword ptr [rbp-80]
+mov r8, qword ptr [rbp-96]
+mov rsi, qword ptr [rbp-72]
+mov r14, qword ptr [rbp-64]
+main..L64:
+cmp r10, 0
+sete r12b
+test r12b, r12b
+jnz main..L73
+main..L65:
+mov edx, dword ptr [r10]
+main..L66:
+cmp ecx, edx
+jge main..L74
+main..L67:
+imul r9d, 31
+movsx rax, ecx
+mov dl, byte ptr [rdi+rax]
+movzx r12d, dl
+add r9d, r12d
+mov ebx, 1000003
+mov rax, r9
+cdq
+idiv ebx
+mov r9d, edx
+add ecx, 1
+jmp main..L64
+main..L68:
+cmp r14, 0
+je main..L71
+main..L69:
+mov r13, r14
+main..L70:
+mov dword ptr [rbp-100], r15d
+mov r15, qword ptr [r13]
+add r15, 9
+mov rdi, r15
+add rdi, 16
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov rdi, rax
+mov rdx, r15
+mov rsi, r13
+mov r13, rax
+call memcpy
+mov r15d, dword ptr [rbp-100]
+jmp main..L12
+main..L71:
+mov r13, 0
+jmp main..L12
+main..L72:
+mov r13, rbx
+jmp main..L70
+main..L73:
+mov edx, 0
+jmp main..L66
+main..L74:
+mov rdi, 36
+mov rbx, r10
+mov r14, r9
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r15, rax
+add r15, 8
+mov rdi, r15
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r14
+mov r14, rax
+call snprintf
+mov rdi, r15
+call strlen
+mov qword ptr [r14], rax
+cmp r14, 0
+je main..L114
+main..L75:
+mov rdi, r15
+call puts
+main..L76:
+cmp r14, 0
+je main..L80
+main..L77:
+sub r14, 16
+mov rax, qword ptr [r14]
+cmp rax, -1
+je main..L80
+main..L78:
+sub rax, 1
+mov qword ptr [r14], rax
+cmp rax, 0
+jne main..L80
+main..L79:
+mov rdi, r14
+call __dealloc
+main..L80:
+test r12b, r12b
+jnz main..L116
+main..L81:
+mov r12d, dword ptr [rbx]
+main..L82:
+mov rdi, 36
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r14, rax
+add r14, 8
+mov rdi, r14
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r12
+mov r15, rax
+call snprintf
+mov rdi, r14
+call strlen
+mov qword ptr [r15], rax
+cmp r15, 0
+je main..L118
+main..L83:
+mov rdi, r14
+call puts
+main..L84:
+cmp r15, 0
+je main..L88
+main..L85:
+sub r15, 16
+mov r14, qword ptr [r15]
+cmp r14, -1
+je main..L88
+main..L86:
+sub r14, 1
+mov qword ptr [r15], r14
+cmp r14, 0
+jne main..L88
+main..L87:
+mov rdi, r15
+call __dealloc
+main..L88:
+mov r15d, 10
+mov rax, r13
+cdq
+idiv r15d
+add eax, 1
+movsx r15, eax
+mov r14, r15
+imul r14, 8
+add r14, 8
+mov rdi, r14
+add rdi, 16
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+cmp rax, 0
+je main..L123
+main..L89:
+mov rdi, rax
+mov esi, 0
+mov rdx, r14
+mov r12, rax
+call memset
+main..L90:
+mov qword ptr [r12], r15
+cmp r12, 0
+je main..L93
+main..L91:
+mov r11, qword ptr [r12-16]
+cmp r11, -1
+je main..L93
+main..L92:
+add r11, 1
+mov qword ptr [r12-16], r11
+main..L93:
+mov rcx, offset _C_8
+mov r14, r12
+add r14, 8
+mov r15, rcx
+add r15, 8
+mov r13d, 0
+mov qword ptr [rbp-56], rbx
+main..L94:
+mov rdi, qword ptr [r12]
+cmp r13d, edi
+jge main..L126
+main..L95:
+mov eax, r13d
+imul eax, 7
+mov ebx, 1000
+mov qword ptr [rbp-48], r12
+cdq
+idiv ebx
+mov rdi, 36
+mov rbx, rdx
+mov r12, rcx
+mov qword ptr [rbp-40], r15
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r15, rax
+add r15, 8
+mov rdi, r15
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, rbx
+mov rbx, rax
+call snprintf
+mov rdi, r15
+call strlen
+mov qword ptr [rbx], rax
+cmp r12, 0
+je main..L140
+main..L96:
+cmp rbx, 0
+je main..L142
+main..L97:
+mov qword ptr [rbp-32], r14
+mov r14, qword ptr [r12]
+mov r12, qword ptr [rbx]
+mov qword ptr [rbp-24], rbx
+mov rbx, r14
+add rbx, r12
+mov rdi, rbx
+add rdi, 9
+add rdi, 16
+mov dword ptr [rbp-100], r13d
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r13, rax
+add r13, 8
+mov qword ptr [rbp-16], rax
+mov rdi, r13
+mov rsi, qword ptr [rbp-40]
+mov rdx, r14
+call memcpy
+add r14, r13
+mov rdi, r14
+mov rdx, r12
+mov rsi, r15
+call memcpy
+mov byte ptr [r14+r12], 0
+mov r15, qword ptr [rbp-16]
+mov qword ptr [r15], rbx
+mov r12, offset _C_8
+mov r14, qword ptr [rbp-32]
+mov r13d, dword ptr [rbp-100]
+mov rbx, qword ptr [rbp-24]
+main..L98:
+movsx r10, r13d
+imul r10, 8
+add r10, r14
+mov rdi, qword ptr [r10]
+cmp rdi, 0
+je main..L102
+main..L99:
+sub rdi, 16
+mov rcx, qword ptr [rdi]
+cmp rcx, -1
+je main..L102
+main..L100:
+sub rcx, 1
+mov qword ptr [rdi], rcx
+cmp rcx, 0
+jne main..L102
+main..L101:
+mov qword ptr [rbp-32], r14
+mov r14, r10
+call __dealloc
+mov rax, qword ptr [rbp-32]
+mov r10, r14
+mov r14, rax
+main..L102:
+mov qword ptr [r10], r15
+cmp r15, 0
+setne r10b
+test r10b, r10b
+jz main..L105
+main..L103:
+mov r11, qword ptr [r15-16]
+cmp r11, -1
+je main..L105
+main..L104:
+add r11, 1
+mov qword ptr [r15-16], r11
+main..L105:
+test r10b, r10b
+jz main..L109
+main..L106:
+sub r15, 16
+mov r10, qword ptr [r15]
+cmp r10, -1
+je main..L109
+main..L107:
+sub r10, 1
+mov qword ptr [r15], r10
+cmp r10, 0
+jne main..L109
+main..L108:
+mov rdi, r15
+call __dealloc
+main..L109:
+cmp rbx, 0
+je main..L189
+main..L110:
+sub rbx, 16
+mov r15, qword ptr [rbx]
+cmp r15, -1
+je main..L189
+main..L111:
+sub r15, 1
+mov qword ptr [rbx], r15
+cmp r15, 0
+jne main..L189
+main..L112:
+mov rdi, rbx
+call __dealloc
+mov rcx, r12
+main..L113:
+add r13d, 1
+mov r12, qword ptr [rbp-48]
+mov r15, qword ptr [rbp-40]
+jmp main..L94
+main..L114:
+mov edi, 10
+call putchar
+jmp main..L76
+main..L115:
+mov r10d, 0
+jmp main..L29
+main..L116:
+mov r12d, 0
+jmp main..L82
+main..L117:
+mov rbx, qword ptr [rbp-48]
+mov rsi, qword ptr [rbp-40]
+mov r8, qword ptr [rbp-32]
+mov r9, r12
+mov r10, r13
+jmp main..L60
+main..L118:
+mov edi, 10
+call putchar
+jmp main..L84
+main..L119:
+mov rsi, qword ptr [rbp-40]
+main..L120:
+mov r11, 0
+jmp main..L36
+main..L121:
+mov rsi, qword ptr [rbp-40]
+jmp main..L120
+main..L122:
+sub r11, 1
+jmp main..L34
+main..L123:
+mov r12, 0
+jmp main..L90
+main..L124:
+mov r8d, 0
+mov r10, qword ptr [rbp-48]
+mov rdi, r15
+mov r9, rbx
+mov rbx, r10
+jmp main..L38
+main..L125:
+mov r15, rdi
+jmp main..L42
+main..L126:
+mov r13, r12
+add r13, 8
+mov r10d, 1
+mov r14d, 0
+mov r15d, 0
+main..L127:
+mov rdx, qword ptr [r12]
+cmp r10d, edx
+jge main..L144
+main..L128:
+movsx rbx, r10d
+imul rbx, 8
+add rbx, r13
+mov rdi, qword ptr [rbx]
+mov r9d, r10d
+sub r9d, 1
+movsx r11, r9d
+imul r11, 8
+add r11, r13
+mov rsi, qword ptr [r11]
+cmp rdi, 0
+je main..L175
+main..L129:
+cmp rsi, 0
+je main..L181
+main..L130:
+mov qword ptr [rbp-48], r12
+add rdi, 8
+add rsi, 8
+mov r12, r10
+call strcmp
+mov r10, qword ptr [rbp-48]
+xchg r12, r10
+main..L131:
+cmp eax, 0
+jge main..L133
+main..L132:
+add r14d, 1
+main..L133:
+mov rdi, qword ptr [rbx]
+mov r9d, 2
+mov eax, r10d
+cdq
+idiv r9d
+movsx rdx, eax
+imul rdx, 8
+add rdx, r13
+mov rsi, qword ptr [rdx]
+cmp rdi, 0
+je main..L190
+main..L134:
+cmp rsi, 0
+je main..L195
+main..L135:
+add rdi, 8
+add rsi, 8
+mov rbx, r10
+call strcmp
+mov r10, rbx
+main..L136:
+cmp eax, 0
+jne main..L138
+main..L137:
+add r15d, 1
+main..L138:
+add r10d, 1
+jmp main..L127
+main..L139:
+mov r11d, 0
+jmp main..L44
+main..L140:
+cmp rbx, 0
+je main..L143
+main..L141:
+mov r12, rbx
+main..L142:
+mov r15, qword ptr [r12]
+add r15, 9
+mov rdi, r15
+add rdi, 16
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov rdi, rax
+mov rdx, r15
+mov rsi, r12
+mov r15, rax
+call memcpy
+mov r12, offset _C_8
+jmp main..L98
+main..L143:
+mov r15, 0
+jmp main..L98
+main..L144:
+mov rdi, 36
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r13, rax
+add r13, 8
+mov rdi, r13
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r14
+mov rbx, rax
+call snprintf
+mov rdi, r13
+call strlen
+mov qword ptr [rbx], rax
+mov r14, offset _C_9
+cmp rbx, 0
+je main..L177
+main..L145:
+cmp r14, 0
+je main..L183
+main..L146:
+mov dword ptr [rbp-24], r15d
+mov r15, qword ptr [rbx]
+mov qword ptr [rbp-40], rbx
+mov r12, qword ptr [r14]
+mov rbx, r15
+add rbx, r12
+mov rdi, rbx
+add rdi, 9
+add rdi, 16
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r10, rax
+add r10, 8
+mov qword ptr [rbp-16], rax
+add r14, 8
+mov rdi, r10
+mov rdx, r15
+mov rsi, r13
+mov r13, r10
+call memcpy
+add r13, r15
+mov rdi, r13
+mov rdx, r12
+mov rsi, r14
+call memcpy
+mov byte ptr [r13+r12], 0
+mov r12, qword ptr [rbp-16]
+mov qword ptr [r12], rbx
+mov r15d, dword ptr [rbp-24]
+mov rbx, qword ptr [rbp-40]
+main..L147:
+mov rdi, 36
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r14, rax
+add r14, 8
+mov rdi, r14
+mov rsi, 12
+mov rdx, offset _C_0
+mov rcx, r15
+mov r13, rax
+call snprintf
+mov rdi, r14
+call strlen
+mov qword ptr [r13], rax
+cmp r12, 0
+je main..L186
+main..L148:
+cmp r13, 0
+je main..L193
+main..L149:
+mov qword ptr [rbp-40], rbx
+mov rbx, qword ptr [r12]
+mov r15, qword ptr [r13]
+mov qword ptr [rbp-32], r13
+mov r13, rbx
+add r13, r15
+mov rdi, r13
+add rdi, 9
+add rdi, 16
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov r10, rax
+add r10, 8
+mov qword ptr [rbp-24], rax
+mov rsi, r12
+add rsi, 8
+mov qword ptr [rbp-16], r12
+mov rdi, r10
+mov rdx, rbx
+mov r12, r10
+call memcpy
+add r12, rbx
+mov rdi, r12
+mov rdx, r15
+mov rsi, r14
+call memcpy
+mov byte ptr [r12+r15], 0
+mov r14, qword ptr [rbp-24]
+mov qword ptr [r14], r13
+mov rbx, qword ptr [rbp-40]
+mov r12, qword ptr [rbp-16]
+mov r13, qword ptr [rbp-32]
+main..L150:
+cmp r14, 0
+je main..L197
+main..L151:
+mov rdi, r14
+add rdi, 8
+call puts
+main..L152:
+cmp r14, 0
+je main..L156
+main..L153:
+sub r14, 16
+mov r15, qword ptr [r14]
+cmp r15, -1
+je main..L156
+main..L154:
+sub r15, 1
+mov qword ptr [r14], r15
+cmp r15, 0
+jne main..L156
+main..L155:
+mov rdi, r14
+call __dealloc
+main..L156:
+cmp r13, 0
+je main..L160
+main..L157:
+sub r13, 16
+mov r14, qword ptr [r13]
+cmp r14, -1
+je main..L160
+main..L158:
+sub r14, 1
+mov qword ptr [r13], r14
+cmp r14, 0
+jne main..L160
+main..L159:
+mov rdi, r13
+call __dealloc
+main..L160:
+cmp r12, 0
+je main..L164
+main..L161:
+sub r12, 16
+mov r13, qword ptr [r12]
+cmp r13, -1
+je main..L164
+main..L162:
+sub r13, 1
+mov qword ptr [r12], r13
+cmp r13, 0
+jne main..L164
+main..L163:
+mov rdi, r12
+call __dealloc
+main..L164:
+cmp rbx, 0
+je main..L168
+main..L165:
+sub rbx, 16
+mov r12, qword ptr [rbx]
+cmp r12, -1
+je main..L168
+main..L166:
+sub r12, 1
+mov qword ptr [rbx], r12
+cmp r12, 0
+jne main..L168
+main..L167:
+mov rdi, rbx
+call __dealloc
+main..L168:
+mov rdi, qword ptr [rbp-56]
+cmp rdi, 0
+je main..L172
+main..L169:
+sub rdi, 16
+mov rdx, qword ptr [rdi]
+cmp rdx, -1
+je main..L172
+main..L170:
+sub rdx, 1
+mov qword ptr [rdi], rdx
+cmp rdx, 0
+jne main..L172
+main..L171:
+call __dealloc
+main..L172:
+mov eax, 0
+mov rbx, qword ptr [rbp-88]
+mov r12, qword ptr [rbp-80]
+mov r13, qword ptr [rbp-96]
+mov r14, qword ptr [rbp-72]
+mov r15, qword ptr [rbp-64]
+mov rsp, rbp
+pop rbp
+ret
+main..L173:
+mov r8, qword ptr [rbp-32]
+main..L174:
+mov r14, 0
+mov r12, r9
+jmp main..L49
+main..L175:
+cmp rsi, 0
+je main..L180
+main..L176:
+mov eax, -1
+jmp main..L131
+main..L177:
+cmp r14, 0
+je main..L182
+main..L178:
+mov r13, qword ptr [r14]
+add r13, 9
+mov rdi, r13
+add rdi, 16
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov rdi, rax
+mov rdx, r13
+mov rsi, r14
+mov r12, rax
+call memcpy
+jmp main..L147
+main..L179:
+mov r8, qword ptr [rbp-32]
+jmp main..L174
+main..L180:
+mov eax, 0
+jmp main..L131
+main..L181:
+mov eax, 1
+jmp main..L131
+main..L182:
+mov r12, 0
+jmp main..L147
+main..L183:
+mov r14, rbx
+jmp main..L178
+main..L184:
+sub rcx, 1
+mov r14, rcx
+jmp main..L47
+main..L185:
+mov r12, rdx
+mov r13, rsi
+jmp main..L53
+main..L186:
+cmp r13, 0
+je main..L192
+main..L187:
+mov r15, r13
+main..L188:
+mov r14, qword ptr [r15]
+add r14, 9
+mov rdi, r14
+add rdi, 16
+call __alloc
+mov qword ptr [rax], 1
+mov qword ptr [rax+8], 0
+add rax, 16
+mov rdi, rax
+mov rdx, r14
+mov rsi, r15
+mov r14, rax
+call memcpy
+jmp main..L150
+main..L189:
+mov rcx, r12
+jmp main..L113
+main..L190:
+cmp rsi, 0
+je main..L194
+main..L191:
+mov eax, -1
+jmp main..L136
+main..L192:
+mov r14, 0
+jmp main..L150
+main..L193:
+mov r15, r12
+jmp main..L188
+main..L194:
+mov eax, 0
+jmp main..L136
+main..L195:
+mov eax, 1
+jmp main..L136
+main..L196:
+mov rsi, r13
+mov r9, r12
+jmp main..L60
+main..L197:
+mov edi, 10
+call putchar
+jmp main..L152
+_C_0:
+.byte 37, 100, 0
+_C_1:
+.byte 82, 117, 110, 116, 105, 109, 101, 32, 69, 114, 114, 111, 114, 58, 32, 0
+_C_2:
+.byte 83, 117, 98, 115, 99, 114, 105, 112, 116, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 0
+_C_3:
+.byte 78, 117, 108, 108, 32, 112, 111, 105, 110, 116, 101, 114, 0
+_C_4:
+.byte 66, 97, 100, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 0
+_C_5:
+.byte 10, 0
+_C_6:
+.byte 37, 115, 0
+.balign 8
+.byte 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0
+_C_7:
+.byte 0, 0, 0, 0, 0, 0, 0, 0, 0
+.balign 8
+.byte 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0
+_C_8:
+.byte 1, 0, 0, 0, 0, 0, 0, 0, 119, 0
+.balign 8
+.byte 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0
+_C_9:
+.byte 1, 0, 0, 0, 0, 0, 0, 0, 32, 0
+.section .bss
+.balign 16
+_GV___heap:
+.zero 8
@@ -0,0 +1,15 @@
+﻿/* Copyright (c) 2012-2017 The ANTLR Project. All rights reserved.
+ * Use of this file is governed by the BSD 3-clause license that
+ * can be found in the LICENSE.txt file in the project root.
+ */
+
+#include "atn/StarLoopEntryState.h"
+
+using namespace antlr4::atn;
+
+StarLoopEntryState::StarLoopEntryState() : DecisionState(), isPrecedenceDecision(false) {
+}
+
+size_t StarLoopEntryState::getStateType() {
+  return STAR_LOOP_ENTRY;
+}
@@ -0,0 +1,794 @@
+#include "common_headers.h"
+#include "BoundsCheckElimination.h"
+#include "MxBuiltin.h"
+#include "CompileStats.h"
+
+namespace MxIR
+{
+	static const std::int64_t NotActive = INT64_MIN;
+	static const std::int64_t MaxOffset = std::int64_t(1) << 32;
+	static const size_t ProofBudget = 4096;		//steps of one proof
+
+	static std::int64_t immValue(const Operand &operand)
+	{
+		switch (operand.size())
+		{
+		case 1:
+			return std::int8_t(operand.val);
+		case 2:
+			return std::int16_t(operand.val);
+		case 4:
+			return std::int32_t(operand.val);
+		default:
+			return std::int64_t(operand.val);
+		}
+	}
+
+	static bool isSmallImm(const Operand &operand)
+	{
+		return operand.isImm() && immValue(operand) > -MaxOffset && immValue(operand) < MaxOffset;
+	}
+
+	static bool isBuiltinCall(const Instruction &ins, MxBuiltin::BuiltinFunc func)
+	{
+		return ins.oper == Call && ins.src1.type == Operand::funcID && ins.src1.val == size_t(func);
+	}
+
+	static bool isSubscriptCall(const Instruction &ins)
+	{
+		return (isBuiltinCall(ins, MxBuiltin::BuiltinFunc::subscript_bool) || isBuiltinCall(ins, MxBuiltin::BuiltinFunc::subscript_int)
+			|| isBuiltinCall(ins, MxBuiltin::BuiltinFunc::subscript_object)) && ins.paramExt.size() == 2;
+	}
+
+	static bool isSizeCall(const Instruction &ins)
+	{
+		return isBuiltinCall(ins, MxBuiltin::BuiltinFunc::size) && ins.paramExt.size() == 1;
+	}
+
+	//a block that starts with reporting the runtime error msg
+	static bool isErrorBlock(Block *block, MxBuiltin::BuiltinConst msg)
+	{
+		if (block->ins.empty())
+			return false;
+		const Instruction &ins = block->ins.front();
+		return isBuiltinCall(ins, MxBuiltin::BuiltinFunc::runtime_error) && ins.paramExt.size() == 1
+			&& ins.paramExt[0].type == Operand::constID && ins.paramExt[0].val == size_t(msg);
+	}
+
+	static bool sameValue(const Operand &a, const Operand &b)
+	{
+		return a.isReg() && b.isReg() && a.val == b.val && a.ver == b.ver;
+	}
+
+	void BoundsCheckElimination::work()
+	{
+		index.build(func);
+		collectDefs();
+		activeUpper.assign(index.size(), NotActive);
+		activeLower.assign(index.size(), NotActive);
+		nextReg = 0;
+
+		size_t nNull = 0, nRange = 0;
+		std::vector<std::pair<Block *, InsList::iterator>> calls;
+		for (Block *block : analysis.blocks())
+		{
+			if (block != func.inBlock.get() && block->preds.empty())
+				continue;
+			for (auto iter = block->ins.begin(); iter != block->ins.end(); ++iter)
+			{
+				if (canReplaceCall(block, iter))
+					calls.push_back({ block, iter });
+			}
+			if (removeNullCheck(block))
+				nNull++;
+			else if (removeRangeCheck(block))
+				nRange++;
+		}
+
+		destructSSI();
+		removeDeadValues();
+		for (auto &call : calls)
+		{
+			if (isSizeCall(*call.second))
+				nNull++;
+			else
+				nRange++;
+			replaceCall(call.first, call.second);
+		}
+		deadBlocks.clear();
+		CompileStats::count("null_checks_removed", nNull);
+		CompileStats::count("bounds_checks_removed", nRange);
+	}
+
+	void BoundsCheckElimination::collectDefs()
+	{
+		defs.assign(index.size(), ValueDef());
+		for (Block *block : analysis.blocks())
+		{
+			for (auto &kv : block->phi)
+			{
+				ValueDef &def = defs[index.id(kv.second.dst)];
+				def.block = block;
+				def.phi = &kv.second;
+			}
+			for (auto iter = block->ins.begin(); iter != block->ins.end(); ++iter)
+			{
+				for (Operand *operand : iter->outputRegs())
+				{
+					ValueDef &def = defs[index.id(*operand)];
+					def.block = block;
+					def.ins = &*iter;
+					def.iter = iter;
+				}
+				if (isBuiltinCall(*iter, MxBuiltin::BuiltinFunc::runtime_error))
+					trapBlocks.insert(block);
+			}
+			for (auto &kv : block->sigma)
+			{
+				for (bool edge : { true, false })
+				{
+					ValueDef &def = defs[index.id(edge ? kv.second.dstTrue : kv.second.dstFalse)];
+					def.block = block;
+					def.sigma = &kv.second;
+					def.edgeTrue = edge;
+				}
+			}
+		}
+
+		std::set<size_t> arrays;
+		for (Block *block : analysis.blocks())
+		{
+			for (auto &ins : block->ins)
+			{
+				if (ins.oper == Load && ins.src1.isReg() && ins.dst.isReg())
+					loadsOf[rootOf(ins.src1)].push_back(index.id(ins.dst));
+				else if ((isSubscriptCall(ins) || isSizeCall(ins)) && ins.paramExt[0].isReg())
+				{
+					size_t array = rootOf(ins.paramExt[0]);
+					arrays.insert(array);
+					if (isSizeCall(ins) && ins.dst.isReg())
+					{
+						sizesOf[array].push_back(index.id(ins.dst));
+						lengthValues.insert(index.id(ins.dst));
+					}
+				}
+				else if (ins.oper == Sgeu && ins.src2.isReg())
+				{
+					const ValueDef &def = defs[index.id(ins.src2)];
+					if (def.ins && def.ins->oper == Load && def.ins->src1.isReg())
+						arrays.insert(rootOf(def.ins->src1));
+				}
+			}
+		}
+		for (size_t array : arrays)
+		{
+			auto iter = loadsOf.find(array);
+			if (iter != loadsOf.end())
+				lengthValues.insert(iter->second.begin(), iter->second.end());
+		}
+	}
+
+	bool BoundsCheckElimination::removeNullCheck(Block *block)
+	{
+		if (block->ins.empty() || block->ins.back().oper != Br || !block->brFalse || !block->ins.back().src1.isReg())
+			return false;
+		if (!isErrorBlock(block->brTrue.get(), MxBuiltin::BuiltinConst::null_ptr))
+			return false;
+		const ValueDef &cond = defs[index.id(block->ins.back().src1)];
+		if (!cond.ins || cond.block != block || cond.ins->oper != Seq || !cond.ins->src2.isImm() || immValue(cond.ins->src2) != 0)
+			return false;
+		if (!isNonNull(cond.ins->src1, block, cond.iter))
+			return false;
+		removeBranch(block);
+		return true;
+	}
+
+	bool BoundsCheckElimination::removeRangeCheck(Block *block)
+	{
+		if (block->ins.empty() || block->ins.back().oper != Br || !block->brFalse || !block->ins.back().src1.isReg())
+			return false;
+		if (!isErrorBlock(block->brTrue.get(), MxBuiltin::BuiltinConst::subscript_out_of_range))
+			return false;
+		const ValueDef &cond = defs[index.id(block->ins.back().src1)];
+		if (!cond.ins || cond.block != block || cond.ins->oper != Sgeu || !cond.ins->src2.isReg())
+			return false;
+		const ValueDef &length = defs[index.id(cond.ins->src2)];
+		if (!length.ins || length.ins->oper != Load || !length.ins->src1.isReg())
+			return false;
+		const Operand &array = length.ins->src1;
+		const Operand &subscript = cond.ins->src1;
+		if (!isChecked(array, subscript, block, cond.iter) && !inRange(array, subscript))
+			return false;
+		removeBranch(block);
+		return true;
+	}
+
+	bool BoundsCheckElimination::canReplaceCall(Block *block, InsList::iterator iter)
+	{
+		if (!iter->dst.isReg())
+			return false;
+		if (isSizeCall(*iter))
+			return isNonNull(iter->paramExt[0], block, iter);
+		if (!isSubscriptCall(*iter) || !isNonNull(iter->paramExt[0], block, iter))
+			return false;
+		return isChecked(iter->paramExt[0], iter->paramExt[1], block, iter) || inRange(iter->paramExt[0], iter->paramExt[1]);
+	}
+
+	//the body of builtin_size_unsafe() / builtin_subscript_unsafe()
+	void BoundsCheckElimination::replaceCall(Block *block, InsList::iterator iter)
+	{
+		Instruction call = *iter;
+		if (isSizeCall(call))
+		{
+			*iter = IR(call.dst, Load, call.paramExt[0]);
+			return;
+		}
+		if (!nextReg)
+		{
+			func.inBlock->traverse([this](Block *block) -> bool
+			{
+				for (auto &ins : block->instructions())
+				{
+					for (Operand *operand : join<Operand *>(ins.inputRegs(), ins.outputRegs()))
+						nextReg = std::max<size_t>(nextReg, operand->val + 1);
+				}
+				return true;
+			});
+		}
+		size_t size = isBuiltinCall(call, MxBuiltin::BuiltinFunc::subscript_bool) ? 1
+			: isBuiltinCall(call, MxBuiltin::BuiltinFunc::subscript_int) ? 4 : 8;
+		const Operand &array = call.paramExt[0], &subscript = call.paramExt[1];
+		if (subscript.isImm())
+		{
+			*iter = IR(call.dst, Add, array, ImmPtr(MxBuiltin::arrayHeader + immValue(subscript) * size));
+			return;
+		}
+		Operand base = RegPtr(nextReg++), offset = RegPtr(nextReg++);
+		block->ins.insert(iter, IR(base, Add, array, ImmPtr(MxBuiltin::arrayHeader)));
+		block->ins.insert(iter, IR(offset, Sext, subscript));
+		block->ins.insert(iter, IR(offset, Mult, offset, ImmPtr(size)));
+		*iter = IR(call.dst, Add, base, offset);
+	}
+
+	//jump to the false branch, and drop the blocks that become unreachable
+	void BoundsCheckElimination::removeBranch(Block *block)
+	{
+		std::shared_ptr<Block> next = block->brFalse->self.lock();
+		std::vector<std::shared_ptr<Block>> workList = { block->brTrue->self.lock() };
+		block->ins.back() = IRJump();
+		block->brTrue = next;
+		block->brFalse.reset();
+
+		while (!workList.empty())
+		{
+			std::shared_ptr<Block> cur = workList.back();
+			workList.pop_back();
+			if (!cur->preds.empty())
+				continue;
+			deadBlocks.push_back(cur);
+			for (Block *succ : { cur->brTrue.get(), cur->brFalse.get() })
+			{
+				if (!succ)
+					continue;
+				for (auto &kv : succ->phi)
+				{
+					auto &srcs = kv.second.srcs;
+					srcs.erase(std::remove_if(srcs.begin(), srcs.end(), [&cur](const std::pair<Operand, std::weak_ptr<Block>> &src)
+					{
+						return src.second.lock() == cur;
+					}), srcs.end());
+				}
+				workList.push_back(succ->self.lock());
+			}
+			cur->brTrue.reset();
+			cur->brFalse.reset();
+		}
+	}
+
+	//replace every value defined by a sigma with its src
+	void BoundsCheckElimination::destructSSI()
+	{
+		std::vector<Operand> replace(index.size());
+		func.inBlock->traverse([&replace, this](Block *block) -> bool
+		{
+			for (auto &kv : block->sigma)
+			{
+				replace[index.id(kv.second.dstTrue)] = kv.second.src;
+				replace[index.id(kv.second.dstFalse)] = kv.second.src;
+			}
+			return true;
+		});
+		func.inBlock->traverse([&replace, this](Block *block) -> bool
+		{
+			block->sigma.clear();
+			for (auto &ins : block->instructions())
+			{
+				for (Operand *operand : ins.inputRegs())
+				{
+					Operand value = *operand;
+					for (size_t id = index.id(value); id != SSAValueIndex::npos && replace[id].isReg(); id = index.id(value))
+						value = replace[id];
+					*operand = value.setSize(operand->size());
+				}
+			}
+			return true;
+		});
+	}
+
+	//the compares, loads and extensions left unused by the removed checks
+	void BoundsCheckElimination::removeDeadValues()
+	{
+		std::vector<size_t> uses(index.size());
+		func.inBlock->traverse([&uses, this](Block *block) -> bool
+		{
+			for (auto &ins : block->instructions())
+				for (Operand *operand : ins.inputRegs())
+				{
+					size_t id = index.id(*operand);
+					if (id != SSAValueIndex::npos)
+						uses[id]++;
+				}
+			return true;
+		});
+
+		bool changed = true;
+		while (changed)
+		{
+			changed = false;
+			func.inBlock->traverse([&uses, &changed, this](Block *block) -> bool
+			{
+				for (auto iter = block->ins.rbegin(); iter != block->ins.rend(); )
+				{
+					auto oper = iter->oper;
+					size_t id = index.id(iter->dst);
+					if ((oper == Seq || oper == Sgeu || oper == Sext || oper == Load || oper == Move) && id != SSAValueIndex::npos && !uses[id])
+					{
+						for (Operand *operand : iter->inputRegs())
+						{
+							size_t src = index.id(*operand);
+							if (src != SSAValueIndex::npos)
+								uses[src]--;
+						}
+						iter = InsList::reverse_iterator(block->ins.erase(std::next(iter).base()));
+						changed = true;
+					}
+					else
+						++iter;
+				}
+				return true;
+			});
+		}
+	}
+
+	size_t BoundsCheckElimination::rootOf(const Operand &operand) const
+	{
+		Operand cur = operand;
+		while (true)
+		{
+			size_t id = index.id(cur);
+			if (id == SSAValueIndex::npos)
+				return id;
+			const ValueDef &def = defs[id];
+			if (def.sigma)
+				cur = def.sigma->src;
+			else if (def.ins && def.ins->oper == Move && def.ins->src1.isReg())
+				cur = def.ins->src1;
+			else
+				return id;
+		}
+	}
+
+	std::pair<size_t, std::int64_t> BoundsCheckElimination::linearOf(const Operand &operand) const
+	{
+		Operand cur = operand;
+		std::int64_t offset = 0;
+		while (true)
+		{
+			size_t id = index.id(cur);
+			if (id == SSAValueIndex::npos)
+				return { id, 0 };
+			const ValueDef &def = defs[id];
+			const Instruction *ins = def.ins;
+			if (def.sigma)
+				cur = def.sigma->src;
+			else if (ins && (ins->oper == Move || ins->oper == Sext) && ins->src1.isReg())
+				cur = ins->src1;
+			else if (ins && ins->oper == Add && ins->src1.isReg() && isSmallImm(ins->src2))
+				offset += immValue(ins->src2), cur = ins->src1;
+			else if (ins && ins->oper == Add && ins->src2.isReg() && isSmallImm(ins->src1))
+				offset += immValue(ins->src1), cur = ins->src2;
+			else if (ins && ins->oper == Sub && ins->src1.isReg() && isSmallImm(ins->src2))
+				offset -= immValue(ins->src2), cur = ins->src1;
+			else
+				return { id, offset };
+		}
+	}
+
+	const BoundsCheckElimination::LengthForm & BoundsCheckElimination::lengthOf(size_t array)
+	{
+		auto iter = lengths.find(array);
+		if (iter != lengths.end())
+			return iter->second;
+		LengthForm &form = lengths[array];
+		for (size_t value : loadsOf[array])
+			form[value] = 0;
+		for (size_t value : sizesOf[array])
+			form[value] = 0;
+		std::pair<size_t, std::int64_t> length;
+		bool found = false;
+		std::set<size_t> visiting = { array };
+		if (allocLength(array, length, found, visiting) && found)
+			form.insert(length);
+		return form;
+	}
+
+	//the length stored right after the allocation, the same for all the arrays merged by a phi
+	//found is set once a length is met; the phis around a loop add nothing
+	bool BoundsCheckElimination::allocLength(size_t array, std::pair<size_t, std::int64_t> &length, bool &found, std::set<size_t> &visiting)
+	{
+		const ValueDef &def = defs[array];
+		const Instruction *store = nullptr;
+		if (def.ins)
+		{
+			if (!isBuiltinCall(*def.ins, MxBuiltin::BuiltinFunc::newobject) && !isBuiltinCall(*def.ins, MxBuiltin::BuiltinFunc::newobject_zero))
+				return false;
+			auto next = std::next(def.iter);
+			if (next != def.block->ins.end())
+				store = &*next;
+		}
+		else if (def.phi && !def.block->ins.empty())	//the allocation inlined: the store follows the phi that merges the null of the failed branch
+			store = &def.block->ins.front();
+		if (store && store->oper == Store && rootOf(store->src1) == array)
+		{
+			std::pair<size_t, std::int64_t> cur;
+			if (!storedLength(*store, cur) || (found && cur != length))
+				return false;
+			length = cur;
+			found = true;
+			return true;
+		}
+		if (!def.phi)
+			return false;
+		for (auto &src : def.phi->srcs)
+		{
+			if (trapBlocks.count(src.second.lock().get()))
+				continue;
+			size_t root = rootOf(src.first);
+			if (root == SSAValueIndex::npos)
+				return false;
+			if (visiting.insert(root).second && !allocLength(root, length, found, visiting))
+				return false;
+		}
+		return true;
+	}
+
+	bool BoundsCheckElimination::storedLength(const Instruction &store, std::pair<size_t, std::int64_t> &length)
+	{
+		Operand value = store.dst;
+		while (value.isReg() && index.id(value) != SSAValueIndex::npos)	//a constant length is moved or extended to the pointer size
+		{
+			const Instruction *ins = defs[index.id(value)].ins;
+			if (!ins || (ins->oper != Move && ins->oper != Sext) || !isSmallImm(ins->src1))
+				break;
+			value = ins->src1;
+		}
+		if (isSmallImm(value))
+		{
+			length = { SSAValueIndex::npos, immValue(value) };
+			return true;
+		}
+		length = linearOf(store.dst);
+		return store.dst.isReg() && length.first != SSAValueIndex::npos;
+	}
+
+	template<class Pred>
+	bool BoundsCheckElimination::dominatedBy(Block *block, InsList::iterator iter, Pred pred)
+	{
+		for (auto cur = block->ins.begin(); cur != iter; ++cur)
+			if (pred(*cur, -1))
+				return true;
+		DomTree &domTree = analysis.domTree();
+		const std::vector<Block *> &blocks = analysis.blocks();
+		size_t idx = analysis.blockIndex(block);
+		while (domTree.getIdom(idx) != idx)
+		{
+			Block *child = blocks[idx];
+			idx = domTree.getIdom(idx);
+			Block *dom = blocks[idx];
+			for (auto &ins : dom->ins)
+			{
+				if (ins.oper != Br)
+				{
+					if (pred(ins, -1))
+						return true;
+				}
+				else if (dom->brFalse && child->preds.size() == 1)	//the edge to child is taken
+				{
+					if ((dom->brTrue.get() == child && pred(ins, 1)) || (dom->brFalse.get() == child && pred(ins, 0)))
+						return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	bool BoundsCheckElimination::isNonNull(const Operand &ptr, Block *block, InsList::iterator iter)
+	{
+		size_t root = rootOf(ptr);
+		if (root == SSAValueIndex::npos)
+			return false;
+		std::set<size_t> visiting;
+		return isNonNull(root, block, iter, visiting);
+	}
+
+	bool BoundsCheckElimination::isNonNull(size_t ptr, Block *block, InsList::iterator iter, std::set<size_t> &visiting)
+	{
+		const ValueDef &def = defs[ptr];
+		if (def.ins && (isBuiltinCall(*def.ins, MxBuiltin::BuiltinFunc::newobject) || isBuiltinCall(*def.ins, MxBuiltin::BuiltinFunc::newobject_zero)))
+			return true;
+		bool checked = dominatedBy(block, iter, [ptr, this](const Instruction &ins, int edge)
+		{
+			if (edge == -1)
+				return (isSubscriptCall(ins) || isSizeCall(ins)) && rootOf(ins.paramExt[0]) == ptr;
+			size_t id = index.id(ins.src1);
+			const Instruction *cond = id == SSAValueIndex::npos ? nullptr : defs[id].ins;
+			if (!cond || !cond->src2.isImm() || immValue(cond->src2) != 0 || rootOf(cond->src1) != ptr)
+				return false;
+			return (cond->oper == Seq && edge == 0) || (cond->oper == Sne && edge == 1);
+		});
+		if (checked)
+			return true;
+		if (def.ins && def.ins->oper == Add && def.ins->src1.isReg() && isSmallImm(def.ins->src2) && immValue(def.ins->src2) >= 0)
+		{
+			size_t root = rootOf(def.ins->src1);
+			return root != SSAValueIndex::npos && visiting.insert(ptr).second && isNonNull(root, def.block, def.iter, visiting);
+		}
+		if (!def.phi)
+			return false;
+		if (!visiting.insert(ptr).second)	//a phi is non-null if all its srcs are
+			return true;
+		for (auto &src : def.phi->srcs)
+		{
+			Block *from = src.second.lock().get();
+			if (trapBlocks.count(from) || isInfeasible(from, visiting))
+				continue;
+			size_t root = rootOf(src.first);
+			if (root == SSAValueIndex::npos || !isNonNull(root, from, from->ins.end(), visiting))
+				return false;
+		}
+		return true;
+	}
+
+	//the block is reached only if a non-null pointer is null
+	bool BoundsCheckElimination::isInfeasible(Block *block, std::set<size_t> &visiting)
+	{
+		return dominatedBy(block, block->ins.end(), [&visiting, this](const Instruction &ins, int edge)
+		{
+			if (edge == -1)
+				return false;
+			size_t id = index.id(ins.src1);
+			const ValueDef *cond = id == SSAValueIndex::npos ? nullptr : &defs[id];
+			if (!cond || !cond->ins || !cond->ins->src2.isImm() || immValue(cond->ins->src2) != 0)
+				return false;
+			if (!((cond->ins->oper == Seq && edge == 1) || (cond->ins->oper == Sne && edge == 0)))
+				return false;
+			size_t ptr = rootOf(cond->ins->src1);
+			return ptr != SSAValueIndex::npos && isNonNull(ptr, cond->block, cond->iter, visiting);
+		});
+	}
+
+	//whether a dominating check on the same array and subscript has passed
+	bool BoundsCheckElimination::isChecked(const Operand &array, const Operand &subscript, Block *block, InsList::iterator iter)
+	{
+		size_t root = rootOf(array);
+		auto linear = linearOf(subscript);
+		if (root == SSAValueIndex::npos || linear.first == SSAValueIndex::npos)
+			return false;
+		return dominatedBy(block, iter, [root, linear, this](const Instruction &ins, int edge)
+		{
+			if (edge == -1)
+				return isSubscriptCall(ins) && rootOf(ins.paramExt[0]) == root && linearOf(ins.paramExt[1]) == linear;
+			size_t id = index.id(ins.src1);
+			const Instruction *cond = id == SSAValueIndex::npos ? nullptr : defs[id].ins;
+			if (edge != 0 || !cond || cond->oper != Sgeu || !cond->src2.isReg() || linearOf(cond->src1) != linear)
+				return false;
+			const Instruction *length = defs[index.id(cond->src2)].ins;
+			return length && length->oper == Load && rootOf(length->src1) == root;
+		});
+	}
+
+	bool BoundsCheckElimination::inRange(const Operand &array, const Operand &subscript)
+	{
+		size_t root = rootOf(array);
+		if (root == SSAValueIndex::npos)
+			return false;
+		budget = ProofBudget;
+		if (!proveLower(subscript, 0))
+			return false;
+		budget = ProofBudget;
+		return proveUpper(subscript, lengthOf(root), -1);
+	}
+
+	bool BoundsCheckElimination::proveUpper(const Operand &operand, const LengthForm &length, std::int64_t c)
+	{
+		if (!budget)
+			return false;
+		budget--;
+		if (operand.isImm())	//a length is never negative
+		{
+			auto iter = length.find(SSAValueIndex::npos);
+			return immValue(operand) <= c || (iter != length.end() && immValue(operand) - iter->second <= c);
+		}
+		auto linear = linearOf(operand);
+		if (linear.first == SSAValueIndex::npos)
+			return false;
+		auto iter = length.find(linear.first);
+		if (iter != length.end() && linear.second - iter->second <= c)
+			return true;
+
+		size_t id = index.id(operand);
+		const ValueDef &def = defs[id];
+		if (def.ins)
+		{
+			const Instruction &ins = *def.ins;
+			switch (ins.oper)
+			{
+			case Move:
+			case Sext:
+				return proveUpper(ins.src1, length, c);
+			case Add:
+				if (isSmallImm(ins.src2))
+					return proveUpper(ins.src1, length, c - immValue(ins.src2));
+				if (isSmallImm(ins.src1))
+					return proveUpper(ins.src2, length, c - immValue(ins.src1));
+				return false;
+			case Sub:
+				if (isSmallImm(ins.src2))
+					return proveUpper(ins.src1, length, c + immValue(ins.src2));
+				return proveUpper(ins.src1, length, c) && proveLower(ins.src2, 0);
+			case And:		//x & k is in [0, k]
+				return isSmallImm(ins.src2) && immValue(ins.src2) >= 0 && immValue(ins.src2) <= c;
+			case Mod:		//|x % k| < k
+				return isSmallImm(ins.src2) && immValue(ins.src2) > 0 && immValue(ins.src2) - 1 <= c;
+			default:
+				return false;
+			}
+		}
+		if (def.phi)
+		{
+			if (activeUpper[id] != NotActive)	//around a loop: fine unless the bound gets tighter
+				return c >= activeUpper[id];
+			activeUpper[id] = c;
+			bool ret = true;
+			for (auto &src : def.phi->srcs)
+			{
+				if (!trapBlocks.count(src.second.lock().get()) && !proveUpper(src.first, length, c))
+				{
+					ret = false;
+					break;
+				}
+			}
+			activeUpper[id] = NotActive;
+			return ret;
+		}
+		if (def.sigma)
+		{
+			Operand other;
+			std::int64_t offset;
+			if (sigmaBound(def, true, other, offset) && proveUpper(other, length, c - offset))
+				return true;
+			return proveUpper(def.sigma->src, length, c);
+		}
+		return false;
+	}
+
+	bool BoundsCheckElimination::proveLower(const Operand &operand, std::int64_t c)
+	{
+		if (!budget)
+			return false;
+		budget--;
+		if (operand.isImm())
+			return immValue(operand) >= c;
+		auto linear = linearOf(operand);
+		if (linear.first == SSAValueIndex::npos)
+			return false;
+		if (lengthValues.count(linear.first) && linear.second >= c)
+			return true;
+
+		size_t id = index.id(operand);
+		const ValueDef &def = defs[id];
+		if (def.ins)
+		{
+			const Instruction &ins = *def.ins;
+			switch (ins.oper)
+			{
+			case Move:
+			case Sext:
+				return proveLower(ins.src1, c);
+			case Add:
+				if (isSmallImm(ins.src2))
+					return proveLower(ins.src1, c - immValue(ins.src2));
+				if (isSmallImm(ins.src1))
+					return proveLower(ins.src2, c - immValue(ins.src1));
+				return proveLower(ins.src1, c) && proveLower(ins.src2, 0);
+			case Sub:
+				return isSmallImm(ins.src2) && proveLower(ins.src1, c + immValue(ins.src2));
+			case And:
+				return isSmallImm(ins.src2) && immValue(ins.src2) >= 0 && c <= 0;
+			case Mod:
+				return isSmallImm(ins.src2) && immValue(ins.src2) > 0 && c <= 0 && proveLower(ins.src1, 0);
+			default:
+				return false;
+			}
+		}
+		if (def.phi)
+		{
+			if (activeLower[id] != NotActive)
+				return c <= activeLower[id];
+			activeLower[id] = c;
+			bool ret = true;
+			for (auto &src : def.phi->srcs)
+			{
+				if (!trapBlocks.count(src.second.lock().get()) && !proveLower(src.first, c))
+				{
+					ret = false;
+					break;
+				}
+			}
+			activeLower[id] = NotActive;
+			return ret;
+		}
+		if (def.sigma)
+		{
+			Operand other;
+			std::int64_t offset;
+			if (sigmaBound(def, false, other, offset) && proveLower(other, c - offset))
+				return true;
+			return proveLower(def.sigma->src, c);
+		}
+		return false;
+	}
+
+	bool BoundsCheckElimination::sigmaBound(const ValueDef &def, bool upper, Operand &other, std::int64_t &offset)
+	{
+		enum Relation { LT, LE, GT, GE, EQ, NE };
+		static const Relation negated[] = { GE, GT, LE, LT, NE, EQ };
+		static const Relation swapped[] = { GT, GE, LT, LE, EQ, NE };
+
+		const Instruction &br = def.block->ins.back();
+		if (br.oper != Br || !br.src1.isReg())
+			return false;
+		const Instruction *cond = defs[index.id(br.src1)].ins;
+		if (!cond)
+			return false;
+		Relation rel;
+		switch (cond->oper)
+		{
+		case Slt: rel = LT; break;
+		case Sle: rel = LE; break;
+		case Sgt: rel = GT; break;
+		case Sge: rel = GE; break;
+		case Seq: rel = EQ; break;
+		default:
+			return false;
+		}
+		if (!def.edgeTrue)
+			rel = negated[rel];
+		if (sameValue(cond->src1, def.sigma->src))
+			other = cond->src2;
+		else if (sameValue(cond->src2, def.sigma->src))
+			other = cond->src1, rel = swapped[rel];
+		else
+			return false;
+
+		if (rel == EQ)
+			offset = 0;
+		else if (upper && (rel == LT || rel == LE))
+			offset = rel == LT ? -1 : 0;
+		else if (!upper && (rel == GT || rel == GE))
+			offset = rel == GT ? 1 : 0;
+		else
+			return false;
+		return true;
+	}
+}
@@ -0,0 +1,79 @@
+#ifndef MX_COMPILER_BOUNDS_CHECK_ELIMINATION_H
+#define MX_COMPILER_BOUNDS_CHECK_ELIMINATION_H
+
+#include "common.h"
+#include "IR.h"
+#include "SSAValueIndex.h"
+#include "FunctionAnalysis.h"
+
+namespace MxIR
+{
+	//Removes the null checks and the range checks of array accesses that are proven redundant.
+	//Works on the SSI form built by SSAConstructor::constructSSIFull, and turns the function back into SSA form.
+	//The checks are the inlined bodies of __subscript_* and size(), and the calls to them that were not inlined.
+	//Ranges are proven on demand as in ABCD (Bodik et al.): a value is bounded through its definition,
+	//the sigma of the branch conditions and the phis of the induction variables.
+	//Like ABCD, it assumes that the induction variables do not wrap around.
+	class BoundsCheckElimination
+	{
+	public:
+		BoundsCheckElimination(Function &func, FunctionAnalysis &analysis) : func(func), analysis(analysis) {}
+		void work();
+
+	protected:
+		struct ValueDef
+		{
+			Block *block = nullptr;		//nullptr for the params
+			Instruction *ins = nullptr;
+			InsList::iterator iter;
+			Block::PhiIns *phi = nullptr;
+			Block::SigmaIns *sigma = nullptr;
+			bool edgeTrue = false;		//the sigma defines the value on the edge to brTrue
+		};
+		typedef std::map<size_t, std::int64_t> LengthForm;	//length == value + offset, for each of the values; npos for a constant
+
+		void collectDefs();
+		bool removeNullCheck(Block *block);
+		bool removeRangeCheck(Block *block);
+		bool canReplaceCall(Block *block, InsList::iterator iter);
+		void replaceCall(Block *block, InsList::iterator iter);
+		void removeBranch(Block *block);
+		void destructSSI();
+		void removeDeadValues();
+
+		size_t rootOf(const Operand &operand) const;	//the value after following moves and sigmas
+		std::pair<size_t, std::int64_t> linearOf(const Operand &operand) const;	//operand == value + offset
+		const LengthForm & lengthOf(size_t array);
+		bool allocLength(size_t array, std::pair<size_t, std::int64_t> &length, bool &found, std::set<size_t> &visiting);
+		bool storedLength(const Instruction &store, std::pair<size_t, std::int64_t> &length);
+
+		//facts known at the site: walk up the dominator tree, and the instructions before iter in block
+		bool isNonNull(const Operand &ptr, Block *block, InsList::iterator iter);
+		bool isNonNull(size_t ptr, Block *block, InsList::iterator iter, std::set<size_t> &visiting);
+		bool isInfeasible(Block *block, std::set<size_t> &visiting);
+		bool isChecked(const Operand &array, const Operand &index, Block *block, InsList::iterator iter);
+		template<class Pred> bool dominatedBy(Block *block, InsList::iterator iter, Pred pred);
+
+		bool inRange(const Operand &array, const Operand &index);
+		bool proveUpper(const Operand &operand, const LengthForm &length, std::int64_t c);	//operand <= length + c
+		bool proveLower(const Operand &operand, std::int64_t c);		//operand >= c
+		//the bound of the sigma src on its edge: src <= other + offset (upper) or src >= other + offset
+		bool sigmaBound(const ValueDef &def, bool upper, Operand &other, std::int64_t &offset);
+
+	protected:
+		Function &func;
+		FunctionAnalysis &analysis;
+		SSAValueIndex index;
+		std::vector<ValueDef> defs;
+		std::set<Block *> trapBlocks;		//blocks that call __runtime_error and never go on
+		std::vector<std::shared_ptr<Block>> deadBlocks;		//kept alive until the end of the pass
+		std::map<size_t, std::vector<size_t>> loadsOf, sizesOf;		//address -> the loads of [address] / the size() of the array
+		std::map<size_t, LengthForm> lengths;
+		std::set<size_t> lengthValues;		//the loaded lengths and the results of size()
+		std::vector<std::int64_t> activeUpper, activeLower;		//the bound a phi on the current proof path is asked for
+		size_t budget;
+		size_t nextReg;
+	};
+}
+
+#endif
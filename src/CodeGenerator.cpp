@@ -1,37 +1,147 @@
 #include "common_headers.h"
 #include "CodeGenerator.h"
 #include "RegisterAllocatorSSA.h"
+#include "RegisterAllocatorLinear.h"
 #include "ASM.h"
 #include "InstructionSelect.h"
+#include "CompileStats.h"
+#include "utils/DynamicBitset.h"
+#include "utils/DepGraph.h"
 using namespace MxIR;
 
 const std::vector<int> CodeGenerator::regCallerSave = { 0, 10, 11, 7, 6, 2, 1, 8, 9 };	//rax r10 r11 rdi rsi rdx rcx r8 r9
 const std::vector<int> CodeGenerator::regCalleeSave = { 3, 12, 13, 14, 15 };			//rbx r12-r15 (rbp)
 const std::vector<int> CodeGenerator::regParam = { 7, 6, 2, 1, 8, 9 };
+const std::vector<int> CodeGenerator::regParamInternal = { 7, 6, 2, 1, 8, 9, 0, 10 };		//rdi rsi rdx rcx r8 r9 rax r10
+const std::vector<int> CodeGenerator::regPreservedRecursive = { 8, 9, 10, 11 };				//r8-r11, unless they pass parameters
+
+std::unique_ptr<CodeGeneratorBasic> CodeGenerator::forkGenerator(std::ostream &out) const
+{
+	return std::unique_ptr<CodeGeneratorBasic>(new CodeGenerator(*this, out));
+}
+
+//In interprocedural mode the functions are generated bottom-up along the call graph,
+//so that the registers overwritten by a callee are known when its callers are allocated.
+//The functions in a cycle of the call graph also keep r8-r11 as callee-save registers,
+//which the calls inside the cycle may rely on before the registers they overwrite are known.
+std::vector<std::vector<size_t>> CodeGenerator::scheduleFuncs()
+{
+	if (!CompileFlags::getInstance()->optim_ipra || CompileFlags::getInstance()->reg_alloc_linear)
+		return CodeGeneratorBasic::scheduleFuncs();
+
+	size_t nFunc = program->vFuncs.size();
+	interproc = std::make_shared<InterprocInfo>();
+	interproc->internal.assign(nFunc, true);
+	interproc->level.assign(nFunc, 0);
+	interproc->component.assign(nFunc, size_t(-1));
+	interproc->preserved.assign(nFunc, 0);
+	interproc->clobber.assign(nFunc, callClobber(EmptyOperand()));
+	std::vector<std::set<size_t>> callee(nFunc);
+	for (size_t i = 0; i < nFunc; i++)
+	{
+		if (program->vFuncs[i].attribute & Export)
+			interproc->internal[i] = false;
+		program->vFuncs[i].content.inBlock->traverse([this, i, &callee](Block *block) -> bool
+		{
+			for (auto &ins : block->ins)
+			{
+				if (ins.oper == Call && ins.src1.type == Operand::funcID)
+					callee[i].insert(ins.src1.val);
+				std::vector<Operand *> operands = { &ins.dst, &ins.src1, &ins.src2 };
+				for (Operand &operand : ins.paramExt)
+					operands.push_back(&operand);
+				for (Operand *operand : operands)
+				{
+					if (operand->type == Operand::funcID && !(ins.oper == Call && operand == &ins.src1))
+						interproc->internal[operand->val] = false;
+				}
+			}
+			return true;
+		});
+	}
+
+	DepGraph callGraph(nFunc);
+	for (size_t i = 0; i < nFunc; i++)
+		for (size_t v : callee[i])
+			callGraph.link(i, v);
+	callGraph.work();
+	for (size_t c = 0; c < callGraph.getGroupCount(); c++)
+	{
+		const std::vector<size_t> &members = callGraph.getVertex(c);
+		size_t level = 0;
+		for (size_t w : members)
+		{
+			interproc->component[w] = c;
+			for (size_t v : callee[w])
+				if (callGraph.getGroup(v) != c)
+					level = std::max(level, interproc->level[v] + 1);
+		}
+		std::uint32_t preserved = 0;
+		if (callGraph.isCyclic(c))
+		{
+			for (int reg : regPreservedRecursive)
+				preserved |= 1U << reg;
+			for (size_t w : members)
+			{
+				const std::vector<int> &param = paramRegs(IDFunc(w));
+				for (size_t i = 0; i < param.size() && i < program->vFuncs[w].content.params.size(); i++)
+					preserved &= ~(1U << param[i]);
+			}
+		}
+		for (size_t w : members)
+		{
+			interproc->level[w] = level;
+			interproc->preserved[w] = preserved;
+		}
+	}
+	std::vector<std::vector<size_t>> groups;
+	for (size_t i = 0; i < nFunc; i++)
+	{
+		if (groups.size() <= interproc->level[i])
+			groups.resize(interproc->level[i] + 1);
+		groups[interproc->level[i]].push_back(i);
+	}
+	CompileStats::count("ipra_levels", groups.size());
+	return groups;
+}
 
 void CodeGenerator::generateFunc(MxProgram::funcInfo &finfo, const std::string &label)
 {
 	func = &finfo.content;
+	funcIndex = &finfo - program->vFuncs.data();
+	IRArena::Scope scope(func->arena);
 	bool hasFuncCall = false;
+	std::uint32_t callMask = 0;
 	varID = 0;
-	func->inBlock->traverse([&hasFuncCall, this](Block *block) -> bool
+	func->inBlock->traverse([&hasFuncCall, &callMask, this](Block *block) -> bool
 	{
 		for (auto &ins : block->ins)
 		{
-			for (Operand *operand : join<Operand *>(ins.getInputReg(), ins.getOutputReg()))
+			for (Operand *operand : join<Operand *>(ins.inputRegs(), ins.outputRegs()))
 				varID = std::max(varID, operand->val);
 
 			if (ins.oper == Call)
+			{
 				hasFuncCall = true;
+				callMask |= callClobber(ins.src1);
+			}
 		}
 		return true;
 	});
 
+	//the linear scan keeps the values living across calls out of the caller-save registers anyway
+	bool linearScan = CompileFlags::getInstance()->reg_alloc_linear;
 	std::vector<int> regList;
-	if (hasFuncCall)
+	if (hasFuncCall && !linearScan)
 	{
+		//the caller-save registers kept by every callee need no saving either
+		for (int reg : regCallerSave)
+			if (!(callMask >> reg & 1))
+				regList.push_back(reg);
 		std::copy(regCalleeSave.begin(), regCalleeSave.end(), std::back_inserter(regList));
-		std::copy(regCallerSave.begin(), regCallerSave.end(), std::back_inserter(regList));
+		for (int reg : regCallerSave)
+			if (callMask >> reg & 1)
+				regList.push_back(reg);
 	}
 	else
 	{
@@ -39,27 +149,50 @@ void CodeGenerator::generateFunc(MxProgram::funcInfo &finfo, const std::string &
 		std::copy(regCalleeSave.begin(), regCalleeSave.end(), std::back_inserter(regList));
 	}
 	
-	InstructionSelect is(*func);
-	is.work();
+	{
+		CompileStats::Scope stats("CodeGenerator.InstructionSelect", *func);
+		InstructionSelect is(*func);
+		is.work();
 
-	regularizeInsnPre();
-	initFuncEntryExit();
-	setRegisterConstrains();
-	setRegisterPrefer();
+		regularizeInsnPre();
+		initFuncEntryExit();
+		setRegisterConstrains();
+		setRegisterPrefer();
+	}
 
-	RegisterAllocatorSSA regAllocator(finfo.content, regList);
-	regAllocator.work();
+	{
+		CompileStats::Scope stats("CodeGenerator.RegisterAllocator", *func);
+		if (linearScan)
+		{
+			RegisterAllocatorLinear regAllocator(finfo.content, regList);
+			regAllocator.work();
+		}
+		else
+		{
+			FunctionAnalysis analysis(finfo.content);
+			RegisterAllocatorSSA regAllocator(finfo.content, analysis, regList);
+			regAllocator.work();
+		}
 
-	regularizeInsnPost();
-	func->mergeBlocks();
+		regularizeInsnPost();
+		func->mergeBlocks();
+		if (CompileFlags::getInstance()->optim_tail_call)
+			markSiblingCalls();
+	}
 
+	CompileStats::Scope stats("CodeGenerator.Emit");
 	allocateStackFrame();
 
 	writeLabel(label);
+	frameWrapped = false;
 	if (hasFuncCall || stackSize > 0)
 	{
-		writeCode("push rbp");
-		writeCode("mov rbp, rsp");
+		frameWrapped = shrinkWrapFrame();
+		if (!frameWrapped)
+		{
+			writeCode("push rbp");
+			writeCode("mov rbp, rsp");
+		}
 		popRBP = true;
 	}
 	else
@@ -68,16 +201,74 @@ void CodeGenerator::generateFunc(MxProgram::funcInfo &finfo, const std::string &
 			kv.second -= 8;
 		popRBP = false;
 	}
-	if (stackSize > 0)
+	if (stackSize > 0 && !frameWrapped)
 		writeCode("sub rsp, ", stackSize);
 
 	translateBlocks(sortBlocks(func->inBlock.get()));
+	computeClobber();
+}
+
+const std::vector<int> & CodeGenerator::paramRegs(const Operand &callee) const
+{
+	if (interproc && callee.type == Operand::funcID && interproc->internal[callee.val])
+		return regParamInternal;
+	return regParam;
+}
+
+std::uint32_t CodeGenerator::callClobber(const Operand &callee) const
+{
+	std::uint32_t mask = 0;
+	for (int reg : regCallerSave)
+		mask |= 1U << reg;
+	if (interproc && callee.type == Operand::funcID)
+	{
+		if (interproc->level[callee.val] < interproc->level[funcIndex])
+			return interproc->clobber[callee.val];
+		if (interproc->component[callee.val] == interproc->component[funcIndex])
+			return mask & ~interproc->preserved[callee.val];
+	}
+	return mask;
+}
+
+void CodeGenerator::computeClobber()
+{
+	if (!interproc)
+		return;
+	std::uint32_t mask = 1U << 0;	//rax is cleared by the returns without value
+	func->inBlock->traverse([&mask, this](Block *block) -> bool
+	{
+		for (auto &ins : block->ins)
+		{
+			for (Operand *operand : ins.outputRegs())
+				if (operand->pregid != -1)
+					mask |= 1U << operand->pregid;
+			if (ins.oper == Xchg)
+				mask |= (1U << ins.src1.pregid) | (1U << ins.src2.pregid);
+			else if (ins.oper == Div || ins.oper == Mod)
+				mask |= (1U << 0) | (1U << 2);
+			else if (ins.oper == Call)
+				mask |= callClobber(ins.src1);
+			else if (ins.oper == Placeholder && ins.src1.val == 4)
+				mask |= callClobber(ins.src2);
+			else if (ins.oper == LockReg)
+			{
+				for (Operand &operand : ins.paramExt)
+					mask |= 1U << operand.pregid;
+			}
+		}
+		return true;
+	});
+	interproc->clobber[funcIndex] = mask & callClobber(EmptyOperand()) & ~interproc->preserved[funcIndex];
 }
 
 void CodeGenerator::initFuncEntryExit()
 {
 	std::vector<Operand> pMoveDst, pMoveSrc;
-	for (int reg : regCalleeSave)
+	std::vector<int> calleeSave = regCalleeSave;
+	for (int reg : regCallerSave)
+		if (interproc && (interproc->preserved[funcIndex] >> reg & 1))
+			calleeSave.push_back(reg);
+	for (int reg : calleeSave)
 	{
 		pMoveDst.push_back(RegPtr(++varID).setPRegID(reg));
 		pMoveSrc.push_back(RegPtr(Operand::InvalidID).setPRegID(reg));
@@ -85,6 +276,7 @@ void CodeGenerator::initFuncEntryExit()
 	func->inBlock->ins.push_front(IRParallelMove(pMoveDst, pMoveSrc));
 	for (Operand &operand : pMoveDst)
 		operand.pregid = -1;
+	func->outBlock->phi.clear();	//never read, and their copies would land after the callee-save registers are restored
 	for (Block *exit : func->outBlock->preds)
 	{
 		assert(exit->ins.back().oper == Return);
@@ -97,14 +289,15 @@ void CodeGenerator::initFuncEntryExit()
 
 	pMoveDst.clear();
 	pMoveSrc.clear();
-	for (size_t i = 0; i < regParam.size() && i < func->params.size(); i++)
+	const std::vector<int> &funcParam = paramRegs(IDFunc(funcIndex));
+	for (size_t i = 0; i < funcParam.size() && i < func->params.size(); i++)
 	{
-		pMoveDst.push_back(func->params[i].clone().setPRegID(regParam[i]));
-		pMoveSrc.push_back(RegPtr(Operand::InvalidID).setPRegID(regParam[i]));
+		pMoveDst.push_back(func->params[i].clone().setPRegID(funcParam[i]));
+		pMoveSrc.push_back(RegPtr(Operand::InvalidID).setPRegID(funcParam[i]));
 	}
 	func->inBlock->ins.push_front(IRParallelMove(pMoveDst, pMoveSrc));
-	for (size_t i = regParam.size(); i < func->params.size(); i++)
-		func->inBlock->ins.push_front(IR(func->params[i], ExternalVar, ImmPtr((std::int64_t(i) - 4) * 8)));
+	for (size_t i = funcParam.size(); i < func->params.size(); i++)
+		func->inBlock->ins.push_front(IR(func->params[i], ExternalVar, ImmPtr((std::int64_t(i - funcParam.size()) + 2) * 8)));
 }
 
 void CodeGenerator::regularizeInsnPre()
@@ -192,20 +385,27 @@ void CodeGenerator::setRegisterConstrains()
 			}
 			else if (iter->oper == Call)
 			{
+				const std::vector<int> &callParam = paramRegs(iter->src1);
 				size_t deltaRSP = 0;
-				if (iter->paramExt.size() > regParam.size() && (iter->paramExt.size() - regParam.size()) % 2 == 1)
+				if (iter->paramExt.size() > callParam.size() && (iter->paramExt.size() - callParam.size()) % 2 == 1)
 					block->ins.insert(iter, IR(EmptyOperand(), Placeholder, ImmPtr(0), ImmPtr(8))), deltaRSP += 8;	//placeholder(0, 8): sub rsp, 8
-				for (size_t i = regParam.size(); i < iter->paramExt.size(); i++)
-					block->ins.insert(iter, IR(EmptyOperand(), PushParam, iter->paramExt[i])), deltaRSP += 8;
+				for (size_t i = iter->paramExt.size(); i > callParam.size(); i--)		//the first one on the stack is pushed last
+					block->ins.insert(iter, IR(EmptyOperand(), PushParam, iter->paramExt[i - 1])), deltaRSP += 8;
 				std::vector<Operand> movRegParam;
-				for (size_t i = 0; i < regParam.size() && i < iter->paramExt.size(); i++)
+				std::uint32_t clobber = callClobber(iter->src1) | 1U << 0;
+				for (size_t i = 0; i < callParam.size() && i < iter->paramExt.size(); i++)
 				{
 					Operand tmp = RegSize(++varID, iter->paramExt[i].size());
 					block->ins.insert(iter, IR(tmp, Move, iter->paramExt[i]));
-					movRegParam.push_back(tmp.clone().setPRegID(regParam[i]));
+					movRegParam.push_back(tmp.clone().setPRegID(callParam[i]));
+					clobber |= 1U << callParam[i];
 				}
+				std::vector<int> lockReg;
 				for (int reg : regCallerSave)
 				{
+					if (!(clobber >> reg & 1))
+						continue;
+					lockReg.push_back(reg);
 					if (std::find_if(movRegParam.begin(), movRegParam.end(),
 						[reg](Operand operand) { return operand.pregid == reg; }) == movRegParam.end())
 					{
@@ -213,7 +413,7 @@ void CodeGenerator::setRegisterConstrains()
 					}
 				}
 				block->ins.insert(iter, IRMoveToRegister(movRegParam));
-				block->ins.insert(iter, IRLockRegister(regCallerSave));
+				block->ins.insert(iter, IRLockRegister(lockReg));
 				iter->paramExt.clear();
 				iter->dst.pregid = 0;
 				if (deltaRSP > 0)
@@ -356,16 +556,147 @@ void CodeGenerator::regularizeInsnPost()
 	});
 }
 
+std::vector<size_t> CodeGenerator::colorStackSlots(const std::vector<Instruction *> &slots)
+{
+	std::map<size_t, size_t> slotIndex;		//vreg id of the slot -> index in slots
+	for (size_t i = 0; i < slots.size(); i++)
+		slotIndex[slots[i]->dst.val] = i;
+	auto forEachSlot = [&slotIndex](Instruction &ins, std::function<void(size_t, bool)> callback)
+	{
+		if (ins.oper == Allocate)
+			return;
+		for (Operand *operand : join<Operand *>(ins.inputRegs(), ins.outputRegs()))
+		{
+			if (!operand->noreg)
+				continue;
+			auto iter = slotIndex.find(operand->val);
+			if (iter != slotIndex.end())
+				callback(iter->second, ins.oper == Store && operand == &ins.src1);		//a spill store overwrites the whole slot
+		}
+	};
+
+	//liveness of the slots: a slot is live from a store to it until its last load
+	std::vector<Block *> blocks;
+	std::map<Block *, DynamicBitset> liveIn, liveOut, used, killed;
+	func->inBlock->traverse([&blocks, &used, &killed, &forEachSlot](Block *block) -> bool
+	{
+		blocks.push_back(block);
+		DynamicBitset &use = used[block], &kill = killed[block];
+		for (auto &ins : block->ins)
+			forEachSlot(ins, [&use, &kill](size_t slot, bool isStore)
+			{
+				if (isStore)
+					kill.insert(slot);
+				else if (!kill.count(slot))
+					use.insert(slot);
+			});
+		return true;
+	});
+	for (bool changed = true; changed;)
+	{
+		changed = false;
+		for (auto iter = blocks.rbegin(); iter != blocks.rend(); ++iter)
+		{
+			Block *block = *iter;
+			for (Block *next : { block->brTrue.get(), block->brFalse.get() })
+				if (next)
+					liveOut[block].unionWith(liveIn[next]);
+			DynamicBitset in = liveOut[block];
+			in.subtract(killed[block]);
+			in.unionWith(used[block]);
+			changed |= liveIn[block].unionWith(in);
+		}
+	}
+
+	//every slot accessed by an instruction interferes with the slots live after it
+	std::vector<DynamicBitset> interfere(slots.size());
+	auto addInterference = [&interfere](size_t slot, const DynamicBitset &live)
+	{
+		for (size_t other : live)
+		{
+			if (other == slot)
+				continue;
+			interfere[slot].insert(other);
+			interfere[other].insert(slot);
+		}
+	};
+	for (Block *block : blocks)
+	{
+		DynamicBitset live = liveOut[block];
+		for (auto iter = block->ins.rbegin(); iter != block->ins.rend(); ++iter)
+		{
+			forEachSlot(*iter, [&live, &addInterference](size_t slot, bool isStore) { addInterference(slot, live); });
+			forEachSlot(*iter, [&live](size_t slot, bool isStore)
+			{
+				if (isStore)
+					live.erase(slot);
+				else
+					live.insert(slot);
+			});
+		}
+	}
+	for (size_t slot : liveIn[func->inBlock.get()])		//read before any store
+		addInterference(slot, liveIn[func->inBlock.get()]);
+
+	//greedy coloring, larger slots first; a slot only joins a color at least as large and as aligned as itself
+	std::vector<size_t> order(slots.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&slots](size_t a, size_t b)
+	{
+		return std::make_pair(slots[a]->src1.val, slots[a]->src2.val) > std::make_pair(slots[b]->src1.val, slots[b]->src2.val);
+	});
+	std::vector<size_t> color(slots.size());
+	std::vector<DynamicBitset> members;
+	std::vector<size_t> leader;		//color -> its first slot, which decides the size and the alignment of the color
+	for (size_t slot : order)
+	{
+		size_t c = 0;
+		for (; c < members.size(); c++)
+		{
+			Instruction *first = slots[leader[c]];
+			if (first->src1.val < slots[slot]->src1.val || first->src2.val < slots[slot]->src2.val)
+				continue;
+			DynamicBitset common = members[c];
+			common.subtract(interfere[slot]);
+			if (common.size() == members[c].size())
+				break;
+		}
+		if (c == members.size())
+		{
+			members.emplace_back();
+			leader.push_back(slot);
+		}
+		members[c].insert(slot);
+		color[slot] = c;
+	}
+	return color;
+}
+
 void CodeGenerator::allocateStackFrame()
 {
-	ssize_t curOffset = 0;
+	//spill slots without a fixed address are colored, and each color is laid out once after the other allocations
+	std::vector<Instruction *> slots;
+	for (auto &ins : func->inBlock->ins)
+		if (ins.oper == Allocate && ins.dst.noreg && ins.paramExt.empty())
+			slots.push_back(&ins);
+	std::vector<size_t> color = colorStackSlots(slots);
+
+	ssize_t curOffset = 0, uncoloredOffset = 0;
 	for (auto &ins : func->inBlock->ins)
 	{
 		if (ins.oper == Allocate)
 		{
-			ssize_t addr;
 			assert(ins.src1.isImm() && ins.src2.isImm());
 			if (ins.paramExt.empty())
+			{
+				uncoloredOffset += ins.src1.val;
+				uncoloredOffset = alignAddr(uncoloredOffset, ins.src2.val);
+			}
+			if (ins.dst.noreg && ins.paramExt.empty())
+				continue;
+
+			ssize_t addr;
+			if (ins.paramExt.empty())
 			{
 				curOffset += ins.src1.val;
 				curOffset = alignAddr(curOffset, ins.src2.val);
@@ -380,8 +711,218 @@ void CodeGenerator::allocateStackFrame()
 				ins = IR(ins.dst, LoadAddr, RegPtr(Operand::InvalidID).setPRegID(5), ImmPtr(addr));
 		}
 	}
+
+	//the colors are placed in decreasing alignment, so that little padding is needed between them
+	size_t nColor = color.empty() ? 0 : *std::max_element(color.begin(), color.end()) + 1;
+	std::vector<size_t> colorSize(nColor, 0), colorAlign(nColor, 1);
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		colorSize[color[i]] = std::max(colorSize[color[i]], size_t(slots[i]->src1.val));
+		colorAlign[color[i]] = std::max(colorAlign[color[i]], size_t(slots[i]->src2.val));
+	}
+	std::vector<size_t> colorOrder(nColor);
+	std::iota(colorOrder.begin(), colorOrder.end(), 0);
+	std::stable_sort(colorOrder.begin(), colorOrder.end(), [&colorAlign](size_t a, size_t b) { return colorAlign[a] > colorAlign[b]; });
+	std::vector<ssize_t> colorAddr(nColor);
+	for (size_t c : colorOrder)
+	{
+		curOffset += colorSize[c];
+		curOffset = alignAddr(curOffset, colorAlign[c]);
+		colorAddr[c] = -curOffset;
+	}
+	for (size_t i = 0; i < slots.size(); i++)
+		stackFrame[slots[i]->dst.val] = colorAddr[color[i]];
+
 	curOffset = alignAddr(curOffset, 16);
 	stackSize = curOffset;
+	CompileStats::count("frame_bytes_uncolored", alignAddr(uncoloredOffset, 16));
+	CompileStats::count("frame_bytes", stackSize);
+}
+
+//A call whose result is returned right away becomes a jump after the frame is left (placeholder(4, target)),
+//when nothing is restored between the call and the return and the call has no argument on the stack.
+void CodeGenerator::markSiblingCalls()
+{
+	size_t cnt = 0;
+	func->inBlock->traverse([this, &cnt](Block *block) -> bool
+	{
+		if (block->ins.empty() || block->ins.back().oper != Return)
+			return true;
+		auto iter = std::prev(block->ins.end());
+		while (iter != block->ins.begin())
+		{
+			--iter;
+			bool noCode = iter->oper == LockReg || iter->oper == UnlockReg || iter->oper == MoveToRegister
+				|| (iter->oper == Placeholder && iter->src1.val == 3);
+			if (!noCode)
+				break;
+		}
+		if (iter->oper != Call || (iter->src1.type != Operand::funcID && iter->src1.type != Operand::externalSymbolName))
+			return true;
+		if (block->ins.back().src1.type == Operand::empty)
+		{
+			//a return without value clears rax, and so do the functions returning void
+			if (iter->src1.type != Operand::funcID || program->vFuncs[iter->src1.val].retType.mainType != MxType::Void)
+				return true;
+		}
+		else if (!iter->dst.isReg() || iter->dst.pregid != 0)
+			return true;
+		if (interproc && (interproc->preserved[funcIndex] & callClobber(iter->src1)))
+			return true;
+
+		Operand target = iter->src1;
+		std::vector<Instruction> leave;
+		for (auto next = std::next(iter); next != block->ins.end(); ++next)
+			if (next->oper == Placeholder)
+				leave.push_back(*next);
+		block->ins.erase(iter, block->ins.end());
+		for (auto &ins : leave)
+			block->ins.push_back(ins);
+		block->ins.push_back(IR(EmptyOperand(), Placeholder, ImmPtr(4), target));
+		cnt++;
+		return true;
+	});
+	CompileStats::count("sibling_calls", cnt);
+}
+
+//Shrink-wrapping: the frame is set up at the heads of single-entry acyclic regions which cover
+//every block touching the stack, when the branch hints make these regions rarer than the entry.
+//The callee-save registers are saved and restored through spill slots, so they stay inside these regions.
+bool CodeGenerator::shrinkWrapFrame()
+{
+	std::vector<Block *> blocks;		//in reverse postorder
+	std::unordered_map<Block *, size_t> index;
+	func->inBlock->traverse_rev_postorder([this, &blocks, &index](Block *block) -> bool
+	{
+		if (block != func->outBlock.get())
+		{
+			index[block] = blocks.size();
+			blocks.push_back(block);
+		}
+		return true;
+	});
+
+	std::vector<double> freq(blocks.size(), 0);
+	freq[0] = 1;
+	for (size_t i = 0; i < blocks.size(); i++)
+	{
+		double probTrue = 1;
+		if (blocks[i]->brFalse)
+		{
+			assert(blocks[i]->ins.back().oper == Br);
+			std::uint64_t hint = blocks[i]->ins.back().src2.val;
+			probTrue = hint == likely ? 0.9 : hint == unlikely ? 0.1 : 0.5;
+		}
+		for (auto edge : { std::make_pair(blocks[i]->brTrue.get(), probTrue), std::make_pair(blocks[i]->brFalse.get(), 1 - probTrue) })
+		{
+			auto iter = index.find(edge.first);
+			if (iter != index.end() && iter->second > i)	//back edges are ignored
+				freq[iter->second] += freq[i] * edge.second;
+		}
+	}
+
+	std::vector<bool> needFrame(blocks.size(), false);
+	for (size_t i = 0; i < blocks.size(); i++)
+	{
+		for (auto &ins : blocks[i]->ins)
+		{
+			if (ins.oper == Allocate)
+				continue;
+			if (ins.oper == Call || ins.oper == PushParam || (ins.oper == Placeholder && ins.src1.val != 4))
+				needFrame[i] = true;
+			for (Operand *operand : join<Operand *>(ins.inputRegs(), ins.outputRegs()))
+				if (operand->pregid == -1 || operand->pregid == 5)	//stack slot or rbp
+					needFrame[i] = true;
+		}
+	}
+
+	//the blocks reachable from root, or an empty vector if root is in a cycle or the region has another entry
+	auto getRegion = [&blocks, &index](size_t root)
+	{
+		std::vector<bool> region(blocks.size(), false);
+		std::vector<size_t> stack = { root };
+		while (!stack.empty())
+		{
+			Block *block = blocks[stack.back()];
+			stack.pop_back();
+			for (Block *next : { block->brTrue.get(), block->brFalse.get() })
+			{
+				auto iter = index.find(next);
+				if (iter == index.end() || region[iter->second])
+					continue;
+				if (iter->second == root)
+					return std::vector<bool>();
+				region[iter->second] = true;
+				stack.push_back(iter->second);
+			}
+		}
+		region[root] = true;
+		for (size_t i = 0; i < blocks.size(); i++)
+			if (region[i] && i != root)
+				for (Block *pred : blocks[i]->preds)
+					if (!index.count(pred) || !region[index[pred]])
+						return std::vector<bool>();
+		return region;
+	};
+
+	FunctionAnalysis analysis(*func);
+	DomTree &dtree = analysis.domTree();
+	auto getIdom = [&blocks, &index, &analysis, &dtree](size_t idx)
+	{
+		return index[analysis.blocks()[dtree.getIdom(analysis.blockIndex(blocks[idx]))]];
+	};
+
+	//every block needing the frame picks its rarest dominator that can hold the frame
+	std::vector<int> validRoot(blocks.size(), -1);
+	std::set<size_t> roots;
+	for (size_t i = 0; i < blocks.size(); i++)
+	{
+		if (!needFrame[i])
+			continue;
+		std::vector<size_t> doms;
+		for (size_t idx = i; idx != 0; idx = getIdom(idx))
+			doms.push_back(idx);
+		size_t best = 0;
+		for (auto iter = doms.rbegin(); iter != doms.rend(); ++iter)
+		{
+			if (freq[*iter] >= freq[best] - 1e-9)
+				continue;
+			if (validRoot[*iter] == -1)
+				validRoot[*iter] = !getRegion(*iter).empty();
+			if (validRoot[*iter])
+				best = *iter;
+		}
+		roots.insert(best);
+	}
+	if (roots.count(0))
+		return false;
+
+	std::vector<size_t> outerRoots;
+	double rootFreq = 0;
+	for (size_t root : roots)
+	{
+		size_t idx = getIdom(root);
+		while (idx != 0 && !roots.count(idx))
+			idx = getIdom(idx);
+		if (idx == 0)
+		{
+			outerRoots.push_back(root);
+			rootFreq += freq[root];
+		}
+	}
+	if (rootFreq >= 1 - 1e-9)
+		return false;
+
+	for (size_t root : outerRoots)
+	{
+		std::vector<bool> region = getRegion(root);
+		blocks[root]->ins.push_front(IR(EmptyOperand(), Placeholder, ImmPtr(2), ImmPtr(stackSize)));	//placeholder(2, size): push rbp; mov rbp, rsp; sub rsp, size
+		for (size_t i = 0; i < blocks.size(); i++)
+			if (region[i] && (blocks[i]->ins.back().oper == Return || (blocks[i]->ins.back().oper == Placeholder && blocks[i]->ins.back().src1.val == 4)))
+				blocks[i]->ins.insert(std::prev(blocks[i]->ins.end()), IR(EmptyOperand(), Placeholder, ImmPtr(3), ImmPtr(0)));	//placeholder(3, 0): mov rsp, rbp; pop rbp
+	}
+	CompileStats::count("shrink_wrapped", 1);
+	return true;
 }
 
 std::string CodeGenerator::getOperand(Operand operand)
@@ -419,6 +960,28 @@ void CodeGenerator::translateIns(Instruction ins)
 			assert(ins.src2.isImm());
 			writeCode("add rsp, ", ins.src2.val);
 		}
+		else if (ins.src1.val == 2)
+		{
+			assert(ins.src2.isImm());
+			writeCode("push rbp");
+			writeCode("mov rbp, rsp");
+			if (ins.src2.val > 0)
+				writeCode("sub rsp, ", ins.src2.val);
+		}
+		else if (ins.src1.val == 3)
+		{
+			writeCode("mov rsp, rbp");
+			writeCode("pop rbp");
+		}
+		else if (ins.src1.val == 4)
+		{
+			if (popRBP && !frameWrapped)
+			{
+				writeCode("mov rsp, rbp");
+				writeCode("pop rbp");
+			}
+			writeCode("jmp ", getOperand(ins.src2));
+		}
 		else
 		{
 			assert(false);
@@ -538,7 +1101,7 @@ void CodeGenerator::translateIns(Instruction ins)
 	}
 	if (ins.oper == Return)
 	{
-		if (popRBP)
+		if (popRBP && !frameWrapped)
 		{
 			writeCode("mov rsp, rbp");
 			writeCode("pop rbp");
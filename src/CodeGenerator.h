@@ -10,6 +10,9 @@ public:
 	CodeGenerator(std::ostream &out) : CodeGeneratorBasic(out) {}
 
 protected:
+	CodeGenerator(const CodeGenerator &other, std::ostream &out) : CodeGeneratorBasic(other, out), interproc(other.interproc) {}
+	virtual std::unique_ptr<CodeGeneratorBasic> forkGenerator(std::ostream &out) const override;
+	virtual std::vector<std::vector<size_t>> scheduleFuncs() override;
 	virtual void generateFunc(MxProgram::funcInfo &finfo, const std::string &label) override;
 	virtual void translateIns(MxIR::Instruction ins) override; 
 
@@ -18,16 +21,37 @@ protected:
 	void setRegisterConstrains();
 	void setRegisterPrefer();
 	void regularizeInsnPost();
+	std::vector<size_t> colorStackSlots(const std::vector<MxIR::Instruction *> &slots);	//return the color of each slot
 	void allocateStackFrame();
+	void markSiblingCalls();
+	bool shrinkWrapFrame();		//return whether the frame is set up by placeholders instead of on entry
 	std::string getOperand(MxIR::Operand operand);
 
+	const std::vector<int> & paramRegs(const MxIR::Operand &callee) const;
+	std::uint32_t callClobber(const MxIR::Operand &callee) const;	//mask of the registers which may be overwritten by the call
+	void computeClobber();
+
 protected:
 	bool popRBP;
+	bool frameWrapped;
 	size_t varID;
 	MxIR::Function *func;
 	std::map<size_t, ssize_t> stackFrame;
 	size_t stackSize;
-	static const std::vector<int> regCallerSave, regCalleeSave, regParam;
+	size_t funcIndex;
+
+	//the call graph shared by all the function generators in interprocedural mode
+	struct InterprocInfo
+	{
+		std::vector<bool> internal;			//neither exported nor used as a value, so it takes the internal calling convention
+		std::vector<size_t> level;			//height in the condensed call graph, the callees of a function are generated in lower levels
+		std::vector<size_t> component;		//strongly connected component in the call graph
+		std::vector<std::uint32_t> preserved;	//caller-save registers kept by a recursive function for the calls from its own component
+		std::vector<std::uint32_t> clobber;	//mask of the caller-save registers overwritten by the function, filled in when it is generated
+	};
+	std::shared_ptr<InterprocInfo> interproc;
+
+	static const std::vector<int> regCallerSave, regCalleeSave, regParam, regParamInternal, regPreservedRecursive;
 };
 
 #endif
\ No newline at end of file
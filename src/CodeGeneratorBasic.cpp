@@ -1,13 +1,28 @@
 #include "common_headers.h"
 #include "CodeGeneratorBasic.h"
 #include "ASM.h"
+#include "utils/ThreadPool.h"
 using namespace MxIR;
 
 const std::string CodeGeneratorBasic::paramReg[] = { "rdi", "rsi", "rdx", "rcx", "r8", "r9" };
 const int CodeGeneratorBasic::paramRegID[] = { 7, 6, 2, 1, 8, 9 };
 
+std::unique_ptr<CodeGeneratorBasic> CodeGeneratorBasic::forkGenerator(std::ostream &out) const
+{
+	return std::unique_ptr<CodeGeneratorBasic>(new CodeGeneratorBasic(*this, out));
+}
+
+std::vector<std::vector<size_t>> CodeGeneratorBasic::scheduleFuncs()
+{
+	std::vector<size_t> all(program->vFuncs.size());
+	std::iota(all.begin(), all.end(), 0);
+	return { all };
+}
+
 void CodeGeneratorBasic::createLabel()
 {
+	labelFunc = std::make_shared<std::vector<std::string>>();
+	labelVar = std::make_shared<std::vector<std::string>>();
 	std::set<std::string> setNames;
 	for (size_t i = 0; i< program->vFuncs.size();i++)
 	{
@@ -17,7 +32,7 @@ void CodeGeneratorBasic::createLabel()
 			std::string funcName = symbol->vSymbol[finfo.funcName];
 			assert(setNames.find(funcName) == setNames.end());
 			setNames.insert(funcName);
-			labelFunc.push_back(funcName);
+			labelFunc->push_back(funcName);
 		}
 		else
 		{
@@ -30,7 +45,7 @@ void CodeGeneratorBasic::createLabel()
 				assert(setNames.find(decName) == setNames.end());
 			}
 			setNames.insert(decName);
-			labelFunc.push_back(decName);
+			labelFunc->push_back(decName);
 		}
 	}
 	for (size_t i = 0; i < program->vGlobalVars.size(); i++)
@@ -38,7 +53,7 @@ void CodeGeneratorBasic::createLabel()
 		std::string varName = "_GV_" + symbol->vSymbol[program->vGlobalVars[i].varName];
 		assert(setNames.find(varName) == setNames.end());
 		setNames.insert(varName);
-		labelVar.push_back(varName);
+		labelVar->push_back(varName);
 	}
 }
 
@@ -394,9 +409,9 @@ std::string CodeGeneratorBasic::getConst(MxIR::Operand src, bool immSigned, int
 		return ss.str();
 	}
 	if (src.type == Operand::funcID)
-		return labelFunc[src.val];
+		return (*labelFunc)[src.val];
 	if (src.type == Operand::globalVarID)
-		return labelVar[src.val];
+		return (*labelVar)[src.val];
 	if (src.type == Operand::externalSymbolName)
 		return symbol->vSymbol[src.val];
 	if (src.type == Operand::constID)
@@ -704,12 +719,27 @@ void CodeGeneratorBasic::generateProgram()
 	createLabel();
 	cntLocalLabel = 0;
 
+	//functions are generated independently into their own buffers and spliced in order.
+	//Local labels (.L<n>) are numbered from 0 in each function; nasm scopes them to the function label.
+	std::vector<std::stringstream> funcCode(program->vFuncs.size());
+	ThreadPool pool(CompileFlags::getInstance()->jobs);
+	for (const std::vector<size_t> &group : scheduleFuncs())
+	{
+		pool.parallelFor(group.size(), [this, &funcCode, &group](size_t k)
+		{
+			size_t i = group[k];
+			if (program->vFuncs[i].disabled)
+				return;
+			forkGenerator(funcCode[i])->generateFunc(program->vFuncs[i], (*labelFunc)[i]);
+		});
+	}
+
 	writeCode("section .text");
 	for (size_t i = 0; i < program->vFuncs.size(); i++)
 	{
 		if (program->vFuncs[i].disabled)
 			continue;
-		generateFunc(program->vFuncs[i], labelFunc[i]);
+		out << funcCode[i].str();
 		out << std::endl;
 	}
 	for (size_t i = 0; i < program->vConst.size(); i++)
@@ -726,7 +756,7 @@ void CodeGeneratorBasic::generateProgram()
 	{
 		if (program->vGlobalVars[i].varType.mainType == MxType::Function)
 			continue;
-		generateVar(program->vGlobalVars[i], labelVar[i]);
+		generateVar(program->vGlobalVars[i], (*labelVar)[i]);
 		out << std::endl;
 	}
 }
\ No newline at end of file
@@ -11,10 +11,18 @@ class CodeGeneratorBasic
 public:
 	CodeGeneratorBasic(std::ostream &out) : 
 		program(MxProgram::getDefault()), symbol(GlobalSymbol::getDefault()), out(out), cntLocalLabel(0) {}
+	virtual ~CodeGeneratorBasic() {}
 
 	void generateProgram();
 
 protected:
+	//a generator for a single function, writing into its own buffer
+	CodeGeneratorBasic(const CodeGeneratorBasic &other, std::ostream &out) :
+		program(other.program), symbol(other.symbol), out(out), labelFunc(other.labelFunc), labelVar(other.labelVar), cntLocalLabel(0) {}
+	virtual std::unique_ptr<CodeGeneratorBasic> forkGenerator(std::ostream &out) const;
+	//groups of functions to generate one after another, the functions in a group are generated in parallel
+	virtual std::vector<std::vector<size_t>> scheduleFuncs();
+
 	void createLabel();
 	virtual std::string decorateFuncName(const MxProgram::funcInfo &finfo);
 	virtual void generateFunc(MxProgram::funcInfo &finfo, const std::string &label);
@@ -50,7 +58,7 @@ protected:
 	MxProgram *program;
 	GlobalSymbol *symbol;
 	std::ostream &out;
-	std::vector<std::string> labelFunc, labelVar;
+	std::shared_ptr<std::vector<std::string>> labelFunc, labelVar;
 	size_t cntLocalLabel;
 	std::vector<std::int64_t> regAddr;
 	std::list<std::tuple<size_t, size_t, std::int64_t>> allocAddr;
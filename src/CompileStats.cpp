@@ -0,0 +1,198 @@
+#include "common_headers.h"
+#include "CompileStats.h"
+#include <sys/resource.h>
+
+using namespace MxIR;
+
+thread_local CompileStats::Record *CompileStats::current = nullptr;
+
+namespace
+{
+	struct IRCount
+	{
+		std::int64_t blocks = 0, instructions = 0, phis = 0;
+	};
+
+	void countIR(Function &func, IRCount &cnt)
+	{
+		if (!func.inBlock)
+			return;
+		func.inBlock->traverse([&cnt](Block *block) -> bool
+		{
+			cnt.blocks++;
+			cnt.instructions += block->ins.size();
+			cnt.phis += block->phi.size();
+			return true;
+		});
+	}
+
+	void countIR(MxProgram *program, IRCount &cnt)
+	{
+		for (auto &finfo : program->vFuncs)
+			countIR(finfo.content, cnt);
+	}
+
+	std::string escapeJSON(const std::string &in)
+	{
+		std::string ret;
+		for (char c : in)
+		{
+			if (c == '"' || c == '\\')
+				ret += '\\';
+			ret += c;
+		}
+		return ret;
+	}
+}
+
+void CompileStats::Record::addCounter(const std::string &counter, std::int64_t value)
+{
+	for (auto &kv : counters)
+		if (kv.first == counter)
+		{
+			kv.second += value;
+			return;
+		}
+	counters.emplace_back(counter, value);
+}
+
+CompileStats::Scope::Scope(const std::string &name) : parent(nullptr)
+{
+	if (!CompileStats::getInstance()->isEnabled())
+		return;
+	record.reset(new Record);
+	record->name = name;
+	begin();
+}
+
+CompileStats::Scope::Scope(const std::string &name, Function &func) : Scope(name)
+{
+	if (!record)
+		return;
+	this->func = &func;
+	IRCount cnt;
+	countIR(func, cnt);
+	record->addCounter("blocks_before", cnt.blocks);
+	record->addCounter("instructions_before", cnt.instructions);
+	record->addCounter("phis_before", cnt.phis);
+}
+
+CompileStats::Scope::Scope(const std::string &name, MxProgram *program) : Scope(name)
+{
+	if (!record)
+		return;
+	this->program = program;
+	IRCount cnt;
+	countIR(program, cnt);
+	record->addCounter("blocks_before", cnt.blocks);
+	record->addCounter("instructions_before", cnt.instructions);
+	record->addCounter("phis_before", cnt.phis);
+}
+
+void CompileStats::Scope::begin()
+{
+	CompileStats *stats = CompileStats::getInstance();
+	{
+		//reserve the slot now, so that records are listed in the order the stages start
+		std::lock_guard<std::mutex> lock(stats->mtx);
+		if (std::find_if(stats->records.begin(), stats->records.end(), [this](const Record &r) { return r.name == record->name; }) == stats->records.end())
+		{
+			stats->records.emplace_back();
+			stats->records.back().name = record->name;
+		}
+	}
+	parent = current;
+	current = record.get();
+	startRSS = peakRSS();
+	start = std::chrono::steady_clock::now();
+}
+
+CompileStats::Scope::~Scope()
+{
+	if (!record)
+		return;
+	record->milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	record->peakRSSDelta = peakRSS() - startRSS;
+	record->runs = 1;
+	current = parent;
+
+	if (func || program)
+	{
+		IRCount cnt;
+		if (func)
+			countIR(*func, cnt);
+		else
+			countIR(program, cnt);
+		record->addCounter("blocks_after", cnt.blocks);
+		record->addCounter("instructions_after", cnt.instructions);
+		record->addCounter("phis_after", cnt.phis);
+	}
+	CompileStats::getInstance()->merge(*record);
+}
+
+void CompileStats::count(const std::string &counter, std::int64_t value)
+{
+	if (current)
+		current->addCounter(counter, value);
+}
+
+void CompileStats::merge(const Record &record)
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	for (auto &r : records)
+		if (r.name == record.name)
+		{
+			r.runs += record.runs;
+			r.milliseconds += record.milliseconds;
+			r.peakRSSDelta += record.peakRSSDelta;
+			for (auto &kv : record.counters)
+				r.addCounter(kv.first, kv.second);
+			return;
+		}
+	records.push_back(record);
+}
+
+long CompileStats::peakRSS()
+{
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss;
+}
+
+void CompileStats::printReport(std::ostream &out) const
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	out << "===== Compile time report =====" << std::endl;
+	out << std::right << std::setw(12) << "Wall (ms)" << std::setw(8) << "Runs" << std::setw(14) << "Peak RSS +KB" << "  Stage" << std::endl;
+	for (auto &r : records)
+	{
+		out << std::fixed << std::setprecision(3) << std::setw(12) << r.milliseconds << std::setw(8) << r.runs << std::setw(14) << r.peakRSSDelta << "  " << r.name << std::endl;
+		if (r.counters.empty())
+			continue;
+		out << std::setw(34) << "";
+		for (size_t i = 0; i < r.counters.size(); i++)
+			out << (i ? ", " : "") << r.counters[i].first << "=" << r.counters[i].second;
+		out << std::endl;
+	}
+	out << "Peak RSS: " << peakRSS() << " KB" << std::endl;
+}
+
+void CompileStats::writeJSON(std::ostream &out) const
+{
+	std::lock_guard<std::mutex> lock(mtx);
+	out << "{" << std::endl;
+	out << "  \"peak_rss_kb\": " << peakRSS() << "," << std::endl;
+	out << "  \"stages\": [";
+	for (size_t i = 0; i < records.size(); i++)
+	{
+		const Record &r = records[i];
+		out << (i ? "," : "") << std::endl;
+		out << "    { \"name\": \"" << escapeJSON(r.name) << "\", \"runs\": " << r.runs
+			<< ", \"wall_ms\": " << std::fixed << std::setprecision(3) << r.milliseconds
+			<< ", \"peak_rss_delta_kb\": " << r.peakRSSDelta << ", \"counters\": {";
+		for (size_t j = 0; j < r.counters.size(); j++)
+			out << (j ? ", " : " ") << "\"" << escapeJSON(r.counters[j].first) << "\": " << r.counters[j].second << (j + 1 == r.counters.size() ? " " : "");
+		out << "} }";
+	}
+	out << std::endl << "  ]" << std::endl << "}" << std::endl;
+}
@@ -0,0 +1,79 @@
+#ifndef MX_COMPILER_COMPILE_STATS_H
+#define MX_COMPILER_COMPILE_STATS_H
+
+#include "common.h"
+#include "IR.h"
+#include "MxProgram.h"
+#include <chrono>
+#include <mutex>
+
+//Wall time, peak RSS growth and IR counters of every compiler stage, for --time-passes and --stats.
+//A stage is measured by a CompileStats::Scope living on the thread that runs it; runs of the same
+//stage (e.g. GVN on every function) are summed into one record. PassManager opens the scopes of the passes,
+//and one around each group of function passes, since the time of a function pass is summed over the threads.
+//Peak RSS is process-wide, so with -j > 1 the deltas of stages running at the same time overlap.
+class CompileStats
+{
+public:
+	struct Record
+	{
+		std::string name;
+		size_t runs = 0;
+		double milliseconds = 0;
+		long peakRSSDelta = 0;		//in KB
+		std::vector<std::pair<std::string, std::int64_t>> counters;		//in the order they are first reported
+
+		void addCounter(const std::string &counter, std::int64_t value);
+	};
+
+	class Scope
+	{
+	public:
+		explicit Scope(const std::string &name);
+		//also count the blocks, instructions and phis of func or program before and after the stage
+		Scope(const std::string &name, MxIR::Function &func);
+		Scope(const std::string &name, MxProgram *program);
+		~Scope();
+
+	protected:
+		void begin();
+
+	protected:
+		std::unique_ptr<Record> record;
+		Record *parent;
+		MxIR::Function *func = nullptr;
+		MxProgram *program = nullptr;
+		std::chrono::steady_clock::time_point start;
+		long startRSS;
+	};
+
+	void enable() { enabled = true; }
+	bool isEnabled() const { return enabled; }
+
+	//add value to a counter of the innermost stage running on this thread
+	static void count(const std::string &counter, std::int64_t value);
+
+	void printReport(std::ostream &out) const;
+	void writeJSON(std::ostream &out) const;
+
+	static CompileStats * getInstance()
+	{
+		static CompileStats instance;
+		return &instance;
+	}
+
+protected:
+	CompileStats() : enabled(false) {}
+	CompileStats(const CompileStats &other) = delete;
+
+	void merge(const Record &record);
+	static long peakRSS();
+
+protected:
+	bool enabled;
+	mutable std::mutex mtx;
+	std::vector<Record> records;		//in the order the stages first finish
+	static thread_local Record *current;
+};
+
+#endif
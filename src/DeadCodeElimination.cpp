@@ -7,9 +7,14 @@ namespace MxIR
 	{
 		static const size_t maxIter = 50;
 
-		func.splitProgramRegion();
+		std::map<Block *, std::set<Block *>> loopBody = analysis.loops();
+		if (func.splitProgramRegion(loopBody))
+			analysis.invalidate();
 		func.constructPST();
 
+		index.build(func);
+		vars.assign(index.size(), VarProperty());
+		regionUse.assign(index.size(), 0);
 		collectVars();
 		
 		size_t i = 0;
@@ -36,17 +41,21 @@ namespace MxIR
 		{
 			for (auto iter = block->phi.begin(); iter != block->phi.end(); ++iter)
 			{
-				vars[iter->second.dst].block = block;
-				vars[iter->second.dst].isPhi = true;
-				vars[iter->second.dst].iterPhi = iter;
+				VarProperty &var = vars[index.id(iter->second.dst)];
+				var.defined = true;
+				var.block = block;
+				var.isPhi = true;
+				var.iterPhi = iter;
 			}
 			for (auto iter = block->ins.begin(); iter != block->ins.end(); ++iter)
 			{
-				for (Operand *operand : iter->getOutputReg())
+				for (Operand *operand : iter->outputRegs())
 				{
-					vars[*operand].block = block;
-					vars[*operand].isPhi = false;
-					vars[*operand].iterInsn = iter;
+					VarProperty &var = vars[index.id(*operand)];
+					var.defined = true;
+					var.block = block;
+					var.isPhi = false;
+					var.iterInsn = iter;
 				}
 			}
 			return true;
@@ -55,16 +64,26 @@ namespace MxIR
 
 	void DeadCodeElimination::eliminateVars()
 	{
-		std::set<Operand> marked;
-		func.inBlock->traverse([&marked, this](Block *block) -> bool
+		std::vector<bool> marked(index.size(), false);
+		std::queue<size_t> worklist;
+		auto mark = [&marked, &worklist, this](const Operand &operand)
+		{
+			size_t id = index.id(operand);
+			if (id != SSAValueIndex::npos && !marked[id])
+			{
+				marked[id] = true;
+				worklist.push(id);
+			}
+		};
+		func.inBlock->traverse([&mark, this](Block *block) -> bool
 		{
 			bool flag = false;
 			for (auto &ins : block->ins)
 			{
 				if (hasSideEffect(ins) || ins.oper == Br)
 				{
-					for (Operand *operand : join<Operand *>(ins.getInputReg(), ins.getOutputReg()))
-						marked.insert(*operand);
+					for (Operand *operand : join<Operand *>(ins.inputRegs(), ins.outputRegs()))
+						mark(*operand);
 					if(ins.oper != Br)
 						flag = true;
 				}
@@ -74,15 +93,12 @@ namespace MxIR
 			return true;
 		});
 
-		std::queue<Operand> worklist;
-		for (auto &op : marked)
-			worklist.push(op);
 		while (!worklist.empty())
 		{
-			Operand cur = worklist.front();
+			size_t cur = worklist.front();
 			worklist.pop();
 
-			if (!vars.count(cur))
+			if (!vars[cur].defined)
 				continue;
 
 			if (vars[cur].isPhi)
@@ -90,23 +106,13 @@ namespace MxIR
 				for (auto &src : vars[cur].iterPhi->second.srcs)
 				{
 					if (src.first.isReg())
-						if (!marked.count(src.first))
-						{
-							marked.insert(src.first);
-							worklist.push(src.first);
-						}
+						mark(src.first);
 				}
 			}
 			else
 			{
-				for (Operand *operand : vars[cur].iterInsn->getInputReg())
-				{
-					if (!marked.count(*operand))
-					{
-						marked.insert(*operand);
-						worklist.push(*operand);
-					}
-				}
+				for (Operand *operand : vars[cur].iterInsn->inputRegs())
+					mark(*operand);
 			}
 		}
 
@@ -114,7 +120,7 @@ namespace MxIR
 		{
 			for (auto iter = block->phi.begin(); iter != block->phi.end();)
 			{
-				if (!marked.count(iter->second.dst))
+				if (!marked[index.id(iter->second.dst)])
 					iter = block->phi.erase(iter);
 				else
 					++iter;
@@ -128,8 +134,8 @@ namespace MxIR
 				}
 
 				bool flag = false;
-				for (Operand *operand : iter->getOutputReg())
-					if (marked.count(*operand))
+				for (Operand *operand : iter->outputRegs())
+					if (marked[index.id(*operand)])
 					{
 						flag = true;
 						break;
@@ -145,45 +151,49 @@ namespace MxIR
 
 	void DeadCodeElimination::countGlobalUse()
 	{
-		for (auto &kv : vars)
-			kv.second.useCount = 0;
+		for (auto &var : vars)
+			var.useCount = 0;
 		func.inBlock->traverse([this](Block *block) -> bool
 		{
 			for (auto &ins : block->instructions())
-				for (Operand *operand : ins.getInputReg())
+				for (Operand *operand : ins.inputRegs())
 				{
-					if (!vars.count(*operand))
+					size_t id = index.id(*operand);
+					if (id == SSAValueIndex::npos || !vars[id].defined)
 						continue;
-					vars[*operand].useCount++;
+					vars[id].useCount++;
 				}
 			return true;
 		});
 	}
 
-	std::map<Operand, size_t> DeadCodeElimination::countUse(const std::set<Block *> &blocks)
+	//count the uses inside blocks into regionUse, return the ids touched
+	std::vector<size_t> DeadCodeElimination::countUse(const std::set<Block *> &blocks)
 	{
-		std::map<Operand, size_t> ret;
+		std::vector<size_t> ret;
 		for (Block *block : blocks)
 		{
 			for (auto &ins : block->instructions())
-				for (Operand *operand : ins.getInputReg())
+				for (Operand *operand : ins.inputRegs())
 				{
-					if (!vars.count(*operand))
+					size_t id = index.id(*operand);
+					if (id == SSAValueIndex::npos || !vars[id].defined)
 						continue;
-					ret[*operand]++;
+					if (regionUse[id]++ == 0)
+						ret.push_back(id);
 				}
 		}
 		return ret;
 	}
 
-	std::set<Operand> DeadCodeElimination::findDef(const std::set<Block *> &blocks)
+	std::vector<size_t> DeadCodeElimination::findDef(const std::set<Block *> &blocks)
 	{
-		std::set<Operand> ret;
+		std::vector<size_t> ret;
 		for (Block *block : blocks)
 		{
 			for (auto &ins : block->instructions())
-				for (Operand *operand : ins.getOutputReg())
-					ret.insert(*operand);
+				for (Operand *operand : ins.outputRegs())
+					ret.push_back(index.id(*operand));
 		}
 		return ret;
 	}
@@ -216,13 +226,21 @@ namespace MxIR
 		std::set<Block *> blocks = node->getBlocks();
 
 		auto def = findDef(blocks);
-		auto use = countUse(blocks);
-		for (auto &op : def)
+		auto used = countUse(blocks);
+		bool usedOutside = false;
+		for (size_t var : def)
 		{
-			assert(vars.count(op));
-			if (vars[op].useCount != use[op])
-				return 0;
+			assert(var != SSAValueIndex::npos && vars[var].defined);
+			if (vars[var].useCount != regionUse[var])
+			{
+				usedOutside = true;
+				break;
+			}
 		}
+		for (size_t var : used)
+			regionUse[var] = 0;
+		if (usedOutside)
+			return 0;
 
 		
 
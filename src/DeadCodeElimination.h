@@ -4,13 +4,15 @@
 #include "common.h"
 #include "MxProgram.h"
 #include "IR.h"
+#include "SSAValueIndex.h"
+#include "FunctionAnalysis.h"
 
 namespace MxIR
 {
 	class DeadCodeElimination
 	{
 	public:
-		DeadCodeElimination(Function &func) : func(func), program(MxProgram::getDefault()) {}
+		DeadCodeElimination(Function &func, FunctionAnalysis &analysis) : func(func), analysis(analysis), program(MxProgram::getDefault()) {}
 		void work();
 
 	protected:
@@ -19,16 +21,17 @@ namespace MxIR
 		void eliminateVars();
 
 		void countGlobalUse();
-		std::map<Operand, size_t> countUse(const std::set<Block *> &blocks);
-		static std::set<Operand> findDef(const std::set<Block *> &blocks);
+		std::vector<size_t> countUse(const std::set<Block *> &blocks);
+		std::vector<size_t> findDef(const std::set<Block *> &blocks);
 		int eliminateRegions(PSTNode *node);
 
 	protected:
 		struct VarProperty
 		{
+			bool defined = false;
 			bool isPhi;
 			Block *block;
-			std::list<Instruction>::iterator iterInsn;
+			InsList::iterator iterInsn;
 			std::map<size_t, Block::PhiIns>::iterator iterPhi;
 
 			size_t useCount = 0;
@@ -36,7 +39,10 @@ namespace MxIR
 
 		MxProgram *program;
 		Function &func;
-		std::map<Operand, VarProperty> vars;
+		FunctionAnalysis &analysis;
+		SSAValueIndex index;
+		std::vector<VarProperty> vars;		//indexed by SSA value id
+		std::vector<size_t> regionUse;
 		std::set<Block *> blockBlacklist;
 		bool regionUpdated;
 	};
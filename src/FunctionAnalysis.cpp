@@ -0,0 +1,143 @@
+#include "common_headers.h"
+#include "FunctionAnalysis.h"
+#include "LoopDetector.h"
+
+namespace MxIR
+{
+	const std::vector<Block *> & FunctionAnalysis::blocks()
+	{
+		if (!(valid & BlockOrder))
+			computeBlocks();
+		return vBlocks;
+	}
+
+	size_t FunctionAnalysis::blockIndex(Block *block)
+	{
+		if (!(valid & BlockOrder))
+			computeBlocks();
+		const size_t *idx = mapBlock.find(block);
+		assert(idx);
+		return *idx;
+	}
+
+	void FunctionAnalysis::computeBlocks()
+	{
+		vBlocks.clear();
+		mapBlock.clear();
+		func.inBlock->traverse([this](Block *block) -> bool
+		{
+			mapBlock.insert(block, vBlocks.size());
+			vBlocks.push_back(block);
+			return true;
+		});
+		valid |= BlockOrder;
+	}
+
+	DomTree & FunctionAnalysis::domTree()
+	{
+		if (valid & Dominator)
+			return dtree;
+		blocks();
+		dtree = DomTree(vBlocks.size());
+		for (size_t i = 0; i < vBlocks.size(); i++)
+			for (Block *next : { vBlocks[i]->brTrue.get(), vBlocks[i]->brFalse.get() })
+				if (next)
+					dtree.link(i, mapBlock[next]);
+		dtree.buildTree(0);
+		valid |= Dominator;
+		return dtree;
+	}
+
+	DomTree & FunctionAnalysis::postDomTree()
+	{
+		if (valid & PostDominator)
+			return postdtree;
+		blocks();
+		postdtree = DomTree(vBlocks.size());
+		for (size_t i = 0; i < vBlocks.size(); i++)
+			for (Block *next : { vBlocks[i]->brTrue.get(), vBlocks[i]->brFalse.get() })
+				if (next)
+					postdtree.link(mapBlock[next], i);
+		postdtree.buildTree(blockIndex(func.outBlock.get()));
+		valid |= PostDominator;
+		return postdtree;
+	}
+
+	const std::map<Block *, std::set<Block *>> & FunctionAnalysis::loops()
+	{
+		if (valid & Loop)
+			return loopBody;
+		LoopDetector detector(func);
+		detector.findLoops(blocks(), domTree());
+		loopBody = detector.getLoops();
+		valid |= Loop;
+		return loopBody;
+	}
+
+	const std::vector<double> & FunctionAnalysis::blockFreq()
+	{
+		if (valid & Frequency)
+			return freq;
+		const std::vector<Block *> &vBlock = blocks();
+		std::vector<size_t> depth(vBlock.size(), 0);
+		std::vector<const std::set<Block *> *> innermost(vBlock.size(), nullptr);
+		for (auto &kv : loops())
+			for (Block *block : kv.second)
+			{
+				size_t idx = mapBlock[block];
+				depth[idx]++;
+				if (!innermost[idx] || kv.second.size() < innermost[idx]->size())
+					innermost[idx] = &kv.second;
+			}
+
+		std::vector<size_t> order;
+		std::vector<size_t> position(vBlock.size());
+		func.inBlock->traverse_rev_postorder([this, &order, &position](Block *block) -> bool
+		{
+			position[mapBlock[block]] = order.size();
+			order.push_back(mapBlock[block]);
+			return true;
+		});
+
+		//the flow along the forward edges, relative to the loops enclosing each block;
+		//a branch leaving the innermost loop does not split the flow, since the loop runs until it exits
+		std::vector<double> flow(vBlock.size(), 0);
+		flow[0] = 1;
+		for (size_t k = 0; k < order.size(); k++)
+		{
+			size_t i = order[k];
+			Block *block = vBlock[i];
+			double probTrue = 1, probFalse = 1;
+			if (block->brFalse && !block->ins.empty() && block->ins.back().oper == Br)
+			{
+				bool exitTrue = innermost[i] && !innermost[i]->count(block->brTrue.get());
+				bool exitFalse = innermost[i] && !innermost[i]->count(block->brFalse.get());
+				if (exitTrue == exitFalse)
+				{
+					std::uint64_t hint = block->ins.back().src2.val;
+					probTrue = hint == likely ? 0.9 : hint == unlikely ? 0.1 : 0.5;
+					probFalse = 1 - probTrue;
+				}
+			}
+			for (auto edge : { std::make_pair(block->brTrue.get(), probTrue), std::make_pair(block->brFalse.get(), probFalse) })
+			{
+				if (!edge.first)
+					continue;
+				size_t next = mapBlock[edge.first];
+				if (position[next] > k)
+					flow[next] += std::min(flow[i], 1.0) * edge.second;
+			}
+		}
+		freq.resize(vBlock.size());
+		for (size_t i = 0; i < vBlock.size(); i++)
+			freq[i] = std::min(flow[i], 1.0) * std::pow(10.0, double(depth[i]));
+		valid |= Frequency;
+		return freq;
+	}
+
+	void FunctionAnalysis::invalidate(unsigned preserved)
+	{
+		if (!(preserved & PreserveCFG))
+			valid = 0;
+	}
+}
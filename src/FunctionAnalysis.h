@@ -0,0 +1,56 @@
+#ifndef MX_COMPILER_FUNCTION_ANALYSIS_H
+#define MX_COMPILER_FUNCTION_ANALYSIS_H
+
+#include "common.h"
+#include "IR.h"
+#include "utils/DomTree.h"
+#include "utils/PointerMap.h"
+
+namespace MxIR
+{
+	//Analyses of the CFG of one function, computed on first use and cached until invalidated.
+	//A pass that changes the CFG must call invalidate() before it (or the next pass) asks for an analysis again.
+	class FunctionAnalysis
+	{
+	public:
+		enum Preserved : unsigned
+		{
+			PreserveNothing = 0,
+			PreserveCFG = 1,	//blocks and edges are unchanged
+		};
+
+		explicit FunctionAnalysis(Function &func) : func(func), valid(0) {}
+
+		//blocks in the order of Block::traverse, blocks()[0] is the entry
+		const std::vector<Block *> & blocks();
+		size_t blockIndex(Block *block);
+		DomTree & domTree();
+		DomTree & postDomTree();	//rooted at func.outBlock
+		const std::map<Block *, std::set<Block *>> & loops();	//loop header -> loop body
+		//estimated executions of each block per call, indexed like blocks():
+		//hinted branches split the flow 9:1, other branches 1:1, and each enclosing loop multiplies it by 10
+		const std::vector<double> & blockFreq();
+
+		//drop every analysis that is not in preserved
+		void invalidate(unsigned preserved = PreserveNothing);
+
+	protected:
+		enum Analysis : unsigned
+		{
+			BlockOrder = 1, Dominator = 2, PostDominator = 4, Loop = 8, Frequency = 16,
+		};
+		void computeBlocks();
+
+	protected:
+		Function &func;
+		unsigned valid;
+
+		std::vector<Block *> vBlocks;
+		PointerMap<Block> mapBlock;
+		DomTree dtree, postdtree;
+		std::map<Block *, std::set<Block *>> loopBody;
+		std::vector<double> freq;
+	};
+}
+
+#endif
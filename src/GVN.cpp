@@ -1,58 +1,32 @@
 #include "common_headers.h"
 #include "GVN.h"
+#include "CompileStats.h"
 #include "utils/DispatchLength.h"
-#include <boost/uuid/sha1.hpp>
 
 namespace MxIR
 {
-	void GVN::ValueHash::process_bytes(const void *buffer, size_t length)
+	void GVN::ValueHash::mix(std::uint64_t value)
 	{
-		const char *begin = static_cast<const char *>(buffer);
-		const char *end = static_cast<const char *>(buffer)+length;
-		for (; begin != end; ++begin)
-			this->buffer.push_back(*begin);
+		hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
 	}
 
 	void GVN::ValueHash::cacluateHash()
 	{
-		boost::uuids::detail::sha1 sha1;
-		for (char c : buffer)
-			sha1.process_byte(c);
-		sha1.get_digest(hash);
-		IFNOT_DEBUG(buffer.clear());
+		//finalizer of MurmurHash3
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdULL;
+		hash ^= hash >> 33;
+		hash *= 0xc4ceb9fe1a85ec53ULL;
+		hash ^= hash >> 33;
 	}
 
 	void GVN::ValueHash::printHash(std::ostream &out)
 	{
 		auto oldflag = out.flags();
-
-		out << std::setfill('0');
-		for (size_t i = 0; i < 5; i++)
-			out << std::setw(8) << std::hex << hash[i];
-
+		out << std::setfill('0') << std::setw(16) << std::hex << hash;
 		out.flags(oldflag);
 	}
 
-	bool GVN::ValueHash::operator<(const ValueHash &rhs) const
-	{
-		for (size_t i = 0; i < 5; i++)
-		{
-			if (hash[i] < rhs.hash[i])
-				return true;
-			else if (hash[i] > rhs.hash[i])
-				return false;
-		}
-		return false;
-	}
-
-	bool GVN::ValueHash::operator==(const ValueHash &rhs) const
-	{
-		for (size_t i = 0; i < 5; i++)
-			if (hash[i] != rhs.hash[i])
-				return false;
-		return true;
-	}
-
 	GVN::ValueImm::ValueImm(Operand operand) : ValueNode(Imm)
 	{
 		assert(operand.isImm());
@@ -112,30 +86,26 @@ namespace MxIR
 	}
 
 	GVN::ValueCommAssoc::ValueCommAssoc(Operator oper, size_t length, 
-		const std::vector<std::shared_ptr<ValueNode>> &varValue, ValueImm immValue) : 
+		const std::vector<ValueNode *> &varValue, ValueImm immValue) : 
 		ValueNode(OperCommAssoc, length), oper(oper), varValue(varValue), immValue(immValue)
 	{
-		std::sort(this->varValue.begin(), this->varValue.end(), 
-			[](std::shared_ptr<GVN::ValueNode> lhs, std::shared_ptr<GVN::ValueNode> rhs)
-		{
-			return lhs->hash < rhs->hash;
-		});
+		std::sort(this->varValue.begin(), this->varValue.end(), [](ValueNode *lhs, ValueNode *rhs) { return lhs->id < rhs->id; });
 
 		hash.process(oper);
-		for (auto &node : this->varValue)
-			hash.process(node->hash.getHash());
+		for (ValueNode *node : this->varValue)
+			hash.process(node->id);
 		hash.process(immValue.hash.getHash());
 		hash.cacluateHash();
 	}
 
-	GVN::ValueBinary::ValueBinary(Operator oper, size_t length, std::shared_ptr<ValueNode> valueL, std::shared_ptr<ValueNode> valueR) :
+	GVN::ValueBinary::ValueBinary(Operator oper, size_t length, ValueNode *valueL, ValueNode *valueR) :
 		ValueNode(OperBinary, length), oper(oper), valueL(valueL), valueR(valueR)
 	{
-		if (oper == Seq && !(this->valueL < this->valueR))
+		if (oper == Seq && valueR->id < valueL->id)
 			std::swap(this->valueL, this->valueR);
 		hash.process(oper);
-		hash.process(this->valueL->hash.getHash());
-		hash.process(this->valueR->hash.getHash());
+		hash.process(this->valueL->id);
+		hash.process(this->valueR->id);
 		hash.cacluateHash();
 	}
 
@@ -172,11 +142,11 @@ namespace MxIR
 		}, val1, length1, sign, val2, length2, sign, 0, lengthResult, sign);
 	}
 
-	GVN::ValueUnary::ValueUnary(Operator oper, size_t length, std::shared_ptr<ValueNode> operand) :
+	GVN::ValueUnary::ValueUnary(Operator oper, size_t length, ValueNode *operand) :
 		ValueNode(OperUnary, length), oper(oper), operand(operand)
 	{
 		hash.process(oper);
-		hash.process(operand->hash.getHash());
+		hash.process(operand->id);
 		hash.cacluateHash();
 	}
 
@@ -207,30 +177,30 @@ namespace MxIR
 	}
 
 
-	GVN::ValueFuncCall::ValueFuncCall(size_t length, size_t funcID, const std::vector<std::shared_ptr<ValueNode>> &params) :
+	GVN::ValueFuncCall::ValueFuncCall(size_t length, size_t funcID, const std::vector<ValueNode *> &params) :
 		ValueNode(OperFuncCall, length), funcID(funcID), params(params)
 	{
 		hash.process(funcID);
-		for (auto &node : params)
-			hash.process(node->hash.getHash());
+		for (ValueNode *node : params)
+			hash.process(node->id);
 		hash.cacluateHash();
 	}
 
-	GVN::ValuePhiIf::ValuePhiIf(size_t length, std::shared_ptr<ValueNode> cond, std::shared_ptr<ValueNode> valueTrue, std::shared_ptr<ValueNode> valueFalse) :
+	GVN::ValuePhiIf::ValuePhiIf(size_t length, ValueNode *cond, ValueNode *valueTrue, ValueNode *valueFalse) :
 		ValueNode(OperPhiIf, length), cond(cond), valueTrue(valueTrue), valueFalse(valueFalse)
 	{
-		hash.process(cond->hash.getHash());
-		hash.process(valueTrue->hash.getHash());
-		hash.process(valueFalse->hash.getHash());
+		hash.process(cond->id);
+		hash.process(valueTrue->id);
+		hash.process(valueFalse->id);
 		hash.cacluateHash();
 	}
 
-	GVN::ValuePhi::ValuePhi(size_t length, size_t blockID, const std::vector<std::shared_ptr<ValueNode>> &srcs) :
+	GVN::ValuePhi::ValuePhi(size_t length, size_t blockID, const std::vector<ValueNode *> &srcs) :
 		ValueNode(OperPhi, length), blockID(blockID), srcs(srcs)
 	{
 		hash.process(blockID);
-		for (auto &node : srcs)
-			hash.process(node->hash.getHash());
+		for (ValueNode *node : srcs)
+			hash.process(node->id);
 		hash.cacluateHash();
 	}
 
@@ -256,30 +226,10 @@ namespace MxIR
 
 	bool GVN::ValueCommAssoc::equal(ValueNode &rhs)
 	{
-		if (!equal_impl(*this, rhs, &ValueCommAssoc::oper))
-			return false;
-		ValueCommAssoc &rnode = dynamic_cast<ValueCommAssoc &>(rhs);
-		if (immValue.val != rnode.immValue.val)
-			return false;
-		if (varValue.size() != rnode.varValue.size())
+		if (!equal_impl(*this, rhs, &ValueCommAssoc::oper, &ValueCommAssoc::varValue))
 			return false;
-		for (size_t i = 0; i < varValue.size(); i++)
-			if (!varValue[i]->equal(*rnode.varValue[i]))
-				return false;
-		return true;
-	}
-
-	bool GVN::ValueFuncCall::equal(ValueNode &rhs)
-	{
-		if (!equal_impl(*this, rhs, &ValueFuncCall::funcID))
-			return false;
-		ValueFuncCall &rnode = dynamic_cast<ValueFuncCall &>(rhs);
-		if (params.size() != rnode.params.size())
-			return false;
-		for (size_t i = 0; i < params.size(); i++)
-			if (!params[i]->equal(*rnode.params[i]))
-				return false;
-		return true;
+		ValueCommAssoc &rnode = static_cast<ValueCommAssoc &>(rhs);
+		return immValue.val == rnode.immValue.val && immValue.length == rnode.immValue.length;
 	}
 
 	bool GVN::isConstExpr(const Instruction &insn)
@@ -291,23 +241,38 @@ namespace MxIR
 		return true;
 	}
 
-	std::shared_ptr<GVN::ValueNode> GVN::getOperand(Operand operand)
+	GVN::ValueNode * GVN::getOperand(Operand operand)
 	{
 		if (operand.isReg())
 		{
-			assert(opNumber.count(operand));
-			return opNumber[operand];
+			assert(isNumbered(operand));
+			size_t id = index.id(operand);
+			return id == SSAValueIndex::npos ? nullptr : opNumber[id];
 		}
 		if (operand.isImm())
-			return std::shared_ptr<ValueNode>(new ValueImm(operand));
-		return std::shared_ptr<ValueNode>(new ValueConst(operand));
+			return intern(new ValueImm(operand));
+		return intern(new ValueConst(operand));
+	}
+
+	GVN::ValueNode * GVN::intern(ValueNode *value)
+	{
+		std::unique_ptr<ValueNode> holder(value);
+		auto range = valueIndex.equal_range(value->hash.getHash());
+		for (auto iter = range.first; iter != range.second; ++iter)
+			if (values[iter->second]->equal(*value))
+				return values[iter->second].get();
+		value->id = values.size();
+		valueIndex.emplace(value->hash.getHash(), value->id);
+		values.push_back(std::move(holder));
+		return value;
 	}
 
-	std::shared_ptr<GVN::ValueNode> GVN::reduceValue(std::shared_ptr<ValueNode> value)
+	GVN::ValueNode * GVN::reduceValue(ValueNode *value)
 	{
-		if (ValueUnary *unary = dynamic_cast<ValueUnary *>(value.get()))
+		std::unique_ptr<ValueNode> holder(value);
+		if (ValueUnary *unary = dynamic_cast<ValueUnary *>(value))
 		{
-			if (ValueUnary *unaryOperand = dynamic_cast<ValueUnary *>(unary->operand.get()))
+			if (ValueUnary *unaryOperand = dynamic_cast<ValueUnary *>(unary->operand))
 			{
 				if (unary->oper == unaryOperand->oper
 					&& (unary->oper == ValueUnary::Not || unary->oper == ValueUnary::Neg || unary->oper == ValueUnary::NotBool))
@@ -315,16 +280,16 @@ namespace MxIR
 					return unaryOperand->operand;
 				}
 			}
-			else if (ValueCommAssoc *unaryOperand = dynamic_cast<ValueCommAssoc *>(unary->operand.get()))
+			else if (ValueCommAssoc *unaryOperand = dynamic_cast<ValueCommAssoc *>(unary->operand))
 			{
 				if(unary->oper == ValueUnary::Neg && unaryOperand->oper == ValueCommAssoc::Add)
 				{
-					std::vector<std::shared_ptr<ValueNode>> varVal;
+					std::vector<ValueNode *> varVal;
 					for (auto &oldVal : unaryOperand->varValue)
 						varVal.emplace_back(reduceValue(new ValueUnary(ValueUnary::Neg, oldVal->length, oldVal)));
 					std::uint64_t immVal = -std::int64_t(unaryOperand->immValue.val);
 
-					return std::shared_ptr<ValueNode>(new ValueCommAssoc(
+					return intern(new ValueCommAssoc(
 						ValueCommAssoc::Add, 
 						unaryOperand->length, 
 						varVal, 
@@ -332,7 +297,7 @@ namespace MxIR
 				}
 				else if (unary->oper == ValueUnary::Neg && unaryOperand->oper == ValueCommAssoc::Mult)
 				{
-					return std::shared_ptr<ValueNode>(new ValueCommAssoc(
+					return intern(new ValueCommAssoc(
 						ValueCommAssoc::Mult, 
 						unaryOperand->length, 
 						unaryOperand->varValue, 
@@ -340,7 +305,7 @@ namespace MxIR
 				}
 				else if (unary->oper == ValueUnary::Not && (unaryOperand->oper == ValueCommAssoc::And || unaryOperand->oper == ValueCommAssoc::Or))
 				{
-					std::vector<std::shared_ptr<ValueNode>> varVal;
+					std::vector<ValueNode *> varVal;
 					for (auto &oldVal : unaryOperand->varValue)
 					{
 						varVal.emplace_back(reduceValue(new ValueUnary(
@@ -348,7 +313,7 @@ namespace MxIR
 					}
 					std::uint64_t immVal = ~unaryOperand->immValue.val;
 
-					return std::shared_ptr<ValueNode>(new ValueCommAssoc(
+					return intern(new ValueCommAssoc(
 						unaryOperand->oper == ValueCommAssoc::And ? ValueCommAssoc::Or : ValueCommAssoc::And,
 						unaryOperand->length,
 						varVal,
@@ -356,42 +321,42 @@ namespace MxIR
 				}
 				else if (unary->oper == ValueUnary::Not && unaryOperand->oper == ValueCommAssoc::Xor)
 				{
-					return std::shared_ptr<ValueNode>(new ValueCommAssoc(
+					return intern(new ValueCommAssoc(
 						ValueCommAssoc::Xor,
 						unaryOperand->length,
 						unaryOperand->varValue,
 						ValueImm(ImmSize(~unaryOperand->immValue.val, unaryOperand->immValue.length))));
 				}
 			}
-			else if (ValueImm *imm = dynamic_cast<ValueImm *>(unary->operand.get()))
+			else if (ValueImm *imm = dynamic_cast<ValueImm *>(unary->operand))
 			{
 				// Constant Fold
-				return std::shared_ptr<ValueNode>(new ValueImm(ImmSize(
+				return intern(new ValueImm(ImmSize(
 					ValueUnary::calculate(imm->val, imm->length, unary->oper, unary->length),
 					unary->length)
 				));
 			}
 		}
-		else if (ValuePhiIf *phi = dynamic_cast<ValuePhiIf *>(value.get()))
+		else if (ValuePhiIf *phi = dynamic_cast<ValuePhiIf *>(value))
 		{
-			if (phi->valueTrue->equal(*phi->valueFalse))
+			if (phi->valueTrue == phi->valueFalse)
 				return phi->valueTrue;
 
-			if (ValueUnary *unaryCond = dynamic_cast<ValueUnary *>(phi->cond.get()))
+			if (ValueUnary *unaryCond = dynamic_cast<ValueUnary *>(phi->cond))
 			{
 				if (unaryCond->oper == ValueUnary::NotBool)
 					return reduceValue(new ValuePhiIf(phi->length, unaryCond->operand, phi->valueFalse, phi->valueTrue));
 			}
 		}
-		else if (ValueBinary *binary = dynamic_cast<ValueBinary *>(value.get()))
+		else if (ValueBinary *binary = dynamic_cast<ValueBinary *>(value))
 		{
 			if (binary->oper == ValueBinary::Seq && binary->valueL->length == binary->length)
 			{
-				ValueImm *imm = dynamic_cast<ValueImm *>(binary->valueR.get());
+				ValueImm *imm = dynamic_cast<ValueImm *>(binary->valueR);
 				auto val = binary->valueL;
 				if (!(imm && val))
 				{
-					imm = dynamic_cast<ValueImm *>(binary->valueL.get());
+					imm = dynamic_cast<ValueImm *>(binary->valueL);
 					val = binary->valueR;
 				}
 				if (imm && val)
@@ -403,73 +368,43 @@ namespace MxIR
 			else
 			{
 				// Constant Fold
-				ValueImm *immL = dynamic_cast<ValueImm *>(binary->valueL.get());
-				ValueImm *immR = dynamic_cast<ValueImm *>(binary->valueR.get());
+				ValueImm *immL = dynamic_cast<ValueImm *>(binary->valueL);
+				ValueImm *immR = dynamic_cast<ValueImm *>(binary->valueR);
 				if (immL && immR)
 				{
-					return std::shared_ptr<ValueNode>(new ValueImm(ImmSize(
+					return intern(new ValueImm(ImmSize(
 						ValueBinary::calculate(immL->val, immL->length, binary->oper, immR->val, immR->length, binary->length),
 						binary->length)
 					));
 				}
 			}
 		}
-		return value;
-	}
-
-	void GVN::computeDomTree()
-	{
-		func.inBlock->traverse([this](Block *block) -> bool
-		{
-			blockIndex[block] = vBlocks.size();
-			vBlocks.push_back(block);
-			return true;
-		});
-		dtree = DomTree(vBlocks.size());
-		postdtree = DomTree(vBlocks.size());
-		for (Block *block : vBlocks)
-		{
-			if (block->brTrue)
-			{
-				dtree.link(blockIndex[block], blockIndex[block->brTrue.get()]);
-				postdtree.link(blockIndex[block->brTrue.get()], blockIndex[block]);
-			}
-			if (block->brFalse)
-			{
-				dtree.link(blockIndex[block], blockIndex[block->brFalse.get()]);
-				postdtree.link(blockIndex[block->brFalse.get()], blockIndex[block]);
-			}
-		}
-		dtree.buildTree(0);
-		postdtree.buildTree(blockIndex[func.outBlock.get()]);
-
-		depth.resize(vBlocks.size());
-		computeDomTreeDepth(0, 0);
+		return intern(holder.release());
 	}
 
 	void GVN::computeDomTreeDepth(size_t idx, size_t curdepth)
 	{
 		depth[idx] = curdepth;
-		for (size_t child : dtree.getDomChildren(idx))
+		for (size_t child : analysis.domTree().getDomChildren(idx))
 			computeDomTreeDepth(child, curdepth + 1);
 	}
 
-	std::shared_ptr<GVN::ValueNode> GVN::numberInstruction(Instruction insn)
+	GVN::ValueNode * GVN::numberInstruction(Instruction insn)
 	{
 		if (insn.getOutputReg().empty())
 			return nullptr;
 		assert(insn.getOutputReg().size() == 1);
 
 		bool ready = true;
-		for (Operand *operand : insn.getInputReg())
-			if (!opNumber.count(*operand))
+		for (Operand *operand : insn.inputRegs())
+			if (!isNumbered(*operand))
 			{
 				ready = false;
 				break;
 			}
 		assert(ready);
 		if (!ready || !isConstExpr(insn) || insn.oper == TestZero)	//TODO
-			return std::shared_ptr<ValueNode>(new ValueVar(insn.dst));
+			return intern(new ValueVar(insn.dst));
 
 		if (insn.oper == Move)
 			return getOperand(insn.src1);
@@ -500,11 +435,11 @@ namespace MxIR
 			std::uint64_t immVal = mapOperCA.find(insn.oper)->second.second;
 
 			auto oper1 = getOperand(insn.src1), oper2 = getOperand(insn.src2);
-			std::vector<std::shared_ptr<ValueNode>> varVal;
+			std::vector<ValueNode *> varVal;
 			
 			for (auto *operand : { &oper1, &oper2 })
 			{
-				ValueCommAssoc *childCA = dynamic_cast<ValueCommAssoc *>(operand->get());
+				ValueCommAssoc *childCA = dynamic_cast<ValueCommAssoc *>(*operand);
 				if (childCA && childCA->oper == oper)
 				{
 					if (insn.oper == Sub && operand == &oper2)
@@ -519,7 +454,7 @@ namespace MxIR
 						immVal = ValueCommAssoc::calculate(immVal, oper, childCA->immValue.val);
 					}
 				}
-				else if (ValueImm *child = dynamic_cast<ValueImm *>(operand->get()))
+				else if (ValueImm *child = dynamic_cast<ValueImm *>(*operand))
 				{
 					if (insn.oper == Sub && operand == &oper2)
 						immVal -= child->val;
@@ -529,16 +464,16 @@ namespace MxIR
 				else
 				{
 					if (insn.oper == Sub && operand == &oper2)
-						varVal.push_back(reduceValue(new ValueUnary(ValueUnary::Neg, operand->get()->length, *operand)));
+						varVal.push_back(reduceValue(new ValueUnary(ValueUnary::Neg, (*operand)->length, *operand)));
 					else
 						varVal.push_back(*operand);
 				}
 			}
 
 			if (varVal.empty())
-				return std::shared_ptr<ValueNode>(new ValueImm(ImmSize(immVal, insn.dst.size())));
+				return intern(new ValueImm(ImmSize(immVal, insn.dst.size())));
 
-			return std::shared_ptr<ValueNode>(new ValueCommAssoc(
+			return intern(new ValueCommAssoc(
 				oper, insn.dst.size(), varVal, ValueImm(ImmSize(immVal, insn.dst.size()))));
 		}
 
@@ -564,20 +499,20 @@ namespace MxIR
 			if (revflag)
 				std::swap(operL, operR);
 
-			std::shared_ptr<ValueNode> tmp(new ValueBinary(oper, insn.dst.size(), operL, operR));
+			ValueNode *tmp = new ValueBinary(oper, insn.dst.size(), operL, operR);
 
 			if (notflag)
-				return reduceValue(new ValueUnary(ValueUnary::NotBool, insn.dst.size(), tmp));
+				return reduceValue(new ValueUnary(ValueUnary::NotBool, insn.dst.size(), intern(tmp)));
 			else
 				return reduceValue(tmp);
 		}
 
 		if (insn.oper == Call)
 		{
-			std::vector<std::shared_ptr<ValueNode>> vParam;
+			std::vector<ValueNode *> vParam;
 			for (auto &op : insn.paramExt)
 				vParam.push_back(getOperand(op));
-			return std::shared_ptr<ValueNode>(new ValueFuncCall(insn.dst.size(), insn.src1.val, vParam));
+			return intern(new ValueFuncCall(insn.dst.size(), insn.src1.val, vParam));
 		}
 
 		assert(false);
@@ -588,23 +523,23 @@ namespace MxIR
 	{
 		if (parent == child)
 			return true;
-		for (size_t next : postdtree.getDomChildren(parent))
+		for (size_t next : analysis.postDomTree().getDomChildren(parent))
 			if (isPostDom(next, child))
 				return true;
 		return false;
 	}
 
-	std::shared_ptr<GVN::ValueNode> GVN::numberPhiInstruction(Block::PhiIns phiins, Block *block)
+	GVN::ValueNode * GVN::numberPhiInstruction(Block::PhiIns phiins, Block *block)
 	{
 		bool ready = true;
-		for (Operand *operand : phiins.getInputReg())
-			if (!opNumber.count(*operand))
+		for (Operand *operand : phiins.inputRegs())
+			if (!isNumbered(*operand))
 			{
 				ready = false;
 				break;
 			}
 		if(!ready)
-			return std::shared_ptr<ValueNode>(new ValueVar(phiins.dst));
+			return intern(new ValueVar(phiins.dst));
 
 		if (blacklist.count(block))
 		{
@@ -612,7 +547,7 @@ namespace MxIR
 			for (auto &src : phiins.srcs)
 				src2val[src.second.lock().get()] = src.first;
 
-			std::vector<std::shared_ptr<ValueNode>> srcs;
+			std::vector<ValueNode *> srcs;
 			for (Block *pred : block->preds)
 			{
 				assert(src2val.count(pred));
@@ -621,12 +556,12 @@ namespace MxIR
 				else
 					srcs.push_back(getOperand(src2val[pred]));
 			}
-			return std::shared_ptr<ValueNode>(new ValuePhi(phiins.dst.size(), blockIndex[block], srcs));
+			return intern(new ValuePhi(phiins.dst.size(), analysis.blockIndex(block), srcs));
 		}
 
 		struct TState
 		{
-			std::shared_ptr<ValueNode> curVal;
+			ValueNode *curVal;
 			Block *startBlock;
 			Block *curBlock;
 			Block *lastBlock;
@@ -637,7 +572,7 @@ namespace MxIR
 		{
 			TState tmp;
 			if (src.first.type == Operand::empty)
-				tmp.curVal.reset(new ValueImm(ImmSize(0, phiins.dst.size())));
+				tmp.curVal = intern(new ValueImm(ImmSize(0, phiins.dst.size())));
 			else
 				tmp.curVal = getOperand(src.first);
 
@@ -647,14 +582,14 @@ namespace MxIR
 			state.push_back(tmp);
 		}
 
-		state.sort([this](const TState &a, const TState &b) { return depth[blockIndex[a.curBlock]] > depth[blockIndex[b.curBlock]]; });
+		state.sort([this](const TState &a, const TState &b) { return depth[analysis.blockIndex(a.curBlock)] > depth[analysis.blockIndex(b.curBlock)]; });
 
 		while (state.size() > 1)
 		{
 			std::map<Block *, std::list<TState>::iterator> mapPosition;
 			for (auto iter = state.begin();
 				iter != state.end() 
-				&& (iter == state.begin() || depth[blockIndex[iter->curBlock]] == depth[blockIndex[std::prev(iter)->curBlock]]);
+				&& (iter == state.begin() || depth[analysis.blockIndex(iter->curBlock)] == depth[analysis.blockIndex(std::prev(iter)->curBlock)]);
 				++iter)
 			{
 				if (!mapPosition.count(iter->curBlock))
@@ -662,8 +597,8 @@ namespace MxIR
 				else
 				{
 					auto merged = mapPosition[iter->curBlock];
-					if(!isPostDom(blockIndex[iter->startBlock], blockIndex[iter->lastBlock])
-						|| !isPostDom(blockIndex[merged->startBlock], blockIndex[merged->lastBlock]))
+					if(!isPostDom(analysis.blockIndex(iter->startBlock), analysis.blockIndex(iter->lastBlock))
+						|| !isPostDom(analysis.blockIndex(merged->startBlock), analysis.blockIndex(merged->lastBlock)))
 					{
 						blacklist.insert(block);
 						return numberPhiInstruction(phiins, block);
@@ -704,10 +639,10 @@ namespace MxIR
 			for (auto iter = state.begin(); iter != state.end(); ++iter)
 			{
 				bool flag = false;
-				if (std::next(iter) != state.end() && depth[blockIndex[iter->curBlock]] != depth[blockIndex[std::next(iter)->curBlock]])
+				if (std::next(iter) != state.end() && depth[analysis.blockIndex(iter->curBlock)] != depth[analysis.blockIndex(std::next(iter)->curBlock)])
 					flag = true;
 				iter->lastBlock = iter->curBlock;
-				iter->curBlock = vBlocks[dtree.getIdom(blockIndex[iter->curBlock])];
+				iter->curBlock = analysis.blocks()[analysis.domTree().getIdom(analysis.blockIndex(iter->curBlock))];
 				if (flag)
 					break;
 			}
@@ -718,47 +653,38 @@ namespace MxIR
 
 	void GVN::computeVarGroup()
 	{
-		std::map<ValueHash, size_t> hash2group;
-		for (auto &kv : opNumber)
+		std::vector<size_t> value2group(values.size(), size_t(-1));
+		groupID.assign(index.size(), 0);
+		for (size_t var = 0; var < opNumber.size(); var++)
 		{
-			ValueHash &hash = kv.second->hash;
-			if (hash2group.count(hash))
-			{		
-				if (CompileFlags::getInstance()->gvn_strict_equal)
-				{
-					if (!opNumber[*varGroups[hash2group[hash]].begin()]->equal(*kv.second))
-					{
-						std::cerr << "WARNING: Found a collision of hash: ";
-						hash.printHash(std::cerr);
-						std::cerr << std::endl;
-					}
-				}
-				groupID[kv.first] = hash2group[hash];
-				varGroups[groupID[kv.first]].insert(kv.first);
+			if (!opNumber[var])
 				continue;
+			size_t &group = value2group[opNumber[var]->id];
+			if (group == size_t(-1))
+			{
+				group = varGroups.size();
+				varGroups.emplace_back();
 			}
-			else
-				hash2group[hash] = varGroups.size();
-
-			groupID[kv.first] = varGroups.size();
-			varGroups.emplace_back(std::set<Operand>{ kv.first });
+			groupID[var] = group;
+			varGroups[group].push_back(var);
 		}
 	}
 
-	void GVN::renameVar(size_t idx, std::map<size_t, Operand> &avaliableGroup)
+	void GVN::renameVar(size_t idx, std::vector<Operand> &avaliableGroup)
 	{
-		Block *block = vBlocks[idx];
-		std::set<size_t> definedInBlock;
+		Block *block = analysis.blocks()[idx];
+		std::vector<size_t> definedInBlock;
 
 		for (auto &ins : block->instructions())
 		{
-			for (Operand *operand : ins.getInputReg())
+			for (Operand *operand : ins.inputRegs())
 			{
-				if (!avaliableGroup.count(groupID[*operand]))
+				size_t group = groupID[index.id(*operand)];
+				if (avaliableGroup[group].type == Operand::empty)
 					continue;
 
-				Operand alter = avaliableGroup[groupID[*operand]];
-				if (ValueImm *imm = dynamic_cast<ValueImm *>(opNumber[alter].get()))
+				Operand alter = avaliableGroup[group];
+				if (ValueImm *imm = dynamic_cast<ValueImm *>(opNumber[index.id(alter)]))
 				{
 					*operand = ImmSize(imm->val, operand->size());
 				}
@@ -768,60 +694,68 @@ namespace MxIR
 					operand->ver = alter.ver;
 				}
 			}
-			for (Operand *operand : ins.getOutputReg())
+			for (Operand *operand : ins.outputRegs())
 			{
-				if (!avaliableGroup.count(groupID[*operand]))
+				size_t group = groupID[index.id(*operand)];
+				if (avaliableGroup[group].type == Operand::empty)
 				{
-					avaliableGroup[groupID[*operand]] = *operand;
-					definedInBlock.insert(groupID[*operand]);
+					avaliableGroup[group] = *operand;
+					definedInBlock.push_back(group);
 				}
 			}
 		}
 
-		for (size_t child : dtree.getDomChildren(idx))
+		for (size_t child : analysis.domTree().getDomChildren(idx))
 			renameVar(child, avaliableGroup);
 
 		for (size_t group : definedInBlock)
-			avaliableGroup.erase(group);
+			avaliableGroup[group] = Operand();
 	}
 
 	void GVN::renameVar()
 	{
-		std::map<size_t, Operand> avaliableGroup;
+		std::vector<Operand> avaliableGroup(std::max<size_t>(varGroups.size(), 1));
 		for (auto &param : func.params)
-			avaliableGroup[groupID[param]] = param;
+			avaliableGroup[groupID[index.id(param)]] = param;
 
 		renameVar(0, avaliableGroup);
 	}
 
 	void GVN::work()
 	{
-		computeDomTree();
+		depth.resize(analysis.blocks().size());
+		computeDomTreeDepth(0, 0);
+		index.build(func);
+		opNumber.assign(index.size(), nullptr);
 		for (auto &param : func.params)
 		{
-			opNumber[param] = std::shared_ptr<ValueNode>(new ValueVar(param));
+			opNumber[index.id(param)] = intern(new ValueVar(param));
 		}
 		func.inBlock->traverse_rev_postorder([this](Block *block) -> bool
 		{
 			for (auto &kv : block->phi)
-				opNumber[kv.second.dst] = numberPhiInstruction(kv.second, block);
+				opNumber[index.id(kv.second.dst)] = numberPhiInstruction(kv.second, block);
 			for (auto &ins : block->ins)
 			{
-				auto output = ins.getOutputReg();
-				if (!output.empty() && output[0]->isReg())
+				auto output = ins.outputRegs();
+				if (!output.empty())
 				{
-					opNumber[*output[0]] = numberInstruction(ins);
-					assert(opNumber[*output[0]]);
+					size_t id = index.id(**output.begin());
+					opNumber[id] = numberInstruction(ins);
+					assert(opNumber[id]);
 				}
 			}
 			return true;
 		});
 		computeVarGroup();
+		CompileStats::count("values_numbered", values.size());
 
-		/*for (auto &kv : opNumber)
+		/*for (size_t var = 0; var < opNumber.size(); var++)
 		{
-			std::cerr << kv.first.val << "_" << kv.first.ver << ": " << groupID[kv.first] << "  ";
-			kv.second->hash.printHash(std::cerr);
+			if (!opNumber[var])
+				continue;
+			std::cerr << var << ": " << groupID[var] << "  ";
+			opNumber[var]->hash.printHash(std::cerr);
 			std::cerr << std::endl;
 		}*/
 		renameVar();
@@ -4,14 +4,15 @@
 #include "common.h"
 #include "IR.h"
 #include "MxProgram.h"
-#include "utils/DomTree.h"
+#include "SSAValueIndex.h"
+#include "FunctionAnalysis.h"
 
 namespace MxIR
 {
 	class GVN
 	{
 	public:
-		GVN(Function &func) : func(func), program(MxProgram::getDefault()) {}
+		GVN(Function &func, FunctionAnalysis &analysis) : func(func), analysis(analysis), program(MxProgram::getDefault()) {}
 		void work();
 
 	protected:
@@ -19,47 +20,54 @@ namespace MxIR
 		{
 			Imm, Var, Const, OperCommAssoc, OperBinary, OperUnary, OperFuncCall, OperPhiIf, OperPhi
 		};
+		//64-bit hash mixed incrementally from the fields of a node and the ids of its children
 		class ValueHash
 		{
 		public:
+			ValueHash() : hash(0x9e3779b97f4a7c15ULL) {}
+
 			template<typename T>
 			void process(const T &value)
 			{
-				process_bytes(&value, sizeof(value));
+				static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "only integers can be hashed");
+				mix(std::uint64_t(value));
 			}
-			void process_bytes(const void *buffer, size_t length);
+			void mix(std::uint64_t value);
 			void cacluateHash();
 
-			bool operator<(const ValueHash &rhs) const;
-			bool operator==(const ValueHash &rhs) const;
-			bool operator!=(const ValueHash &rhs) const { return !(*this == rhs); }
+			bool operator<(const ValueHash &rhs) const { return hash < rhs.hash; }
+			bool operator==(const ValueHash &rhs) const { return hash == rhs.hash; }
+			bool operator!=(const ValueHash &rhs) const { return hash != rhs.hash; }
 
 			void printHash(std::ostream &out);
-			const std::uint32_t (&getHash() const)[5] { return hash; }
-			
+			std::uint64_t getHash() const { return hash; }
 
 		protected:
-			std::uint32_t hash[5];
-			std::vector<char> buffer;
+			std::uint64_t hash;
 		};
+		//Value nodes are hash-consed: every distinct value is created once and owned by the value table of the GVN,
+		//so two nodes are equal iff they are the same node, and children are compared by pointer.
 		struct ValueNode
 		{
+			static const size_t npos = size_t(-1);
+
 			const NodeType nodeType;
 			ValueHash hash;
 			size_t length;
+			size_t id = npos;	//index in the value table, assigned when the node is interned
 
 			ValueNode(NodeType nodeType) : nodeType(nodeType)
 			{
-				hash.process(char(nodeType));
+				hash.process(nodeType);
 			}
 			ValueNode(NodeType nodeType, size_t length) : nodeType(nodeType), length(length) 
 			{
-				hash.process(char(nodeType));
-				hash.process(char(length));
+				hash.process(nodeType);
+				hash.process(length);
 			}
 			virtual ~ValueNode() {}
 
-			bool operator<(const ValueNode &rhs) const { return hash < rhs.hash; }
+			//shallow comparison with a node that is not interned yet
 			virtual bool equal(ValueNode &rhs) = 0;
 
 		protected:
@@ -68,8 +76,7 @@ namespace MxIR
 			{
 				if (lhs.nodeType != rhs.nodeType || lhs.length != rhs.length || lhs.hash != rhs.hash)
 					return false;
-				T &node = dynamic_cast<T &>(rhs);
-				return equal_recursive(lhs, node, param...);
+				return equal_recursive(lhs, static_cast<T &>(rhs), param...);
 			}
 
 		private:
@@ -82,23 +89,6 @@ namespace MxIR
 					return false;
 				return equal_recursive(lhs, rhs, other...);
 			}
-			template<class T, class ...Tother>
-			static bool equal_recursive(T &lhs, T &rhs, std::shared_ptr<ValueNode> T::*param, Tother ...other)
-			{
-				if (!((lhs.*param).get()->equal(*(rhs.*param))))
-					return false;
-				return equal_recursive(lhs, rhs, other...);
-			}
-			template<class T, class ...Tother>
-			static bool equal_recursive(T &lhs, T &rhs, std::vector<std::shared_ptr<ValueNode>> T::*param, Tother ...other)
-			{
-				if ((lhs.*param).size() != (rhs.*param).size())
-					return false;
-				for (size_t i = 0; i < (lhs.*param).size(); i++)
-					if (!(lhs.*param)[i]->equal(*(rhs.*param)[i]))
-						return false;
-				return equal_recursive(lhs, rhs, other...);
-			}
 		};
 		struct ValueImm : public ValueNode
 		{
@@ -126,10 +116,10 @@ namespace MxIR
 		{
 			enum Operator { Add, Mult, And, Or, Xor };
 			Operator oper;
-			std::vector<std::shared_ptr<ValueNode>> varValue;
+			std::vector<ValueNode *> varValue;
 			ValueImm immValue;
 
-			ValueCommAssoc(Operator oper, size_t length, const std::vector<std::shared_ptr<ValueNode>> &varValue, ValueImm immValue);
+			ValueCommAssoc(Operator oper, size_t length, const std::vector<ValueNode *> &varValue, ValueImm immValue);
 			virtual bool equal(ValueNode &rhs) override;
 			static std::uint64_t calculate(std::uint64_t val1, Operator oper, std::uint64_t val2);
 		};
@@ -137,9 +127,9 @@ namespace MxIR
 		{
 			enum Operator { Div, Mod, Shl, Shr, Shlu, Shru, Seq, Slt, Sltu };
 			Operator oper;
-			std::shared_ptr<ValueNode> valueL, valueR;
+			ValueNode *valueL, *valueR;
 
-			ValueBinary(Operator oper, size_t length, std::shared_ptr<ValueNode> valueL, std::shared_ptr<ValueNode> valueR);
+			ValueBinary(Operator oper, size_t length, ValueNode *valueL, ValueNode *valueR);
 			virtual bool equal(ValueNode &rhs) override { return equal_impl(*this, rhs, &ValueBinary::oper, &ValueBinary::valueL, &ValueBinary::valueR); }
 
 			static std::uint64_t calculate(std::uint64_t val1, size_t length1, Operator oper, std::uint64_t val2, size_t length2, size_t lengthResult);
@@ -148,9 +138,9 @@ namespace MxIR
 		{
 			enum Operator { Not, Neg, Sext, Zext, NotBool };
 			Operator oper;
-			std::shared_ptr<ValueNode> operand;
+			ValueNode *operand;
 
-			ValueUnary(Operator oper, size_t length, std::shared_ptr<ValueNode> operand);
+			ValueUnary(Operator oper, size_t length, ValueNode *operand);
 			virtual bool equal(ValueNode &rhs) override { return equal_impl(*this, rhs, &ValueUnary::oper, &ValueUnary::operand); }
 
 			static std::uint64_t calculate(std::uint64_t val, size_t length, Operator oper, size_t lengthResult);
@@ -158,58 +148,65 @@ namespace MxIR
 		struct ValueFuncCall : public ValueNode
 		{
 			size_t funcID;
-			std::vector<std::shared_ptr<ValueNode>> params;
+			std::vector<ValueNode *> params;
 
-			ValueFuncCall(size_t length, size_t funcID, const std::vector<std::shared_ptr<ValueNode>> &params);
-			virtual bool equal(ValueNode &rhs) override;
+			ValueFuncCall(size_t length, size_t funcID, const std::vector<ValueNode *> &params);
+			virtual bool equal(ValueNode &rhs) override { return equal_impl(*this, rhs, &ValueFuncCall::funcID, &ValueFuncCall::params); }
 		};
 		struct ValuePhiIf : public ValueNode
 		{
-			std::shared_ptr<ValueNode> cond;
-			std::shared_ptr<ValueNode> valueTrue, valueFalse;
-			ValuePhiIf(size_t length, std::shared_ptr<ValueNode> cond, std::shared_ptr<ValueNode> valueTrue, std::shared_ptr<ValueNode> valueFalse);
+			ValueNode *cond;
+			ValueNode *valueTrue, *valueFalse;
+			ValuePhiIf(size_t length, ValueNode *cond, ValueNode *valueTrue, ValueNode *valueFalse);
 			virtual bool equal(ValueNode &rhs) override { return equal_impl(*this, rhs, &ValuePhiIf::cond, &ValuePhiIf::valueTrue, &ValuePhiIf::valueFalse); }
 		};
 		struct ValuePhi : public ValueNode
 		{
 			size_t blockID;
-			std::vector<std::shared_ptr<ValueNode>> srcs;
-			ValuePhi(size_t length, size_t blockID, const std::vector<std::shared_ptr<ValueNode>> &srcs);
+			std::vector<ValueNode *> srcs;
+			ValuePhi(size_t length, size_t blockID, const std::vector<ValueNode *> &srcs);
 			virtual bool equal(ValueNode &rhs) override { return equal_impl(*this, rhs, &ValuePhi::blockID, &ValuePhi::srcs); }
 		};
 
 	protected:
 		bool isConstExpr(const Instruction &insn);
-		std::shared_ptr<ValueNode> getOperand(Operand operand);
+		ValueNode * getOperand(Operand operand);
 
-		static std::shared_ptr<ValueNode> reduceValue(std::shared_ptr<ValueNode> value);
-		static std::shared_ptr<ValueNode> reduceValue(ValueNode *value) { return reduceValue(std::shared_ptr<ValueNode>(value)); }
+		//take the ownership of a new node and return the unique node equal to it
+		ValueNode * intern(ValueNode *value);
+		//simplify a new node, the result is interned
+		ValueNode * reduceValue(ValueNode *value);
 
-		void computeDomTree();
 		void computeDomTreeDepth(size_t idx, size_t curdepth);
 		bool isPostDom(size_t parent, size_t child);
-		std::shared_ptr<ValueNode> numberInstruction(Instruction insn);
-		std::shared_ptr<ValueNode> numberPhiInstruction(Block::PhiIns phiins, Block *block);
+		ValueNode * numberInstruction(Instruction insn);
+		ValueNode * numberPhiInstruction(Block::PhiIns phiins, Block *block);
 		void computeVarGroup();
 
-		void renameVar(size_t idx, std::map<size_t, Operand> &avaliableGroup);
+		bool isNumbered(const Operand &operand) const
+		{
+			size_t id = index.id(operand);
+			return id != SSAValueIndex::npos && opNumber[id];
+		}
+		void renameVar(size_t idx, std::vector<Operand> &avaliableGroup);
 		void renameVar();
 
 	protected:
 		Function &func;
+		FunctionAnalysis &analysis;
 		MxProgram *program;
 
-		DomTree dtree, postdtree;
 		std::vector<size_t> depth;
 		
 		std::set<Block *> blacklist;
-		std::map<Block *, size_t> blockIndex;
-		std::vector<Block *> vBlocks;
 
-		std::map<Operand, std::shared_ptr<ValueNode>> opNumber;
+		SSAValueIndex index;
+		std::vector<std::unique_ptr<ValueNode>> values;		//the value table, indexed by ValueNode::id
+		std::unordered_multimap<std::uint64_t, size_t> valueIndex;	//hash -> ids of the values with that hash
+		std::vector<ValueNode *> opNumber;	//indexed by SSA value id
 
-		std::vector<std::set<Operand>> varGroups;
-		std::map<Operand, size_t> groupID;
+		std::vector<std::vector<size_t>> varGroups;
+		std::vector<size_t> groupID;
 	};
 }
 
@@ -14,6 +14,7 @@ struct GlobalSymbol
 
 	GlobalSymbol() : sumStringSize(0), memoryUsage(0) {}
 
+	//symbols are only added by the front end; the IR passes just read them
 	void setDefault() { defGS = this; }
 	static GlobalSymbol * getDefault() { return defGS; }
 
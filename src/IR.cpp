@@ -1,10 +1,135 @@
 #include "common_headers.h"
 #include "IR.h"
+#include "CompileStats.h"
 #include "utils/CycleEquiv.h"
-#include "LoopDetector.h"
+#include "utils/PointerMap.h"
 
 namespace MxIR
 {
+	thread_local IRArena *IRArena::curArena = nullptr;
+	const size_t IRArena::minChunkSize, IRArena::maxChunkSize;
+
+	IRArena::~IRArena()
+	{
+		//blocks kept alive only by cycles (loops) are torn down here, 
+		//together with those of the adopted arenas since edges may cross between them
+		std::vector<std::shared_ptr<Block>> blocks;
+		collectBlocks(blocks);
+		for (auto &block : blocks)
+		{
+			block->brTrue.detach();
+			block->brFalse.detach();
+		}
+		for (auto &block : blocks)
+		{
+			block->preds.clear();
+			block->phi.clear();
+			block->sigma.clear();
+		}
+		blocks.clear();
+		if (liveBlocks)
+		{
+			//still referenced from outside; keep the memory rather than leave dangling pointers
+			for (auto &chunk : chunks)
+				chunk.release();
+		}
+	}
+
+	void IRArena::adopt(std::shared_ptr<IRArena> other)
+	{
+		if (other.get() != this)
+			adopted.push_back(std::move(other));
+	}
+
+	void * IRArena::allocate(size_t size)
+	{
+		if (size_t(end - cur) < size)
+		{
+			while (chunkSize < size)
+				chunkSize *= 2;
+			chunks.emplace_back(new char[chunkSize]);
+			cur = chunks.back().get();
+			end = cur + chunkSize;
+			nBytes += chunkSize;
+			chunkSize = std::min(chunkSize * 2, maxChunkSize);
+		}
+		void *ret = cur;
+		cur += size;
+		return ret;
+	}
+
+	void * IRArena::allocateNode(size_t size)
+	{
+		size = alignAddr(size, sizeof(NodeHeader));
+		IRArena *arena = curArena;
+		NodeHeader *node;
+		size_t idx = size / sizeof(NodeHeader);
+		if (!arena)
+			node = static_cast<NodeHeader *>(::operator new(sizeof(NodeHeader) + size));
+		else if (idx < arena->freeNodes.size() && arena->freeNodes[idx])
+		{
+			FreeNode *free = arena->freeNodes[idx];
+			arena->freeNodes[idx] = free->next;
+			node = reinterpret_cast<NodeHeader *>(free) - 1;
+		}
+		else
+			node = static_cast<NodeHeader *>(arena->allocate(sizeof(NodeHeader) + size));
+		node->owner = arena;
+		node->size = size;
+		return node + 1;
+	}
+
+	void IRArena::deallocateNode(void *ptr)
+	{
+		NodeHeader *node = static_cast<NodeHeader *>(ptr) - 1;
+		IRArena *arena = node->owner;
+		if (!arena)
+		{
+			::operator delete(node);
+			return;
+		}
+		size_t idx = node->size / sizeof(NodeHeader);
+		if (idx < arena->freeNodes.size())
+		{
+			FreeNode *free = static_cast<FreeNode *>(ptr);
+			free->next = arena->freeNodes[idx];
+			arena->freeNodes[idx] = free;
+		}
+	}
+
+	void IRArena::linkBlock(Block *block)
+	{
+		block->arena = this;
+		block->arenaPrev = nullptr;
+		block->arenaNext = liveBlocks;
+		if (liveBlocks)
+			liveBlocks->arenaPrev = block;
+		liveBlocks = block;
+	}
+
+	void IRArena::unlinkBlock(Block *block)
+	{
+		if (block->arenaPrev)
+			block->arenaPrev->arenaNext = block->arenaNext;
+		else
+			liveBlocks = block->arenaNext;
+		if (block->arenaNext)
+			block->arenaNext->arenaPrev = block->arenaPrev;
+		block->arena = nullptr;
+	}
+
+	void IRArena::collectBlocks(std::vector<std::shared_ptr<Block>> &blocks)
+	{
+		for (Block *block = liveBlocks; block; block = block->arenaNext)
+		{
+			std::shared_ptr<Block> ptr = block->self.lock();
+			if (ptr)
+				blocks.push_back(std::move(ptr));
+		}
+		for (auto &arena : adopted)
+			arena->collectBlocks(blocks);
+	}
+
 	Block::block_ptr::~block_ptr()
 	{
 		if (ptr)
@@ -45,13 +170,22 @@ namespace MxIR
 
 	std::shared_ptr<Block> Block::construct()
 	{
-		std::shared_ptr<Block> ptr(new Block);
+		Block *block = new (IRArena::allocateNode(sizeof(Block))) Block;
+		if (IRArena::current())
+			IRArena::current()->linkBlock(block);
+		std::shared_ptr<Block> ptr(block, [](Block *block)
+		{
+			if (block->arena)
+				block->arena->unlinkBlock(block);
+			block->~Block();
+			IRArena::deallocateNode(block);
+		}, IRAllocator<Block>());
 		ptr->self = ptr;
 		return ptr;
 	}
 	void Block::traverse(std::function<bool(Block *)> func)
 	{
-		std::set<Block *> visited;
+		PointerMap<Block> visited;
 		std::queue<Block *> q;
 		q.push(this);
 		visited.insert(this);
@@ -61,31 +195,25 @@ namespace MxIR
 			q.pop();
 			if (!func(cur))
 				return;
-			if (cur->brTrue && visited.find(cur->brTrue.get()) == visited.end())
-			{
-				visited.insert(cur->brTrue.get());
+			if (cur->brTrue && visited.insert(cur->brTrue.get()))
 				q.push(cur->brTrue.get());
-			}
-			if (cur->brFalse && visited.find(cur->brFalse.get()) == visited.end())
-			{
-				visited.insert(cur->brFalse.get());
+			if (cur->brFalse && visited.insert(cur->brFalse.get()))
 				q.push(cur->brFalse.get());
-			}
 		}
 	}
 	void Block::traverse_preorder(std::function<bool(Block *)> func)
 	{
-		std::set<Block *> visited;
+		PointerMap<Block> visited;
 		std::function<bool(Block *)> dfs;
 		dfs = [&func, &dfs, &visited](Block *block) -> bool
 		{
 			visited.insert(block);
 			if (!func(block))
 				return false;
-			if (block->brTrue && !visited.count(block->brTrue.get()))
+			if (block->brTrue && !visited.find(block->brTrue.get()))
 				if (!dfs(block->brTrue.get()))
 					return false;
-			if (block->brFalse && !visited.count(block->brFalse.get()))
+			if (block->brFalse && !visited.find(block->brFalse.get()))
 				if (!dfs(block->brFalse.get()))
 					return false;
 			return true;
@@ -94,15 +222,15 @@ namespace MxIR
 	}
 	void Block::traverse_postorder(std::function<bool(Block *)> func)
 	{
-		std::set<Block *> visited;
+		PointerMap<Block> visited;
 		std::function<bool(Block *)> dfs;
 		dfs = [&func, &dfs, &visited](Block *block) -> bool
 		{
 			visited.insert(block);
-			if (block->brTrue && !visited.count(block->brTrue.get()))
+			if (block->brTrue && !visited.find(block->brTrue.get()))
 				if (!dfs(block->brTrue.get()))
 					return false;
-			if (block->brFalse && !visited.count(block->brFalse.get()))
+			if (block->brFalse && !visited.find(block->brFalse.get()))
 				if (!dfs(block->brFalse.get()))
 					return false;
 			if (!func(block))
@@ -150,8 +278,32 @@ namespace MxIR
 		return phisrc.empty();
 	}
 
+	Function & Function::operator=(const Function &other)
+	{
+		std::shared_ptr<IRArena> oldArena = std::move(arena);	//the old blocks are released before their arena
+		params = other.params;
+		inBlock = other.inBlock;
+		outBlock = other.outBlock;
+		pstRoot = other.pstRoot;
+		arena = other.arena;
+		return *this;
+	}
+
+	Function & Function::operator=(Function &&other)
+	{
+		std::shared_ptr<IRArena> oldArena = std::move(arena);
+		params = std::move(other.params);
+		inBlock = std::move(other.inBlock);
+		outBlock = std::move(other.outBlock);
+		pstRoot = std::move(other.pstRoot);
+		arena = std::move(other.arena);
+		return *this;
+	}
+
 	Function Function::clone()
 	{
+		Function ret;
+		IRArena::Scope scope(ret.arena);
 		std::map<Block *, std::shared_ptr<Block>> mapNewBlock;	// old block -> new block
 		inBlock->traverse([&mapNewBlock](Block *block) -> bool
 		{
@@ -168,15 +320,23 @@ namespace MxIR
 				mapNewBlock[block]->brTrue = mapNewBlock[block->brTrue.get()];
 			if (block->brFalse)
 				mapNewBlock[block]->brFalse = mapNewBlock[block->brFalse.get()];
+			for (auto &kv : mapNewBlock[block]->phi)
+				for (auto &src : kv.second.srcs)
+					src.second = mapNewBlock[src.second.lock().get()];
 			return true;
 		});
-		Function ret;
 		ret.params = params;
 		ret.inBlock = mapNewBlock[inBlock.get()];
 		ret.outBlock = mapNewBlock[outBlock.get()];
 		return ret;
 	}
 
+	bool Function::isEmpty() const
+	{
+		return inBlock && inBlock->ins.size() == 1 && inBlock->ins.front().oper == Return
+			&& !inBlock->brFalse && inBlock->brTrue.get() == outBlock.get();
+	}
+
 	void PSTNode::traverse(std::function<void(PSTNode *)> func)
 	{
 		std::function<void(PSTNode *)> dfs;
@@ -202,33 +362,60 @@ namespace MxIR
 
 	void Function::constructPST()
 	{
-		std::map<Block *, size_t> blockID;
+		CompileStats::Scope stats("Function::constructPST");
+		PointerMap<Block> blockID;
 		std::vector<Block *> vBlocks;
 		std::vector<std::pair<Block *, Block *>> vEdges;
-		inBlock->traverse_preorder([&](Block *block) -> bool
+		std::vector<std::pair<size_t, size_t>> vEdgeID;
+		std::vector<std::array<size_t, 2>> treeChild;	//block id -> ids of the blocks first reached through brTrue and brFalse, npos if none
+		const size_t npos = size_t(-1);
+		std::function<size_t(Block *)> number;
+		number = [&](Block *block) -> size_t
 		{
+			size_t id = vBlocks.size();
 			block->pstNode.reset();
-			blockID[block] = vBlocks.size();
+			blockID.insert(block, id);
 			vBlocks.push_back(block);
+			treeChild.push_back({ { npos, npos } });
+			size_t edge = vEdges.size();
 			if (block->brTrue)
 				vEdges.push_back(std::make_pair(block, block->brTrue.get()));
 			if (block->brFalse)
 				vEdges.push_back(std::make_pair(block, block->brFalse.get()));	//note that the ids of edges are in dfs order
-			return true;
-		});
+			vEdgeID.resize(vEdges.size());
+			for (int k = 0; k < 2; k++)
+			{
+				Block *next = (k == 0 ? block->brTrue : block->brFalse).get();
+				if (!next)
+					continue;
+				const size_t *known = blockID.find(next);
+				size_t nextID;
+				if (!known)
+				{
+					nextID = number(next);
+					treeChild[id][k] = nextID;
+				}
+				else
+					nextID = *known;
+				vEdgeID[edge++] = std::make_pair(id, nextID);
+			}
+			return id;
+		};
+		number(inBlock.get());
 
 		vEdges.push_back(std::make_pair(outBlock.get(), inBlock.get()));
+		vEdgeID.push_back(std::make_pair(*blockID.find(outBlock.get()), size_t(0)));
 		CycleEquiv solver(vBlocks.size());
-		for (auto &e : vEdges)
-			solver.addEdge(blockID[e.first], blockID[e.second]);
+		for (auto &e : vEdgeID)
+			solver.addEdge(e.first, e.second);
 
-		std::vector<std::set<size_t>> result = solver.work();
+		std::vector<std::vector<size_t>> result = solver.work();
 		std::vector<std::shared_ptr<PSTNode>> nodes;
-		std::map<PSTNode *, Block *> outBlockNext;
+		std::unordered_map<PSTNode *, Block *> outBlockNext;
 		for (auto &equClass : result)
 		{
 			std::vector<size_t> tmp;
-			if (*std::prev(equClass.end()) == vEdges.size() - 1)
+			if (equClass.back() == vEdges.size() - 1)
 				tmp.push_back(vEdges.size() - 1);
 			for (size_t e : equClass)
 				tmp.push_back(e);
@@ -251,12 +438,12 @@ namespace MxIR
 		std::shared_ptr<PSTNode> root(new PSTNode);
 
 		std::stack<std::shared_ptr<PSTNode>> stkPST;
-		std::set<Block *> visited;
-		std::function<void(Block *)> dfs;
+		std::function<void(size_t)> dfs;
 		stkPST.push(root);
-		dfs = [&outBlockNext, &stkPST, &visited, &dfs](Block *block)
+		//walks the same dfs tree as number()
+		dfs = [&outBlockNext, &stkPST, &vBlocks, &treeChild, &dfs, npos](size_t id)
 		{
-			visited.insert(block);
+			Block *block = vBlocks[id];
 			int flag = block->pstNode.expired() ? 0 :
 				stkPST.top() == block->pstNode.lock() ? -1 : 1;
 
@@ -275,25 +462,16 @@ namespace MxIR
 			}
 
 			std::shared_ptr<PSTNode> oldTop;
-			if (block->brTrue && !visited.count(block->brTrue.get()))
+			for (size_t next : treeChild[id])
 			{
-				if (block->brTrue.get() == outBlockNext[stkPST.top().get()])
-				{
-					oldTop = stkPST.top();
-					stkPST.pop();
-				}
-				dfs(block->brTrue.get());
-				if (oldTop)
-					stkPST.emplace(std::move(oldTop));
-			}
-			if (block->brFalse && !visited.count(block->brFalse.get()))
-			{
-				if (block->brFalse.get() == outBlockNext[stkPST.top().get()])
+				if (next == npos)
+					continue;
+				if (vBlocks[next] == outBlockNext[stkPST.top().get()])
 				{
 					oldTop = stkPST.top();
 					stkPST.pop();
 				}
-				dfs(block->brFalse.get());
+				dfs(next);
 				if (oldTop)
 					stkPST.emplace(std::move(oldTop));
 			}
@@ -301,28 +479,60 @@ namespace MxIR
 			if (flag == 1)
 				stkPST.pop();
 		};
-
-		dfs(inBlock.get());
+		dfs(0);
 		pstRoot = root;
 	}
 
-	void Function::splitProgramRegion()
+	bool Function::splitProgramRegion(std::map<Block *, std::set<Block *>> &loops)
 	{
-		std::map<size_t, size_t> maxVer;
+		bool changed = false;
+		IRArena::Scope scope(arena);
 		std::vector<Block *> vBlocks;
-		inBlock->traverse([&maxVer, &vBlocks, this](Block *block) -> bool
+		inBlock->traverse([&vBlocks, this](Block *block) -> bool
 		{
 			if(block != outBlock.get())
 				vBlocks.push_back(block);
-			for (auto &ins : block->instructions())
-				for (Operand *operand : join<Operand *>(ins.getInputReg(), ins.getOutputReg()))
-					maxVer[operand->val] = std::max(maxVer[operand->val], operand->ver);
 			return true;
 		});
 
-		LoopDetector detector(*this);
-		detector.findLoops();
-		auto &loops = detector.getLoops();
+		//only a phi split in two needs a new version, so the versions are scanned on first use
+		std::vector<size_t> maxVer;		//register id -> max version
+		bool scanned = false;
+		auto newVersion = [&maxVer, &scanned, this](size_t reg) -> size_t
+		{
+			if (!scanned)
+			{
+				inBlock->traverse([&maxVer](Block *block) -> bool
+				{
+					for (auto &ins : block->instructions())
+						for (Operand *operand : join<Operand *>(ins.inputRegs(), ins.outputRegs()))
+						{
+							if (operand->val == Operand::InvalidID)
+								continue;
+							if (operand->val >= maxVer.size())
+								maxVer.resize(operand->val + 1, 0);
+							maxVer[operand->val] = std::max<size_t>(maxVer[operand->val], operand->ver);
+						}
+					return true;
+				});
+				scanned = true;
+			}
+			return ++maxVer[reg];
+		};
+
+		//a block inserted in front of block lies in the loops around block, but not in the one block heads
+		std::unordered_map<Block *, std::vector<std::set<Block *> *>> outerLoops;
+		for (auto &kv : loops)
+			for (Block *block : kv.second)
+				if (block != kv.first)
+					outerLoops[block].push_back(&kv.second);
+		auto addToLoops = [&outerLoops](Block *block, Block *newBlock)
+		{
+			auto iter = outerLoops.find(block);
+			if (iter != outerLoops.end())
+				for (std::set<Block *> *body : iter->second)
+					body->insert(newBlock);
+		};
 
 		for (Block *block : vBlocks)
 		{
@@ -337,6 +547,8 @@ namespace MxIR
 				if (entryPred.size() > 1)
 				{
 					std::shared_ptr<Block> blockPreheader = Block::construct();
+					changed = true;
+					addToLoops(block, blockPreheader.get());
 					blockPreheader->ins = { IRJump() };
 					blockPreheader->brTrue = block->self.lock();
 					for (Block *pred : entryPred)
@@ -384,7 +596,7 @@ namespace MxIR
 						else
 						{
 							upperPhi.dst = iter->second.dst;
-							upperPhi.dst.ver = ++maxVer[upperPhi.dst.val];
+							upperPhi.dst.ver = newVersion(upperPhi.dst.val);
 							blockPreheader->phi[upperPhi.dst.val] = upperPhi;
 							remainPhi.dst = iter->second.dst;
 							remainPhi.srcs.push_back({ upperPhi.dst, blockPreheader });
@@ -398,6 +610,8 @@ namespace MxIR
 					Block *pred = entryPred.front();
 
 					std::shared_ptr<Block> blockPreheader = Block::construct();
+					changed = true;
+					addToLoops(block, blockPreheader.get());
 					blockPreheader->ins = { IRJump() };
 					blockPreheader->brTrue = block->self.lock();
 
@@ -414,6 +628,8 @@ namespace MxIR
 			{
 				auto preds = block->preds;
 				std::shared_ptr<Block> tmp = Block::construct();
+				changed = true;
+				addToLoops(block, tmp.get());
 				tmp->phi = std::move(block->phi);
 				tmp->brTrue = block->self.lock();
 				tmp->ins = { IRJump() };
@@ -440,6 +656,8 @@ namespace MxIR
 				{
 					auto preds = block->preds;
 					std::shared_ptr<Block> tmp = Block::construct();
+					changed = true;
+					addToLoops(block, tmp.get());
 					tmp->ins.splice(tmp->ins.end(), block->ins, block->ins.begin(), spliceEnd);
 					tmp->ins.push_back(IRJump());
 					tmp->brTrue = block->self.lock();
@@ -455,6 +673,7 @@ namespace MxIR
 				}
 			}
 		}
+		return changed;
 	}
 
 	void Block::redirectPhiSrc(Block *from, Block *to)
@@ -53,21 +53,22 @@ namespace MxIR
 			imm64, imm32, imm16, imm8,
 			funcID, constID, globalVarID, externalSymbolName
 		};
-		OperandType type;
+		//packed into 16 bytes: operands are copied and compared in every pass
 		std::uint64_t val;
-		std::size_t ver;		//in ssa form, ver >= 1
-		int pregid;				//physical register id
+		std::uint32_t ver;		//in ssa form, ver >= 1
+		std::int8_t pregid;		//physical register id
+		OperandType type;
 		bool noreg;
 
 		static const std::uint64_t InvalidID = std::uint64_t(-1);
 
-		Operand() : type(empty), pregid(-1), ver(0), noreg(false) {}
-		Operand(OperandType type, std::uint64_t val) : type(type), val(val), pregid(-1), ver(0), noreg(false) {}
+		Operand() : val(0), ver(0), pregid(-1), type(empty), noreg(false) {}
+		Operand(OperandType type, std::uint64_t val) : val(val), ver(0), pregid(-1), type(type), noreg(false) {}
 
 		Operand clone() const { return Operand(*this); }
-		Operand & setVer(size_t newVer) { ver = newVer; return *this; }
+		Operand & setVer(size_t newVer) { assert(newVer <= UINT32_MAX); ver = std::uint32_t(newVer); return *this; }
 		Operand & setVal(std::uint64_t newVal) { val = newVal; return *this; }
-		Operand & setPRegID(int newRegID) { pregid = newRegID; return *this; }
+		Operand & setPRegID(int newRegID) { assert(newRegID >= -1 && newRegID <= INT8_MAX); pregid = std::int8_t(newRegID); return *this; }
 		Operand & setNOReg(bool newFlag) { noreg = newFlag; return *this; }
 		Operand & setSize(size_t size)
 		{
@@ -125,6 +126,7 @@ namespace MxIR
 			return type < rhs.type;
 		}
 	};
+	static_assert(sizeof(Operand) == 16, "Operand is expected to fit in 16 bytes");
 	//NOTE: when writing one part of the 64-bit register, the value in the other part of the register is UNDEFINED
 	inline Operand Reg64(std::uint64_t regid) { return Operand{ Operand::reg64, regid }; }
 	inline Operand Reg32(std::uint64_t regid) { return Operand{ Operand::reg32, regid }; }
@@ -181,12 +183,83 @@ namespace MxIR
 
 	struct InstructionBase
 	{
-		enum registerHint { NoPrefer, PreferAnyOfOperands, PreferOperands, PreferCorrespondingOperand };
+		enum registerHint : std::uint8_t { NoPrefer, PreferAnyOfOperands, PreferOperands, PreferCorrespondingOperand };
+		enum instructionKind : std::uint8_t { KindNormal, KindPhi, KindSigma };
 		registerHint hint;
+		const instructionKind kind;
+
+		//Register operands of an instruction, visited in place: no allocation and no virtual call.
+		//Slots are numbered in the same order as getInputReg / getOutputReg return them.
+		class RegRange
+		{
+		public:
+			typedef bool (*filter_t)(const Operand &);
+
+			class iterator
+			{
+			public:
+				typedef std::input_iterator_tag iterator_category;
+				typedef Operand * value_type;
+				typedef std::ptrdiff_t difference_type;
+				typedef Operand ** pointer;
+				typedef Operand *& reference;
+
+				iterator() : ins(nullptr), pos(0), end(0), output(false), filter(nullptr), cur(nullptr) {}
+				iterator(InstructionBase *ins, size_t pos, size_t end, bool output, filter_t filter) : 
+					ins(ins), pos(pos), end(end), output(output), filter(filter), cur(nullptr) { seek(); }
+
+				Operand *& operator*() { return cur; }
+				iterator & operator++() { pos++; seek(); return *this; }
+				bool operator==(const iterator &rhs) const { return pos == rhs.pos; }
+				bool operator!=(const iterator &rhs) const { return pos != rhs.pos; }
+
+			protected:
+				void seek()
+				{
+					for (; pos < end; pos++)
+					{
+						cur = ins->regSlot(output, pos);
+						if (cur && (!filter || filter(*cur)))
+							return;
+					}
+					cur = nullptr;
+				}
+
+			protected:
+				InstructionBase *ins;
+				size_t pos, end;
+				bool output;
+				filter_t filter;
+				Operand *cur;
+			};
+
+			RegRange(InstructionBase *ins, bool output, filter_t filter = nullptr) : 
+				ins(ins), nSlot(ins->regSlotCount(output)), output(output), filter(filter) {}
 
-		InstructionBase() : hint(NoPrefer) {}
-		virtual std::vector<Operand *> getInputReg() = 0;
-		virtual std::vector<Operand *> getOutputReg() = 0;
+			iterator begin() const { return iterator(ins, 0, nSlot, output, filter); }
+			iterator end() const { return iterator(ins, nSlot, nSlot, output, filter); }
+			bool empty() const { return begin() == end(); }
+			RegRange filtered(filter_t newFilter) const { assert(!filter); return RegRange(ins, output, newFilter); }
+
+		protected:
+			InstructionBase *ins;
+			size_t nSlot;
+			bool output;
+			filter_t filter;
+		};
+
+		InstructionBase(instructionKind kind) : hint(NoPrefer), kind(kind) {}
+		InstructionBase(const InstructionBase &other) = default;
+		InstructionBase & operator=(const InstructionBase &other) { hint = other.hint; assert(kind == other.kind); return *this; }
+
+		RegRange inputRegs() { return RegRange(this, false); }
+		RegRange outputRegs() { return RegRange(this, true); }
+		std::vector<Operand *> getInputReg() { RegRange range = inputRegs(); return std::vector<Operand *>(range.begin(), range.end()); }
+		std::vector<Operand *> getOutputReg() { RegRange range = outputRegs(); return std::vector<Operand *>(range.begin(), range.end()); }
+
+		//operand in slot pos, or nullptr if that slot holds no register
+		inline Operand * regSlot(bool output, size_t pos);
+		inline size_t regSlotCount(bool output) const;
 	};
 
 	struct Instruction : public InstructionBase
@@ -195,11 +268,11 @@ namespace MxIR
 		Operand dst, src1, src2;
 		std::vector<Operand> paramExt;
 
-		Instruction() { autoPrefer(); }
-		Instruction(Operation oper) : oper(oper) { autoPrefer(); }
-		Instruction(Operation oper, Operand dst, Operand src1) : oper(oper), dst(dst), src1(src1) { autoPrefer(); }
-		Instruction(Operation oper, Operand dst, Operand src1, Operand src2) : oper(oper), dst(dst), src1(src1), src2(src2) { autoPrefer(); }
-		Instruction(Operation oper, Operand dst, Operand src1, Operand src2, const std::vector<Operand> &paramExt) : oper(oper), dst(dst), src1(src1), src2(src2), paramExt(paramExt) { autoPrefer(); }
+		Instruction() : InstructionBase(KindNormal) { autoPrefer(); }
+		Instruction(Operation oper) : InstructionBase(KindNormal), oper(oper) { autoPrefer(); }
+		Instruction(Operation oper, Operand dst, Operand src1) : InstructionBase(KindNormal), oper(oper), dst(dst), src1(src1) { autoPrefer(); }
+		Instruction(Operation oper, Operand dst, Operand src1, Operand src2) : InstructionBase(KindNormal), oper(oper), dst(dst), src1(src1), src2(src2) { autoPrefer(); }
+		Instruction(Operation oper, Operand dst, Operand src1, Operand src2, const std::vector<Operand> &paramExt) : InstructionBase(KindNormal), oper(oper), dst(dst), src1(src1), src2(src2), paramExt(paramExt) { autoPrefer(); }
 
 		void autoPrefer()
 		{
@@ -209,46 +282,43 @@ namespace MxIR
 				hint = PreferCorrespondingOperand;
 		}
 
-		virtual std::vector<Operand *> getInputReg() override final
+		Operand * regSlot(bool output, size_t pos)
 		{
-			std::vector<Operand *> ret;
 			if (oper == ParallelMove)
 			{
-				assert(paramExt.size() % 2 == 0);
-				for (size_t i = paramExt.size() / 2; i < paramExt.size(); i++)
-				{
-					assert(paramExt[i].isReg());
-					ret.push_back(&paramExt[i]);
-				}
-				return ret;
+				Operand *operand = &paramExt[output ? pos : paramExt.size() / 2 + pos];
+				assert(operand->isReg());
+				return operand;
 			}
-			if ((oper == Store || oper == StoreA) && dst.isReg())
-				ret.push_back(&dst);
-			if (src1.isReg())
-				ret.push_back(&src1);
-			if (src2.isReg())
-				ret.push_back(&src2);
-			for (auto &param : paramExt)
-				if (param.isReg())
-					ret.push_back(&param);
-			return ret;
+			if (output)
+				return oper != Store && oper != StoreA && dst.isReg() ? &dst : nullptr;
+			Operand *operand;
+			switch (pos)
+			{
+			case 0:
+				if (oper != Store && oper != StoreA)
+					return nullptr;
+				operand = &dst;
+				break;
+			case 1:
+				operand = &src1;
+				break;
+			case 2:
+				operand = &src2;
+				break;
+			default:
+				operand = &paramExt[pos - 3];
+			}
+			return operand->isReg() ? operand : nullptr;
 		}
-		virtual std::vector<Operand *> getOutputReg() override final
+		size_t regSlotCount(bool output) const
 		{
-			std::vector<Operand *> ret;
 			if (oper == ParallelMove)
 			{
 				assert(paramExt.size() % 2 == 0);
-				for (size_t i = 0; i < paramExt.size() / 2; i++)
-				{
-					assert(paramExt[i].isReg());
-					ret.push_back(&paramExt[i]);
-				}
-				return ret;
+				return paramExt.size() / 2;
 			}
-			if (oper != Store && oper != StoreA && dst.isReg())
-				ret.push_back(&dst);
-			return ret;
+			return output ? 1 : 3 + paramExt.size();
 		}
 	};
 
@@ -290,6 +360,85 @@ namespace MxIR
 	inline Instruction IRUnlockRegister() { return Instruction(UnlockReg); }
 
 	class Block;
+
+	//Storage of the blocks and instruction nodes of a function. Memory is handed out by bump allocation, 
+	//recycled within the arena and released in one go when the last Function sharing the arena is destroyed.
+	class IRArena
+	{
+	public:
+		class Scope
+		{
+		public:
+			explicit Scope(const std::shared_ptr<IRArena> &arena) : prev(curArena) { curArena = arena.get(); }
+			Scope(const Scope &other) = delete;
+			~Scope() { curArena = prev; }
+
+		protected:
+			IRArena *prev;
+		};
+
+	public:
+		IRArena() : cur(nullptr), end(nullptr), chunkSize(minChunkSize), nBytes(0), liveBlocks(nullptr), freeNodes{} {}
+		IRArena(const IRArena &other) = delete;
+		~IRArena();
+
+		//keep another arena alive as long as this one, e.g. after blocks of a clone are inlined
+		void adopt(std::shared_ptr<IRArena> other);
+		size_t allocatedBytes() const { return nBytes; }
+
+		//nodes come from the arena of the innermost Scope on this thread, or from the heap if there is none
+		static void * allocateNode(size_t size);
+		static void deallocateNode(void *ptr);
+		static IRArena * current() { return curArena; }
+
+	protected:
+		friend class Block;
+		struct alignas(16) NodeHeader
+		{
+			IRArena *owner;
+			size_t size;
+		};
+		struct FreeNode
+		{
+			FreeNode *next;
+		};
+		void * allocate(size_t size);
+		void linkBlock(Block *block);
+		void unlinkBlock(Block *block);
+		void collectBlocks(std::vector<std::shared_ptr<Block>> &blocks);
+
+	protected:
+		std::vector<std::unique_ptr<char[]>> chunks;
+		char *cur, *end;
+		size_t chunkSize;
+		size_t nBytes;
+		Block *liveBlocks;
+		std::array<FreeNode *, 64> freeNodes;	//size / 16 -> recycled nodes
+		std::vector<std::shared_ptr<IRArena>> adopted;
+
+		static thread_local IRArena *curArena;
+		static const size_t minChunkSize = 4096, maxChunkSize = 1 << 20;
+	};
+
+	template<typename T>
+	class IRAllocator
+	{
+	public:
+		typedef T value_type;
+
+		IRAllocator() {}
+		template<typename U> IRAllocator(const IRAllocator<U> &) {}
+
+		T * allocate(size_t n) { return static_cast<T *>(IRArena::allocateNode(n * sizeof(T))); }
+		void deallocate(T *ptr, size_t n) { IRArena::deallocateNode(ptr); }
+
+		//every node records its owner, so any allocator can release it
+		template<typename U> bool operator==(const IRAllocator<U> &) const { return true; }
+		template<typename U> bool operator!=(const IRAllocator<U> &) const { return false; }
+	};
+
+	typedef std::list<Instruction, IRAllocator<Instruction>> InsList;
+
 	struct PSTNode
 	{
 		Block *inBlock, *outBlock;
@@ -309,7 +458,6 @@ namespace MxIR
 		}
 		
 	};
-	//FIXME: Possible Memory Leak
 	class Block
 	{
 	public:
@@ -318,44 +466,40 @@ namespace MxIR
 			Operand dst;
 			std::vector<std::pair<Operand, std::weak_ptr<Block>>> srcs;
 
-			PhiIns() { hint = PreferOperands; }
-			PhiIns(Operand dst) : dst(dst) { hint = PreferOperands; }
+			PhiIns() : InstructionBase(KindPhi) { hint = PreferOperands; }
+			PhiIns(Operand dst) : InstructionBase(KindPhi), dst(dst) { hint = PreferOperands; }
 
-			virtual std::vector<Operand *> getInputReg() override final
+			Operand * regSlot(bool output, size_t pos)
 			{
-				std::vector<Operand *> ret;
-				for (auto &src : srcs)
+				if (output)
 				{
-					if(src.first.isReg())
-						ret.push_back(&src.first);
+					assert(dst.isReg());
+					return &dst;
 				}
-				return ret;
-			}
-			virtual std::vector<Operand *> getOutputReg() override final
-			{
-				assert(dst.isReg());
-				return { &dst };
+				return srcs[pos].first.isReg() ? &srcs[pos].first : nullptr;
 			}
+			size_t regSlotCount(bool output) const { return output ? 1 : srcs.size(); }
 		};
 		struct SigmaIns : public InstructionBase
 		{
 			Operand dstTrue, dstFalse;
 			Operand src;
 
-			SigmaIns() {}
-			SigmaIns(Operand src) : src(src) {}
+			SigmaIns() : InstructionBase(KindSigma) {}
+			SigmaIns(Operand src) : InstructionBase(KindSigma), src(src) {}
 
-			virtual std::vector<Operand *> getInputReg() override final
-			{
-				assert(src.isReg());
-				return { &src };
-			}
-			virtual std::vector<Operand *> getOutputReg() override final
+			Operand * regSlot(bool output, size_t pos)
 			{
+				if (!output)
+				{
+					assert(src.isReg());
+					return &src;
+				}
 				assert(dstTrue.isReg());
 				assert(dstFalse.isReg());
-				return { &dstTrue, &dstFalse };
+				return pos == 0 ? &dstTrue : &dstFalse;
 			}
+			size_t regSlotCount(bool output) const { return output ? 2 : 1; }
 		};
 		class block_ptr
 		{
@@ -378,6 +522,10 @@ namespace MxIR
 			Block * get() const { return ptr.get(); }
 			operator bool() const { return bool(ptr); }
 
+		protected:
+			friend class IRArena;
+			void detach() { ptr.reset(); }	//drop the edge without touching the preds of the target
+
 		protected:
 			std::shared_ptr<Block> ptr;
 			std::list<Block *>::iterator iterPred;
@@ -385,7 +533,7 @@ namespace MxIR
 		};
 
 	public:
-		std::list<Instruction> ins;
+		InsList ins;
 		std::map<size_t, PhiIns> phi;		//map register id to phi instruction
 		std::map<size_t, SigmaIns> sigma;
 
@@ -415,23 +563,60 @@ namespace MxIR
 		std::list<Block *>::iterator newPred(Block *pred);
 		void removePred(std::list<Block *>::iterator iterPred);
 
+		friend class IRArena;
+		IRArena *arena;
+		Block *arenaPrev, *arenaNext;	//blocks alive in the arena
+
 	private:
-		Block() : brTrue(this), brFalse(this) {}
+		Block() : brTrue(this), brFalse(this), arena(nullptr), arenaPrev(nullptr), arenaNext(nullptr) {}
 	};
 
 	class Function
 	{
 	public:
+		std::shared_ptr<IRArena> arena = std::make_shared<IRArena>();	//must outlive the blocks below
 		std::vector<Operand> params;
 		std::shared_ptr<Block> inBlock, outBlock;
 
 		std::shared_ptr<PSTNode> pstRoot;
 
+		Function() {}
+		Function(const Function &other) = default;
+		Function(Function &&other) = default;
+		Function & operator=(const Function &other);
+		Function & operator=(Function &&other);
+
 		void constructPST();
-		void splitProgramRegion();
+		bool splitProgramRegion(std::map<Block *, std::set<Block *>> &loops);	//return whether the CFG is changed; the inserted blocks are added to loops
 		void mergeBlocks();
 		Function clone();
+		bool isEmpty() const;	//the body only returns, like the stubs of the builtins not implemented yet
 	};
+
+	inline Operand * InstructionBase::regSlot(bool output, size_t pos)
+	{
+		switch (kind)
+		{
+		case KindPhi:
+			return static_cast<Block::PhiIns *>(this)->regSlot(output, pos);
+		case KindSigma:
+			return static_cast<Block::SigmaIns *>(this)->regSlot(output, pos);
+		default:
+			return static_cast<Instruction *>(this)->regSlot(output, pos);
+		}
+	}
+	inline size_t InstructionBase::regSlotCount(bool output) const
+	{
+		switch (kind)
+		{
+		case KindPhi:
+			return static_cast<const Block::PhiIns *>(this)->regSlotCount(output);
+		case KindSigma:
+			return static_cast<const Block::SigmaIns *>(this)->regSlotCount(output);
+		default:
+			return static_cast<const Instruction *>(this)->regSlotCount(output);
+		}
+	}
 }
 
 #endif
\ No newline at end of file
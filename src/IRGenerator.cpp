@@ -123,6 +123,7 @@ Instruction IRGenerator::releaseXValue(Operand addr, MxType type)
 Function IRGenerator::generate(ASTDeclFunc *declFunc)
 {
 	Function ret;
+	IRArena::Scope scope(ret.arena);
 	const MxProgram::funcInfo &finfo = program->vFuncs[declFunc->funcID];
 	regNum = program->vLocalVars[declFunc->funcID].size();
 	if (finfo.isThiscall)
@@ -139,6 +140,13 @@ Function IRGenerator::generate(ASTDeclFunc *declFunc)
 
 	ret.inBlock = Block::construct();
 	returnBlock = Block::construct();
+
+	//a return releases every object variable declared before it, even one whose declaration a loop or a branch skipped
+	auto &localVars = program->vLocalVars[declFunc->funcID];
+	for (size_t i = finfo.isThiscall ? finfo.paramType.size() - 1 : finfo.paramType.size(); i < localVars.size(); i++)
+		if (localVars[i].varType.isObject())
+			ret.inBlock->ins.push_back(IR(RegPtr(i), Move, ImmPtr(0)));
+
 	std::shared_ptr<Block> currentBlock = ret.inBlock;
 	for (auto &stat : declFunc->stats)
 	{
@@ -265,7 +273,7 @@ void IRGenerator::visit(ASTExprUnary *unary)
 		visitExprRec(unary->operand.get());
 		resumeFlag();
 
-		std::list<Instruction> &insList = lastBlockOut ? lastBlockOut->ins : lastIns;
+		InsList &insList = lastBlockOut ? lastBlockOut->ins : lastIns;
 		Operand retval;
 		if (visFlag & Read)
 		{
@@ -293,7 +301,7 @@ void IRGenerator::visit(ASTExprUnary *unary)
 		visitExprRec(unary->operand.get());
 		resumeFlag();
 
-		std::list<Instruction> &insList = lastBlockOut ? lastBlockOut->ins : lastIns;
+		InsList &insList = lastBlockOut ? lastBlockOut->ins : lastIns;
 		if (lastWriteAddr.type != Operand::empty)
 		{
 			Operand regtmp = RegByType(regNum++, unary->exprType);
@@ -312,7 +320,7 @@ void IRGenerator::visit(ASTExprUnary *unary)
 	if (!(visFlag & Read))
 		return;
 
-	std::list<Instruction> &insList = lastBlockOut ? lastBlockOut->ins : lastIns;
+	InsList &insList = lastBlockOut ? lastBlockOut->ins : lastIns;
 	switch (unary->oper)
 	{
 	case ASTExprUnary::Positive:
@@ -702,7 +710,7 @@ void IRGenerator::visit(ASTExprMemberAccess *expr)
 	}
 
 	Operand addrObj = lastOperand;
-	std::list<Instruction> &insList = lastBlockOut ? lastBlockOut->ins : lastIns;
+	InsList &insList = lastBlockOut ? lastBlockOut->ins : lastIns;
 
 	lastWriteAddr = RegPtr(regNum++);
 	insList.push_back(IR(lastWriteAddr, Add, 
@@ -1130,43 +1138,46 @@ void IRGenerator::generateProgram(MxAST::ASTRoot *root)
 		program->vConst.push_back(MxBuiltin::string2Const(symbol->vString[i]));
 	}
 
-	std::shared_ptr<Block> blkIn(Block::construct());
-	std::shared_ptr<Block> cur = blkIn;
+	{
+		Function funcStart;
+		IRArena::Scope scope(funcStart.arena);
+		std::shared_ptr<Block> blkIn(Block::construct());
+		std::shared_ptr<Block> cur = blkIn;
 
-	regNum = 0;
+		regNum = 0;
 
-	for (auto &child : root->nodes)
-	{
-		ASTDeclVarGlobal *declVar = dynamic_cast<ASTDeclVarGlobal *>(child.get());
-		if (declVar)
+		for (auto &child : root->nodes)
 		{
-			if (declVar->initVal)
+			ASTDeclVarGlobal *declVar = dynamic_cast<ASTDeclVarGlobal *>(child.get());
+			if (declVar)
 			{
-				setFlag(Read);
-				visitExprRec(declVar->initVal.get());
-				resumeFlag();
-				merge(cur);
-				cur->ins.push_back(IRStore(lastOperand, IDGlobalVar(declVar->varID)));
-
-				ASTExpr *initExpr = dynamic_cast<ASTExpr *>(declVar->initVal.get());
-				assert(initExpr);
-				if (initExpr->exprType.isObject())
-					cur->ins.push_back(IRCall(EmptyOperand(), IDFunc(size_t(MxBuiltin::BuiltinFunc::addref_object)), { lastOperand }));
-
-				clearXValueStack();
-				merge(cur);
+				if (declVar->initVal)
+				{
+					setFlag(Read);
+					visitExprRec(declVar->initVal.get());
+					resumeFlag();
+					merge(cur);
+					cur->ins.push_back(IRStore(lastOperand, IDGlobalVar(declVar->varID)));
+
+					ASTExpr *initExpr = dynamic_cast<ASTExpr *>(declVar->initVal.get());
+					assert(initExpr);
+					if (initExpr->exprType.isObject())
+						cur->ins.push_back(IRCall(EmptyOperand(), IDFunc(size_t(MxBuiltin::BuiltinFunc::addref_object)), { lastOperand }));
+
+					clearXValueStack();
+					merge(cur);
+				}
 			}
 		}
-	}
 
-	cur->ins.push_back(IRReturn());
+		cur->ins.push_back(IRReturn());
 
-	Function funcStart;
-	funcStart.inBlock = std::move(blkIn);
-	funcStart.outBlock = Block::construct();
-	redirectReturn(funcStart.inBlock, funcStart.outBlock);
+		funcStart.inBlock = std::move(blkIn);
+		funcStart.outBlock = Block::construct();
+		redirectReturn(funcStart.inBlock, funcStart.outBlock);
 
-	program->vFuncs[size_t(MxBuiltin::BuiltinFunc::initialize)].content = std::move(funcStart);
+		program->vFuncs[size_t(MxBuiltin::BuiltinFunc::initialize)].content = std::move(funcStart);
+	}
 
 	regNum = 0;
 
@@ -24,6 +24,8 @@ public:
 	//  5. add 'Export' attribute to main function
 	void generateProgram(MxAST::ASTRoot *root);	
 
+	static MxIR::Instruction releaseXValue(MxIR::Operand addr, MxType type);	//the call that drops a reference to addr, or a nop
+
 protected:
 	static void redirectReturn(std::shared_ptr<MxIR::Block> inBlock, std::shared_ptr<MxIR::Block> outBlock);	//link all blocks that are ended with return to outBlock
 	static MxIR::Operand RegByType(size_t regid, MxType type);
@@ -32,7 +34,6 @@ protected:
 	static MxIR::Operand ImmByType(std::int64_t imm, MxIR::Operand other);
 	static void merge(std::shared_ptr<MxIR::Block> &currentBlock, std::shared_ptr<MxIR::Block> &blkIn, std::shared_ptr<MxIR::Block> &blkOut);
 	void merge(std::shared_ptr<MxIR::Block> &currentBlock);	//merge last block / lastIns to current block
-	static MxIR::Instruction releaseXValue(MxIR::Operand addr, MxType type);
 
 	virtual void visit(MxAST::ASTDeclVar *declVar) override;
 	virtual void visit(MxAST::ASTExprImm *imm) override;
@@ -66,7 +67,7 @@ protected:
 	MxProgram *program;
 	GlobalSymbol *symbol;
 	IssueCollector *issues;
-	std::list<MxIR::Instruction> lastIns;
+	MxIR::InsList lastIns;
 	std::shared_ptr<MxIR::Block> lastBlockIn, lastBlockOut;
 	std::shared_ptr<MxIR::Block> loopContinue, loopBreak;
 	std::shared_ptr<MxIR::Block> returnBlock;
@@ -1,6 +1,9 @@
 #include "common_headers.h"
 #include "InlineOptimizer.h"
+#include "FunctionAnalysis.h"
+#include "CompileStats.h"
 #include "utils/JoinIterator.h"
+#include "utils/DepGraph.h"
 
 namespace MxIR
 {
@@ -13,65 +16,144 @@ namespace MxIR
 	}
 
 	void InlineOptimizer::work()
+	{
+		analyzeProgram();
+		size_t nFunc = program->vFuncs.size();
+		DepGraph callGraph(nFunc);
+		size_t totalInsn = 0;
+		for (size_t i = 0; i < nFunc; i++)
+		{
+			for (auto &kv : stats[i].callTo)
+				callGraph.link(i, kv.first);
+			if (!program->vFuncs[i].disabled)
+				totalInsn += stats[i].nInsn;
+		}
+		callGraph.work();
+		component.resize(nFunc);
+		cyclic.resize(callGraph.getGroupCount());
+		for (size_t c = 0; c < callGraph.getGroupCount(); c++)
+		{
+			cyclic[c] = callGraph.isCyclic(c);
+			for (size_t idx : callGraph.getVertex(c))
+				component[idx] = c;
+		}
+		growth = 0;
+		budget = totalInsn * CompileFlags::getInstance()->inline_growth / 100;
+
+		for (size_t c = 0; c < callGraph.getGroupCount(); c++)
+		{
+			const std::vector<size_t> &members = callGraph.getVertex(c);
+			for (size_t idx : members)
+				inlineCallSites(idx);
+			if (members.size() == 1 && stats[members[0]].callTo.count(members[0]) && !(program->vFuncs[members[0]].attribute & NoInline))
+				unrollRecursion(members[0]);
+		}
+		disableUnusedFuncs();
+		bodies.clear();
+		CompileStats::count("inline_growth", growth);
+	}
+
+	void InlineOptimizer::inlineCallSites(size_t caller)
 	{
 		const size_t maxPenalty = CompileFlags::getInstance()->inline_param;
-		const int threshold = CompileFlags::getInstance()->inline_param2;
-		struct Tqueue
+		struct Site
 		{
-			size_t idx, nUpdate, penalty;
-			bool operator<(const Tqueue &rhs) const { return penalty > rhs.penalty; }
+			Instruction *call;
+			size_t callee;
+			double weight;
 		};
-		std::priority_queue<Tqueue> Q;
-		analyzeProgram();
-		for (size_t i = 0; i < stats.size(); i++)
+		std::vector<Site> sites;
+		{
+			FunctionAnalysis analysis(program->vFuncs[caller].content);
+			const std::vector<Block *> &blocks = analysis.blocks();
+			const std::vector<double> &freq = analysis.blockFreq();
+			for (size_t i = 0; i < blocks.size(); i++)
+				for (auto &ins : blocks[i]->ins)
+				{
+					if (ins.oper != Call || ins.src1.type != Operand::funcID)
+						continue;
+					size_t callee = ins.src1.val;
+					if (cyclic[component[callee]] || (program->vFuncs[callee].attribute & NoInline))
+						continue;
+					sites.push_back(Site{ &ins, callee, freq[i] });
+				}
+		}
+		std::stable_sort(sites.begin(), sites.end(), [](const Site &lhs, const Site &rhs) { return lhs.weight > rhs.weight; });
+
+		//a site in a loop may take a callee up to twice the usual size, a site on a cold path a tenth of it
+		std::map<size_t, std::set<Instruction *>> chosen;
+		for (const Site &site : sites)
 		{
-			if (program->vFuncs[i].attribute & NoInline)
+			const statFunc &stat = stats[site.callee];
+			size_t cost = stat.nInsn + program->vFuncs[site.callee].content.params.size();
+			if (stat.penalty() > maxPenalty * std::min(std::max(site.weight, 0.1), 2.0))
 				continue;
-			Q.push(Tqueue{ i, stats[i].nUpdate, stats[i].penalty() });
+			if (!stat.forceInline && growth + cost > budget)
+				continue;
+			std::set<Instruction *> &calls = chosen[site.callee];
+			if ((stat.nBlock - 1) * (calls.size() + 1) > blockLimit(caller))
+				continue;
+			calls.insert(site.call);
+			growth += cost;
 		}
-		while (!Q.empty())
+		for (auto &kv : chosen)
 		{
-			Tqueue cur = Q.top();
-			Q.pop();
-			if (cur.nUpdate != stats[cur.idx].nUpdate)
+			if (kv.second.empty())
 				continue;
-			if (cur.penalty > maxPenalty)
+			applyInline(kv.first, caller, calleeBody(kv.first), &kv.second);
+		}
+	}
+
+	//a self-recursive function is unrolled by inlining its current body into itself while it stays small
+	void InlineOptimizer::unrollRecursion(size_t func)
+	{
+		const size_t maxPenalty = CompileFlags::getInstance()->inline_param;
+		while (stats[func].callTo.count(func) && stats[func].penalty() <= maxPenalty)
+		{
+			size_t calls = stats[func].callTo[func];
+			size_t cost = (stats[func].nInsn + program->vFuncs[func].content.params.size()) * calls;
+			if ((stats[func].nBlock - 1) * calls > blockLimit(func))
 				break;
-			Function content = program->vFuncs[cur.idx].content.clone();
-			if (stats[cur.idx].callTo.count(cur.idx))
-			{
-				size_t incBlock = (stats[cur.idx].nBlock - 1) * stats[cur.idx].callTo[cur.idx];
-				if (incBlock > threshold + stats[cur.idx].nBlock * sqrt(threshold))
-					continue;
+			if (!stats[func].forceInline && growth + cost > budget)
+				break;
+			Function content = program->vFuncs[func].content.clone();
+			applyInline(func, func, content);
+			growth += cost;
+		}
+	}
 
-				applyInline(cur.idx, cur.idx, content);
-				stats[cur.idx].nUpdate++;
-				Q.push(Tqueue{ cur.idx, stats[cur.idx].nUpdate, stats[cur.idx].penalty() });
-			}
-			else
-			{
-				bool flag = true;
-				for (size_t i = 0; i < stats.size(); i++)
-					if (stats[i].callTo.count(cur.idx))
-					{
-						size_t incBlock = (stats[cur.idx].nBlock - 1) * stats[i].callTo[cur.idx];
-						if (incBlock > threshold + stats[i].nBlock * sqrt(threshold))
-						{
-							flag = false;
-							continue;
-						}
+	//the callers are visited before their callees, so a function is dropped once no remaining caller calls it
+	void InlineOptimizer::disableUnusedFuncs()
+	{
+		std::vector<size_t> order(stats.size());
+		for (size_t i = 0; i < order.size(); i++)
+			order[i] = i;
+		std::stable_sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs) { return component[lhs] > component[rhs]; });
+		for (size_t idx : order)
+		{
+			if (program->vFuncs[idx].attribute & Export)
+				continue;
+			bool called = false;
+			for (size_t i = 0; i < stats.size() && !called; i++)
+				if (i != idx && !program->vFuncs[i].disabled && stats[i].callTo.count(idx))
+					called = true;
+			if (!called)
+				program->vFuncs[idx].disabled = true;
+		}
+	}
 
-						applyInline(cur.idx, i, content);
-						assert(!stats[i].callTo.count(cur.idx));
-						stats[i].nUpdate++;
+	Function & InlineOptimizer::calleeBody(size_t callee)
+	{
+		auto iter = bodies.find(callee);
+		if (iter == bodies.end())
+			iter = bodies.emplace(callee, program->vFuncs[callee].content.clone()).first;
+		return iter->second;
+	}
 
-						if(!(program->vFuncs[i].attribute & NoInline))
-							Q.push(Tqueue{ i, stats[i].nUpdate, stats[i].penalty() });
-					}
-				if(flag && !(program->vFuncs[cur.idx].attribute & Export))
-					program->vFuncs[cur.idx].disabled = true;
-			}
-		}
+	size_t InlineOptimizer::blockLimit(size_t caller) const
+	{
+		const int threshold = CompileFlags::getInstance()->inline_param2;
+		return size_t(threshold + stats[caller].nBlock * sqrt(threshold));
 	}
 
 	void InlineOptimizer::analyzeProgram()
@@ -80,10 +162,7 @@ namespace MxIR
 		for (size_t i = 0; i < program->vFuncs.size(); i++)
 		{
 			stats[i] = analyzeFunc(program->vFuncs[i].content);
-			if (program->vFuncs[i].attribute & ForceInline)
-				stats[i].forceInline = true;
-			else
-				stats[i].forceInline = false;
+			stats[i].forceInline = (program->vFuncs[i].attribute & ForceInline) != 0;
 		}
 	}
 
@@ -117,8 +196,9 @@ namespace MxIR
 		return stat;
 	}
 
-	void InlineOptimizer::applyInline(size_t callee, size_t caller, Function &content)
+	void InlineOptimizer::applyInline(size_t callee, size_t caller, Function &content, const std::set<Instruction *> *sites)
 	{
+		IRArena::Scope scope(program->vFuncs[caller].content.arena);
 		std::vector<Block *> vBlocks;
 		program->vFuncs[caller].content.inBlock->traverse([&vBlocks](Block *block) -> bool
 		{
@@ -132,10 +212,11 @@ namespace MxIR
 			//auto endIter = block->ins.end();
 			for (auto iter = block->ins.begin(); iter != block->ins.end(); )
 			{
-				if (iter->oper == Call && iter->src1.type == Operand::funcID && iter->src1.val == callee)
+				if (iter->oper == Call && iter->src1.type == Operand::funcID && iter->src1.val == callee && (!sites || sites->count(&*iter)))
 				{
 					Operand retVar = iter->dst;
 					Function child = content.clone();
+					program->vFuncs[caller].content.arena->adopt(child.arena);
 					assert(child.outBlock->ins.empty());
 					size_t offsetVarID = stats[caller].nVar;
 
@@ -6,6 +6,9 @@
 
 namespace MxIR
 {
+	//Bottom-up inliner: the strongly connected components of the call graph are visited callees first,
+	//so the body of a callee is final when its call sites are considered and is cloned only once.
+	//Call sites are taken hottest first by the frequency of their block, within a whole-program growth budget.
 	class InlineOptimizer
 	{
 	public:
@@ -21,19 +24,27 @@ namespace MxIR
 			bool externalCall, forceInline;
 			std::map<size_t, size_t> callTo;	//func ID -> call times
 
-			size_t nUpdate;
-
-			statFunc() : nInsn(0), nBlock(0), nVar(0), externalCall(false), nUpdate(0) {}
+			statFunc() : nInsn(0), nBlock(0), nVar(0), externalCall(false), forceInline(false) {}
 			size_t penalty() const;
 		};
 
 	protected:
 		void analyzeProgram();
 		statFunc analyzeFunc(Function &func);
-		void applyInline(size_t callee, size_t caller, Function &content);
+		void inlineCallSites(size_t caller);
+		void unrollRecursion(size_t func);
+		void disableUnusedFuncs();
+		Function & calleeBody(size_t callee);
+		size_t blockLimit(size_t caller) const;
+		//inline the calls in sites, or every call to callee if sites is null
+		void applyInline(size_t callee, size_t caller, Function &content, const std::set<Instruction *> *sites = nullptr);
 
 	protected:
 		std::vector<statFunc> stats;
+		std::vector<size_t> component;		//func ID -> SCC of the call graph, callees first
+		std::vector<bool> cyclic;			//SCC -> whether it contains a recursion
+		std::map<size_t, Function> bodies;	//callee -> its final body, cloned at each call site
+		size_t growth, budget;				//in instructions
 		MxProgram *program;
 	};
 }
@@ -3,18 +3,8 @@
 
 namespace MxIR
 {
-	void InstructionSelect::computeUseCount()
-	{
-		func.inBlock->traverse([this](Block *block) -> bool
-		{
-			for (auto &ins : block->instructions())
-				for (Operand *operand : ins.getInputReg())
-					useCount[*operand]++;
-			return true;
-		});
-	}
-
-	void InstructionSelect::selectInsn(Block *block)
+	//the comparison right before the branch ending block, if the branch tests its result
+	static InsList::iterator branchCompare(Block *block)
 	{
 		static const std::set<Operation> alterInsn = {
 			Slt, Sle, Seq, Sgt, Sge, Sne,
@@ -23,26 +13,75 @@ namespace MxIR
 		if (block->ins.back().oper == Br && block->ins.size() >= 2)
 		{
 			auto iter = std::prev(block->ins.end(), 2);
-			if (alterInsn.count(iter->oper))
+			if (alterInsn.count(iter->oper) && iter->dst.isReg() && iter->dst.val != Operand::InvalidID
+				&& iter->dst.val == block->ins.back().src1.val && iter->dst.ver == block->ins.back().src1.ver)
+				return iter;
+		}
+		return block->ins.end();
+	}
+
+	void InstructionSelect::findCandidates()
+	{
+		for (Block *block : blocks)
+		{
+			if (block == func.outBlock.get())
+				continue;
+			auto iter = branchCompare(block);
+			if (iter == block->ins.end())
+				continue;
+			size_t reg = iter->dst.val;
+			if (reg >= firstCandidate.size())
+				firstCandidate.resize(reg + 1, 0);
+			candidates.push_back(Candidate{ iter->dst.ver, 0, firstCandidate[reg] });
+			firstCandidate[reg] = candidates.size();
+		}
+	}
+
+	void InstructionSelect::countUses()
+	{
+		for (Block *block : blocks)
+			for (auto &ins : block->instructions())
+				for (Operand *operand : ins.inputRegs())
+				{
+					if (operand->val >= firstCandidate.size())
+						continue;
+					for (size_t c = firstCandidate[operand->val]; c; c = candidates[c - 1].next)
+						if (candidates[c - 1].ver == operand->ver)
+							candidates[c - 1].uses++;
+				}
+	}
+
+	void InstructionSelect::selectInsn(Block *block)
+	{
+		auto iter = branchCompare(block);
+		if (iter == block->ins.end())
+			return;
+		for (size_t c = firstCandidate[iter->dst.val]; c; c = candidates[c - 1].next)
+			if (candidates[c - 1].ver == iter->dst.ver)
 			{
-				if (iter->dst.val == block->ins.back().src1.val && iter->dst.ver == block->ins.back().src1.ver
-					&& useCount[iter->dst] == 1)
+				if (candidates[c - 1].uses == 1)
 				{
 					iter->dst = EmptyOperand();
 					block->ins.back().src1 = EmptyOperand();
 				}
+				return;
 			}
-		}
 	}
 
 	void InstructionSelect::work()
 	{
-		computeUseCount();
+		//only the values of the candidates are counted, so the uses of the other values need no index
 		func.inBlock->traverse([this](Block *block) -> bool
 		{
-			if(block != func.outBlock.get())
-				selectInsn(block);
+			blocks.push_back(block);
 			return true;
 		});
+		findCandidates();
+		if (candidates.empty())
+			return;
+		countUses();
+		for (Block *block : blocks)
+			if (block != func.outBlock.get())
+				selectInsn(block);
 	}
 }
\ No newline at end of file
@@ -13,12 +13,24 @@ namespace MxIR
 		void work();
 
 	protected:
-		void computeUseCount();
+		void findCandidates();
+		void countUses();
 		void selectInsn(Block *block);
 
+	protected:
+		//a comparison whose result is the condition of the branch right after it
+		struct Candidate
+		{
+			std::uint32_t ver;
+			size_t uses;
+			size_t next;	//another candidate of the same register id, plus 1, or 0
+		};
+
 	protected:
 		Function &func;
-		std::map<Operand, size_t> useCount;
+		std::vector<Block *> blocks;
+		std::vector<Candidate> candidates;
+		std::vector<size_t> firstCandidate;	//register id -> the first of its candidates plus 1, or 0 if there is none
 	};
 }
 
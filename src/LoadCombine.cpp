@@ -5,21 +5,58 @@ namespace MxIR
 {
 	void LoadCombine::combine(Block *block)
 	{
-		std::map<Operand, Operand> loadOp;	//addr -> var
+		std::map<Operand, Operand> loadOp;	//addr -> var, for the addresses not kept in regLoad
 		std::map<std::pair<Operand, Operand>, Operand> loadAOp;
+		epoch++;
 
 		for (auto &ins : block->ins)
 		{
+			//a call that writes no memory through pointers only invalidates the global vars it writes
+			if (ins.oper == Call && ins.src1.type == Operand::funcID && !program->vFuncs[ins.src1.val].modRef.writeMemory)
+			{
+				const MxProgram::modRefInfo &modRef = program->vFuncs[ins.src1.val].modRef;
+				for (auto iter = loadOp.begin(); iter != loadOp.end(); )
+				{
+					if (iter->first.type == Operand::globalVarID && modRef.mayWriteGlobal(iter->first.val))
+						iter = loadOp.erase(iter);
+					else
+						++iter;
+				}
+				continue;
+			}
 			if (ins.oper == Call || ins.oper == Store || ins.oper == StoreA)
 			{
 				loadOp.clear();
 				loadAOp.clear();
+				epoch++;
 				continue;
 			}
 			if (ins.oper == Load)
 			{
-				if (loadOp.count(ins.src1) && loadOp[ins.src1].size() >= ins.dst.size())
-					ins = IR(ins.dst, Move, loadOp[ins.src1].clone().setSize(ins.dst.size()));
+				//another version of the same register in this epoch goes to loadOp
+				RegLoad *slot = nullptr;
+				if (ins.src1.isReg() && ins.src1.val != Operand::InvalidID)
+				{
+					if (ins.src1.val >= regLoad.size())
+						regLoad.resize(ins.src1.val + 1);
+					slot = &regLoad[ins.src1.val];
+					if (slot->epoch == epoch && slot->ver != ins.src1.ver)
+						slot = nullptr;
+				}
+				Operand *loaded = nullptr;
+				if (slot)
+					loaded = slot->epoch == epoch ? &slot->var : nullptr;
+				else if (loadOp.count(ins.src1))
+					loaded = &loadOp[ins.src1];
+
+				if (loaded && loaded->size() >= ins.dst.size())
+					ins = IR(ins.dst, Move, loaded->clone().setSize(ins.dst.size()));
+				else if (slot)
+				{
+					slot->epoch = epoch;
+					slot->ver = ins.src1.ver;
+					slot->var = ins.dst;
+				}
 				else
 					loadOp[ins.src1] = ins.dst;
 			}
@@ -36,10 +73,12 @@ namespace MxIR
 
 	void LoadCombine::work()
 	{
-		func.inBlock->traverse([](Block *block) -> bool
+		regLoad.clear();
+		epoch = 0;
+		func.inBlock->traverse([this](Block *block) -> bool
 		{
 			combine(block);
 			return true;
 		});
 	}
-}
\ No newline at end of file
+}
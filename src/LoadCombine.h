@@ -3,20 +3,31 @@
 
 #include "common.h"
 #include "IR.h"
+#include "MxProgram.h"
 
 namespace MxIR
 {
 	class LoadCombine
 	{
 	public:
-		LoadCombine(Function &func) : func(func) {}
+		LoadCombine(Function &func) : func(func), program(MxProgram::getDefault()) {}
 		void work();
 
 	protected:
-		static void combine(Block *block);
+		void combine(Block *block);
 
 	protected:
+		struct RegLoad
+		{
+			size_t epoch = 0;
+			std::uint32_t ver = 0;
+			Operand var;
+		};
+
 		Function &func;
+		MxProgram *program;
+		std::vector<RegLoad> regLoad;		//register id -> var loaded from the version ver, valid if epoch matches
+		size_t epoch;
 	};
 }
 
@@ -1,26 +1,21 @@
 #include "common_headers.h"
 #include "LoopDetector.h"
+#include "FunctionAnalysis.h"
 
 namespace MxIR
 {
 	void LoopDetector::findLoops()
 	{
-		func.inBlock->traverse([this](Block *block) -> bool
-		{
-			mapBlock[block] = vBlock.size();
-			vBlock.push_back(block);
-			return true;
-		});
-		dtree = DomTree(vBlock.size());
-		for (Block *blk : vBlock)
-		{
-			if (blk->brTrue)
-				dtree.link(mapBlock[blk], mapBlock[blk->brTrue.get()]);
-			if (blk->brFalse)
-				dtree.link(mapBlock[blk], mapBlock[blk->brFalse.get()]);
-		}
-		assert(vBlock[0] == func.inBlock.get());
-		dtree.buildTree(0);
+		FunctionAnalysis analysis(func);
+		findLoops(analysis.blocks(), analysis.domTree());
+	}
+
+	void LoopDetector::findLoops(const std::vector<Block *> &blocks, DomTree &dtree)
+	{
+		assert(blocks[0] == func.inBlock.get());
+		vBlock = &blocks;
+		this->dtree = &dtree;
+		loops.clear();
 
 		std::set<Block *> predecessors;
 		dfs_dtree(0, predecessors);
@@ -28,23 +23,29 @@ namespace MxIR
 
 	void LoopDetector::dfs_dtree(size_t idx, std::set<Block *> &predecessors)
 	{
-		Block *blk = vBlock[idx];
+		Block *blk = (*vBlock)[idx];
 		for (auto *child : { &blk->brTrue, &blk->brFalse })
 			if (*child && predecessors.count(child->get()))
 				dfs_backward(blk, child->get());
 		predecessors.insert(blk);
-		for (size_t child_dtree : dtree.getDomChildren(idx))
+		for (size_t child_dtree : dtree->getDomChildren(idx))
 			dfs_dtree(child_dtree, predecessors);
 		predecessors.erase(blk);
 	}
 
 	void LoopDetector::dfs_backward(Block *blk, Block *target)
 	{
-		loops[target].insert(blk);
-		if (blk == target)
-			return;
-		for (Block *pred : blk->preds)
-			if (!loops[target].count(pred))
-				dfs_backward(pred, target);
+		std::set<Block *> &body = loops[target];
+		std::vector<Block *> stk;
+		if (body.insert(blk).second && blk != target)
+			stk.push_back(blk);
+		while (!stk.empty())
+		{
+			Block *cur = stk.back();
+			stk.pop_back();
+			for (Block *pred : cur->preds)
+				if (body.insert(pred).second && pred != target)
+					stk.push_back(pred);
+		}
 	}
 }
\ No newline at end of file
@@ -12,6 +12,8 @@ namespace MxIR
 	public:
 		LoopDetector(Function &func) : func(func) {}
 		void findLoops();
+		//reuse the blocks and the dominator tree of a FunctionAnalysis, blocks[0] must be the entry
+		void findLoops(const std::vector<Block *> &blocks, DomTree &dtree);
 		const std::map<Block *, std::set<Block *>> &getLoops() const { return loops; }
 
 	protected:
@@ -21,9 +23,8 @@ namespace MxIR
 	protected:
 		Function &func;
 
-		std::map<Block *, size_t> mapBlock;
-		std::vector<Block *> vBlock;
-		DomTree dtree;
+		const std::vector<Block *> *vBlock;
+		DomTree *dtree;
 
 		std::map<Block *, std::set<Block *>> loops;	//loop header -> set of loop body
 	};
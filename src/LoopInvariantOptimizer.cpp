@@ -1,24 +1,27 @@
 #include "common_headers.h"
 #include "LoopInvariantOptimizer.h"
-#include "LoopDetector.h"
 #include "IRVisualizer.h"
 
 namespace MxIR
 {
 	void LoopInvariantOptimizer::work()
 	{
-		func.splitProgramRegion();
+		//the split keeps loopBody up to date, so the loops need not be detected again on the new CFG
+		std::map<Block *, std::set<Block *>> loopBody = analysis.loops();
+		if (func.splitProgramRegion(loopBody))
+			analysis.invalidate();
 		func.constructPST();
 
-		computeMaxVer();
+		index.build(func);
+		nextReg = index.regCount();
+		mapVar.assign(index.size(), size_t(-1));
+		failedVar.assign(index.size(), false);
 
-		LoopDetector detector(func);
-		detector.findLoops();
-		for (auto &kv : detector.getLoops())
+		for (auto &kv : loopBody)
 		{
 			loop cur;
 			cur.header = kv.first;
-			cur.body = kv.second;
+			cur.body = std::move(kv.second);
 			
 			loops.push_back(cur);
 		}
@@ -42,9 +45,8 @@ namespace MxIR
 			irv.printFoot();
 			loptim_tmp.close();*/
 
-			mapVar.clear();
+			clearVars();
 			mapRegion.clear();
-			failedVar.clear();
 			vInvar.clear();
 
 			insertPoint = nullptr;
@@ -142,19 +144,6 @@ namespace MxIR
 		}
 	}
 
-	void LoopInvariantOptimizer::computeMaxVer()
-	{
-		func.inBlock->traverse([this](Block *block) -> bool
-		{
-			for (auto &ins : block->instructions())
-			{
-				for (Operand *operand : join<Operand *>(ins.getInputReg(), ins.getOutputReg()))
-					maxVer[operand->val] = std::max(maxVer[operand->val], operand->ver);
-			}
-			return true;
-		});
-	}
-
 	void LoopInvariantOptimizer::createInvars(const loop &lp)
 	{
 		std::shared_ptr<PSTNode> node(lp.header->pstNode.lock());
@@ -171,21 +160,20 @@ namespace MxIR
 				traverse(child.get());
 		}
 
-		failedVar.clear();
 		for (Block *block : lp.body)
 		{
 			bool blockFailed = false;
 			for (auto iter = block->ins.begin(); iter != block->ins.end(); ++iter)
 			{
 				auto &ins = *iter;
-				auto output = ins.getOutputReg();
-				if (ins.oper == Call && (ins.src1.type != Operand::funcID || !(program->vFuncs[ins.src1.val].attribute & ConstExpr))
+				auto output = ins.outputRegs();
+				if (ins.oper == Call && (ins.src1.type != Operand::funcID || (program->vFuncs[ins.src1.val].attribute & (ConstExpr | MayTrap)) != ConstExpr)
 					|| ins.oper == Load || ins.oper == LoadA
 					|| ins.oper == Store || ins.oper == StoreA)
 				{
 					blockFailed = true;
 					for (Operand *operand : output)
-						failedVar.insert(*operand);
+						setVarFailed(*operand);
 				}
 				else if (!output.empty())
 				{
@@ -206,14 +194,15 @@ namespace MxIR
 		if (isPhi)
 			return fail();
 		std::set<size_t> dependency;
-		for (Operand *operand : insn->getInputReg())
+		for (Operand *operand : insn->inputRegs())
 		{
-			if (parent.failedVar.count(*operand))
+			if (parent.isVarFailed(*operand))
 				return fail();
-			if (parent.mapVar.count(*operand))
+			size_t invar = parent.varInvar(*operand);
+			if (invar != size_t(-1))
 			{
-				assert(dynamic_cast<InvariantVar *>(parent.vInvar[parent.mapVar[*operand]].get()));
-				dependency.insert(parent.mapVar[*operand]);
+				assert(dynamic_cast<InvariantVar *>(parent.vInvar[invar].get()));
+				dependency.insert(invar);
 			}
 		}
 		if (!setDependOn(dependency))
@@ -225,11 +214,11 @@ namespace MxIR
 	{
 		Invariant::fail();
 		if (isPhi)
-			parent.failedVar.insert(phiDst);
+			parent.setVarFailed(phiDst);
 		else
 		{
-			for (Operand *operand : insn->getOutputReg())
-				parent.failedVar.insert(*operand);
+			for (Operand *operand : insn->outputRegs())
+				parent.setVarFailed(*operand);
 		}
 	}
 
@@ -241,6 +230,11 @@ namespace MxIR
 		{
 			if (parent.failedBlock.count(block))
 				return fail();
+			//a region may leave the loop through an exit, and the blocks outside the loop have no invariants
+			for (auto &ins : block->instructions())
+				for (Operand *operand : ins.outputRegs())
+					if (parent.varInvar(*operand) == size_t(-1))
+						return fail();
 		}
 		std::set<size_t> dependency;
 		for (auto &child : node->children)
@@ -264,14 +258,15 @@ namespace MxIR
 
 		auto isDefined = [&dependency, &children, this](Operand operand)
 		{
-			assert(!parent.failedVar.count(operand));
-			if (!parent.mapVar.count(operand))
+			assert(!parent.isVarFailed(operand));
+			size_t invar = parent.varInvar(operand);
+			if (invar == size_t(-1))
 				return true;
-			if (dependBy.count(parent.mapVar[operand]))
+			if (dependBy.count(invar))
 				return true;
 			for (size_t child : children)
 			{
-				if (parent.vInvar[child]->dependBy.count(parent.mapVar[operand]))
+				if (parent.vInvar[child]->dependBy.count(invar))
 					return true;
 			}
 			return false;
@@ -280,21 +275,23 @@ namespace MxIR
 		for (Block *block : node->blocks)
 			for (auto &ins : block->instructions())
 			{
-				for (Operand *operand : ins.getOutputReg())
+				for (Operand *operand : ins.outputRegs())
 				{
-					parent.vInvar[parent.mapVar[*operand]]->setDependOn({ index });
-					parent.vInvar[parent.mapVar[*operand]]->inited = true;
+					size_t invar = parent.varInvar(*operand);
+					assert(invar != size_t(-1));
+					parent.vInvar[invar]->setDependOn({ index });
+					parent.vInvar[invar]->inited = true;
 				}
 			}
 		for(Block *block : node->blocks)
 			for (auto &ins : block->instructions())
 			{
-				for (Operand *operand : ins.getInputReg())
+				for (Operand *operand : ins.inputRegs())
 				{
-					if (parent.failedVar.count(*operand))
+					if (parent.isVarFailed(*operand))
 						return fail();
 					if (!isDefined(*operand))
-						dependency.insert(parent.mapVar[*operand]);
+						dependency.insert(parent.varInvar(*operand));
 				}
 			}
 		if (!setDependOn(dependency))
@@ -333,20 +330,58 @@ namespace MxIR
 		Invariant::fail();
 	}
 
-	void LoopInvariantOptimizer::protectDivisor(Block *block, std::list<Instruction>::iterator insn)
+	void LoopInvariantOptimizer::protectDivisor(Block *block, InsList::iterator insn)
 	{
 		if (insn->oper == Div || insn->oper == Mod)
 		{
 			if (insn->src2.isImm())
 				return;
 			assert(insn->src2.isReg());
-			Operand tmp = RegSize(maxVer.empty() ? 0 : maxVer.rbegin()->first + 1, insn->src2.size());
-			maxVer[tmp.val] = 0;
+			Operand tmp = RegSize(nextReg++, insn->src2.size());
+			index.add(tmp);
 			block->ins.insert(insn, IR(tmp, TestZero, insn->src2, ImmSize(1, insn->src1.size())));
 			insn->src2 = tmp;
 		}
 	}
 
+	void LoopInvariantOptimizer::setVarInvar(const Operand &operand, size_t invar)
+	{
+		size_t id = index.id(operand);
+		assert(id != SSAValueIndex::npos);
+		if (id >= mapVar.size())
+		{
+			mapVar.resize(index.size(), size_t(-1));
+			failedVar.resize(index.size(), false);
+		}
+		if (mapVar[id] == size_t(-1) && !failedVar[id])
+			touchedVar.push_back(id);
+		mapVar[id] = invar;
+	}
+
+	void LoopInvariantOptimizer::setVarFailed(const Operand &operand)
+	{
+		size_t id = index.id(operand);
+		assert(id != SSAValueIndex::npos);
+		if (id >= mapVar.size())
+		{
+			mapVar.resize(index.size(), size_t(-1));
+			failedVar.resize(index.size(), false);
+		}
+		if (mapVar[id] == size_t(-1) && !failedVar[id])
+			touchedVar.push_back(id);
+		failedVar[id] = true;
+	}
+
+	void LoopInvariantOptimizer::clearVars()
+	{
+		for (size_t id : touchedVar)
+		{
+			mapVar[id] = size_t(-1);
+			failedVar[id] = false;
+		}
+		touchedVar.clear();
+	}
+
 	void LoopInvariantOptimizer::InvariantVar::work()
 	{
 		if (worked)
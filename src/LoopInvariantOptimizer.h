@@ -4,13 +4,15 @@
 #include "common.h"
 #include "IR.h"
 #include "MxProgram.h"
+#include "SSAValueIndex.h"
+#include "FunctionAnalysis.h"
 
 namespace MxIR
 {
 	class LoopInvariantOptimizer
 	{
 	public:
-		LoopInvariantOptimizer(Function &func) : func(func), program(MxProgram::getDefault()) {}
+		LoopInvariantOptimizer(Function &func, FunctionAnalysis &analysis) : func(func), analysis(analysis), program(MxProgram::getDefault()) {}
 		void work();
 
 	protected:
@@ -59,26 +61,26 @@ namespace MxIR
 		struct InvariantVar : public Invariant
 		{
 			Block *block;
-			std::list<Instruction>::iterator insn;
+			InsList::iterator insn;
 			Operand phiDst;
 			bool isPhi;
 
 			InvariantVar(LoopInvariantOptimizer &parent, size_t index, Block *block, const Block::PhiIns &phi) : Invariant(parent, index), block(block), isPhi(true), phiDst(phi.dst) {}
-			InvariantVar(LoopInvariantOptimizer &parent, size_t index, Block *block, std::list<Instruction>::iterator insn) :
+			InvariantVar(LoopInvariantOptimizer &parent, size_t index, Block *block, InsList::iterator insn) :
 				Invariant(parent, index), block(block), insn(insn), isPhi(false) {}
 
 			static InvariantVar *construct(LoopInvariantOptimizer &parent, Block *block, const Block::PhiIns &phi)
 			{
 				parent.vInvar.emplace_back(new InvariantVar(parent, parent.vInvar.size(), block, phi));
 				InvariantVar *ptr = dynamic_cast<InvariantVar *>(parent.vInvar.back().get());
-				parent.mapVar[ptr->phiDst] = ptr->index;
+				parent.setVarInvar(ptr->phiDst, ptr->index);
 				return ptr;
 			}
-			static InvariantVar *construct(LoopInvariantOptimizer &parent, Block *block, std::list<Instruction>::iterator insn)
+			static InvariantVar *construct(LoopInvariantOptimizer &parent, Block *block, InsList::iterator insn)
 			{
 				parent.vInvar.emplace_back(new InvariantVar(parent, parent.vInvar.size(), block, insn)); 
 				InvariantVar *ptr = dynamic_cast<InvariantVar *>(parent.vInvar.back().get());
-				parent.mapVar[ptr->insn->dst] = ptr->index;
+				parent.setVarInvar(ptr->insn->dst, ptr->index);
 				return ptr;
 			}
 
@@ -108,23 +110,40 @@ namespace MxIR
 		};
 
 	protected:
-		void computeMaxVer();
 		void createInvars(const loop &lp);
-		void protectDivisor(Block *block, std::list<Instruction>::iterator insn);
+		void protectDivisor(Block *block, InsList::iterator insn);
+
+		//per-value state of the current loop, kept in flat vectors indexed by SSA value id
+		size_t varInvar(const Operand &operand) const
+		{
+			size_t id = index.id(operand);
+			return id < mapVar.size() ? mapVar[id] : size_t(-1);
+		}
+		bool isVarFailed(const Operand &operand) const
+		{
+			size_t id = index.id(operand);
+			return id < failedVar.size() && failedVar[id];
+		}
+		void setVarInvar(const Operand &operand, size_t invar);
+		void setVarFailed(const Operand &operand);
+		void clearVars();
 
 	protected:
 		Function &func;
+		FunctionAnalysis &analysis;
 		MxProgram *program;
 		std::vector<std::unique_ptr<Invariant>> vInvar;
-		std::map<Operand, size_t> mapVar;
+		SSAValueIndex index;
+		std::vector<size_t> mapVar;		//value id -> invariant, size_t(-1) if none
+		std::vector<size_t> touchedVar;
 		std::map<PSTNode *, size_t> mapRegion;
 
 		Block *insertPoint;
 
-		std::set<Operand> failedVar;
+		std::vector<bool> failedVar;
 		std::set<Block *> failedBlock;
 
-		std::map<size_t, size_t> maxVer;
+		size_t nextReg;		//first unused register id
 
 		std::vector<loop> loops;
 		std::multimap<Block *, size_t> loopID;
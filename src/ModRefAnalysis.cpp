@@ -0,0 +1,154 @@
+#include "common_headers.h"
+#include "ModRefAnalysis.h"
+#include "FunctionAnalysis.h"
+#include "CompileStats.h"
+#include "utils/DepGraph.h"
+
+namespace MxIR
+{
+	void ModRefAnalysis::work()
+	{
+		size_t nFunc = program->vFuncs.size();
+		callee.assign(nFunc, std::set<size_t>());
+		hasLoop.assign(nFunc, false);
+		std::vector<MxProgram::modRefInfo> local(nFunc);
+		DepGraph callGraph(nFunc);
+		for (size_t i = 0; i < nFunc; i++)
+		{
+			MxProgram::funcInfo &finfo = program->vFuncs[i];
+			if (finfo.attribute & Builtin)
+			{
+				finfo.modRef = builtinModRef(finfo.attribute);
+				continue;
+			}
+			local[i] = analyzeFunc(i);
+			for (size_t v : callee[i])
+				callGraph.link(i, v);
+		}
+		callGraph.work();
+
+		size_t nPure = 0, nConst = 0;
+		for (size_t c = 0; c < callGraph.getGroupCount(); c++)
+		{
+			const std::vector<size_t> &members = callGraph.getVertex(c);
+			if (program->vFuncs[members[0]].attribute & Builtin)
+				continue;
+			MxProgram::modRefInfo summary = noEffect();
+			bool linear = !callGraph.isCyclic(c);
+			bool mayTrap = false;
+			for (size_t w : members)
+			{
+				merge(summary, local[w]);
+				linear = linear && !hasLoop[w];
+				for (size_t v : callee[w])
+				{
+					if (callGraph.getGroup(v) == c)
+						continue;
+					merge(summary, program->vFuncs[v].modRef);
+					linear = linear && (program->vFuncs[v].attribute & (Linear | Builtin));
+					mayTrap = mayTrap || (program->vFuncs[v].attribute & MayTrap);
+				}
+			}
+			for (size_t w : members)
+			{
+				MxProgram::funcInfo &finfo = program->vFuncs[w];
+				finfo.modRef = summary;
+				if (mayTrap)
+					finfo.attribute |= MayTrap;
+				if (!linear)
+					continue;
+				finfo.attribute |= Linear;
+				if (summary.mayWrite())
+					continue;
+				finfo.attribute |= NoSideEffect;
+				nPure++;
+				if (summary.mayRead())
+					continue;
+				finfo.attribute |= ConstExpr;
+				nConst++;
+			}
+		}
+		CompileStats::count("pure_funcs", nPure);
+		CompileStats::count("const_funcs", nConst);
+	}
+
+	MxProgram::modRefInfo ModRefAnalysis::analyzeFunc(size_t idx)
+	{
+		MxProgram::modRefInfo info = noEffect();
+		bool opaque = false;
+		FunctionAnalysis analysis(program->vFuncs[idx].content);
+		hasLoop[idx] = !analysis.loops().empty();
+		for (Block *block : analysis.blocks())
+		{
+			for (auto &ins : block->ins)
+			{
+				if (ins.oper == Call)
+				{
+					if (ins.src1.type == Operand::funcID)
+						callee[idx].insert(ins.src1.val);
+					else
+						opaque = true;
+				}
+				else if (ins.oper == Load || ins.oper == LoadA)
+				{
+					if (ins.oper == Load && ins.src1.type == Operand::globalVarID)
+						info.readGlobals.insert(ins.src1.val);
+					else if (ins.src1.type != Operand::constID)
+						info.readMemory = true;
+				}
+				else if (ins.oper == Store || ins.oper == StoreA)
+				{
+					if (ins.oper == Store && ins.src1.type == Operand::globalVarID)
+						info.writeGlobals.insert(ins.src1.val);
+					else
+						info.writeMemory = true;
+				}
+
+				//a global var or a function used as a value may be accessed anywhere
+				std::vector<const Operand *> operands = { &ins.dst, &ins.src2 };
+				if (ins.oper != Call && ins.oper != Load && ins.oper != Store)
+					operands.push_back(&ins.src1);
+				for (const Operand &operand : ins.paramExt)
+					operands.push_back(&operand);
+				for (const Operand *operand : operands)
+				{
+					if (operand->type == Operand::globalVarID || operand->type == Operand::funcID)
+						opaque = true;
+				}
+			}
+		}
+		return opaque ? MxProgram::modRefInfo() : info;
+	}
+
+	MxProgram::modRefInfo ModRefAnalysis::noEffect()
+	{
+		MxProgram::modRefInfo info;
+		info.readMemory = info.writeMemory = false;
+		info.readAllGlobals = info.writeAllGlobals = false;
+		return info;
+	}
+
+	//builtins never touch the global vars of the program
+	MxProgram::modRefInfo ModRefAnalysis::builtinModRef(std::uint32_t attribute)
+	{
+		if (!(attribute & NoSideEffect))
+			return MxProgram::modRefInfo();
+		MxProgram::modRefInfo info = noEffect();
+		info.readMemory = !(attribute & ConstExpr);
+		return info;
+	}
+
+	void ModRefAnalysis::merge(MxProgram::modRefInfo &dst, const MxProgram::modRefInfo &src)
+	{
+		dst.readMemory = dst.readMemory || src.readMemory;
+		dst.writeMemory = dst.writeMemory || src.writeMemory;
+		dst.readAllGlobals = dst.readAllGlobals || src.readAllGlobals;
+		dst.writeAllGlobals = dst.writeAllGlobals || src.writeAllGlobals;
+		dst.readGlobals.insert(src.readGlobals.begin(), src.readGlobals.end());
+		dst.writeGlobals.insert(src.writeGlobals.begin(), src.writeGlobals.end());
+		if (dst.readAllGlobals)
+			dst.readGlobals.clear();
+		if (dst.writeAllGlobals)
+			dst.writeGlobals.clear();
+	}
+}
@@ -0,0 +1,33 @@
+#ifndef MX_COMPILER_MOD_REF_ANALYSIS_H
+#define MX_COMPILER_MOD_REF_ANALYSIS_H
+
+#include "common.h"
+#include "MxProgram.h"
+
+namespace MxIR
+{
+	//Interprocedural mod/ref analysis: summarizes the memory and the global variables each function may read or write,
+	//visiting the strongly connected components of the call graph callees first.
+	//A user function that always returns and writes nothing becomes NoSideEffect, and ConstExpr if it reads nothing either.
+	//A user function that calls one that may trap is marked MayTrap, so that its calls are not hoisted.
+	class ModRefAnalysis
+	{
+	public:
+		ModRefAnalysis() : program(MxProgram::getDefault()) {}
+		ModRefAnalysis(MxProgram *program) : program(program) {}
+		void work();
+
+	protected:
+		MxProgram::modRefInfo analyzeFunc(size_t idx);	//the effects of the function itself, without its callees
+		static MxProgram::modRefInfo noEffect();
+		static MxProgram::modRefInfo builtinModRef(std::uint32_t attribute);
+		static void merge(MxProgram::modRefInfo &dst, const MxProgram::modRefInfo &src);
+
+	protected:
+		MxProgram *program;
+		std::vector<std::set<size_t>> callee;
+		std::vector<bool> hasLoop;
+	};
+}
+
+#endif
@@ -37,11 +37,11 @@ void MxBuiltin::fillBuiltinSymbol()
 		"print", "println", "getString", 
 		"getInt", "toString", "length", 
 		"substring", "parseInt", "ord", "size", "$string", "$array", 
-		"strcmp", "malloc", "free", "realloc", "scanf", "puts", "printf", "putchar", "getchar", "snprintf", "strlen", "memcpy", "sscanf", "fputs", "stderr", "exit", "memset",
+		"strcmp", "malloc", "free", "realloc", "scanf", "puts", "printf", "putchar", "getchar", "snprintf", "strlen", "memcpy", "sscanf", "fputs", "stderr", "exit", "memset", "mmap",
 		"__runtime_error", "__strcat", "__strcmp", "__subscript_bool", "__subscript_int", "__subscript_object", "__newobject",
 		"__release_string", "__release_array_internal", "__release_array_string", "__release_array_object",
 		"__release_object", "__addref_object", "__newobject_zero",
-		"__initialize" };
+		"__initialize", "__alloc", "__dealloc", "__heap" };
 	for (size_t i = 0; i < symbol->vSymbol.size(); i++)
 		symbol->mapSymbol.insert({ symbol->vSymbol[i], i });
 }
@@ -58,28 +58,32 @@ void MxBuiltin::fillBuiltinMemberTable()
 		MxProgram::funcInfo{size_t(BuiltinSymbol::length),		MxType{MxType::Integer},	{MxType{MxType::String}}, NoSideEffect | Builtin, true, {}, builtin_length()},
 		MxProgram::funcInfo{size_t(BuiltinSymbol::substring),	MxType{MxType::String},		{MxType{MxType::String}, MxType{MxType::Integer}, MxType{MxType::Integer}}, NoSideEffect | Builtin, true, {}, builtin_substring()},
 		MxProgram::funcInfo{size_t(BuiltinSymbol::parseInt),	MxType{MxType::Integer},	{MxType{MxType::String}}, NoSideEffect | Builtin, true, {}, builtin_parseInt() },
-		MxProgram::funcInfo{size_t(BuiltinSymbol::ord),			MxType{MxType::Integer},	{MxType{MxType::String}, MxType{MxType::Integer}}, NoSideEffect | Builtin, true, {}, safe ? builtin_ord_safe() : builtin_ord_unsafe() },
-		MxProgram::funcInfo{size_t(BuiltinSymbol::size),		MxType{MxType::Integer},	{MxType{MxType::Object, 0, size_t(-1)}}, NoSideEffect | Builtin, true, {}, safe ? builtin_size() : builtin_size_unsafe() },
+		MxProgram::funcInfo{size_t(BuiltinSymbol::ord),			MxType{MxType::Integer},	{MxType{MxType::String}, MxType{MxType::Integer}}, NoSideEffect | Builtin | (safe ? MayTrap : 0), true, {}, safe ? builtin_ord_safe() : builtin_ord_unsafe() },
+		MxProgram::funcInfo{size_t(BuiltinSymbol::size),		MxType{MxType::Integer},	{MxType{MxType::Object, 0, size_t(-1)}}, NoSideEffect | Builtin | (safe ? MayTrap : 0), true, {}, safe ? builtin_size() : builtin_size_unsafe() },
 		MxProgram::funcInfo{size_t(BuiltinSymbol::Hruntime_error), MxType{MxType::Void},	{MxType{MxType::Object, 0, size_t(-1)}}, Builtin | NoInline, false, {}, builtin_runtime_error()},
 		MxProgram::funcInfo{size_t(BuiltinSymbol::Hstrcat),		MxType{MxType::String},		{MxType{MxType::String}, MxType{MxType::String}}, NoSideEffect | Builtin, false, {}, builtin_strcat()},
 		MxProgram::funcInfo{size_t(BuiltinSymbol::Hstrcmp),		MxType{MxType::Integer},	{MxType{MxType::String}, MxType{MxType::String}}, NoSideEffect | Builtin, false, {}, builtin_strcmp()},
-		MxProgram::funcInfo{size_t(BuiltinSymbol::Hsubscript_bool),	MxType::Null(),				{MxType{MxType::Bool, 1}, MxType{MxType::Integer}}, NoSideEffect | ConstExpr | Builtin | ForceInline, true, {}, safe ? builtin_subscript_safe(1) : builtin_subscript_unsafe(1) },
-		MxProgram::funcInfo{size_t(BuiltinSymbol::Hsubscript_int),	MxType::Null(),				{MxType{MxType::Integer, 1 }, MxType{ MxType::Integer } }, NoSideEffect | ConstExpr | Builtin | ForceInline, true,{}, safe ? builtin_subscript_safe(4) : builtin_subscript_unsafe(4) },
-		MxProgram::funcInfo{size_t(BuiltinSymbol::Hsubscript_object),	MxType::Null(),				{ MxType{ MxType::Object, 1, size_t(-1)}, MxType{ MxType::Integer } }, NoSideEffect | ConstExpr | Builtin | ForceInline, true,{}, safe ? builtin_subscript_safe(8) : builtin_subscript_unsafe(8)},
+		MxProgram::funcInfo{size_t(BuiltinSymbol::Hsubscript_bool),	MxType::Null(),				{MxType{MxType::Bool, 1}, MxType{MxType::Integer}}, NoSideEffect | ConstExpr | Builtin | ForceInline | (safe ? MayTrap : 0), true, {}, safe ? builtin_subscript_safe(1) : builtin_subscript_unsafe(1) },
+		MxProgram::funcInfo{size_t(BuiltinSymbol::Hsubscript_int),	MxType::Null(),				{MxType{MxType::Integer, 1 }, MxType{ MxType::Integer } }, NoSideEffect | ConstExpr | Builtin | ForceInline | (safe ? MayTrap : 0), true,{}, safe ? builtin_subscript_safe(4) : builtin_subscript_unsafe(4) },
+		MxProgram::funcInfo{size_t(BuiltinSymbol::Hsubscript_object),	MxType::Null(),				{ MxType{ MxType::Object, 1, size_t(-1)}, MxType{ MxType::Integer } }, NoSideEffect | ConstExpr | Builtin | ForceInline | (safe ? MayTrap : 0), true,{}, safe ? builtin_subscript_safe(8) : builtin_subscript_unsafe(8)},
 		MxProgram::funcInfo{size_t(BuiltinSymbol::Hnewobject),	MxType::Null(),				{MxType::Null(), MxType::Null()}, Builtin, false, {}, builtin_newobject()},
 		MxProgram::funcInfo{size_t(BuiltinSymbol::Hrelease_string), MxType{MxType::Void},	{MxType{MxType::String}}, Builtin, false, {}, /*builtin_stub({ RegPtr(0) })*/builtin_release_string()},
 		MxProgram::funcInfo{size_t(BuiltinSymbol::Hrelease_array_internal), MxType{MxType::Void}, {MxType::Null()}, Builtin, false, {}, /*builtin_stub({RegPtr(0), Reg32(1)})*/ builtin_release_array(true)/*TODO*/},
 		MxProgram::funcInfo{ size_t(BuiltinSymbol::Hrelease_array_string), MxType{ MxType::Void },{ MxType::Null() }, Builtin, false,{}, builtin_stub({ RegPtr(0) })/*TODO*/ },
 		MxProgram::funcInfo{ size_t(BuiltinSymbol::Hrelease_array_object), MxType{ MxType::Void },{ MxType::Null() }, Builtin, false,{}, /*builtin_stub({ RegPtr(0), Reg32(1) })*/ builtin_release_array(false)/*TODO*/ },
-		MxProgram::funcInfo{ size_t(BuiltinSymbol::Hrelease_object), MxType{ MxType::Void },{ MxType::Null() }, Builtin, false,{}, builtin_stub({ RegPtr(0) })/*TODO*/ },
+		MxProgram::funcInfo{ size_t(BuiltinSymbol::Hrelease_object), MxType{ MxType::Void },{ MxType::Null() }, Builtin, false,{}, /*builtin_stub({ RegPtr(0) })*/ builtin_release_object()/*TODO: release the fields*/ },
 		MxProgram::funcInfo{ size_t(BuiltinSymbol::Haddref_object), MxType{ MxType::Void },{ MxType::Null() }, Builtin, false,{}, builtin_addref_object() },
 		MxProgram::funcInfo{ size_t(BuiltinSymbol::Hnewobject_zero), MxType::Null(), { MxType::Null(), MxType::Null() }, Builtin, false,{}, builtin_newobject_zero() },
 		MxProgram::funcInfo{size_t(BuiltinSymbol::Hinitialize), MxType{MxType::Void}, {}, Builtin, false, {}},
+		MxProgram::funcInfo{ size_t(BuiltinSymbol::Halloc), MxType::Null(), { MxType::Null() }, Builtin | NoInline, false,{}, builtin_alloc() },
+		MxProgram::funcInfo{ size_t(BuiltinSymbol::Hdealloc), MxType{ MxType::Void },{ MxType::Null() }, Builtin | NoInline, false,{}, builtin_dealloc() },
 	};
 	for (size_t i = size_t(BuiltinFunc::print); i <= size_t(BuiltinFunc::size); i++)
 		program->vOverloadedFuncs.push_back({ i });
 	for (size_t i = size_t(BuiltinFunc::print); i <= size_t(BuiltinFunc::toString); i++)
 		program->vGlobalVars.push_back(MxProgram::varInfo{ i, MxType{MxType::Function, 0, size_t(-1), i} });
+	assert(program->vGlobalVars.size() == size_t(BuiltinVar::heap));
+	program->vGlobalVars.push_back(MxProgram::varInfo{ size_t(BuiltinSymbol::Hheap), MxType::Null() });
 
 	program->vClass.insert({ 0, { size_t(BuiltinClass::string), std::vector<MxProgram::varInfo>() } });
 	for (size_t i = size_t(BuiltinFunc::length); i <= size_t(BuiltinFunc::ord); i++)
@@ -113,6 +117,8 @@ size_t MxBuiltin::getBuiltinClassByType(MxType type)
 
 Function MxBuiltin::builtin_print()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[4];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -136,7 +142,6 @@ Function MxBuiltin::builtin_print()
 	};
 	block[2]->brTrue = block[3];
 
-	Function ret;
 	ret.params = { RegPtr(0) };
 	ret.inBlock = block[0];
 	ret.outBlock = block[3];
@@ -145,6 +150,8 @@ Function MxBuiltin::builtin_print()
 
 Function MxBuiltin::builtin_println()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[4];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -169,7 +176,6 @@ Function MxBuiltin::builtin_println()
 	};
 	block[2]->brTrue = block[3];
 
-	Function ret;
 	ret.params = { RegPtr(0) };
 	ret.inBlock = block[0];
 	ret.outBlock = block[3];
@@ -179,13 +185,15 @@ Function MxBuiltin::builtin_println()
 //FIXME: release reference before returning
 Function MxBuiltin::builtin_getString()
 {
-	static const size_t blockSize = 1024;
+	Function ret;
+	IRArena::Scope scope(ret.arena);
+	static const size_t blockSize = 96;		//fills a size class of the pool with the prefix
 	std::shared_ptr<Block> block[11];
 	for (auto &blk : block)
 		blk = Block::construct();
 
 	block[0]->ins = {
-		IRCall(RegPtr(0), IDExtSymbol(size_t(BuiltinSymbol::malloc)), {ImmPtr(objectHeader + stringHeader + blockSize)}),
+		IRCall(RegPtr(0), IDFunc(size_t(BuiltinFunc::alloc)), {ImmPtr(objectHeader + stringHeader + blockSize)}),
 		IR(RegPtr(1), Move, ImmPtr(objectHeader + stringHeader)),	//current offset
 		IR(RegPtr(2), Move, ImmPtr(objectHeader + stringHeader + blockSize)),	//size
 		IRJump(),
@@ -225,7 +233,10 @@ Function MxBuiltin::builtin_getString()
 
 	block[5]->ins = {
 		IR(RegPtr(2), Shl, RegPtr(2), ImmPtr(1)),
-		IRCall(RegPtr(0), IDExtSymbol(size_t(BuiltinSymbol::realloc)), {RegPtr(0), RegPtr(2)}),
+		IRCall(RegPtr(14), IDFunc(size_t(BuiltinFunc::alloc)), {RegPtr(2)}),
+		IRCall(EmptyOperand(), IDExtSymbol(size_t(BuiltinSymbol::memcpy)), {RegPtr(14), RegPtr(0), RegPtr(1)}),
+		IRCall(EmptyOperand(), IDFunc(size_t(BuiltinFunc::dealloc)), {RegPtr(0)}),
+		IR(RegPtr(0), Move, RegPtr(14)),
 		IRJump(),
 	};
 	block[5]->brTrue = block[1];
@@ -238,15 +249,13 @@ Function MxBuiltin::builtin_getString()
 	block[6]->brFalse = block[8];
 
 	block[7]->ins = {
-		IRCall(EmptyOperand(), IDExtSymbol(size_t(BuiltinSymbol::free)), {RegPtr(0)}),
+		IRCall(EmptyOperand(), IDFunc(size_t(BuiltinFunc::dealloc)), {RegPtr(0)}),
 		IRReturn(ImmPtr(0)),
 	};
 	block[7]->brTrue = block[10];
 
 	block[8]->ins = {
 		IRStoreA(Imm8('\0'), RegPtr(0), RegPtr(1)),
-		IR(RegPtr(10), Add, RegPtr(1), ImmPtr(1)),
-		IRCall(RegPtr(0), IDExtSymbol(size_t(BuiltinSymbol::realloc)), {RegPtr(0), RegPtr(10)}),
 		IRStore(Imm64(1), RegPtr(0)),	//TODO: Write Type ID
 		IR(RegPtr(11), Sub, RegPtr(1), ImmPtr(objectHeader + stringHeader)),	//string size = current offset - 24
 		IRStoreA(RegPtr(11), RegPtr(0), ImmPtr(objectHeader)),		//write string size
@@ -262,7 +271,6 @@ Function MxBuiltin::builtin_getString()
 	block[9]->brTrue = block[1];		//if we read ' ' or '\n' and we didn't read any other char, we can continue the process
 	block[9]->brFalse = block[8];
 
-	Function ret;
 	ret.inBlock = block[0];
 	ret.outBlock = block[10];
 	return ret;
@@ -271,6 +279,7 @@ Function MxBuiltin::builtin_getString()
 Function MxBuiltin::builtin_getInt()
 {
 	Function ret;
+	IRArena::Scope scope(ret.arena);
 	ret.inBlock = Block::construct();
 	ret.outBlock = Block::construct();
 	ret.inBlock->ins = {
@@ -286,6 +295,7 @@ Function MxBuiltin::builtin_getInt()
 Function MxBuiltin::builtin_toString()
 {
 	Function ret;
+	IRArena::Scope scope(ret.arena);
 	ret.params.push_back(Reg32(0));
 	ret.inBlock = Block::construct();
 	ret.outBlock = Block::construct();
@@ -303,6 +313,8 @@ Function MxBuiltin::builtin_toString()
 
 Function MxBuiltin::builtin_length()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[4];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -325,7 +337,6 @@ Function MxBuiltin::builtin_length()
 	};
 	block[2]->brTrue = block[3];
 
-	Function ret;
 	ret.params.push_back(RegPtr(0));
 	ret.inBlock = block[0];
 	ret.outBlock = block[3];
@@ -334,6 +345,8 @@ Function MxBuiltin::builtin_length()
 
 Function MxBuiltin::builtin_substring()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[10];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -411,7 +424,6 @@ Function MxBuiltin::builtin_substring()
 	};
 	block[8]->brTrue = block[9];
 
-	Function ret;
 	ret.params = { RegPtr(0), Reg32(1), Reg32(2) };
 	ret.inBlock = block[0];
 	ret.outBlock = block[9];
@@ -420,6 +432,8 @@ Function MxBuiltin::builtin_substring()
 
 Function MxBuiltin::builtin_parseInt()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[4];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -445,7 +459,6 @@ Function MxBuiltin::builtin_parseInt()
 	};
 	block[2]->brTrue = block[3];
 
-	Function ret;
 	ret.params = { RegPtr(0) };
 	ret.inBlock = block[0];
 	ret.outBlock = block[3];
@@ -454,6 +467,8 @@ Function MxBuiltin::builtin_parseInt()
 
 Function MxBuiltin::builtin_ord_safe()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[6];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -498,7 +513,6 @@ Function MxBuiltin::builtin_ord_safe()
 	};
 	block[4]->brTrue = block[5];
 
-	Function ret;
 	ret.params = { RegPtr(0), Reg32(1) };
 	ret.inBlock = block[0];
 	ret.outBlock = block[5];
@@ -508,6 +522,7 @@ Function MxBuiltin::builtin_ord_safe()
 Function MxBuiltin::builtin_ord_unsafe()
 {
 	Function ret;
+	IRArena::Scope scope(ret.arena);
 	ret.inBlock = Block::construct();
 	ret.outBlock = Block::construct();
 	ret.params = { RegPtr(0), Reg32(1) };
@@ -524,6 +539,8 @@ Function MxBuiltin::builtin_ord_unsafe()
 
 Function MxBuiltin::builtin_size()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[4];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -549,7 +566,6 @@ Function MxBuiltin::builtin_size()
 	};
 	block[2]->brTrue = block[3];
 
-	Function ret;
 	ret.params = { RegPtr(0) };
 	ret.inBlock = block[0];
 	ret.outBlock = block[3];
@@ -559,6 +575,7 @@ Function MxBuiltin::builtin_size()
 Function MxBuiltin::builtin_size_unsafe()
 {
 	Function ret;
+	IRArena::Scope scope(ret.arena);
 	ret.params = { RegPtr(0) };
 	ret.inBlock = Block::construct();
 	ret.outBlock = Block::construct();
@@ -573,6 +590,7 @@ Function MxBuiltin::builtin_size_unsafe()
 Function MxBuiltin::builtin_runtime_error()
 {
 	Function ret;
+	IRArena::Scope scope(ret.arena);
 	ret.params = { RegPtr(0) };
 	ret.inBlock = Block::construct();
 	ret.outBlock = Block::construct();
@@ -590,6 +608,8 @@ Function MxBuiltin::builtin_runtime_error()
 
 Function MxBuiltin::builtin_strcat()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[8];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -658,7 +678,6 @@ Function MxBuiltin::builtin_strcat()
 	};
 	block[6]->brTrue = block[7];
 
-	Function ret;
 	ret.params = { RegPtr(0), RegPtr(1) };
 	ret.inBlock = block[0];
 	ret.outBlock = block[7];
@@ -667,6 +686,8 @@ Function MxBuiltin::builtin_strcat()
 
 Function MxBuiltin::builtin_strcmp()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[8];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -715,7 +736,6 @@ Function MxBuiltin::builtin_strcmp()
 	};
 	block[6]->brTrue = block[7];
 
-	Function ret;
 	ret.params = { RegPtr(0), RegPtr(1) };
 	ret.inBlock = block[0];
 	ret.outBlock = block[7];
@@ -724,6 +744,8 @@ Function MxBuiltin::builtin_strcmp()
 
 Function MxBuiltin::builtin_subscript_safe(size_t size)
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	assert(size == 1 || size == 2 || size == 4 || size == 8);
 
 	std::shared_ptr<Block> block[6];
@@ -767,7 +789,6 @@ Function MxBuiltin::builtin_subscript_safe(size_t size)
 	};
 	block[4]->brTrue = block[5];
 
-	Function ret;
 	ret.params = { RegPtr(0), Reg32(1) };
 	ret.inBlock = block[0];
 	ret.outBlock = block[5];
@@ -777,6 +798,7 @@ Function MxBuiltin::builtin_subscript_safe(size_t size)
 Function MxBuiltin::builtin_subscript_unsafe(size_t size)
 {
 	Function ret;
+	IRArena::Scope scope(ret.arena);
 	ret.params = { RegPtr(0), Reg32(1) };
 	ret.inBlock = Block::construct();
 	ret.outBlock = Block::construct();
@@ -793,76 +815,215 @@ Function MxBuiltin::builtin_subscript_unsafe(size_t size)
 
 Function MxBuiltin::builtin_newobject()
 {
-	std::shared_ptr<Block> block[4];
+	Function ret;
+	IRArena::Scope scope(ret.arena);
+	ret.inBlock = Block::construct();
+	ret.outBlock = Block::construct();
+	ret.inBlock->ins = {
+		IR(RegPtr(0), Add, RegPtr(0), ImmPtr(objectHeader)),		//actual size = object size + object header
+		IRCall(RegPtr(2), IDFunc(size_t(BuiltinFunc::alloc)), {RegPtr(0)}),		//never returns null
+		IRStore(ImmPtr(1), RegPtr(2)),	//reference count
+		IRStoreA(RegPtr(1), RegPtr(2), ImmPtr(POINTER_SIZE)),	//type id
+		IR(RegPtr(4), Add, RegPtr(2), ImmPtr(objectHeader)),	//return the address of the object (header not included)
+		IRReturn(RegPtr(4)),
+		// ********  ********  **......
+		// ^refcount ^typeid   ^actual return address
+	};
+	ret.inBlock->brTrue = ret.outBlock;
+	ret.params = { RegPtr(0), RegPtr(1) };
+	return ret;
+}
+
+MxIR::Function MxBuiltin::builtin_newobject_zero()
+{
+	Function ret;
+	IRArena::Scope scope(ret.arena);
+	ret.inBlock = Block::construct();
+	ret.outBlock = Block::construct();
+	ret.inBlock->ins = {
+		IRCall(RegPtr(2), IDFunc(size_t(BuiltinFunc::newobject)), {RegPtr(0), RegPtr(1)}),		//never returns null
+		IRCall(EmptyOperand(), IDExtSymbol(size_t(BuiltinSymbol::memset)), {RegPtr(2), Imm32(0), RegPtr(0)}),
+		IRReturn(RegPtr(2)),
+	};
+	ret.inBlock->brTrue = ret.outBlock;
+	ret.params = { RegPtr(0), RegPtr(1) };
+	return ret;
+}
+
+//the pool starts the first slab: the bump pointer, the end of the slab, and the free list of each size class
+MxIR::Function MxBuiltin::builtin_alloc()
+{
+	static const size_t stateSize = 2 * POINTER_SIZE + poolClassCount * POINTER_SIZE;
+	Function ret;
+	IRArena::Scope scope(ret.arena);
+	std::shared_ptr<Block> block[14];
 	for (auto &blk : block)
 		blk = Block::construct();
+	auto mmapSlab = [](const Operand &dst)		//mmap(0, poolSlabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+	{
+		return IRCall(dst, IDExtSymbol(size_t(BuiltinSymbol::mmap)), { ImmPtr(0), ImmPtr(poolSlabSize), Imm32(0x3), Imm32(0x22), Imm32(-1), ImmPtr(0) });
+	};
 
 	block[0]->ins = {
-		IR(RegPtr(0), Add, RegPtr(0), ImmPtr(objectHeader)),		//actual size = object size + object header
-		IRCall(RegPtr(2), IDExtSymbol(size_t(BuiltinSymbol::malloc)), {RegPtr(0)}),
-		IR(Reg8(3), Seq, RegPtr(2), ImmPtr(0)),
-		IRBranch(Reg8(3), unlikely),
+		IR(RegPtr(1), Load, IDGlobalVar(size_t(BuiltinVar::heap))),
+		IR(Reg8(2), Seq, RegPtr(1), ImmPtr(0)),
+		IRBranch(Reg8(2), unlikely),
 	};
 	block[0]->brTrue = block[1];
-	block[0]->brFalse = block[2];
+	block[0]->brFalse = block[3];
 
 	block[1]->ins = {
-		IRCall(EmptyOperand(), IDFunc(size_t(BuiltinFunc::runtime_error)), {IDConst(size_t(BuiltinConst::bad_allocation))}),
-		IRReturn(ImmPtr(0)),
+		mmapSlab(RegPtr(3)),
+		IR(Reg8(4), Seq, RegPtr(3), ImmPtr(-1)),
+		IRBranch(Reg8(4), unlikely),
 	};
-	block[1]->brTrue = block[3];
+	block[1]->brTrue = block[12];
+	block[1]->brFalse = block[2];
 
 	block[2]->ins = {
-		IRStore(ImmPtr(1), RegPtr(2)),	//reference count
-		IRStoreA(RegPtr(1), RegPtr(2), ImmPtr(POINTER_SIZE)),	//type id
-		IR(RegPtr(4), Add, RegPtr(2), ImmPtr(objectHeader)),	//return the address of the object (header not included)
-		IRReturn(RegPtr(4)),
-		// ********  ********  **......
-		// ^refcount ^typeid   ^actual return address
+		IRStore(RegPtr(3), IDGlobalVar(size_t(BuiltinVar::heap))),
+		IR(RegPtr(1), Move, RegPtr(3)),
+		IR(RegPtr(5), Add, RegPtr(3), ImmPtr(stateSize)),
+		IRStore(RegPtr(5), RegPtr(1)),
+		IR(RegPtr(6), Add, RegPtr(3), ImmPtr(poolSlabSize)),
+		IRStoreA(RegPtr(6), RegPtr(1), ImmPtr(POINTER_SIZE)),
+		IRJump(),
 	};
 	block[2]->brTrue = block[3];
 
-	Function ret;
-	ret.params = { RegPtr(0), RegPtr(1) };
+	block[3]->ins = {
+		IR(RegPtr(7), Add, RegPtr(0), ImmPtr(POINTER_SIZE + poolGranularity - 1)),	//%7: size class, counting the prefix
+		IR(RegPtr(7), Shru, RegPtr(7), ImmPtr(4)),
+		IR(Reg8(8), Sgtu, RegPtr(7), ImmPtr(poolClassCount)),
+		IRBranch(Reg8(8), unlikely),
+	};
+	block[3]->brTrue = block[10];
+	block[3]->brFalse = block[4];
+
+	block[4]->ins = {
+		IR(RegPtr(9), Shl, RegPtr(7), ImmPtr(3)),
+		IR(RegPtr(9), Add, RegPtr(9), RegPtr(1)),		//%9 + 8: head of the free list
+		IR(RegPtr(10), LoadA, RegPtr(9), ImmPtr(POINTER_SIZE)),
+		IR(Reg8(11), Seq, RegPtr(10), ImmPtr(0)),
+		IRBranch(Reg8(11)),
+	};
+	block[4]->brTrue = block[6];
+	block[4]->brFalse = block[5];
+
+	block[5]->ins = {	//a free block stores the next one where the object starts
+		IR(RegPtr(12), Load, RegPtr(10)),
+		IRStoreA(RegPtr(12), RegPtr(9), ImmPtr(POINTER_SIZE)),
+		IRReturn(RegPtr(10)),
+	};
+	block[5]->brTrue = block[13];
+
+	block[6]->ins = {
+		IR(RegPtr(13), Load, RegPtr(1)),
+		IR(RegPtr(14), Shl, RegPtr(7), ImmPtr(4)),
+		IR(RegPtr(15), Add, RegPtr(13), RegPtr(14)),
+		IR(RegPtr(16), LoadA, RegPtr(1), ImmPtr(POINTER_SIZE)),
+		IR(Reg8(17), Sgtu, RegPtr(15), RegPtr(16)),
+		IRBranch(Reg8(17), unlikely),
+	};
+	block[6]->brTrue = block[8];
+	block[6]->brFalse = block[7];
+
+	block[7]->ins = {
+		IRStore(RegPtr(15), RegPtr(1)),
+		IRStore(RegPtr(7), RegPtr(13)),
+		IR(RegPtr(18), Add, RegPtr(13), ImmPtr(POINTER_SIZE)),
+		IRReturn(RegPtr(18)),
+	};
+	block[7]->brTrue = block[13];
+
+	block[8]->ins = {	//the rest of a full slab is left unused
+		mmapSlab(RegPtr(3)),
+		IR(Reg8(4), Seq, RegPtr(3), ImmPtr(-1)),
+		IRBranch(Reg8(4), unlikely),
+	};
+	block[8]->brTrue = block[12];
+	block[8]->brFalse = block[9];
+
+	block[9]->ins = {
+		IRStore(RegPtr(3), RegPtr(1)),
+		IR(RegPtr(6), Add, RegPtr(3), ImmPtr(poolSlabSize)),
+		IRStoreA(RegPtr(6), RegPtr(1), ImmPtr(POINTER_SIZE)),
+		IRJump(),
+	};
+	block[9]->brTrue = block[6];
+
+	block[10]->ins = {
+		IR(RegPtr(19), Add, RegPtr(0), ImmPtr(POINTER_SIZE)),
+		IRCall(RegPtr(20), IDExtSymbol(size_t(BuiltinSymbol::malloc)), {RegPtr(19)}),
+		IR(Reg8(21), Seq, RegPtr(20), ImmPtr(0)),
+		IRBranch(Reg8(21), unlikely),
+	};
+	block[10]->brTrue = block[12];
+	block[10]->brFalse = block[11];
+
+	block[11]->ins = {
+		IRStore(ImmPtr(0), RegPtr(20)),
+		IR(RegPtr(22), Add, RegPtr(20), ImmPtr(POINTER_SIZE)),
+		IRReturn(RegPtr(22)),
+	};
+	block[11]->brTrue = block[13];
+
+	block[12]->ins = {
+		IRCall(EmptyOperand(), IDFunc(size_t(BuiltinFunc::runtime_error)), {IDConst(size_t(BuiltinConst::bad_allocation))}),
+		IRReturn(ImmPtr(0)),
+	};
+	block[12]->brTrue = block[13];
+
 	ret.inBlock = block[0];
-	ret.outBlock = block[3];
+	ret.outBlock = block[13];
+	ret.params = { RegPtr(0) };
 	return ret;
 }
 
-MxIR::Function MxBuiltin::builtin_newobject_zero()
+MxIR::Function MxBuiltin::builtin_dealloc()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[4];
 	for (auto &blk : block)
 		blk = Block::construct();
 
 	block[0]->ins = {
-		IRCall(RegPtr(2), IDFunc(size_t(BuiltinFunc::newobject)), {RegPtr(0), RegPtr(1)}),
+		IR(RegPtr(1), Sub, RegPtr(0), ImmPtr(POINTER_SIZE)),
+		IR(RegPtr(2), Load, RegPtr(1)),
 		IR(Reg8(3), Seq, RegPtr(2), ImmPtr(0)),
 		IRBranch(Reg8(3), unlikely),
 	};
-	block[0]->brTrue = block[1];
-	block[0]->brFalse = block[2];
+	block[0]->brTrue = block[2];
+	block[0]->brFalse = block[1];
 
 	block[1]->ins = {
-		IRReturn(ImmPtr(0)),
+		IR(RegPtr(4), Load, IDGlobalVar(size_t(BuiltinVar::heap))),
+		IR(RegPtr(5), Shl, RegPtr(2), ImmPtr(3)),
+		IR(RegPtr(5), Add, RegPtr(5), RegPtr(4)),
+		IR(RegPtr(6), LoadA, RegPtr(5), ImmPtr(POINTER_SIZE)),
+		IRStore(RegPtr(6), RegPtr(0)),
+		IRStoreA(RegPtr(0), RegPtr(5), ImmPtr(POINTER_SIZE)),
+		IRReturn(),
 	};
 	block[1]->brTrue = block[3];
 
 	block[2]->ins = {
-		IRCall(EmptyOperand(), IDExtSymbol(size_t(BuiltinSymbol::memset)), {RegPtr(2), Imm32(0), RegPtr(0)}),
-		IRReturn(RegPtr(2)),
+		IRCall(EmptyOperand(), IDExtSymbol(size_t(BuiltinSymbol::free)), {RegPtr(1)}),
+		IRReturn(),
 	};
 	block[2]->brTrue = block[3];
 
-	Function ret;
-	ret.params = { RegPtr(0), RegPtr(1) };
 	ret.inBlock = block[0];
 	ret.outBlock = block[3];
+	ret.params = { RegPtr(0) };
 	return ret;
 }
 
 MxIR::Function MxBuiltin::builtin_addref_object()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[5];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -894,7 +1055,6 @@ MxIR::Function MxBuiltin::builtin_addref_object()
 	};
 	block[3]->brTrue = block[4];
 
-	Function ret;
 	ret.inBlock = block[0];
 	ret.outBlock = block[4];
 	ret.params = { RegPtr(0) };
@@ -903,6 +1063,8 @@ MxIR::Function MxBuiltin::builtin_addref_object()
 
 MxIR::Function MxBuiltin::builtin_release_string()
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[6];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -933,7 +1095,7 @@ MxIR::Function MxBuiltin::builtin_release_string()
 	block[2]->brFalse = block[4];
 
 	block[3]->ins = {
-		IRCall(EmptyOperand(), IDExtSymbol(size_t(BuiltinSymbol::free)), {RegPtr(1)}),
+		IRCall(EmptyOperand(), IDFunc(size_t(BuiltinFunc::dealloc)), {RegPtr(1)}),
 		IRReturn(),
 	};
 	block[3]->brTrue = block[5];
@@ -943,7 +1105,57 @@ MxIR::Function MxBuiltin::builtin_release_string()
 	};
 	block[4]->brTrue = block[5];
 
+	ret.inBlock = block[0];
+	ret.outBlock = block[5];
+	ret.params = { RegPtr(0) };
+	return ret;
+}
+
+//the type id is not filled in yet, so the fields of the object are not released with it
+MxIR::Function MxBuiltin::builtin_release_object()
+{
 	Function ret;
+	IRArena::Scope scope(ret.arena);
+	std::shared_ptr<Block> block[6];
+	for (auto &blk : block)
+		blk = Block::construct();
+
+	block[0]->ins = {
+		IR(Reg8(6), Sne, RegPtr(0), ImmPtr(0)),
+		IRBranch(Reg8(6), likely),
+	};
+	block[0]->brTrue = block[1];
+	block[0]->brFalse = block[4];
+
+	block[1]->ins = {
+		IR(RegPtr(1), Sub, RegPtr(0), ImmPtr(objectHeader)),
+		IR(RegPtr(2), Load, RegPtr(1)),
+		IR(Reg8(3), Sne, RegPtr(2), ImmPtr(-1)),
+		IRBranch(Reg8(3)),
+	};
+	block[1]->brTrue = block[2];
+	block[1]->brFalse = block[4];
+
+	block[2]->ins = {
+		IR(RegPtr(4), Sub, RegPtr(2), ImmPtr(1)),
+		IRStore(RegPtr(4), RegPtr(1)),
+		IR(Reg8(5), Seq, RegPtr(4), ImmPtr(0)),
+		IRBranch(Reg8(5)),
+	};
+	block[2]->brTrue = block[3];
+	block[2]->brFalse = block[4];
+
+	block[3]->ins = {
+		IRCall(EmptyOperand(), IDFunc(size_t(BuiltinFunc::dealloc)), {RegPtr(1)}),
+		IRReturn(),
+	};
+	block[3]->brTrue = block[5];
+
+	block[4]->ins = {
+		IRReturn(),
+	};
+	block[4]->brTrue = block[5];
+
 	ret.inBlock = block[0];
 	ret.outBlock = block[5];
 	ret.params = { RegPtr(0) };
@@ -952,6 +1164,8 @@ MxIR::Function MxBuiltin::builtin_release_string()
 
 MxIR::Function MxBuiltin::builtin_release_array(bool internal)
 {
+	Function ret;
+	IRArena::Scope scope(ret.arena);
 	std::shared_ptr<Block> block[10];
 	for (auto &blk : block)
 		blk = Block::construct();
@@ -1019,12 +1233,11 @@ MxIR::Function MxBuiltin::builtin_release_array(bool internal)
 
 	block[5]->ins = {
 		IR(RegPtr(8), Sub, RegPtr(0), ImmPtr(objectHeader)),
-		IRCall(EmptyOperand(), IDExtSymbol(size_t(BuiltinSymbol::free)), {RegPtr(8)}),
+		IRCall(EmptyOperand(), IDFunc(size_t(BuiltinFunc::dealloc)), {RegPtr(8)}),
 		IRReturn(),
 	};
 	block[5]->brTrue = block[6];
 
-	Function ret;
 	ret.inBlock = block[7];
 	ret.outBlock = block[6];
 	ret.params = { RegPtr(0), Reg32(1) };
@@ -1034,6 +1247,7 @@ MxIR::Function MxBuiltin::builtin_release_array(bool internal)
 MxIR::Function MxBuiltin::builtin_stub(const std::vector<Operand> &param)
 {
 	Function ret;
+	IRArena::Scope scope(ret.arena);
 	ret.inBlock = Block::construct();
 	ret.outBlock = Block::construct();
 	ret.inBlock->ins = { IRReturn() };
@@ -36,6 +36,8 @@ public:
 		addref_object = 22,			//void __addref_object(object)
 		newobject_zero = 23,		//object __newobject_zero(size_t size, size_t typeid) //new object and memset to zero
 		initialize = 24,			//void __initialize()
+		alloc = 25,					//ptr __alloc(size_t size)
+		dealloc = 26,				//void __dealloc(ptr)
 	};
 
 public:
@@ -82,6 +84,7 @@ protected:
 		Stderr,		//stderr
 		exit,
 		memset,
+		mmap,
 
 		Hruntime_error,
 		Hstrcat,
@@ -99,7 +102,12 @@ protected:
 		Hnewobject_zero,
 
 		Hinitialize,
+		Halloc,
+		Hdealloc,
+		Hheap,
 	};
+
+public:
 	enum class BuiltinConst : size_t
 	{
 		Percent_d = 0,		//"%d"
@@ -110,6 +118,10 @@ protected:
 		line_break = 5,		//"\n"
 		Percend_s = 6,
 	};
+	enum class BuiltinVar : size_t
+	{
+		heap = 5,			//the state of the pooled allocator
+	};
 	enum class BuiltinClass : size_t
 	{
 		string = 10,
@@ -138,9 +150,12 @@ protected:
 	MxIR::Function builtin_subscript_unsafe(size_t size);
 	MxIR::Function builtin_newobject();
 	MxIR::Function builtin_newobject_zero();
+	MxIR::Function builtin_alloc();
+	MxIR::Function builtin_dealloc();
 
 	MxIR::Function builtin_addref_object();
 	MxIR::Function builtin_release_string();
+	MxIR::Function builtin_release_object();
 	MxIR::Function builtin_release_array(bool internal);
 
 	MxIR::Function builtin_stub(const std::vector<MxIR::Operand> &param);
@@ -149,8 +164,13 @@ protected:
 	GlobalSymbol *symbol;
 	MxProgram *program;
 	static MxBuiltin *defBI;
+
+public:
 	static const size_t objectHeader = 2 * POINTER_SIZE;
 	static const size_t stringHeader = POINTER_SIZE, arrayHeader = POINTER_SIZE;
+	//__alloc carves blocks of 16-byte size classes from mmap'd slabs and reuses them through a free list per class;
+	//the word before each block holds its class, or 0 for the larger blocks taken from malloc
+	static const size_t poolGranularity = 16, poolClassCount = 32, poolSlabSize = 1 << 20;
 };
 
 #endif
\ No newline at end of file
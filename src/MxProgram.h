@@ -8,16 +8,28 @@ enum FuncAttribute : std::uint32_t
 {
 	NoSideEffect = 1,
 	ConstExpr = 2,		//No global var read/write
-	Linear = 4,			//No cycle
+	Linear = 4,			//No cycle: no loop and no recursion, so a call always returns
 	Builtin = 8,
 	ForceInline = 16,
 	NoInline = 32,
 	Export = 64,		//use 'global' to export in NASM; export name is the same as funcName; multiple export function with the same name is not allowed
+	MayTrap = 128,		//may stop the program with a runtime error, so a call can not be moved to where it would not run
 };
 
 class MxProgram
 {
 public:
+	//the memory a call may read or write, filled in by ModRefAnalysis; the default allows anything
+	struct modRefInfo
+	{
+		bool readMemory = true, writeMemory = true;		//memory reached through pointers
+		bool readAllGlobals = true, writeAllGlobals = true;
+		std::set<size_t> readGlobals, writeGlobals;		//global var IDs, when not all of them
+
+		bool mayWriteGlobal(size_t varID) const { return writeAllGlobals || writeGlobals.count(varID); }
+		bool mayWrite() const { return writeMemory || writeAllGlobals || !writeGlobals.empty(); }
+		bool mayRead() const { return readMemory || readAllGlobals || !readGlobals.empty(); }
+	};
 	struct funcInfo
 	{
 		size_t funcName;
@@ -29,6 +41,8 @@ public:
 
 		MxIR::Function content;
 		bool disabled = false;
+		modRefInfo modRef;
+		std::vector<bool> borrowedParams;	//the object params the callee takes no reference to, filled in by ParamOwnership
 	};
 	struct varInfo
 	{
@@ -55,6 +69,8 @@ public:
 	std::vector<std::vector<varInfo>> vLocalVars;
 	std::vector<constInfo> vConst;
 
+	//the default program is set before any pass runs and never changed afterwards, 
+	//so passes on different threads may read it concurrently
 	void setDefault() { defProg = this; }
 	static MxProgram * getDefault() { return defProg; }
 	
@@ -0,0 +1,121 @@
+#include "common_headers.h"
+#include "ParamOwnership.h"
+#include "IRGenerator.h"
+#include "MxBuiltin.h"
+#include "CompileStats.h"
+#include "utils/DepGraph.h"
+
+namespace MxIR
+{
+	void ParamOwnership::work()
+	{
+		size_t nFunc = program->vFuncs.size();
+		callee.assign(nFunc, std::set<size_t>());
+		std::vector<bool> drops(nFunc, false);
+		std::vector<std::set<size_t>> assigned(nFunc);
+		DepGraph callGraph(nFunc);
+		for (size_t i = 0; i < nFunc; i++)
+		{
+			if (program->vFuncs[i].attribute & Builtin)
+				continue;
+			drops[i] = mayDrop(i, assigned[i]);
+			for (size_t v : callee[i])
+				callGraph.link(i, v);
+		}
+		callGraph.work();
+		for (size_t c = 0; c < callGraph.getGroupCount(); c++)
+		{
+			const std::vector<size_t> &members = callGraph.getVertex(c);
+			bool groupDrops = false;
+			for (size_t w : members)
+			{
+				groupDrops = groupDrops || drops[w];
+				for (size_t v : callee[w])
+					groupDrops = groupDrops || drops[v];
+			}
+			for (size_t w : members)
+				drops[w] = groupDrops;
+		}
+
+		size_t nBorrowed = 0, nOwned = 0;
+		for (size_t i = 0; i < nFunc; i++)
+		{
+			MxProgram::funcInfo &finfo = program->vFuncs[i];
+			if (finfo.attribute & Builtin)
+				continue;
+			Function &func = finfo.content;
+			IRArena::Scope scope(func.arena);
+			assert(func.params.size() == finfo.paramType.size());
+			finfo.borrowedParams.assign(func.params.size(), false);
+			for (size_t k = 0; k < func.params.size(); k++)
+			{
+				const MxType &type = finfo.paramType[k];
+				if (!type.isObject())
+					continue;
+				if (mayBeFreed(type) && (drops[i] || assigned[i].count(func.params[k].val)))
+				{
+					ownParam(func, func.params[k], type);
+					nOwned++;
+				}
+				else
+				{
+					finfo.borrowedParams[k] = true;
+					nBorrowed++;
+				}
+			}
+		}
+		CompileStats::count("params_borrowed", nBorrowed);
+		CompileStats::count("params_owned", nOwned);
+	}
+
+	//IRGenerator releases the old value of an object in memory right after loading it for the assignment
+	bool ParamOwnership::mayDrop(size_t idx, std::set<size_t> &assigned)
+	{
+		typedef MxBuiltin::BuiltinFunc BuiltinFunc;
+		static const std::set<size_t> releaseFunc = {
+			size_t(BuiltinFunc::release_string), size_t(BuiltinFunc::release_array_internal), size_t(BuiltinFunc::release_array_string),
+			size_t(BuiltinFunc::release_array_object), size_t(BuiltinFunc::release_object),
+		};
+		Function &func = program->vFuncs[idx].content;
+		std::set<size_t> loaded, released;
+		func.inBlock->traverse([this, idx, &assigned, &loaded, &released](Block *block) -> bool
+		{
+			for (auto &ins : block->ins)
+			{
+				for (Operand *operand : ins.outputRegs())
+					assigned.insert(operand->val);
+				if ((ins.oper == Load || ins.oper == LoadA) && ins.dst.isReg())
+					loaded.insert(ins.dst.val);
+				if (ins.oper != Call || ins.src1.type != Operand::funcID)
+					continue;
+				if (!(program->vFuncs[ins.src1.val].attribute & Builtin))
+					callee[idx].insert(ins.src1.val);
+				else if (releaseFunc.count(ins.src1.val) && ins.paramExt[0].isReg() && !program->vFuncs[ins.src1.val].content.isEmpty())
+					released.insert(ins.paramExt[0].val);
+			}
+			return true;
+		});
+		for (size_t reg : released)
+			if (loaded.count(reg))
+				return true;
+		return false;
+	}
+
+	//class objects and string arrays are never freed while their release_* are stubs
+	bool ParamOwnership::mayBeFreed(const MxType &type) const
+	{
+		Instruction release = IRGenerator::releaseXValue(RegPtr(0), type);
+		return release.oper == Call && !program->vFuncs[release.src1.val].content.isEmpty();
+	}
+
+	void ParamOwnership::ownParam(Function &func, const Operand &param, const MxType &type)
+	{
+		func.inBlock->ins.push_front(IRCall(EmptyOperand(), IDFunc(size_t(MxBuiltin::BuiltinFunc::addref_object)), { param }));
+		func.inBlock->traverse([&param, &type](Block *block) -> bool
+		{
+			if (!block->ins.empty() && block->ins.back().oper == Return)
+				block->ins.insert(std::prev(block->ins.end()), IRGenerator::releaseXValue(param, type));
+			return true;
+		});
+	}
+}
@@ -0,0 +1,35 @@
+#ifndef MX_COMPILER_PARAM_OWNERSHIP_H
+#define MX_COMPILER_PARAM_OWNERSHIP_H
+
+#include "common.h"
+#include "IR.h"
+#include "MxProgram.h"
+
+namespace MxIR
+{
+	//Decides which object params are borrowed: the caller keeps the argument alive during the call,
+	//so neither the caller nor the callee touches its reference count, which is how IRGenerator passes every argument.
+	//A callee may only drop a reference it was lent by assigning to the param, or by overwriting an object held by
+	//the heap or a global var, which may be the only other owner of the argument. The latter is summarized over
+	//the strongly connected components of the call graph, callees first.
+	//The callee takes its own reference to the other params that may be freed: an addref on entry and a release on return.
+	//Runs on the IR right after IRGenerator, since the other passes rely on the references being balanced.
+	class ParamOwnership
+	{
+	public:
+		ParamOwnership() : program(MxProgram::getDefault()) {}
+		ParamOwnership(MxProgram *program) : program(program) {}
+		void work();
+
+	protected:
+		bool mayDrop(size_t idx, std::set<size_t> &assigned);	//whether the function itself overwrites an object in memory
+		bool mayBeFreed(const MxType &type) const;
+		void ownParam(Function &func, const Operand &param, const MxType &type);
+
+	protected:
+		MxProgram *program;
+		std::vector<std::set<size_t>> callee;
+	};
+}
+
+#endif
@@ -0,0 +1,68 @@
+#include "common_headers.h"
+#include "PassManager.h"
+#include "CompileStats.h"
+#include "utils/ThreadPool.h"
+
+namespace MxIR
+{
+	PassManager & PassManager::addProgramPass(const std::string &name, ProgramPass pass)
+	{
+		passes.emplace_back();
+		passes.back().name = name;
+		passes.back().programPass = std::move(pass);
+		passes.back().preserved = FunctionAnalysis::PreserveNothing;
+		return *this;
+	}
+
+	PassManager & PassManager::addFunctionPass(const std::string &name, FunctionPass pass, unsigned preserved)
+	{
+		passes.emplace_back();
+		passes.back().name = name;
+		passes.back().functionPass = std::move(pass);
+		passes.back().preserved = preserved;
+		return *this;
+	}
+
+	void PassManager::run(size_t nThreads)
+	{
+		for (size_t i = 0; i < passes.size();)
+		{
+			if (passes[i].programPass)
+			{
+				{
+					CompileStats::Scope stats(passes[i].name, program);
+					passes[i].programPass(program);
+				}
+				i++;
+				continue;
+			}
+			size_t last = i;
+			while (last < passes.size() && passes[last].functionPass)
+				last++;
+			{
+				CompileStats::Scope stats("Function passes (" + passes[i].name + " .. " + passes[last - 1].name + ")");
+				runFunctionPasses(i, last, nThreads);
+			}
+			i = last;
+		}
+	}
+
+	void PassManager::runFunctionPasses(size_t first, size_t last, size_t nThreads)
+	{
+		ThreadPool pool(nThreads);
+		pool.parallelFor(program->vFuncs.size(), [first, last, this](size_t idx)
+		{
+			Function &func = program->vFuncs[idx].content;
+			IRArena::Scope scope(func.arena);
+			FunctionAnalysis analysis(func);
+			for (size_t i = first; i < last; i++)
+			{
+				{
+					CompileStats::Scope stats(passes[i].name, func);
+					passes[i].functionPass(func, analysis);
+				}
+				analysis.invalidate(passes[i].preserved);
+			}
+		});
+	}
+}
@@ -0,0 +1,44 @@
+#ifndef MX_COMPILER_PASS_MANAGER_H
+#define MX_COMPILER_PASS_MANAGER_H
+
+#include "common.h"
+#include "IR.h"
+#include "MxProgram.h"
+#include "FunctionAnalysis.h"
+
+namespace MxIR
+{
+	//Runs the optimization pipeline; every run of a pass is measured by a CompileStats::Scope named after it.
+	//Consecutive function passes form a stage: every function goes through the whole stage on one thread
+	//of the pool, sharing a FunctionAnalysis between the passes. A program pass is a barrier between stages.
+	class PassManager
+	{
+	public:
+		typedef std::function<void(MxProgram *)> ProgramPass;
+		typedef std::function<void(Function &, FunctionAnalysis &)> FunctionPass;
+
+		explicit PassManager(MxProgram *program) : program(program) {}
+
+		PassManager & addProgramPass(const std::string &name, ProgramPass pass);
+		//preserved: the analyses (FunctionAnalysis::Preserved) that stay valid after the pass
+		PassManager & addFunctionPass(const std::string &name, FunctionPass pass, unsigned preserved = FunctionAnalysis::PreserveNothing);
+
+		void run(size_t nThreads);
+
+	protected:
+		struct PassInfo
+		{
+			std::string name;
+			ProgramPass programPass;
+			FunctionPass functionPass;
+			unsigned preserved;
+		};
+		void runFunctionPasses(size_t first, size_t last, size_t nThreads);
+
+	protected:
+		MxProgram *program;
+		std::vector<PassInfo> passes;
+	};
+}
+
+#endif
@@ -0,0 +1,246 @@
+#include "common_headers.h"
+#include "RefCountOptimizer.h"
+#include "MxBuiltin.h"
+#include "CompileStats.h"
+
+namespace MxIR
+{
+	typedef MxBuiltin::BuiltinFunc BuiltinFunc;
+
+	void RefCountOptimizer::work()
+	{
+		emptyBody.assign(program->vFuncs.size(), false);
+		for (size_t i = 0; i < program->vFuncs.size(); i++)
+			emptyBody[i] = (program->vFuncs[i].attribute & Builtin) && program->vFuncs[i].content.isEmpty();
+
+		size_t nRemoved = 0;
+		for (size_t i = 0; i < program->vFuncs.size(); i++)
+		{
+			if (program->vFuncs[i].disabled || (program->vFuncs[i].attribute & Builtin))
+				continue;
+			Function &func = program->vFuncs[i].content;
+			IRArena::Scope scope(func.arena);
+			func.inBlock->traverse([this, &nRemoved](Block *block) -> bool
+			{
+				nRemoved += cancelPairs(block);
+				return true;
+			});
+			nRemoved += removeNoops(func);
+			nRemoved += removeUnobserved(func);
+		}
+		CompileStats::count("rc_calls_removed", nRemoved);
+	}
+
+	size_t RefCountOptimizer::removeNoops(Function &func)
+	{
+		size_t nRemoved = 0;
+		func.inBlock->traverse([this, &nRemoved](Block *block) -> bool
+		{
+			for (auto iter = block->ins.begin(); iter != block->ins.end(); )
+			{
+				if (isNoop(*iter))
+				{
+					iter = block->ins.erase(iter);
+					nRemoved++;
+				}
+				else
+					++iter;
+			}
+			return true;
+		});
+		return nRemoved;
+	}
+
+	//walk back from each release to the addref of the same register; only other addrefs, releases
+	//and calls that release nothing may be in between, and the released registers must not be written after them
+	size_t RefCountOptimizer::cancelPairs(Block *block)
+	{
+		size_t nRemoved = 0;
+		auto iter = block->ins.begin();
+		while (iter != block->ins.end())
+		{
+			if (!isRelease(*iter) || !iter->paramExt[0].isReg())
+			{
+				++iter;
+				continue;
+			}
+			size_t value = iter->paramExt[0].val;
+			std::set<size_t> written;
+			std::vector<InsList::iterator> sunk;	//nearest first
+			auto addref = block->ins.end();
+			for (auto prev = iter; prev != block->ins.begin(); )
+			{
+				--prev;
+				if (isAddref(*prev) && prev->paramExt[0].isReg() && prev->paramExt[0].val == value)
+				{
+					addref = prev;
+					break;
+				}
+				if (isRelease(*prev))
+				{
+					bool stale = false;
+					for (auto &operand : prev->paramExt)
+						stale = stale || (operand.isReg() && written.count(operand.val));
+					if (stale)
+						break;
+					sunk.push_back(prev);
+				}
+				else if (isBarrier(*prev))
+					break;
+				bool redefined = false;
+				for (Operand *operand : prev->outputRegs())
+				{
+					redefined = redefined || operand->val == value;
+					written.insert(operand->val);
+				}
+				if (redefined)
+					break;
+			}
+			if (addref == block->ins.end())
+			{
+				++iter;
+				continue;
+			}
+			auto next = std::next(iter);
+			for (auto s = sunk.rbegin(); s != sunk.rend(); ++s)
+				block->ins.splice(next, block->ins, *s);
+			auto resume = sunk.empty() ? next : sunk.back();	//a sunk release may meet an addref now
+			block->ins.erase(addref);
+			block->ins.erase(iter);
+			iter = resume;
+			nRemoved += 2;
+		}
+		return nRemoved;
+	}
+
+	//the count of an object is only read by the releases, so nobody reads the count of a fresh object
+	//that is not released in this function and never leaves it: its addrefs are dead stores
+	size_t RefCountOptimizer::removeUnobserved(Function &func)
+	{
+		std::map<size_t, size_t> nDef;
+		func.inBlock->traverse([&nDef](Block *block) -> bool
+		{
+			for (auto &ins : block->ins)
+				for (Operand *operand : ins.outputRegs())
+					nDef[operand->val]++;
+			return true;
+		});
+
+		//register -> the allocation it holds, or points into
+		std::map<size_t, size_t> owner, inside;
+		func.inBlock->traverse([this, &nDef, &owner, &inside](Block *block) -> bool
+		{
+			for (auto &ins : block->ins)
+			{
+				if (!ins.dst.isReg() || nDef[ins.dst.val] != 1)
+					continue;
+				bool fromReg = ins.src1.isReg();
+				if (ins.oper == Call && ins.src1.type == Operand::funcID
+					&& (ins.src1.val == size_t(BuiltinFunc::newobject) || ins.src1.val == size_t(BuiltinFunc::newobject_zero)))
+				{
+					owner[ins.dst.val] = ins.dst.val;
+				}
+				else if (ins.oper == Move && fromReg && owner.count(ins.src1.val))
+					owner[ins.dst.val] = owner[ins.src1.val];
+				else if (ins.oper == Add && fromReg && ins.src2.isImm() && owner.count(ins.src1.val))
+					inside[ins.dst.val] = owner[ins.src1.val];
+				else if (ins.oper == Call && ins.src1.type == Operand::funcID && !ins.paramExt.empty() && ins.paramExt[0].isReg() && owner.count(ins.paramExt[0].val)
+					&& (ins.src1.val == size_t(BuiltinFunc::subscript_bool) || ins.src1.val == size_t(BuiltinFunc::subscript_int)
+						|| ins.src1.val == size_t(BuiltinFunc::subscript_object)))
+				{
+					inside[ins.dst.val] = owner[ins.paramExt[0].val];
+				}
+			}
+			return true;
+		});
+		if (owner.empty())
+			return 0;
+
+		//besides the addrefs, the allocation may only be copied, compared, and accessed through
+		auto isAccessor = [](const Instruction &ins)
+		{
+			return ins.oper == Call && ins.src1.type == Operand::funcID
+				&& (ins.src1.val == size_t(BuiltinFunc::subscript_bool) || ins.src1.val == size_t(BuiltinFunc::subscript_int)
+					|| ins.src1.val == size_t(BuiltinFunc::subscript_object) || ins.src1.val == size_t(BuiltinFunc::size));
+		};
+		std::set<size_t> escaped;
+		func.inBlock->traverse([this, &owner, &inside, &escaped, &isAccessor](Block *block) -> bool
+		{
+			for (auto &ins : block->ins)
+			{
+				if (isAddref(ins))
+					continue;
+				for (Operand *operand : ins.inputRegs())
+				{
+					bool owned = owner.count(operand->val) != 0;
+					if (!owned && !inside.count(operand->val))
+						continue;
+					size_t object = owned ? owner[operand->val] : inside[operand->val];
+					bool memory = ins.oper == Load || ins.oper == LoadA || ins.oper == Store || ins.oper == StoreA;
+					if (memory && operand == &ins.src1)
+						continue;
+					if (owned && !isRelease(ins))
+					{
+						if (ins.oper >= Slt && ins.oper <= Sgtu)
+							continue;
+						if (ins.oper == Move && owner.count(ins.dst.val) && owner[ins.dst.val] == object)
+							continue;
+						if (ins.oper == Add && operand == &ins.src1 && ins.src2.isImm() && inside.count(ins.dst.val) && inside[ins.dst.val] == object)
+							continue;
+						if (isAccessor(ins) && operand == &ins.paramExt[0] && (ins.src1.val == size_t(BuiltinFunc::size) || inside.count(ins.dst.val)))
+							continue;
+					}
+					escaped.insert(object);		//stored, passed, returned or released
+				}
+			}
+			return true;
+		});
+
+		size_t nRemoved = 0;
+		func.inBlock->traverse([this, &owner, &escaped, &nRemoved](Block *block) -> bool
+		{
+			for (auto iter = block->ins.begin(); iter != block->ins.end(); )
+			{
+				if (isAddref(*iter) && iter->paramExt[0].isReg() && owner.count(iter->paramExt[0].val) && !escaped.count(owner[iter->paramExt[0].val]))
+				{
+					iter = block->ins.erase(iter);
+					nRemoved++;
+				}
+				else
+					++iter;
+			}
+			return true;
+		});
+		return nRemoved;
+	}
+
+	bool RefCountOptimizer::isAddref(const Instruction &ins) const
+	{
+		return ins.oper == Call && ins.src1.type == Operand::funcID && ins.src1.val == size_t(BuiltinFunc::addref_object);
+	}
+
+	bool RefCountOptimizer::isRelease(const Instruction &ins) const
+	{
+		static const std::set<size_t> releaseFunc = {
+			size_t(BuiltinFunc::release_string), size_t(BuiltinFunc::release_array_internal), size_t(BuiltinFunc::release_array_string),
+			size_t(BuiltinFunc::release_array_object), size_t(BuiltinFunc::release_object),
+		};
+		return ins.oper == Call && ins.src1.type == Operand::funcID && releaseFunc.count(ins.src1.val);
+	}
+
+	bool RefCountOptimizer::isNoop(const Instruction &ins) const
+	{
+		if (!isAddref(ins) && !isRelease(ins))
+			return false;
+		const Operand &object = ins.paramExt[0];
+		return object.isImm() || object.type == Operand::constID || emptyBody[ins.src1.val];		//null, or a constant string that is never freed
+	}
+
+	bool RefCountOptimizer::isBarrier(const Instruction &ins) const
+	{
+		if (ins.oper != Call || isAddref(ins))
+			return false;
+		//only the release_* builtins drop references
+		return isRelease(ins) || ins.src1.type != Operand::funcID || !(program->vFuncs[ins.src1.val].attribute & Builtin);
+	}
+}
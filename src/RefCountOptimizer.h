@@ -0,0 +1,39 @@
+#ifndef MX_COMPILER_REF_COUNT_OPTIMIZER_H
+#define MX_COMPILER_REF_COUNT_OPTIMIZER_H
+
+#include "common.h"
+#include "IR.h"
+#include "MxProgram.h"
+
+namespace MxIR
+{
+	//Removes the calls to __addref_object and __release_* that can not change when an object is freed,
+	//before inlining turns them into code, and before SSA construction.
+	//An addref followed by a release of the same value in a block cancel out; the releases in between
+	//are sunk after the pair, since freeing later is always safe and they then drop the counts the same way.
+	//The addrefs of a freshly allocated object that never escapes the function are dropped when no release reads its count.
+	//The calls on constants and the calls to release_* builtins that do nothing yet are dropped too.
+	class RefCountOptimizer
+	{
+	public:
+		RefCountOptimizer() : program(MxProgram::getDefault()) {}
+		RefCountOptimizer(MxProgram *program) : program(program) {}
+		void work();
+
+	protected:
+		size_t removeNoops(Function &func);
+		size_t cancelPairs(Block *block);
+		size_t removeUnobserved(Function &func);
+
+		bool isAddref(const Instruction &ins) const;
+		bool isRelease(const Instruction &ins) const;
+		bool isNoop(const Instruction &ins) const;		//an addref or a release that never changes anything
+		bool isBarrier(const Instruction &ins) const;	//a call that may release objects
+
+	protected:
+		MxProgram *program;
+		std::vector<bool> emptyBody;
+	};
+}
+
+#endif
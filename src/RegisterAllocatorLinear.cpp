@@ -0,0 +1,502 @@
+#include "common_headers.h"
+#include "RegisterAllocatorLinear.h"
+#include "CompileStats.h"
+#include "utils/JoinIterator.h"
+
+namespace MxIR
+{
+	const std::vector<int> RegisterAllocatorLinear::regScratch = { 10, 11 };	//r10 r11
+
+	void RegisterAllocatorLinear::work()
+	{
+		func.inBlock->traverse_rev_postorder([this](Block *block) -> bool
+		{
+			blockIndex[block] = blocks.size();
+			blocks.push_back(block);
+			return true;
+		});
+
+		relabelVReg();
+		CompileStats::count("vregs", nVar);
+		destructSSA();
+		lowerConstraints();
+		buildIntervals();
+		allocateRegister();
+		for (Block *block : blocks)
+			rewriteBlock(block);
+		insertAllocateCode();
+	}
+
+	void RegisterAllocatorLinear::relabelVReg()
+	{
+		std::map<Operand, size_t> newIndex;
+		for (Block *block : blocks)
+		{
+			for (auto &ins : block->instructions())
+			{
+				for (Operand *operand : join<Operand *>(ins.inputRegs(), ins.outputRegs()))
+				{
+					if (operand->val == Operand::InvalidID)
+						continue;
+					auto iter = newIndex.find(*operand);
+					if (iter != newIndex.end())
+						operand->val = iter->second;
+					else
+					{
+						size_t idx = newIndex.size();
+						newIndex[*operand] = idx;
+						operand->val = idx;
+					}
+					operand->ver = 0;
+				}
+			}
+		}
+		nVar = newIndex.size();
+	}
+
+	void RegisterAllocatorLinear::destructSSA()
+	{
+		//a phi is replaced by copies to a new register at the end of every predecessor and a copy from it
+		//at the begin of the block, which needs neither splitting the critical edges nor ordering the copies
+		for (Block *block : blocks)
+		{
+			if (block == func.outBlock.get())	//never reached: all its predecessors end with Return
+			{
+				block->phi.clear();
+				continue;
+			}
+			for (auto &kv : block->phi)
+			{
+				Block::PhiIns &phi = kv.second;
+				Operand tmp = phi.dst.clone().setVal(nVar++);
+				for (auto &src : phi.srcs)
+				{
+					if (src.first.type == Operand::empty)
+						continue;
+					std::shared_ptr<Block> pred = src.second.lock();
+					auto pos = std::prev(pred->ins.end());
+					if (pos->oper == Br && pos->src1.type == Operand::empty)	//the branch reads the flags set by the comparison before it
+						--pos;
+					pred->ins.insert(pos, IR(tmp, Move, src.first));
+				}
+				block->ins.push_front(IR(phi.dst, Move, tmp));
+			}
+			block->phi.clear();
+		}
+	}
+
+	void RegisterAllocatorLinear::lowerConstraints()
+	{
+		interval.assign(nVar, Interval());
+		slot.assign(nVar, size_t(Operand::InvalidID));
+
+		//the incoming parameters and the callee-save registers are read by one parallel move,
+		//so that no register defined there overwrites a physical register that has not been read yet
+		InsList &entry = func.inBlock->ins;
+		std::vector<Instruction> externalVar;
+		auto iter = entry.begin();
+		while (iter != entry.end() && iter->oper == ExternalVar)
+		{
+			externalVar.push_back(*iter);
+			iter = entry.erase(iter);
+		}
+		auto entryMove = iter++;
+		assert(entryMove->oper == ParallelMove && iter != entry.end() && iter->oper == ParallelMove);
+		size_t n = entryMove->paramExt.size() / 2, m = iter->paramExt.size() / 2;
+		entryMove->paramExt.insert(entryMove->paramExt.begin() + n, iter->paramExt.begin(), iter->paramExt.begin() + m);
+		entryMove->paramExt.insert(entryMove->paramExt.end(), iter->paramExt.begin() + m, iter->paramExt.end());
+		iter = entry.erase(iter);
+		//parameters passed on the stack are loaded after that, and use their incoming slot if spilled
+		for (Instruction &insn : externalVar)
+		{
+			assert(isVReg(insn.dst));
+			Operand addr = RegPtr(nVar + nSlot++).setNOReg(true);
+			Instruction alloc = IR(addr, Allocate, ImmPtr(8), ImmPtr(8));
+			alloc.paramExt.push_back(insn.src1);
+			allocInsn.push_back(alloc);
+			slot[insn.dst.val] = addr.val;
+			entry.insert(iter, IR(insn.dst, Load, addr));
+		}
+
+		for (Block *block : blocks)
+		{
+			bool locked = false;
+			std::vector<Instruction> afterUnlock;	//copies out of the fixed registers written in the locked region
+			for (auto iter = block->ins.begin(); iter != block->ins.end(); ++iter)
+			{
+				if (iter->oper == LockReg)
+					locked = true;
+				else if (iter->oper == UnlockReg)
+				{
+					locked = false;
+					block->ins.insert(std::next(iter), afterUnlock.begin(), afterUnlock.end());
+					std::advance(iter, afterUnlock.size());
+					afterUnlock.clear();
+				}
+				else if (iter->oper == MoveToRegister)
+				{
+					//placeholders stay as moves from a register to itself, which only mark the register as overwritten
+					std::vector<Operand> dst, src;
+					for (Operand *operand : iter->inputRegs())
+					{
+						assert(operand->pregid != -1);
+						if (operand->val == Operand::InvalidID)
+						{
+							dst.push_back(*operand);
+							src.push_back(*operand);
+							continue;
+						}
+						dst.push_back(RegSize(Operand::InvalidID, operand->size()).setPRegID(operand->pregid));
+						src.push_back(operand->clone().setPRegID(-1));
+						interval[operand->val].hintPReg = operand->pregid;
+					}
+					*iter = IRParallelMove(dst, src);
+				}
+				else if (iter->oper == ParallelMove)
+				{
+					//registers defined with a fixed register are copied from that register
+					for (size_t i = 0; i < iter->paramExt.size() / 2; i++)
+					{
+						Operand &operand = iter->paramExt[i];
+						if (isVReg(operand) && operand.pregid != -1)
+						{
+							interval[operand.val].hintPReg = operand.pregid;
+							operand.pregid = -1;
+						}
+					}
+				}
+				else if (iter->oper == Return && iter->src1.isReg())
+					iter->src1.noreg = true;	//the value has been moved to rax
+				else if (iter->oper != Store && iter->oper != StoreA && isVReg(iter->dst) && iter->dst.pregid != -1)
+				{
+					Operand fixed = RegSize(Operand::InvalidID, iter->dst.size()).setPRegID(iter->dst.pregid);
+					Instruction move = IR(iter->dst.clone().setPRegID(-1), Move, fixed);
+					interval[iter->dst.val].hintPReg = iter->dst.pregid;
+					iter->dst = fixed;
+					if (locked)
+						afterUnlock.push_back(move);
+					else
+						iter = block->ins.insert(std::next(iter), move);
+				}
+			}
+			assert(!locked && afterUnlock.empty());
+		}
+	}
+
+	void RegisterAllocatorLinear::setHint(size_t vreg, size_t fromVReg)
+	{
+		if (interval[vreg].hintVReg == Operand::InvalidID)
+			interval[vreg].hintVReg = fromVReg;
+	}
+
+	void RegisterAllocatorLinear::buildIntervals()
+	{
+		property.resize(blocks.size());
+		size_t pos = 0;
+		for (size_t idx = 0; idx < blocks.size(); idx++)
+		{
+			BlockProperty &bp = property[idx];
+			bp.begin = pos;
+			std::uint32_t locked = 0;
+			for (auto &ins : blocks[idx]->ins)
+			{
+				size_t use = pos, def = pos + 1;
+				for (Operand *operand : ins.inputRegs())
+				{
+					if (!isVReg(*operand))
+						continue;
+					Interval &itv = interval[operand->val];
+					itv.begin = std::min(itv.begin, use);
+					itv.end = std::max(itv.end, use);
+					if (!bp.definedVar.count(operand->val))
+						bp.usedVar.insert(operand->val);
+				}
+				std::uint32_t written = locked;
+				for (Operand *operand : ins.outputRegs())
+				{
+					if (isVReg(*operand))
+					{
+						Interval &itv = interval[operand->val];
+						itv.begin = std::min(itv.begin, def);
+						itv.end = std::max(itv.end, def);
+						bp.definedVar.insert(operand->val);
+					}
+					else if (operand->val == Operand::InvalidID && operand->pregid != -1)
+						written |= 1U << operand->pregid;
+				}
+				if (ins.oper == LockReg)
+				{
+					for (Operand &operand : ins.paramExt)
+						locked |= 1U << operand.pregid;
+					written |= locked;
+				}
+				else if (ins.oper == UnlockReg)
+					locked = written = 0;
+				fixedWrite.push_back(written);
+
+				if (ins.oper == TestZero && isVReg(ins.src1))	//the result is written before src1 is read
+					interval[ins.src1.val].end = std::max(interval[ins.src1.val].end, def);
+				if (ins.hint != InstructionBase::NoPrefer && isVReg(ins.dst) && isVReg(ins.src1))
+					setHint(ins.dst.val, ins.src1.val);
+				pos += 2;
+			}
+			bp.end = pos - 1;
+		}
+
+		analysisLiveness();
+		for (size_t idx = 0; idx < blocks.size(); idx++)
+		{
+			BlockProperty &bp = property[idx];
+			for (size_t vreg : bp.liveIn)
+				interval[vreg].begin = std::min(interval[vreg].begin, bp.begin);
+			for (size_t vreg : bp.liveOut)
+				interval[vreg].end = std::max(interval[vreg].end, bp.end);
+
+			//a fixed register is kept out of the registers live across the write and the results of the instruction,
+			//but may be assigned to an interval that only has a hole there
+			DynamicBitset live = bp.liveOut;
+			size_t insn = (bp.end + 1) / 2;
+			for (auto iter = blocks[idx]->ins.rbegin(); iter != blocks[idx]->ins.rend(); ++iter)
+			{
+				std::uint32_t written = fixedWrite[--insn];
+				if (written)
+				{
+					for (size_t vreg : live)
+						interval[vreg].forbidden |= written;
+				}
+				for (Operand *operand : iter->outputRegs())
+				{
+					if (!isVReg(*operand))
+						continue;
+					interval[operand->val].forbidden |= written;
+					live.erase(operand->val);
+				}
+				for (Operand *operand : iter->inputRegs())
+					if (isVReg(*operand))
+						live.insert(operand->val);
+			}
+		}
+	}
+
+	void RegisterAllocatorLinear::analysisLiveness()
+	{
+		bool changed = true;
+		while (changed)
+		{
+			changed = false;
+			for (size_t idx = blocks.size(); idx-- > 0;)
+			{
+				Block *block = blocks[idx];
+				BlockProperty &bp = property[idx];
+				for (Block *next : { block->brTrue.get(), block->brFalse.get() })
+					if (next)
+						bp.liveOut.unionWith(property[blockIndex[next]].liveIn);
+				DynamicBitset live = bp.liveOut;
+				live.subtract(bp.definedVar);
+				live.unionWith(bp.usedVar);
+				if (bp.liveIn.unionWith(live))
+					changed = true;
+			}
+		}
+	}
+
+	void RegisterAllocatorLinear::allocateRegister()
+	{
+		std::vector<size_t> order;
+		for (size_t i = 0; i < nVar; i++)
+			if (interval[i].begin != size_t(-1))
+				order.push_back(i);
+		std::sort(order.begin(), order.end(), [this](size_t a, size_t b)
+		{
+			return interval[a].begin < interval[b].begin || (interval[a].begin == interval[b].begin && a < b);
+		});
+
+		std::vector<bool> allocatable(16, false), used(16, false);
+		for (int reg : phyReg)
+			if (std::find(regScratch.begin(), regScratch.end(), reg) == regScratch.end())
+				allocatable[reg] = true;
+
+		std::vector<size_t> active;
+		size_t spills = 0;
+		for (size_t vreg : order)
+		{
+			Interval &cur = interval[vreg];
+			for (size_t i = 0; i < active.size();)
+			{
+				if (interval[active[i]].end < cur.begin)
+				{
+					used[interval[active[i]].preg] = false;
+					active[i] = active.back();
+					active.pop_back();
+				}
+				else
+					i++;
+			}
+
+			int hint = cur.hintPReg;
+			if (hint == -1 && cur.hintVReg != Operand::InvalidID)
+				hint = interval[cur.hintVReg].preg;
+			int choice = -1;
+			if (hint != -1 && allocatable[hint] && !used[hint] && !(cur.forbidden >> hint & 1))
+				choice = hint;
+			for (size_t i = 0; i < phyReg.size() && choice == -1; i++)
+				if (allocatable[phyReg[i]] && !used[phyReg[i]] && !(cur.forbidden >> phyReg[i] & 1))
+					choice = phyReg[i];
+
+			if (choice == -1)
+			{
+				//spill the interval that ends last
+				spills++;
+				auto victim = active.end();
+				for (auto iter = active.begin(); iter != active.end(); ++iter)
+					if (!(cur.forbidden >> interval[*iter].preg & 1) && (victim == active.end() || interval[*iter].end > interval[*victim].end))
+						victim = iter;
+				if (victim == active.end() || interval[*victim].end <= cur.end)
+					continue;
+				choice = interval[*victim].preg;
+				interval[*victim].preg = -1;
+				active.erase(victim);
+			}
+			cur.preg = choice;
+			used[choice] = true;
+			active.push_back(vreg);
+		}
+		CompileStats::count("spills", spills);
+	}
+
+	Operand RegisterAllocatorLinear::getSlot(size_t vreg)
+	{
+		if (slot[vreg] == Operand::InvalidID)
+		{
+			slot[vreg] = nVar + nSlot++;
+			allocInsn.push_back(IR(RegPtr(slot[vreg]).setNOReg(true), Allocate, ImmPtr(8), ImmPtr(8)));
+		}
+		return RegPtr(slot[vreg]).setNOReg(true);
+	}
+
+	void RegisterAllocatorLinear::rewriteBlock(Block *block)
+	{
+		for (auto iter = block->ins.begin(); iter != block->ins.end();)
+		{
+			auto next = std::next(iter);
+			if (iter->oper == ParallelMove)
+			{
+				//a spilled destination is stored before the move, while the source still holds the value;
+				//a spilled source is loaded after the move, when its destination is not read any more
+				size_t n = iter->paramExt.size() / 2;
+				std::vector<Operand> dst, src;
+				for (size_t i = 0; i < n; i++)
+				{
+					Operand d = iter->paramExt[i], s = iter->paramExt[n + i];
+					bool dMem = isSpilled(d), sMem = isSpilled(s);
+					if (isVReg(d) && !dMem)
+						d.pregid = interval[d.val].preg;
+					if (isVReg(s) && !sMem)
+						s.pregid = interval[s.val].preg;
+					if (!dMem && !sMem)
+					{
+						dst.push_back(d);
+						src.push_back(s);
+					}
+					else if (!sMem)
+						block->ins.insert(iter, IRStore(s, getSlot(d.val)));
+					else if (!dMem)
+						block->ins.insert(next, IR(d, Load, getSlot(s.val)));
+					else if (d.val != s.val)
+					{
+						Operand tmp = RegSize(Operand::InvalidID, s.size()).setPRegID(regScratch[0]);
+						block->ins.insert(iter, IR(tmp, Load, getSlot(s.val)));
+						block->ins.insert(iter, IRStore(tmp, getSlot(d.val)));
+					}
+				}
+				*iter = IRParallelMove(dst, src);
+				iter = next;
+				continue;
+			}
+			if (iter->oper == Load && isSpilled(iter->dst) && iter->src1.noreg && slot[iter->dst.val] == iter->src1.val)
+			{
+				iter = block->ins.erase(iter);	//parameter that stays in its incoming slot
+				continue;
+			}
+
+			std::vector<std::pair<size_t, int>> loaded;		//spilled vreg -> scratch register
+			auto scratchOf = [&loaded](size_t vreg) -> int
+			{
+				for (auto &kv : loaded)
+					if (kv.first == vreg)
+						return kv.second;
+				return -1;
+			};
+			auto freeScratch = [&loaded]() -> int
+			{
+				for (int reg : regScratch)
+					if (std::find_if(loaded.begin(), loaded.end(), [reg](const std::pair<size_t, int> &kv) { return kv.second == reg; }) == loaded.end())
+						return reg;
+				return -1;
+			};
+
+			if (iter->oper == StoreA && isSpilled(iter->dst) && isSpilled(iter->src1) && isSpilled(iter->src2) &&
+				iter->dst.val != iter->src1.val && iter->dst.val != iter->src2.val && iter->src1.val != iter->src2.val)
+			{
+				//three spilled operands: compute the address in the first scratch register
+				Operand base = RegPtr(Operand::InvalidID).setPRegID(regScratch[0]), offset = RegPtr(Operand::InvalidID).setPRegID(regScratch[1]);
+				block->ins.insert(iter, IR(base, Load, getSlot(iter->src1.val)));
+				block->ins.insert(iter, IR(offset, Load, getSlot(iter->src2.val)));
+				block->ins.insert(iter, IR(base, LoadAddr, base, offset));
+				iter->src1 = base;
+				iter->src2 = ImmPtr(0);
+				loaded.push_back(std::make_pair(size_t(Operand::InvalidID), regScratch[0]));
+			}
+
+			for (Operand *operand : iter->inputRegs())
+			{
+				if (!isVReg(*operand))
+					continue;
+				if (interval[operand->val].preg != -1)
+				{
+					operand->pregid = interval[operand->val].preg;
+					continue;
+				}
+				int reg = scratchOf(operand->val);
+				if (reg == -1)
+				{
+					reg = freeScratch();
+					assert(reg != -1);
+					block->ins.insert(iter, IR(RegSize(Operand::InvalidID, operand->size()).setPRegID(reg), Load, getSlot(operand->val)));
+					loaded.push_back(std::make_pair(size_t(operand->val), reg));
+				}
+				operand->pregid = reg;
+			}
+
+			for (Operand *operand : iter->outputRegs())
+			{
+				if (!isVReg(*operand))
+					continue;
+				if (interval[operand->val].preg != -1)
+				{
+					operand->pregid = interval[operand->val].preg;
+					continue;
+				}
+				if (iter->oper == Move && iter->src1.isReg())
+				{
+					*iter = IRStore(iter->src1.clone().setSize(operand->size()), getSlot(operand->val));
+					break;
+				}
+				//the result may share the scratch register of src1, except in TestZero where it is written first
+				int reg = iter->oper != TestZero && isSpilled(iter->src1) ? scratchOf(iter->src1.val) : freeScratch();
+				if (reg == -1)
+					reg = scratchOf(iter->src2.val);
+				assert(reg != -1);
+				operand->pregid = reg;
+				block->ins.insert(next, IRStore(operand->clone(), getSlot(operand->val)));
+			}
+			iter = next;
+		}
+	}
+
+	void RegisterAllocatorLinear::insertAllocateCode()
+	{
+		for (Instruction &insn : allocInsn)
+			func.inBlock->ins.push_front(insn);
+	}
+}
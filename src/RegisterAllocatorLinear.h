@@ -0,0 +1,69 @@
+#ifndef MX_COMPILER_REGISTER_ALLOCATOR_LINEAR_H
+#define MX_COMPILER_REGISTER_ALLOCATOR_LINEAR_H
+
+#include "common.h"
+#include "IR.h"
+#include "utils/DynamicBitset.h"
+
+namespace MxIR
+{
+	//Linear scan register allocator (Poletto & Sarkar), used for quick builds.
+	//Every virtual register gets a single live interval over the blocks in reverse postorder,
+	//and lives in one physical register or in one stack slot during the whole function.
+	//r10 and r11 are not allocated: they hold the spilled operands of one instruction.
+	class RegisterAllocatorLinear
+	{
+	public:
+		explicit RegisterAllocatorLinear(Function &func, const std::vector<int> &phyReg) : func(func), phyReg(phyReg), nVar(0), nSlot(0) {}
+		void work();
+
+	protected:
+		void relabelVReg();
+		void destructSSA();
+		void lowerConstraints();
+		void buildIntervals();
+		void analysisLiveness();
+		void allocateRegister();
+		void rewriteBlock(Block *block);
+		void insertAllocateCode();
+
+		bool isVReg(const Operand &operand) const { return operand.isReg() && operand.val != Operand::InvalidID && !operand.noreg; }
+		bool isSpilled(const Operand &operand) const { return isVReg(operand) && interval[operand.val].preg == -1; }
+		Operand getSlot(size_t vreg);
+		void setHint(size_t vreg, size_t fromVReg);
+
+	protected:
+		struct Interval
+		{
+			size_t begin, end;		//instruction i uses its operands at 2i and defines its results at 2i+1
+			int preg;				//-1 if spilled
+			int hintPReg;
+			size_t hintVReg;
+			std::uint32_t forbidden;	//mask of the physical registers overwritten while the register is live
+			Interval() : begin(size_t(-1)), end(0), preg(-1), hintPReg(-1), hintVReg(Operand::InvalidID), forbidden(0) {}
+		};
+		struct BlockProperty
+		{
+			DynamicBitset usedVar, definedVar;	//used before defined / defined in this block
+			DynamicBitset liveIn, liveOut;
+			size_t begin, end;
+		};
+
+		Function &func;
+		const std::vector<int> &phyReg;
+		size_t nVar;
+		size_t nSlot;		//stack slots are numbered from nVar
+
+		std::vector<Block *> blocks;		//in reverse postorder
+		std::unordered_map<Block *, size_t> blockIndex;
+		std::vector<BlockProperty> property;
+		std::vector<Interval> interval;
+		std::vector<std::uint32_t> fixedWrite;	//instruction -> mask of the physical registers it overwrites
+		std::vector<size_t> slot;			//vreg -> id of its stack slot
+		std::vector<Instruction> allocInsn;
+
+		static const std::vector<int> regScratch;
+	};
+}
+
+#endif
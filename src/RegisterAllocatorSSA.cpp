@@ -1,7 +1,7 @@
 #include "common_headers.h"
 #include "RegisterAllocatorSSA.h"
-#include "LoopDetector.h"
 #include "SSAReconstructor.h"
+#include "CompileStats.h"
 #include "utils/JoinIterator.h"
 #include "utils/UnionFindSet.h"
 #include "utils/MaxClique.h"
@@ -45,6 +45,14 @@ namespace MxIR
 		});
 		return ret;
 	}
+	InstructionBase::RegRange operator|(const InstructionBase::RegRange &range, needreg_filter_t)
+	{
+		return range.filtered([](const Operand &operand) { return needreg(operand); });
+	}
+	InstructionBase::RegRange operator|(const InstructionBase::RegRange &range, hasreg_filter_t)
+	{
+		return range.filtered([](const Operand &operand) { return hasreg(operand); });
+	}
 
 	void RegisterAllocatorSSA::work()
 	{
@@ -54,20 +62,25 @@ namespace MxIR
 		//	return true;
 		//});
 
-		splitCriticalEdge();
+		if (splitCriticalEdge())
+			analysis.invalidate();
 
 		computeDomTree();
 		computeLoop();
 		relabelVReg();
+		CompileStats::count("vregs", nVar);
 		computeVarOp();
 		computeDefUses();
 		computeVarGroup();
 		computeNextUse();
 		computeMaxPressure();
 		computeExternalVar();
+		computeRematerializable();
 		
 		spillRegister();
 		eliminateSpillCode();
+		if (CompileStats::getInstance()->isEnabled())
+			countSpillCode();
 		insertAllocateCode();
 		
 		reconstructSSA();
@@ -82,11 +95,13 @@ namespace MxIR
 		/*writeRegInfo(); return;*/
 
 		destructSSA();
+		CompileStats::count("coalesce_fallbacks", cliqueFallbacks);
 		writeRegInfo();
 	}
 
-	void RegisterAllocatorSSA::splitCriticalEdge()
+	bool RegisterAllocatorSSA::splitCriticalEdge()
 	{
+		bool changed = false;
 		std::vector<Block *> blockList;
 		func.inBlock->traverse([&blockList](Block *block) -> bool { blockList.push_back(block); return true; });
 
@@ -100,6 +115,7 @@ namespace MxIR
 				assert(false);
 				block->ins.back() = IRJump();
 				block->brFalse.reset();
+				changed = true;
 				continue;
 			}
 
@@ -108,6 +124,7 @@ namespace MxIR
 				if (next->preds.size() <= 1)
 					continue;
 				std::shared_ptr<Block> midBlock = Block::construct();
+				changed = true;
 				newPred[next.get()][block] = midBlock;
 				midBlock->ins = { IRJump() };
 				midBlock->brTrue = next;
@@ -130,33 +147,20 @@ namespace MxIR
 				}
 			}
 		}
+		return changed;
 	}
 
 	void RegisterAllocatorSSA::computeDomTree()
 	{
-		func.inBlock->traverse([this](Block *block) -> bool
-		{
-			property[block].idx = vBlock.size();
-			vBlock.push_back(block);
-			return true;
-		});
-		dtree = DomTree(vBlock.size());
+		const std::vector<Block *> &vBlock = analysis.blocks();
 		for (size_t i = 0; i < vBlock.size(); i++)
-		{
-			Block *blk = vBlock[i];
-			for (Block *next : { blk->brTrue.get(), blk->brFalse.get() })
-				if (next)
-					dtree.link(i, property[next].idx);
-		}
-		assert(property[func.inBlock.get()].idx == 0);
-		dtree.buildTree(0);
+			property[vBlock[i]].idx = i;
+		analysis.domTree();
 	}
 
 	void RegisterAllocatorSSA::computeLoop()
 	{
-		LoopDetector loopDetector(func);
-		loopDetector.findLoops();
-		for (auto &kv : loopDetector.getLoops())
+		for (auto &kv : analysis.loops())
 		{
 			Block *header = kv.first;
 			const std::set<Block *> &body = kv.second;
@@ -177,7 +181,7 @@ namespace MxIR
 		{
 			for (auto &ins : block->instructions())
 			{
-				for (Operand *operand : join<Operand *>(ins.getInputReg(), ins.getOutputReg()))
+				for (Operand *operand : join<Operand *>(ins.inputRegs(), ins.outputRegs()))
 				{
 					if (operand->val == Operand::InvalidID)
 						continue;
@@ -217,13 +221,13 @@ namespace MxIR
 			bp.usedVar.clear();
 			for (auto &ins : block->ins)
 			{
-				for (Operand *operand : ins.getOutputReg())
+				for (Operand *operand : ins.outputRegs())
 				{
 					if (operand->val == Operand::InvalidID)
 						continue;
 					bp.definedVar.insert(operand->val);
 				}
-				for (Operand *operand : ins.getInputReg())
+				for (Operand *operand : ins.inputRegs())
 				{
 					if (operand->val == Operand::InvalidID)
 						continue;
@@ -234,78 +238,163 @@ namespace MxIR
 		});
 	}
 
+	size_t * RegisterAllocatorSSA::findNextUse(NextUseList &list, size_t var)
+	{
+		auto iter = std::lower_bound(list.begin(), list.end(), std::make_pair(var, size_t(0)));
+		if (iter == list.end() || iter->first != var)
+			return nullptr;
+		return &iter->second;
+	}
+
 	void RegisterAllocatorSSA::computeNextUse()
 	{
+		static const size_t INF = size_t(-1);
+
+		//the distance to the first use in the block of each var used before defined
+		std::vector<size_t> firstUse(nVar, INF);
+		std::vector<size_t> touched;
+		std::map<Block *, DynamicBitset> keyBegin, keyEnd;	//vars having a next use at the begin/end of the block
 		std::queue<Block *> Q;
-		std::map<Block *, std::set<size_t>> updatedVar;
-		auto updateNextUseOut = [&Q, &updatedVar, this](Block *block, size_t var, size_t newDistance)
+		std::set<Block *> inQueue;
+		auto push = [&Q, &inQueue](Block *block)
+		{
+			if (inQueue.insert(block).second)
+				Q.push(block);
+		};
+		func.inBlock->traverse([&firstUse, &touched, &keyBegin, &push, this](Block *block) -> bool
 		{
 			BlockProperty &bp = property[block];
-			if (!bp.nextUseEnd.count(var) || newDistance < bp.nextUseEnd[var])
+			ssize_t curInsn = block->ins.size() - 1;
+			for (auto iter = block->ins.rbegin(); iter != block->ins.rend(); ++iter, curInsn--)
 			{
-				bp.nextUseEnd[var] = newDistance;
-				if (updatedVar[block].empty())
-					Q.push(block);
-				updatedVar[block].insert(var);
+				for (Operand *operand : iter->outputRegs() | needreg)
+					firstUse[operand->val] = INF;
+				for (Operand *operand : iter->inputRegs() | needreg)
+				{
+					firstUse[operand->val] = curInsn;
+					touched.push_back(operand->val);
+				}
 			}
+			std::sort(touched.begin(), touched.end());
+			touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+			bp.nextUseBegin.clear();
+			DynamicBitset &keys = keyBegin[block];
+			for (size_t var : touched)
+			{
+				if (firstUse[var] != INF)
+				{
+					bp.nextUseBegin.emplace_back(var, firstUse[var]);
+					keys.insert(var);
+				}
+				firstUse[var] = INF;
+			}
+			touched.clear();
+			push(block);
+			return true;
+		});
+
+		//find the vars having a next use: the uses flow into the preds through the phi srcs if the var is a phi dst,
+		//and from the end to the begin of a block if the var is not defined in it
+		auto addKeyEnd = [&keyBegin, &keyEnd, &push, this](Block *block, const DynamicBitset &vars)
+		{
+			if (!keyEnd[block].unionWith(vars))
+				return;
+			DynamicBitset add = keyEnd[block];
+			add.subtract(property[block].definedVar);
+			if (keyBegin[block].unionWith(add))
+				push(block);
 		};
-		auto updatePred = [&updateNextUseOut, this](Block *block, size_t var)
+		while (!Q.empty())
 		{
-			BlockProperty &bp = property[block];
-			if (block->phi.count(var))
+			Block *block = Q.front();
+			Q.pop();
+			inQueue.erase(block);
+			DynamicBitset pass = keyBegin[block];
+			for (auto &kv : block->phi)
 			{
-				for (auto &src : block->phi[var].srcs)
+				pass.erase(kv.first);
+				if (!keyBegin[block].count(kv.first))
+					continue;
+				for (auto &src : kv.second.srcs)
 				{
 					if (!src.first.isReg())
 						continue;
-					std::shared_ptr<Block> pred = src.second.lock();
-					BlockProperty &bpPred = property[pred.get()];
-					size_t newDistance = bpPred.loopBorder.count(block) ? outLoopPenalty + bp.nextUseBegin[var] : bp.nextUseBegin[var];
-					updateNextUseOut(pred.get(), src.first.val, newDistance);
+					DynamicBitset var;
+					var.insert(src.first.val);
+					addKeyEnd(src.second.lock().get(), var);
 				}
 			}
-			else
+			for (Block *pred : block->preds)
+				addKeyEnd(pred, pass);
+		}
+
+		//relax the distances, which only decrease, until nothing changes
+		for (auto &kv : keyBegin)
+		{
+			BlockProperty &bp = property[kv.first];
+			NextUseList list;
+			auto iterFirstUse = bp.nextUseBegin.cbegin();
+			for (size_t var : kv.second)
 			{
-				for (Block *pred : block->preds)
-				{
-					BlockProperty &bpPred = property[pred];
-					size_t newDistance = bpPred.loopBorder.count(block) ? outLoopPenalty + bp.nextUseBegin[var] : bp.nextUseBegin[var];
-					updateNextUseOut(pred, var, newDistance);
-				}
+				if (iterFirstUse != bp.nextUseBegin.cend() && iterFirstUse->first == var)
+					list.push_back(*iterFirstUse++);
+				else
+					list.emplace_back(var, INF);
 			}
-		};
-		func.inBlock->traverse([&updatePred, this](Block *block) -> bool
+			bp.nextUseBegin = std::move(list);
+			push(kv.first);
+		}
+		for (auto &kv : keyEnd)
 		{
-			BlockProperty &bp = property[block];
-			ssize_t curInsn = block->ins.size() - 1;
-			for (auto iter = block->ins.rbegin(); iter != block->ins.rend(); ++iter, curInsn--)
+			BlockProperty &bp = property[kv.first];
+			bp.nextUseEnd.clear();
+			for (size_t var : kv.second)
+				bp.nextUseEnd.emplace_back(var, INF);
+		}
+		auto updateNextUseOut = [&push, this](Block *block, BlockProperty &bp, size_t var, size_t newDistance)
+		{
+			size_t *distEnd = findNextUse(bp.nextUseEnd, var);
+			assert(distEnd);
+			if (newDistance >= *distEnd)
+				return;
+			*distEnd = newDistance;
+			if (bp.definedVar.count(var))
+				return;
+			size_t *distBegin = findNextUse(bp.nextUseBegin, var);
+			assert(distBegin);
+			if (newDistance + block->ins.size() < *distBegin)
 			{
-				for (Operand *operand : iter->getOutputReg() | needreg)
-					bp.nextUseBegin.erase(operand->val);
-				for (Operand *operand : iter->getInputReg() | needreg)
-					bp.nextUseBegin[operand->val] = curInsn;
+				*distBegin = newDistance + block->ins.size();
+				push(block);
 			}
-			for (auto &kv : bp.nextUseBegin)
-				updatePred(block, kv.first);
-			return true;
-		});
+		};
 		while (!Q.empty())
 		{
 			Block *block = Q.front();
 			Q.pop();
+			inQueue.erase(block);
 			BlockProperty &bp = property[block];
-			std::vector<size_t> vars;
-			for (size_t var : updatedVar[block])
-				vars.push_back(var);
-			updatedVar[block].clear();
-			for (size_t var : vars)
-			{
-				if (!bp.definedVar.count(var))
-					if (!bp.nextUseBegin.count(var) || bp.nextUseEnd[var] + block->ins.size() < bp.nextUseBegin[var])
-					{
-						bp.nextUseBegin[var] = bp.nextUseEnd[var] + block->ins.size();
-						updatePred(block, var);
-					}
+			for (auto &kv : block->phi)
+			{
+				size_t *dist = findNextUse(bp.nextUseBegin, kv.first);
+				if (!dist || *dist == INF)
+					continue;
+				for (auto &src : kv.second.srcs)
+				{
+					if (!src.first.isReg())
+						continue;
+					std::shared_ptr<Block> pred = src.second.lock();
+					BlockProperty &bpPred = property[pred.get()];
+					updateNextUseOut(pred.get(), bpPred, src.first.val, bpPred.loopBorder.count(block) ? outLoopPenalty + *dist : *dist);
+				}
+			}
+			for (Block *pred : block->preds)
+			{
+				BlockProperty &bpPred = property[pred];
+				size_t penalty = bpPred.loopBorder.count(block) ? outLoopPenalty : 0;
+				for (auto &kv : bp.nextUseBegin)
+					if (kv.second != INF && !block->phi.count(kv.first))
+						updateNextUseOut(pred, bpPred, kv.first, penalty + kv.second);
 			}
 		}
 
@@ -314,11 +403,12 @@ namespace MxIR
 			BlockProperty &bp = property[block];
 			for (auto iter = block->phi.cbegin(); iter != block->phi.cend();)
 			{
-				if (!bp.nextUseBegin.count(iter->first))
+				if (!findNextUse(bp.nextUseBegin, iter->first))
 					iter = block->phi.erase(iter);
 				else
 					++iter;
 			}
+			assert(std::none_of(bp.nextUseBegin.begin(), bp.nextUseBegin.end(), [](const std::pair<size_t, size_t> &kv) { return kv.second == INF; }));
 
 			/*std::stringstream ss;
 			ss << "nextUseBegin: ";
@@ -352,7 +442,7 @@ namespace MxIR
 			ssize_t curIns = block->ins.size() - 1;
 			for (auto iter = block->ins.rbegin(); iter != block->ins.rend(); iter++)
 			{
-				for (Operand *operand : iter->getInputReg() | needreg)
+				for (Operand *operand : iter->inputRegs() | needreg)
 				{
 					if (!lastUse.count(operand->val))
 						lastUse[operand->val] = curIns;
@@ -389,7 +479,7 @@ namespace MxIR
 					assert(lastUseInsn[curIns] <= pressure);
 					pressure -= lastUseInsn[curIns];
 				}
-				for (Operand *operand : ins.getOutputReg() | needreg)
+				for (Operand *operand : ins.outputRegs() | needreg)
 				{
 					pressure++;
 					bp.maxPressure = std::max(bp.maxPressure, pressure);
@@ -406,7 +496,7 @@ namespace MxIR
 		{
 			for (auto &ins : block->instructions())
 			{
-				for (Operand *operand : ins.getOutputReg())
+				for (Operand *operand : ins.outputRegs())
 				{
 					if (operand->val == Operand::InvalidID)
 						continue;
@@ -466,7 +556,7 @@ namespace MxIR
 					assert(src.first.size() == phi.dst.size());
 					assert(src.first.size() == varOp[src.first.val].size());
 					
-					if (ifGraph[findVertexRoot(src.first.val)].neighbor.count(findVertexRoot(phi.dst.val)))
+					if (isInterfering(findVertexRoot(src.first.val), findVertexRoot(phi.dst.val)))
 						copySrc(src);
 					else
 					{
@@ -489,11 +579,11 @@ namespace MxIR
 					{
 						size_t rootI = findVertexRoot(iterI->first);
 						size_t rootJ = findVertexRoot(iterJ->first);
-						if (!ifGraph[rootI].neighbor.count(rootJ) && !ifGraph[rootJ].neighbor.count(rootI))
+						if (!isInterfering(rootI, rootJ))
 							solver.link(iterI->second, iterJ->second);
 					}
 				std::set<size_t> setMaxClique;
-				for (size_t vtx : solver.findMaxClique())
+				for (size_t vtx : findClique(solver, maxUnitCliqueSteps))
 					setMaxClique.insert(vtx);
 				for (size_t i = 0; i < regSrc.size(); i++)
 				{
@@ -551,6 +641,28 @@ namespace MxIR
 		}
 	}
 
+	void RegisterAllocatorSSA::computeRematerializable()
+	{
+		//a var moved from a constant, or copied from such a var, is recomputed instead of being stored and loaded,
+		//unless its group has other vars sharing its memory
+		std::vector<size_t> groupSize(nVar);
+		for (size_t vreg = 0; vreg < nVar; vreg++)
+			groupSize[varGroup[vreg] - nVar]++;
+		func.inBlock->traverse_rev_postorder([&groupSize, this](Block *block) -> bool
+		{
+			for (auto &ins : block->ins)
+			{
+				if (ins.oper != Move || !needreg(ins.dst) || groupSize[varGroup[ins.dst.val] - nVar] != 1 || externalVarHint.count(ins.dst.val))
+					continue;
+				if (ins.src1.isConst())
+					rematValue[ins.dst.val] = ins.src1;
+				else if (needreg(ins.src1) && rematValue.count(ins.src1.val))
+					rematValue[ins.dst.val] = rematValue[ins.src1.val];
+			}
+			return true;
+		});
+	}
+
 	void RegisterAllocatorSSA::spillRegister()
 	{
 		func.inBlock->traverse_rev_postorder([this](Block *block) -> bool
@@ -595,7 +707,7 @@ namespace MxIR
 					size_t vreg = vregPred;
 					if (mapPhiDst[pred].count(vregPred))
 						vreg = mapPhiDst[pred][vregPred];
-					if (!property[block].Wentry.count(vreg))
+					if (!property[block].Wentry.count(vreg) && !rematValue.count(vregPred))
 						pred->ins.insert(position, getSpillInsn(vregPred));
 				}
 				for (size_t vreg : property[block].Wentry)
@@ -649,7 +761,7 @@ namespace MxIR
 		ssize_t curInsn = block->ins.size() - 1;
 		for (auto iter = block->ins.rbegin(); iter != block->ins.rend(); ++iter)
 		{
-			for (Operand *operand : iter->getInputReg() | needreg)
+			for (Operand *operand : iter->inputRegs() | needreg)
 			{
 				//if (varUse[operand->val].empty() || varUse[operand->val].top() != curInsn)
 				varUse[operand->val].push(curInsn);
@@ -671,19 +783,19 @@ namespace MxIR
 			W.push_back(vreg);
 		std::make_heap(W.begin(), W.end(), cmpVarUse);
 
-		auto limitReg = [&W, &cmpVarUse, &varUse, block, this](size_t maxReg, std::list<Instruction>::iterator pos)
+		auto limitReg = [&W, &cmpVarUse, &varUse, block, this](size_t maxReg, InsList::iterator pos)
 		{
 			while (W.size() > maxReg)
 			{
 				std::pop_heap(W.begin(), W.end(), cmpVarUse);
-				if (!varUse[W.back()].empty())
+				if (!varUse[W.back()].empty() && !rematValue.count(W.back()))
 				{
 					// Spill the register as early as possible
 					auto iterInsert = pos;
 					for (; iterInsert != block->ins.begin(); --iterInsert)
 					{
 						bool regInUse = false;
-						for (Operand *operand : join<Operand *>(std::prev(iterInsert)->getInputReg(), std::prev(iterInsert)->getOutputReg()))
+						for (Operand *operand : join<Operand *>(std::prev(iterInsert)->inputRegs(), std::prev(iterInsert)->outputRegs()))
 						{
 							if (operand->val == W.back())
 							{
@@ -787,7 +899,7 @@ namespace MxIR
 
 			std::vector<size_t> reload;
 			size_t nOperandLastUse = 0;
-			for (Operand *operand : iter->getInputReg() | needreg)
+			for (Operand *operand : iter->inputRegs() | needreg)
 			{
 				if (std::find(W.begin(), W.end(), operand->val) == W.end())
 				{
@@ -801,7 +913,7 @@ namespace MxIR
 			limitReg(remainRegister, iter);
 			
 			std::vector<size_t> outRegValid;
-			for (Operand *operand : iter->getOutputReg() | hasreg)
+			for (Operand *operand : iter->outputRegs() | hasreg)
 			{
 				if (operand->pregid != -1 && lastLock.count(operand->pregid))
 					manuallyAllocVar[operand->pregid] = operand->val;
@@ -810,7 +922,7 @@ namespace MxIR
 			}
 			limitReg(remainRegister - outRegValid.size() + nOperandLastUse, iter);
 
-			for (Operand *operand : iter->getInputReg() | needreg)
+			for (Operand *operand : iter->inputRegs() | needreg)
 			{
 				assert(varUse[operand->val].top() == curInsn);
 				varUse[operand->val].pop();
@@ -829,12 +941,14 @@ namespace MxIR
 		}
 
 		for (size_t vreg : W)
-			if (property[block].nextUseEnd.count(vreg))
+			if (findNextUse(property[block].nextUseEnd, vreg))
 				property[block].Wexit.insert(vreg);
 	}
 
 	Instruction RegisterAllocatorSSA::getLoadInsn(size_t regid)
 	{
+		if (rematValue.count(regid))
+			return IR(varOp[regid], Move, rematValue[regid]);
 		Operand op = RegPtr(varGroup[regid]);
 		op.noreg = true;
 		return IR(varOp[regid], Load, op);
@@ -853,6 +967,11 @@ namespace MxIR
 		std::vector<size_t> livethrough;
 		for (auto &kv : property[block].nextUseBegin)
 			alive.insert(kv.first);
+		auto nextUse = [this, block](size_t vreg) -> size_t
+		{
+			size_t *dist = findNextUse(property[block].nextUseBegin, vreg);
+			return dist ? *dist : 0;
+		};
 
 		size_t maxPressure = 0;
 		std::set<Block *> tmp({ block });
@@ -861,7 +980,7 @@ namespace MxIR
 			maxPressure = std::max(maxPressure, property[blkBody].maxPressure);
 			for (auto &ins : blkBody->instructions())
 			{
-				for (Operand *operand : ins.getInputReg())
+				for (Operand *operand : ins.inputRegs())
 				{
 					if (operand->val == Operand::InvalidID)
 						continue;
@@ -882,8 +1001,7 @@ namespace MxIR
 			if (maxPressure - livethrough.size() < phyReg.size())
 			{
 				size_t freeReg = phyReg.size() + livethrough.size() - maxPressure;
-				std::sort(livethrough.begin(), livethrough.end(),
-					[this, block](size_t a, size_t b) { return property[block].nextUseBegin[a] < property[block].nextUseBegin[b]; });
+				std::sort(livethrough.begin(), livethrough.end(), [&nextUse](size_t a, size_t b) { return nextUse(a) < nextUse(b); });
 				for (size_t i = 0; i < freeReg && i < livethrough.size(); i++)
 					property[block].Wentry.insert(livethrough[i]);
 			}
@@ -893,8 +1011,7 @@ namespace MxIR
 			std::vector<size_t> vCand;
 			for (size_t vreg : cand)
 				vCand.push_back(vreg);
-			std::sort(vCand.begin(), vCand.end(),
-				[this, block](size_t a, size_t b) { return property[block].nextUseBegin[a] < property[block].nextUseBegin[b]; });
+			std::sort(vCand.begin(), vCand.end(), [&nextUse](size_t a, size_t b) { return nextUse(a) < nextUse(b); });
 			for (size_t i = 0; i < phyReg.size(); i++)
 				property[block].Wentry.insert(vCand[i]);
 		}
@@ -941,8 +1058,13 @@ namespace MxIR
 			std::vector<size_t> vCand;
 			for (size_t vreg : cand)
 				vCand.push_back(vreg);
-			std::sort(vCand.begin(), vCand.end(),
-				[this, block](size_t a, size_t b) { return property[block].nextUseBegin[a] < property[block].nextUseBegin[b]; });
+			//vars without a next use in this block are taken as distance 0
+			auto nextUse = [this, block](size_t vreg) -> size_t
+			{
+				size_t *dist = findNextUse(property[block].nextUseBegin, vreg);
+				return dist ? *dist : 0;
+			};
+			std::sort(vCand.begin(), vCand.end(), [&nextUse](size_t a, size_t b) { return nextUse(a) < nextUse(b); });
 			for (size_t i = 0; i < phyReg.size() - take && i < vCand.size(); i++)
 				property[block].Wentry.insert(vCand[i]);
 		}
@@ -968,7 +1090,7 @@ namespace MxIR
 
 	void RegisterAllocatorSSA::eliminateSpillCode(size_t idx, std::set<size_t> &spilled)
 	{
-		Block *block = vBlock[idx];
+		Block *block = analysis.blocks()[idx];
 		for (auto iter = block->ins.cbegin(); iter != block->ins.cend();)
 		{
 			if (isSpill(*iter))
@@ -982,13 +1104,34 @@ namespace MxIR
 			}
 			++iter;
 		}
-		for (size_t child : dtree.getDomChildren(idx))
+		for (size_t child : analysis.domTree().getDomChildren(idx))
 			eliminateSpillCode(child, spilled);
 		for (auto &ins : block->ins)
 			if(isSpill(ins))
 				spilled.erase(ins.dst.val);
 	}
 
+	void RegisterAllocatorSSA::countSpillCode()
+	{
+		std::int64_t spills = 0, reloads = 0, remats = -std::int64_t(rematValue.size());	//the original definitions are not counted
+		func.inBlock->traverse([&spills, &reloads, &remats, this](Block *block) -> bool
+		{
+			for (auto &ins : block->ins)
+			{
+				if (isSpill(ins))
+					spills++;
+				else if (isReload(ins))
+					reloads++;
+				else if (ins.oper == Move && needreg(ins.dst) && rematValue.count(ins.dst.val))
+					remats++;
+			}
+			return true;
+		});
+		CompileStats::count("spills", spills);
+		CompileStats::count("reloads", reloads);
+		CompileStats::count("remats", remats);
+	}
+
 	void RegisterAllocatorSSA::insertAllocateCode()
 	{
 		std::set<size_t> allocated;
@@ -1011,7 +1154,7 @@ namespace MxIR
 
 	void RegisterAllocatorSSA::reconstructSSA()
 	{
-		SSAReconstructor reconstructor(func);
+		SSAReconstructor reconstructor(func, analysis);
 		reconstructor.preprocess();
 		reconstructor.reconstructAuto();
 	}
@@ -1025,31 +1168,20 @@ namespace MxIR
 		}
 
 		std::queue<Block *> Q;
-		std::map<Block *, std::set<size_t>> updatedVar;
-		auto newLiveOut = [&Q, &updatedVar, this](Block *block, size_t var)
+		std::set<Block *> inQueue;
+		auto addLiveOut = [&Q, &inQueue, this](Block *block, const DynamicBitset &vars)
 		{
-			BlockProperty &bp = property[block];
-			if (!bp.liveOut.count(var))
-			{
-				bp.liveOut.insert(var);
-				if (updatedVar[block].empty())
-					Q.push(block);
-				updatedVar[block].insert(var);
-			}
-		};
-		auto updatedLiveIn = [&newLiveOut](Block *block, size_t var)
-		{
-			for (Block *pred : block->preds)
-				newLiveOut(pred, var);
+			if (property[block].liveOut.unionWith(vars) && inQueue.insert(block).second)
+				Q.push(block);
 		};
-		func.inBlock->traverse([&newLiveOut, &updatedLiveIn, this](Block *block) -> bool
+		func.inBlock->traverse([&addLiveOut, this](Block *block) -> bool
 		{
 			BlockProperty &bp = property[block];
 			for (auto iter = block->ins.rbegin(); iter != block->ins.rend(); ++iter)
 			{
-				for (Operand *operand : iter->getOutputReg() | needreg)
+				for (Operand *operand : iter->outputRegs() | needreg)
 					bp.liveIn.erase(operand->val);
-				for (Operand *operand : iter->getInputReg() | needreg)
+				for (Operand *operand : iter->inputRegs() | needreg)
 					bp.liveIn.insert(operand->val);
 			}
 			for (auto &kv : block->phi)
@@ -1059,31 +1191,30 @@ namespace MxIR
 				{
 					if (!src.first.isReg())
 						continue;
-					std::shared_ptr<Block> pred = src.second.lock();
-					newLiveOut(pred.get(), src.first.val);
+					DynamicBitset var;
+					var.insert(src.first.val);
+					addLiveOut(src.second.lock().get(), var);
 				}
 			}
-			for (size_t var : bp.liveIn)
-				updatedLiveIn(block, var);
+			for (Block *pred : block->preds)
+				addLiveOut(pred, bp.liveIn);
 			return true;
 		});
 		while (!Q.empty())
 		{
 			Block *block = Q.front();
 			Q.pop();
+			inQueue.erase(block);
 			BlockProperty &bp = property[block];
-			std::vector<size_t> vars;
-			for (size_t var : updatedVar[block])
-				vars.push_back(var);
-			updatedVar[block].clear();
-			for (size_t var : vars)
-			{
-				if (!bp.definedVar.count(var) && !bp.usedVar.count(var) && !block->phi.count(var))
-				{
-					bp.liveIn.insert(var);
-					updatedLiveIn(block, var);
-				}
-			}
+			DynamicBitset add = bp.liveOut;
+			add.subtract(bp.definedVar);
+			add.subtract(bp.usedVar);
+			for (auto &kv : block->phi)
+				add.erase(kv.first);
+			if (!bp.liveIn.unionWith(add))
+				continue;
+			for (Block *pred : block->preds)
+				addLiveOut(pred, bp.liveIn);
 		}
 
 #if defined(_DEBUG) && !defined(NDEBUG)
@@ -1116,34 +1247,55 @@ namespace MxIR
 		ifGraph.resize(nVar);
 		for (size_t i = 0; i < ifGraph.size(); i++)
 			ifGraph[i].root = i;
+		//without the matrix, isInterfering falls back to a binary search on the adjacency vectors
+		useAdjMatrix = nVar <= maxMatrixVar;
+		adjMatrix = useAdjMatrix ? DynamicBitset(nVar * (nVar + 1) / 2) : DynamicBitset();
+
+		static const size_t npos = size_t(-1);
+		std::vector<size_t> remainUses(nVar, 0);	//vreg id -> number of uses not visited yet, the live out counts as one use
+		std::vector<size_t> touched;
+		std::vector<size_t> live, livePos(nVar, npos);	//the set of live vregs and the position of each vreg in it
+		auto insertLive = [&live, &livePos](size_t vreg)
+		{
+			if (livePos[vreg] != npos)
+				return;
+			livePos[vreg] = live.size();
+			live.push_back(vreg);
+		};
+		auto eraseLive = [&live, &livePos](size_t vreg)
+		{
+			if (livePos[vreg] == npos)
+				return;
+			live[livePos[vreg]] = live.back();
+			livePos[live.back()] = livePos[vreg];
+			live.pop_back();
+			livePos[vreg] = npos;
+		};
 
-		func.inBlock->traverse([this](Block *block) -> bool
+		func.inBlock->traverse([&remainUses, &touched, &live, &livePos, &insertLive, &eraseLive, this](Block *block) -> bool
 		{
 			BlockProperty &bp = property[block];
-			std::map<size_t, std::stack<ssize_t>> uses;
 			for (size_t vreg : bp.liveOut)
-				uses[vreg].push(-1);
-			ssize_t curInsn = block->ins.size() - 1;
-			for (auto iter = block->ins.rbegin(); iter != block->ins.rend(); ++iter)
 			{
-				for (Operand *operand : iter->getInputReg() | needreg)
+				remainUses[vreg]++;
+				touched.push_back(vreg);
+			}
+			for (auto &ins : block->ins)
+				for (Operand *operand : ins.inputRegs() | needreg)
 				{
-					uses[operand->val].push(curInsn);
+					remainUses[operand->val]++;
+					touched.push_back(operand->val);
 				}
-				curInsn--;
-			}
 			
 			std::shared_ptr<std::set<int>> forbiddenReg;
-			std::set<size_t> live = bp.liveIn;
-			auto interfere = [&live, &forbiddenReg, this](size_t vreg, std::shared_ptr<std::set<int>> altForbiddenReg)
+			for (size_t vreg : bp.liveIn)
+				insertLive(vreg);
+			auto interfere = [&live, &livePos, &forbiddenReg, this](size_t vreg, std::shared_ptr<std::set<int>> altForbiddenReg)
 			{
-				assert(!live.count(vreg));
+				assert(livePos[vreg] == npos);
 				//assert(live.size() <= phyReg.size() - (forbiddenReg ? forbiddenReg->size() : 0));
 				for (size_t neighbor : live)
-				{
-					ifGraph[vreg].neighbor.insert(neighbor);
-					ifGraph[neighbor].neighbor.insert(vreg);
-				}
+					addEdge(vreg, neighbor);
 				if (!altForbiddenReg)
 					ifGraph[vreg].forbiddenReg = forbiddenReg;
 				else
@@ -1152,10 +1304,9 @@ namespace MxIR
 			for (auto &kv : block->phi)
 			{
 				interfere(kv.first, nullptr);
-				if (!uses[kv.first].empty())
-					live.insert(kv.first);
+				if (remainUses[kv.first])
+					insertLive(kv.first);
 			}
-			curInsn = 0;
 			for (auto &ins : block->ins)
 			{
 				if (ins.oper == LockReg)
@@ -1174,11 +1325,11 @@ namespace MxIR
 					continue;
 				}
 
-				for (Operand *operand : ins.getInputReg() | needreg)
+				for (Operand *operand : ins.inputRegs() | needreg)
 				{
-					uses[operand->val].pop();
-					if (uses[operand->val].empty())
-						live.erase(operand->val);
+					assert(remainUses[operand->val] > 0);
+					if (--remainUses[operand->val] == 0)
+						eraseLive(operand->val);
 				}
 
 				std::shared_ptr<std::set<int>> alternative;
@@ -1187,7 +1338,7 @@ namespace MxIR
 				else
 					alternative.reset(new std::set<int>());
 				bool enableAlternative = false;
-				for (Operand *operand : ins.getOutputReg() | hasreg)
+				for (Operand *operand : ins.outputRegs() | hasreg)
 				{
 					if (operand->pregid != -1)
 					{
@@ -1196,7 +1347,7 @@ namespace MxIR
 					}
 				}
 
-				for (Operand *operand : ins.getOutputReg() | needreg)
+				for (Operand *operand : ins.outputRegs() | needreg)
 				{
 					if (operand->pregid != -1)
 					{
@@ -1213,18 +1364,47 @@ namespace MxIR
 						else
 							interfere(operand->val, alternative);
 					}
-					//if (!uses[operand->val].empty())
-					live.insert(operand->val);
+					//if (remainUses[operand->val])
+					insertLive(operand->val);
 				}
-				for (Operand *operand : ins.getOutputReg() | needreg)
+				for (Operand *operand : ins.outputRegs() | needreg)
 				{
-					if (uses[operand->val].empty())
-						live.erase(operand->val);
+					if (!remainUses[operand->val])
+						eraseLive(operand->val);
 				}
-				curInsn++;
 			}
+
+			while (!live.empty())
+				eraseLive(live.back());
+			for (size_t vreg : touched)
+				remainUses[vreg] = 0;
+			touched.clear();
+			//the liveness of the block is not used any more
+			bp.liveIn = DynamicBitset();
+			bp.liveOut = DynamicBitset();
 			return true;
 		});
+
+		for (auto &vertex : ifGraph)
+		{
+			std::sort(vertex.neighbor.begin(), vertex.neighbor.end());
+			vertex.neighbor.erase(std::unique(vertex.neighbor.begin(), vertex.neighbor.end()), vertex.neighbor.end());
+		}
+	}
+
+	void RegisterAllocatorSSA::addEdge(size_t u, size_t v)
+	{
+		if (useAdjMatrix && !adjMatrix.insert(matrixIndex(u, v)))
+			return;
+		ifGraph[u].neighbor.push_back(v);
+		ifGraph[v].neighbor.push_back(u);
+	}
+
+	bool RegisterAllocatorSSA::isInterfering(size_t u, size_t v) const
+	{
+		if (useAdjMatrix)
+			return adjMatrix.count(matrixIndex(u, v));
+		return std::binary_search(ifGraph[u].neighbor.begin(), ifGraph[u].neighbor.end(), v);
 	}
 
 	void RegisterAllocatorSSA::allocateRegister()
@@ -1234,7 +1414,7 @@ namespace MxIR
 
 	void RegisterAllocatorSSA::allocateRegisterDFS(size_t idx)
 	{
-		Block *block = vBlock[idx];
+		Block *block = analysis.blocks()[idx];
 		for (auto &ins : block->instructions())
 		{
 			std::vector<int> prefer;
@@ -1257,7 +1437,7 @@ namespace MxIR
 			}
 			if (ins.hint == InstructionBase::PreferAnyOfOperands || ins.hint == InstructionBase::PreferOperands)
 			{
-				for (Operand *operand : ins.getInputReg())
+				for (Operand *operand : ins.inputRegs())
 				{
 					if (operand->pregid != -1)
 						prefer.push_back(operand->pregid);
@@ -1265,11 +1445,11 @@ namespace MxIR
 						prefer.push_back(ifGraph[operand->val].preg);
 				}
 			}
-			for (Operand *operand : ins.getOutputReg() | needreg)
+			for (Operand *operand : ins.outputRegs() | needreg)
 				ifGraph[operand->val].preg = chooseRegister(operand->val, prefer);
 		}
 
-		for (size_t child : dtree.getDomChildren(idx))
+		for (size_t child : analysis.domTree().getDomChildren(idx))
 			allocateRegisterDFS(child);
 	}
 
@@ -1284,7 +1464,6 @@ namespace MxIR
 					return false;
 			return true;
 		};
-		static int lastReg = phyReg[phyReg.size() - 1];
 		for (int preg : prefer)
 			if (testRegister(preg))
 				return lastReg = preg;
@@ -1323,6 +1502,17 @@ namespace MxIR
 		return ifGraph[findVertexRoot(operand.val)].preg;
 	}
 
+	const std::vector<size_t> & RegisterAllocatorSSA::findClique(MaxClique &solver, size_t budget)
+	{
+		//the exact search is exponential in the worst case, so wide phi webs get a greedy clique
+		//once the unit or the whole function has used up its steps
+		const std::vector<size_t> &clique = solver.findMaxClique(std::min(budget, cliqueBudget));
+		cliqueBudget -= std::min(cliqueBudget, solver.getStepsUsed());
+		if (solver.isExhausted())
+			cliqueFallbacks++;
+		return clique;
+	}
+
 	void RegisterAllocatorSSA::coalesce()
 	{
 		struct OUcmp
@@ -1382,11 +1572,11 @@ namespace MxIR
 					continue;
 				if (ins.hint == InstructionBase::PreferAnyOfOperands)
 				{
-					for (Operand *opOut : ins.getOutputReg() | hasreg)
+					for (Operand *opOut : ins.outputRegs() | hasreg)
 					{
 						clearOptim();
 						bool flag = false;
-						for (Operand *opIn : ins.getInputReg() | hasreg)
+						for (Operand *opIn : ins.inputRegs() | hasreg)
 						{
 							if (getPReg(*opOut) == getPReg(*opIn))
 							{
@@ -1438,11 +1628,11 @@ namespace MxIR
 				}
 				else if (ins.hint == InstructionBase::PreferOperands)
 				{
-					for (Operand *opOut : ins.getOutputReg() | needreg)
+					for (Operand *opOut : ins.outputRegs() | needreg)
 					{
 						clearOptim();
 						std::vector<size_t> srcVar;
-						for (Operand *opIn : ins.getInputReg() | needreg)
+						for (Operand *opIn : ins.inputRegs() | needreg)
 							srcVar.push_back(opIn->val);
 						OptimUnitAll OU(*this, opOut->val, srcVar);
 						for (int preg : phyReg)
@@ -1517,7 +1707,7 @@ namespace MxIR
 		{
 			size_t idx;
 			int oldReg;
-			std::set<size_t>::const_iterator iter;
+			std::vector<size_t>::const_iterator iter;
 		};
 		std::stack<stkInfo> stk;
 		stk.push(stkInfo{ src, getCurrentReg(src), allocator.ifGraph[src].neighbor.cbegin() });
@@ -1574,7 +1764,7 @@ namespace MxIR
 		return -1;
 	}
 
-	RegisterAllocatorSSA::OptimUnitAll::OptimUnitAll(RegisterAllocatorSSA &allocator, size_t key, const std::vector<size_t> &another) : OptimUnit(allocator, 2, -1)
+	RegisterAllocatorSSA::OptimUnitAll::OptimUnitAll(RegisterAllocatorSSA &allocator, size_t key, const std::vector<size_t> &another) : OptimUnit(allocator, 2, -1), budget(maxUnitCliqueSteps)
 	{
 		keyVertex = allocator.findVertexRoot(key);
 		vertices.insert(keyVertex);
@@ -1583,13 +1773,13 @@ namespace MxIR
 			var = allocator.findVertexRoot(var);
 			if (var == keyVertex)
 				continue;
-			if (!allocator.ifGraph[keyVertex].neighbor.count(var) && !allocator.ifGraph[var].neighbor.count(keyVertex))
+			if (!allocator.isInterfering(keyVertex, var))
 				vertices.insert(var);
 		}
 		for (auto iterI = vertices.begin(); iterI != vertices.end(); ++iterI)
 			for (auto iterJ = std::next(iterI); iterJ != vertices.end(); ++iterJ)
 			{
-				if (allocator.ifGraph[*iterI].neighbor.count(*iterJ) || allocator.ifGraph[*iterJ].neighbor.count(*iterI))
+				if (allocator.isInterfering(*iterI, *iterJ))
 				{
 					edges.insert(std::make_pair(*iterI, *iterJ));
 					edges.insert(std::make_pair(*iterJ, *iterI));
@@ -1636,15 +1826,16 @@ namespace MxIR
 					!edges.count(std::make_pair(originalID[j], originalID[i])))
 					clique.link(i, j);
 			}
-		for (size_t t : clique.findMaxClique())
+		for (size_t t : allocator.findClique(clique, budget))
 			S.insert(originalID[t]);
+		budget -= std::min(budget, clique.getStepsUsed());
 	}
 
 	RegisterAllocatorSSA::OptimUnitOne::OptimUnitOne(RegisterAllocatorSSA &allocator, size_t u, size_t v) : OptimUnit(allocator, 2, -1)
 	{
 		keyVertex = allocator.findVertexRoot(u);
 		another = allocator.findVertexRoot(v);
-		if (keyVertex != another && !allocator.ifGraph[keyVertex].neighbor.count(another) && !allocator.ifGraph[another].neighbor.count(keyVertex))
+		if (keyVertex != another && !allocator.isInterfering(keyVertex, another))
 			S.insert({ keyVertex, another });
 	}
 
@@ -1677,7 +1868,7 @@ namespace MxIR
 		func.inBlock->traverse([this](Block *block) -> bool
 		{
 			for (auto &ins : block->instructions())
-				for (Operand *operand : join<Operand *>(ins.getInputReg() | needreg, ins.getOutputReg() | needreg))
+				for (Operand *operand : join<Operand *>(ins.inputRegs() | needreg, ins.outputRegs() | needreg))
 				{
 					operand->pregid = ifGraph[findVertexRoot(operand->val)].preg;
 				}
@@ -1732,12 +1923,28 @@ namespace MxIR
 			if (vtx == root)
 				continue;
 			assert(ifGraph[vtx].preg == ifGraph[root].preg);
+			std::vector<size_t> &rootNeighbor = ifGraph[root].neighbor;
+			std::vector<size_t> merged;
+			std::set_union(rootNeighbor.begin(), rootNeighbor.end(), ifGraph[vtx].neighbor.begin(), ifGraph[vtx].neighbor.end(), std::back_inserter(merged));
+			merged.erase(std::remove(merged.begin(), merged.end(), vtx), merged.end());
+			rootNeighbor = std::move(merged);
 			for (size_t neighbor : ifGraph[vtx].neighbor)
 			{
 				assert(neighbor != vtx);
-				ifGraph[root].neighbor.insert(neighbor);
-				ifGraph[neighbor].neighbor.erase(vtx);
-				ifGraph[neighbor].neighbor.insert(root);
+				if (useAdjMatrix)
+				{
+					adjMatrix.erase(matrixIndex(neighbor, vtx));
+					adjMatrix.insert(matrixIndex(neighbor, root));
+				}
+				if (neighbor == root)
+					continue;
+				std::vector<size_t> &list = ifGraph[neighbor].neighbor;
+				auto pos = std::lower_bound(list.begin(), list.end(), vtx);
+				assert(pos != list.end() && *pos == vtx);
+				list.erase(pos);
+				pos = std::lower_bound(list.begin(), list.end(), root);
+				if (pos == list.end() || *pos != root)
+					list.insert(pos, root);
 			}
 			ifGraph[vtx].neighbor.clear();
 			ifGraph[vtx].forbiddenReg.reset();
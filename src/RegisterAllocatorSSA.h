@@ -3,18 +3,22 @@
 
 #include "common.h"
 #include "IR.h"
-#include "utils/DomTree.h"
+#include "FunctionAnalysis.h"
+#include "utils/DynamicBitset.h"
+
+class MaxClique;
 
 namespace MxIR
 {
 	class RegisterAllocatorSSA
 	{
 	public:
-		explicit RegisterAllocatorSSA(Function &func, const std::vector<int> &phyReg) : func(func), phyReg(phyReg) {}
+		explicit RegisterAllocatorSSA(Function &func, FunctionAnalysis &analysis, const std::vector<int> &phyReg) : 
+			useAdjMatrix(false), cliqueBudget(maxFunctionCliqueSteps), cliqueFallbacks(0), func(func), analysis(analysis), phyReg(phyReg), lastReg(phyReg.back()) {}
 		void work();
 
 	protected:
-		void splitCriticalEdge();
+		bool splitCriticalEdge();	//return whether any edge is split
 		void computeDomTree();
 		void computeLoop();
 		void relabelVReg();
@@ -24,6 +28,7 @@ namespace MxIR
 		void computeVarOp();
 		void computeVarGroup();
 		void computeExternalVar();
+		void computeRematerializable();
 
 		void spillRegister();
 		void spillRegisterBlock(Block *block);
@@ -36,6 +41,7 @@ namespace MxIR
 		bool isReload(const Instruction &insn);
 		void eliminateSpillCode();
 		void eliminateSpillCode(size_t idx, std::set<size_t> &spilled);
+		void countSpillCode();
 		void insertAllocateCode();
 
 		void reconstructSSA();
@@ -49,32 +55,39 @@ namespace MxIR
 
 		int getPReg(Operand operand);
 		void coalesce();
+		const std::vector<size_t> & findClique(MaxClique &solver, size_t budget);	//budget: steps left for the caller
 
 		void destructSSA();
 		void writeRegInfo();
 
 		size_t findVertexRoot(size_t vtx);
 		void mergeVertices(const std::set<size_t> &vtxList);
+		void addEdge(size_t u, size_t v);
+		bool isInterfering(size_t u, size_t v) const;
+		static size_t matrixIndex(size_t u, size_t v) { return u >= v ? u * (u + 1) / 2 + v : v * (v + 1) / 2 + u; }
 
 	protected:
+		typedef std::vector<std::pair<size_t, size_t>> NextUseList;	//(vreg id, distance), sorted by vreg id
+		static size_t * findNextUse(NextUseList &list, size_t var);	//return nullptr if var is not in the list
+
 		struct BlockProperty
 		{
 			size_t idx;
-			std::map<size_t, size_t> nextUseBegin, nextUseEnd;	//global next use distance at the begin/end of the block
+			NextUseList nextUseBegin, nextUseEnd;	//global next use distance at the begin/end of the block
 			std::set<Block *> loopBorder;						//edges leading out of loop
 			std::set<Block *> loopBody;
 
-			std::set<size_t> definedVar;		//virtual register that is defined in this block
-			std::set<size_t> usedVar;
+			DynamicBitset definedVar;		//virtual register that is defined in this block
+			DynamicBitset usedVar;
 			// std::set<size_t> updateDistance;	//virtual register of which the next use distance at end is updated. used in computeNextUse
 
 			size_t maxPressure;
 
-			std::set<size_t> Wentry, Wexit;
+			DynamicBitset Wentry, Wexit;
 
 			bool visited;		//visited in spill stage
 
-			std::set<size_t> liveIn, liveOut;	//used when building inference graph
+			DynamicBitset liveIn, liveOut;	//used when building inference graph
 
 			/*
 				------- liveIn ---------
@@ -91,7 +104,7 @@ namespace MxIR
 		};
 		struct GraphVertex
 		{
-			std::set<size_t> neighbor;
+			std::vector<size_t> neighbor;	//sorted
 			std::shared_ptr<std::set<int>> forbiddenReg;
 			int preg;
 			bool pinned;
@@ -128,6 +141,8 @@ namespace MxIR
 			std::set<size_t> vertices;	//including keyVertex
 			std::set<std::pair<size_t, size_t>> edges;
 
+			size_t budget;	//MaxClique steps left for this unit
+
 			OptimUnitAll(RegisterAllocatorSSA &allocator, size_t key, const std::vector<size_t> &another);
 
 			virtual void fail(size_t u) override;
@@ -161,19 +176,27 @@ namespace MxIR
 			virtual void conflict(size_t u, size_t v) override { S.clear(); }
 		};
 		std::vector<GraphVertex> ifGraph;
+		DynamicBitset adjMatrix;	//lower triangle of the adjacency matrix of ifGraph, see matrixIndex
+		bool useAdjMatrix;			//the matrix is only built for functions with at most maxMatrixVar vregs
+		size_t cliqueBudget;		//MaxClique steps left for this function
+		size_t cliqueFallbacks;		//MaxClique searches that ran out of budget and fell back to a greedy clique
 		std::map<Block *, BlockProperty> property;
-		std::vector<Block *> vBlock;
-		DomTree dtree;
 
 		std::vector<Operand> varOp;
 		std::vector<size_t> varGroup;	//vregid -> groupid. note that groupid is also the store address of the register
 		std::map<size_t, Operand> externalVarHint;	//varid -> alloc hint
+		std::map<size_t, Operand> rematValue;		//varid -> the constant it is defined with, if it is reloaded by redefining it
 		size_t nVar;
 
 		Function &func;
+		FunctionAnalysis &analysis;
 		std::vector<int> phyReg;
+		int lastReg;	//round-robin start of chooseRegister
 
 		static const size_t outLoopPenalty = 1000;
+		static const size_t maxMatrixVar = 16384;	//32 MB of matrix
+		static const size_t maxUnitCliqueSteps = 20000;
+		static const size_t maxFunctionCliqueSteps = 2000000;
 	};
 }
 
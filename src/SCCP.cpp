@@ -0,0 +1,768 @@
+#include "common_headers.h"
+#include "SCCP.h"
+#include "CompileStats.h"
+
+namespace MxIR
+{
+	typedef __int128 int128;
+	typedef SCCP::Range Range;
+
+	static const size_t WidenAfter = 3;		//times a range may grow before it is widened
+
+	static std::int64_t minOf(size_t size)
+	{
+		return size >= 8 ? INT64_MIN : -(std::int64_t(1) << (size * 8 - 1));
+	}
+
+	static std::int64_t maxOf(size_t size)
+	{
+		return size >= 8 ? INT64_MAX : (std::int64_t(1) << (size * 8 - 1)) - 1;
+	}
+
+	static std::uint64_t maskOf(size_t size)
+	{
+		return size >= 8 ? ~std::uint64_t(0) : (std::uint64_t(1) << (size * 8)) - 1;
+	}
+
+	//the low bytes of val as a signed value
+	static std::int64_t truncate(std::uint64_t val, size_t size)
+	{
+		switch (size)
+		{
+		case 1:
+			return std::int8_t(val);
+		case 2:
+			return std::int16_t(val);
+		case 4:
+			return std::int32_t(val);
+		default:
+			return std::int64_t(val);
+		}
+	}
+
+	static Range fullRange(size_t size)
+	{
+		return Range(minOf(size), maxOf(size));
+	}
+
+	static Range constRange(std::int64_t val)
+	{
+		return Range(val, val);
+	}
+
+	//the whole type if the bounds overflow
+	static Range fitRange(int128 lo, int128 hi, size_t size)
+	{
+		if (lo < minOf(size) || hi > maxOf(size))
+			return fullRange(size);
+		return Range(std::int64_t(lo), std::int64_t(hi));
+	}
+
+	static Range joinRange(const Range &a, const Range &b)
+	{
+		if (a.top)
+			return b;
+		if (b.top)
+			return a;
+		return Range(std::min(a.lo, b.lo), std::max(a.hi, b.hi));
+	}
+
+	static bool sameValue(const Operand &a, const Operand &b)
+	{
+		return a.isReg() && b.isReg() && a.val == b.val && a.ver == b.ver;
+	}
+
+	static bool isCompare(Operation oper)
+	{
+		return oper >= Slt && oper <= Sgtu;
+	}
+
+	static Operation negated(Operation oper)
+	{
+		switch (oper)
+		{
+		case Slt: return Sge;
+		case Sle: return Sgt;
+		case Seq: return Sne;
+		case Sge: return Slt;
+		case Sgt: return Sle;
+		case Sne: return Seq;
+		case Sltu: return Sgeu;
+		case Sleu: return Sgtu;
+		case Sgeu: return Sltu;
+		case Sgtu: return Sleu;
+		default:
+			assert(false);
+			return oper;
+		}
+	}
+
+	static Operation swapped(Operation oper)
+	{
+		switch (oper)
+		{
+		case Slt: return Sgt;
+		case Sle: return Sge;
+		case Sge: return Sle;
+		case Sgt: return Slt;
+		case Sltu: return Sgtu;
+		case Sleu: return Sgeu;
+		case Sgeu: return Sleu;
+		case Sgtu: return Sltu;
+		default:
+			return oper;
+		}
+	}
+
+	//1 / 0 if the compare of any values in the ranges is always true / false, -1 if unknown
+	template<class T>
+	static int decide(Operation oper, T alo, T ahi, T blo, T bhi)
+	{
+		switch (oper)
+		{
+		case Slt: case Sltu:
+			return ahi < blo ? 1 : alo >= bhi ? 0 : -1;
+		case Sle: case Sleu:
+			return ahi <= blo ? 1 : alo > bhi ? 0 : -1;
+		case Sgt: case Sgtu:
+			return alo > bhi ? 1 : ahi <= blo ? 0 : -1;
+		case Sge: case Sgeu:
+			return alo >= bhi ? 1 : ahi < blo ? 0 : -1;
+		case Seq:
+			return alo == ahi && blo == bhi && alo == blo ? 1 : ahi < blo || bhi < alo ? 0 : -1;
+		case Sne:
+			return alo == ahi && blo == bhi && alo == blo ? 0 : ahi < blo || bhi < alo ? 1 : -1;
+		default:
+			assert(false);
+			return -1;
+		}
+	}
+
+	static Range compareRange(Operation oper, const Range &a, const Range &b, size_t size)
+	{
+		int ret;
+		if (oper == Sltu || oper == Sleu || oper == Sgeu || oper == Sgtu)
+		{
+			//the unsigned values of a range that does not cross zero are contiguous
+			auto unsignedLo = [size](const Range &r) { return r.lo < 0 && r.hi >= 0 ? 0 : std::uint64_t(r.lo) & maskOf(size); };
+			auto unsignedHi = [size](const Range &r) { return r.lo < 0 && r.hi >= 0 ? maskOf(size) : std::uint64_t(r.hi) & maskOf(size); };
+			ret = decide(oper, unsignedLo(a), unsignedHi(a), unsignedLo(b), unsignedHi(b));
+		}
+		else
+			ret = decide(oper, a.lo, a.hi, b.lo, b.hi);
+		return ret == -1 ? Range(0, 1) : constRange(ret);
+	}
+
+	static Range binaryRange(Operation oper, const Range &a, const Range &b, size_t size)
+	{
+		bool isConst = a.lo == a.hi && b.lo == b.hi;
+		switch (oper)
+		{
+		case Add:
+			if (isConst)
+				return constRange(truncate(std::uint64_t(a.lo) + std::uint64_t(b.lo), size));
+			return fitRange(int128(a.lo) + b.lo, int128(a.hi) + b.hi, size);
+		case Sub:
+			if (isConst)
+				return constRange(truncate(std::uint64_t(a.lo) - std::uint64_t(b.lo), size));
+			return fitRange(int128(a.lo) - b.hi, int128(a.hi) - b.lo, size);
+		case Mult:
+		{
+			if (isConst)
+				return constRange(truncate(std::uint64_t(a.lo) * std::uint64_t(b.lo), size));
+			int128 p[] = { int128(a.lo) * b.lo, int128(a.lo) * b.hi, int128(a.hi) * b.lo, int128(a.hi) * b.hi };
+			return fitRange(*std::min_element(p, p + 4), *std::max_element(p, p + 4), size);
+		}
+		case Div:
+		case Mod:
+		{
+			//never fold what traps at run time
+			if (b.lo <= 0 && b.hi >= 0)
+				return fullRange(size);
+			if (a.lo == minOf(size) && b.lo <= -1 && b.hi >= -1)
+				return fullRange(size);
+			if (oper == Div)
+			{
+				std::int64_t q[] = { a.lo / b.lo, a.lo / b.hi, a.hi / b.lo, a.hi / b.hi };
+				return Range(*std::min_element(q, q + 4), *std::max_element(q, q + 4));
+			}
+			if (isConst)
+				return constRange(a.lo % b.lo);
+			int128 maxAbs = b.lo > 0 ? int128(b.hi) : -int128(b.lo);
+			int128 minAbs = b.lo > 0 ? int128(b.lo) : -int128(b.hi);
+			if (a.lo > -minAbs && a.hi < minAbs)	//a % b == a
+				return a;
+			std::int64_t m = std::int64_t(maxAbs - 1);
+			return Range(a.lo >= 0 ? 0 : std::max(a.lo, -m), a.hi <= 0 ? 0 : std::min(a.hi, m));
+		}
+		case Shl: case Shlu: case Shr: case Shru:
+		{
+			if (b.lo != b.hi)
+				return (oper == Shr || oper == Shru) && a.lo >= 0 ? Range(0, a.hi) : fullRange(size);
+			int k = int(b.lo & (size >= 8 ? 63 : 31));	//the count is masked by the cpu
+			if (oper == Shl || oper == Shlu)
+			{
+				if (isConst)
+					return constRange(truncate(std::uint64_t(a.lo) << k, size));
+				return fitRange(int128(a.lo) * (int128(1) << k), int128(a.hi) * (int128(1) << k), size);
+			}
+			if (oper == Shr || a.lo >= 0)
+				return Range(a.lo >> k, a.hi >> k);
+			if (isConst)
+				return constRange(truncate((std::uint64_t(a.lo) & maskOf(size)) >> k, size));
+			return k == 0 ? a : Range(0, std::int64_t(maskOf(size) >> k));
+		}
+		case And: case Or: case Xor:
+		{
+			if (isConst)
+			{
+				std::uint64_t val = oper == And ? std::uint64_t(a.lo) & std::uint64_t(b.lo)
+					: oper == Or ? std::uint64_t(a.lo) | std::uint64_t(b.lo) : std::uint64_t(a.lo) ^ std::uint64_t(b.lo);
+				return constRange(truncate(val, size));
+			}
+			if (oper == And)
+			{
+				if (a.lo >= 0 || b.lo >= 0)
+					return Range(0, a.lo >= 0 && b.lo >= 0 ? std::min(a.hi, b.hi) : a.lo >= 0 ? a.hi : b.hi);
+				return fullRange(size);
+			}
+			if (a.lo < 0 || b.lo < 0)
+				return fullRange(size);
+			std::uint64_t bound = 1;
+			while (bound <= std::uint64_t(std::max(a.hi, b.hi)))
+				bound <<= 1;
+			return Range(oper == Or ? std::max(a.lo, b.lo) : 0, std::int64_t(bound - 1));
+		}
+		default:
+			if (isCompare(oper))
+				return compareRange(oper, a, b, size);
+			return fullRange(size);
+		}
+	}
+
+	static Range unaryRange(Operation oper, const Range &a, size_t srcSize, size_t size)
+	{
+		switch (oper)
+		{
+		case Move:
+		case Sext:
+			return fitRange(a.lo, a.hi, size);
+		case Zext:
+			if (a.lo >= 0)
+				return fitRange(a.lo, a.hi, size);
+			if (srcSize >= 8)
+				return fullRange(size);
+			if (a.hi < 0)
+				return fitRange(int128(a.lo) + maskOf(srcSize) + 1, int128(a.hi) + maskOf(srcSize) + 1, size);
+			return fitRange(0, maskOf(srcSize), size);
+		case Neg:
+			if (a.lo == a.hi)
+				return constRange(truncate(-std::uint64_t(a.lo), size));
+			return fitRange(-int128(a.hi), -int128(a.lo), size);
+		case Not:
+			return Range(~a.hi, ~a.lo);
+		default:
+			return fullRange(size);
+		}
+	}
+
+	void SCCP::work()
+	{
+		index.build(func);
+		nNarrowed = nCompares = 0;
+		collect();
+		solve();
+		if (solved())
+			transform();
+		else if (!keepSigma)
+		{
+			blockExec.assign(blockExec.size(), true);	//only turn it back into SSA form
+			edgeTrueExec.assign(edgeTrueExec.size(), true);
+			edgeFalseExec.assign(edgeFalseExec.size(), true);
+			ranges.assign(ranges.size(), fullRange(8));
+			transform();
+		}
+		CompileStats::count("divisions_narrowed", nNarrowed);
+		CompileStats::count("compares_simplified", nCompares);
+	}
+
+	void SCCP::collect()
+	{
+		const std::vector<Block *> &blocks = analysis.blocks();
+		ranges.assign(index.size(), Range());
+		changes.assign(index.size(), 0);
+		insDef.assign(index.size(), nullptr);
+		sigmaDef.assign(index.size(), nullptr);
+		users.assign(index.size(), {});
+		blockExec.assign(blocks.size(), false);
+		edgeTrueExec.assign(blocks.size(), false);
+		edgeFalseExec.assign(blocks.size(), false);
+
+		std::vector<bool> defined(index.size());
+		for (Block *block : blocks)
+		{
+			for (auto &ins : block->instructions())
+				for (Operand *operand : ins.outputRegs())
+					defined[index.id(*operand)] = true;
+			for (auto &ins : block->ins)
+				for (Operand *operand : ins.outputRegs())
+					insDef[index.id(*operand)] = &ins;
+			for (auto &kv : block->sigma)
+			{
+				sigmaDef[index.id(kv.second.dstTrue)] = &kv.second;
+				sigmaDef[index.id(kv.second.dstFalse)] = &kv.second;
+			}
+		}
+		for (Block *block : blocks)
+		{
+			for (auto &ins : block->instructions())
+			{
+				for (Operand *operand : ins.inputRegs())
+				{
+					size_t id = index.id(*operand);
+					users[id].push_back({ block, &ins });
+					if (!defined[id])		//the params and the values never defined
+						ranges[id] = fullRange(operand->size());
+				}
+			}
+			//a sigma is narrowed by the operands of the compare on its edges
+			if (block->sigma.empty() || block->ins.empty() || block->ins.back().oper != Br || !block->ins.back().src1.isReg())
+				continue;
+			std::vector<Operand> conds = { block->ins.back().src1 };
+			if (const Instruction *cond = definition(conds[0]))
+			{
+				if (isCompare(cond->oper))
+					conds.insert(conds.end(), { cond->src1, cond->src2 });
+			}
+			for (auto &cond : conds)
+			{
+				size_t id = index.id(cond);
+				if (id == SSAValueIndex::npos)
+					continue;
+				for (auto &kv : block->sigma)
+					users[id].push_back({ block, &kv.second });
+			}
+		}
+	}
+
+	void SCCP::solve()
+	{
+		markExecutable(func.inBlock.get());
+		while (!blockWork.empty() || !insWork.empty())
+		{
+			if (!blockWork.empty())
+			{
+				Block *block = blockWork.back();
+				blockWork.pop_back();
+				for (auto &ins : block->instructions())
+					visit(block, ins);
+				continue;
+			}
+			auto cur = insWork.back();
+			insWork.pop_back();
+			if (blockExec[analysis.blockIndex(cur.first)])
+				visit(cur.first, *cur.second);
+		}
+	}
+
+	//every branch that is reached has a known condition, and the function can return
+	bool SCCP::solved()
+	{
+		const std::vector<Block *> &blocks = analysis.blocks();
+		if (!blockExec[analysis.blockIndex(func.outBlock.get())])
+			return false;
+		for (size_t i = 0; i < blocks.size(); i++)
+		{
+			if (blockExec[i] && !blocks[i]->ins.empty() && blocks[i]->ins.back().oper == Br && rangeOf(blocks[i]->ins.back().src1).top)
+				return false;
+		}
+		return true;
+	}
+
+	void SCCP::transform()
+	{
+		const std::vector<Block *> &blocks = analysis.blocks();
+		std::vector<Operand> replace(index.size());
+		std::vector<std::shared_ptr<Block>> deadBlocks;
+		std::vector<std::pair<Block *, bool>> folded;	//block, whether the true edge is kept
+		size_t nConst = 0;
+
+		for (size_t i = 0; i < blocks.size(); i++)
+		{
+			Block *block = blocks[i];
+			if (!blockExec[i])
+			{
+				deadBlocks.push_back(block->self.lock());
+				continue;
+			}
+			for (auto iter = block->phi.begin(); iter != block->phi.end(); )
+			{
+				auto &srcs = iter->second.srcs;
+				srcs.erase(std::remove_if(srcs.begin(), srcs.end(), [block, this](const std::pair<Operand, std::weak_ptr<Block>> &src)
+				{
+					return !isEdgeExecutable(src.second.lock().get(), block);
+				}), srcs.end());
+				if (ranges[index.id(iter->second.dst)].isConst())
+				{
+					nConst++;
+					iter = block->phi.erase(iter);
+				}
+				else
+					++iter;
+			}
+			for (auto &ins : block->ins)
+			{
+				if (ins.oper == Call || ins.outputRegs().empty())
+					continue;
+				const Range &range = ranges[index.id(ins.dst)];
+				if (range.isConst())
+				{
+					if (ins.oper != Move || !ins.src1.isImm())
+					{
+						ins = IR(ins.dst, Move, ImmSize(std::uint64_t(range.lo), ins.dst.size()));
+						nConst++;
+					}
+				}
+				else
+					simplify(ins);
+			}
+			bool fold = block->brFalse && edgeTrueExec[i] != edgeFalseExec[i];
+			if (fold)
+				folded.push_back({ block, edgeTrueExec[i] });
+			if (fold || !keepSigma)
+			{
+				for (auto &kv : block->sigma)
+				{
+					replace[index.id(kv.second.dstTrue)] = kv.second.src;
+					replace[index.id(kv.second.dstFalse)] = kv.second.src;
+				}
+				block->sigma.clear();
+			}
+		}
+
+		for (auto &kv : folded)
+		{
+			Block *block = kv.first;
+			block->ins.back() = IRJump();
+			if (!kv.second)
+				block->brTrue = block->brFalse;
+			block->brFalse.reset();
+		}
+		for (auto &block : deadBlocks)
+		{
+			block->brTrue.reset();
+			block->brFalse.reset();
+		}
+
+		auto resolve = [&replace, this](const Operand &operand) -> Operand
+		{
+			Operand value = operand;
+			for (size_t id = index.id(value); id != SSAValueIndex::npos; id = index.id(value))
+			{
+				if (ranges[id].isConst())
+					return ImmSize(std::uint64_t(ranges[id].lo), operand.size());
+				if (!replace[id].isReg())
+					break;
+				value = replace[id];
+			}
+			return value.setSize(operand.size());
+		};
+		func.inBlock->traverse([&resolve, this](Block *block) -> bool
+		{
+			for (auto iter = block->sigma.begin(); iter != block->sigma.end(); )
+			{
+				Operand src = resolve(iter->second.src);
+				if (src.isImm())
+					iter = block->sigma.erase(iter);
+				else
+				{
+					iter->second.src = src;
+					++iter;
+				}
+			}
+			for (auto &ins : block->instructions())
+				for (Operand *operand : ins.inputRegs())
+					*operand = resolve(*operand);
+			return true;
+		});
+
+		CompileStats::count("constants_propagated", nConst);
+		CompileStats::count("branches_folded", folded.size());
+		CompileStats::count("blocks_removed", deadBlocks.size());
+	}
+
+	void SCCP::markExecutable(Block *block)
+	{
+		size_t idx = analysis.blockIndex(block);
+		if (blockExec[idx])
+			return;
+		blockExec[idx] = true;
+		blockWork.push_back(block);
+	}
+
+	void SCCP::markEdge(Block *block, bool edgeTrue)
+	{
+		size_t idx = analysis.blockIndex(block);
+		std::vector<bool> &exec = edgeTrue ? edgeTrueExec : edgeFalseExec;
+		Block *next = edgeTrue ? block->brTrue.get() : block->brFalse.get();
+		if (exec[idx] || !next)
+			return;
+		exec[idx] = true;
+		for (auto &kv : block->sigma)
+			insWork.push_back({ block, &kv.second });
+		if (!blockExec[analysis.blockIndex(next)])
+			markExecutable(next);
+		else
+		{
+			for (auto &kv : next->phi)
+				insWork.push_back({ next, &kv.second });
+		}
+	}
+
+	bool SCCP::isEdgeExecutable(Block *from, Block *to)
+	{
+		size_t idx = analysis.blockIndex(from);
+		return (from->brTrue.get() == to && edgeTrueExec[idx]) || (from->brFalse.get() == to && edgeFalseExec[idx]);
+	}
+
+	void SCCP::visit(Block *block, InstructionBase &base)
+	{
+		if (base.kind == InstructionBase::KindPhi)
+		{
+			auto &phi = static_cast<Block::PhiIns &>(base);
+			Range range;
+			for (auto &src : phi.srcs)
+			{
+				if (isEdgeExecutable(src.second.lock().get(), block))
+					range = joinRange(range, rangeOf(src.first));
+			}
+			update(phi.dst, range, true);
+			return;
+		}
+		if (base.kind == InstructionBase::KindSigma)
+		{
+			auto &sigma = static_cast<Block::SigmaIns &>(base);
+			size_t idx = analysis.blockIndex(block);
+			if (edgeTrueExec[idx])
+				update(sigma.dstTrue, refine(block, sigma, true));
+			if (edgeFalseExec[idx])
+				update(sigma.dstFalse, refine(block, sigma, false));
+			return;
+		}
+		auto &ins = static_cast<Instruction &>(base);
+		if (ins.oper == Br)
+		{
+			Range cond = rangeOf(ins.src1);
+			if (cond.top)
+				return;
+			if (cond.lo != 0 || cond.hi != 0)
+				markEdge(block, true);
+			if (cond.lo <= 0 && cond.hi >= 0)
+				markEdge(block, false);
+			return;
+		}
+		for (Operand *operand : ins.outputRegs())
+			update(*operand, evaluate(ins));
+		if (&ins == &block->ins.back())
+		{
+			markEdge(block, true);
+			markEdge(block, false);
+		}
+	}
+
+	//ranges only grow, and a phi that keeps growing goes to the bound of its type
+	//every cycle of values passes a phi, and widening there leaves the sigmas on the way free to narrow it again
+	void SCCP::update(const Operand &value, Range range, bool widen)
+	{
+		if (range.top)
+			return;
+		size_t id = index.id(value);
+		Range &cur = ranges[id];
+		if (!cur.top)
+		{
+			if (range.lo >= cur.lo && range.hi <= cur.hi)
+				return;
+			if (widen && ++changes[id] > WidenAfter)
+			{
+				if (range.lo < cur.lo)
+					range.lo = minOf(value.size());
+				if (range.hi > cur.hi)
+					range.hi = maxOf(value.size());
+			}
+			range = joinRange(range, cur);
+		}
+		cur = range;
+		insWork.insert(insWork.end(), users[id].begin(), users[id].end());
+	}
+
+	Range SCCP::rangeOf(const Operand &operand) const
+	{
+		if (operand.isImm())
+			return constRange(truncate(operand.val, operand.size()));
+		size_t id = index.id(operand);
+		if (id == SSAValueIndex::npos)
+			return fullRange(operand.size());
+		const Range &range = ranges[id];
+		if (!range.top && (range.lo < minOf(operand.size()) || range.hi > maxOf(operand.size())))
+			return fullRange(operand.size());
+		return range;
+	}
+
+	Range SCCP::evaluate(const Instruction &ins) const
+	{
+		size_t size = ins.dst.size();
+		switch (ins.oper)
+		{
+		case Move: case Sext: case Zext: case Neg: case Not:
+		{
+			Range a = rangeOf(ins.src1);
+			return a.top ? a : unaryRange(ins.oper, a, ins.src1.size(), size);
+		}
+		case Add: case Sub: case Mult: case Div: case Mod:
+		case Shlu: case Shru: case Shl: case Shr:
+		case And: case Or: case Xor:
+		case Slt: case Sle: case Seq: case Sge: case Sgt: case Sne:
+		case Sltu: case Sleu: case Sgeu: case Sgtu:
+		{
+			Range a = rangeOf(ins.src1), b = rangeOf(ins.src2);
+			if (a.top || b.top)
+				return Range();
+			return binaryRange(ins.oper, a, b, isCompare(ins.oper) ? ins.src1.size() : size);
+		}
+		default:
+			return fullRange(size);
+		}
+	}
+
+	//the range of the sigma src on one edge of the branch that ends block
+	Range SCCP::refine(Block *block, const Block::SigmaIns &sigma, bool edgeTrue) const
+	{
+		Range range = rangeOf(sigma.src);
+		const Instruction &br = block->ins.back();
+		if (range.top || br.oper != Br || !br.src1.isReg())
+			return range;
+		int128 lo = range.lo, hi = range.hi;
+		const Instruction *cond = definition(br.src1);
+		if (sameValue(br.src1, sigma.src))
+		{
+			if (!edgeTrue)
+				lo = std::max<int128>(lo, 0), hi = std::min<int128>(hi, 0);
+			else if (range.lo == 0)
+				lo = 1;
+			else if (range.hi == 0)
+				hi = -1;
+		}
+		else if (cond && isCompare(cond->oper))
+		{
+			Operation oper = cond->oper;
+			Operand other;
+			if (sameValue(cond->src1, sigma.src))
+				other = cond->src2;
+			else if (sameValue(cond->src2, sigma.src))
+				other = cond->src1, oper = swapped(oper);
+			else
+				return range;
+			if (!edgeTrue)
+				oper = negated(oper);
+			Range bound = rangeOf(other);
+			if (bound.top || other.size() != sigma.src.size())
+				return range;
+			switch (oper)
+			{
+			case Slt: hi = std::min<int128>(hi, int128(bound.hi) - 1); break;
+			case Sle: hi = std::min<int128>(hi, bound.hi); break;
+			case Sgt: lo = std::max<int128>(lo, int128(bound.lo) + 1); break;
+			case Sge: lo = std::max<int128>(lo, bound.lo); break;
+			case Seq: lo = std::max<int128>(lo, bound.lo), hi = std::min<int128>(hi, bound.hi); break;
+			case Sne:
+				if (bound.isConst() && lo == bound.lo)
+					lo++;
+				else if (bound.isConst() && hi == bound.lo)
+					hi--;
+				break;
+			//below a non-negative bound the unsigned order is the signed one
+			case Sltu:
+				if (bound.lo >= 0)
+					lo = std::max<int128>(lo, 0), hi = std::min<int128>(hi, int128(bound.hi) - 1);
+				break;
+			case Sleu:
+				if (bound.lo >= 0)
+					lo = std::max<int128>(lo, 0), hi = std::min<int128>(hi, bound.hi);
+				break;
+			case Sgtu:
+				if (bound.lo >= 0 && range.lo >= 0)
+					lo = std::max<int128>(lo, int128(bound.lo) + 1);
+				break;
+			case Sgeu:
+				if (bound.lo >= 0 && range.lo >= 0)
+					lo = std::max<int128>(lo, bound.lo);
+				break;
+			default:
+				break;
+			}
+		}
+		if (lo > hi)	//the edge is never taken
+			return range;
+		return Range(std::int64_t(lo), std::int64_t(hi));
+	}
+
+	const Instruction * SCCP::definition(const Operand &operand) const
+	{
+		for (size_t id = index.id(operand); id != SSAValueIndex::npos; )
+		{
+			if (sigmaDef[id])
+				id = index.id(sigmaDef[id]->src);
+			else
+				return insDef[id];
+		}
+		return nullptr;
+	}
+
+	bool SCCP::simplify(Instruction &ins)
+	{
+		size_t size = ins.dst.size();
+		if (ins.oper == Div || ins.oper == Mod)
+		{
+			Range a = rangeOf(ins.src1), b = rangeOf(ins.src2);
+			if (a.top || b.top || (b.lo <= 0 && b.hi >= 0))
+				return false;
+			int128 minAbs = b.lo > 0 ? int128(b.lo) : -int128(b.hi);
+			if (ins.oper == Mod && a.lo > -minAbs && a.hi < minAbs)
+				ins = IR(ins.dst, Move, ins.src1);
+			else if (ins.oper == Div && b.isConst() && b.lo == 1)
+				ins = IR(ins.dst, Move, ins.src1);
+			else if (b.isConst() && b.lo > 1 && !(b.lo & (b.lo - 1)) && a.lo >= 0)	//by a power of 2
+			{
+				int k = 0;
+				while ((std::int64_t(1) << k) != b.lo)
+					k++;
+				if (ins.oper == Div)
+					ins = IR(ins.dst, Shr, ins.src1, ImmSize(k, size));
+				else
+					ins = IR(ins.dst, And, ins.src1, ImmSize(b.lo - 1, size));
+			}
+			else
+				return false;
+			nNarrowed++;
+			return true;
+		}
+		//compare the result of a compare with 0 / 1
+		if (ins.oper == Seq || ins.oper == Sne)
+		{
+			Operand value = ins.src1, imm = ins.src2;
+			if (value.isImm())
+				std::swap(value, imm);
+			const Instruction *cond = definition(value);
+			if (!imm.isImm() || !cond || !isCompare(cond->oper) || cond->dst.size() != value.size())
+				return false;
+			std::int64_t c = truncate(imm.val, imm.size());
+			if (c != 0 && c != 1)
+				return false;
+			Operation oper = (ins.oper == Seq) == (c == 1) ? cond->oper : negated(cond->oper);
+			ins = IR(ins.dst, oper, cond->src1, cond->src2);
+			nCompares++;
+			return true;
+		}
+		return false;
+	}
+}
@@ -0,0 +1,69 @@
+#ifndef MX_COMPILER_SCCP_H
+#define MX_COMPILER_SCCP_H
+
+#include "common.h"
+#include "IR.h"
+#include "SSAValueIndex.h"
+#include "FunctionAnalysis.h"
+
+namespace MxIR
+{
+	//Sparse conditional constant propagation (Wegman & Zadeck) on the value ranges of the SSA values.
+	//Works on the SSI form built by SSAConstructor::constructSSIFull: a sigma narrows the range of its src
+	//by the compare on its edge. A range that still grows after a few rounds is widened to the whole type.
+	//Folds the constants and the branches decided by the ranges, drops the blocks that become unreachable,
+	//and turns the divisions and the compares of compares into cheaper instructions where the ranges allow.
+	//With keepSigma the function is left in SSI form for BoundsCheckElimination, otherwise in SSA form.
+	class SCCP
+	{
+	public:
+		SCCP(Function &func, FunctionAnalysis &analysis, bool keepSigma = false) : func(func), analysis(analysis), keepSigma(keepSigma) {}
+		void work();
+
+	public:
+		struct Range		//[lo, hi] of the signed value
+		{
+			std::int64_t lo, hi;
+			bool top;		//not evaluated yet
+
+			Range() : lo(0), hi(0), top(true) {}
+			Range(std::int64_t lo, std::int64_t hi) : lo(lo), hi(hi), top(false) {}
+			bool isConst() const { return !top && lo == hi; }
+		};
+
+	protected:
+		void collect();
+		void solve();
+		bool solved();
+		void transform();
+
+		void markExecutable(Block *block);
+		void markEdge(Block *block, bool edgeTrue);
+		bool isEdgeExecutable(Block *from, Block *to);
+		void visit(Block *block, InstructionBase &ins);
+		void update(const Operand &value, Range range, bool widen = false);
+
+		Range rangeOf(const Operand &operand) const;
+		Range evaluate(const Instruction &ins) const;
+		Range refine(Block *block, const Block::SigmaIns &sigma, bool edgeTrue) const;
+		const Instruction * definition(const Operand &operand) const;	//the instruction that defines the value, through the sigmas
+		bool simplify(Instruction &ins);
+
+	protected:
+		Function &func;
+		FunctionAnalysis &analysis;
+		bool keepSigma;
+		SSAValueIndex index;
+		std::vector<Range> ranges;
+		std::vector<size_t> changes;
+		std::vector<const Instruction *> insDef;
+		std::vector<const Block::SigmaIns *> sigmaDef;
+		std::vector<std::vector<std::pair<Block *, InstructionBase *>>> users;	//value -> the instructions to visit again once it changes
+		std::vector<bool> blockExec, edgeTrueExec, edgeFalseExec;	//indexed like analysis.blocks()
+		std::vector<Block *> blockWork;
+		std::vector<std::pair<Block *, InstructionBase *>> insWork;
+		size_t nNarrowed, nCompares;
+	};
+}
+
+#endif
@@ -8,7 +8,8 @@ namespace MxIR
 	{
 		preprocess();
 
-		DomTree domTree = getDomTree(false);
+		DomTree &domTree = analysis.domTree();
+		assert(analysis.blocks() == blocks);
 
 		for (auto &kv : vars)
 		{
@@ -42,22 +43,52 @@ namespace MxIR
 	{
 		preprocess();
 
-		DomTree domTree = getDomTree(false);
-		DomTree postDomTree = getDomTree(true);
+		DomTree &domTree = analysis.domTree();
+		DomTree &postDomTree = analysis.postDomTree();
+		assert(analysis.blocks() == blocks);
 
+		for (auto &param : func.params)
+		{
+			auto iter = vars.find(param.val);
+			if (iter != vars.end() && iter->second.operand.type == Operand::empty)
+				iter->second.operand = param;
+		}
 		for (auto &kv : vars)
 		{
 			size_t varID = kv.first;
 			const globalVar &var = kv.second;
+			if (var.operand.type == Operand::empty)	//never defined
+				continue;
 
-			std::queue<size_t> workListPhi;		//blockid, operand
+			std::queue<size_t> workListPhi;		//blockid
 			std::queue<size_t> workListSigma;	//blockid
 			for (size_t i : var.def)
 				workListPhi.push(i);
 			for (size_t i : var.uses)
 				workListSigma.push(i);
 
-			while (!workListPhi.empty() && !workListSigma.empty())
+			//a sigma defines the var on the outgoing edges of its block:
+			//a successor with a single predecessor becomes a definition, a join needs a phi
+			auto defineOnEdges = [&workListPhi, &workListSigma, &var, varID, this](size_t curBlock)
+			{
+				for (Block *next : { blocks[curBlock]->brTrue.get(), blocks[curBlock]->brFalse.get() })
+				{
+					if (!next)
+						continue;
+					size_t nextID = mapBlock[next];
+					if (next->preds.size() == 1)
+						workListPhi.push(nextID);
+					else if (!next->phi.count(varID))
+					{
+						next->phi.insert({ varID, Block::PhiIns(var.operand) });
+						workListPhi.push(nextID);
+						if (!var.uses.count(nextID))
+							workListSigma.push(nextID);
+					}
+				}
+			};
+
+			while (!workListPhi.empty() || !workListSigma.empty())
 			{
 				while (!workListPhi.empty())
 				{
@@ -84,8 +115,7 @@ namespace MxIR
 						if (!blocks[frontier]->sigma.count(varID))
 						{
 							blocks[frontier]->sigma.insert({ varID, Block::SigmaIns(var.operand) });
-							if (!var.def.count(frontier) && !blocks[frontier]->phi.count(varID))
-								workListPhi.push(frontier);
+							defineOnEdges(frontier);
 							if (!var.uses.count(frontier) && !blocks[frontier]->phi.count(varID))
 								workListSigma.push(frontier);
 						}
@@ -93,6 +123,8 @@ namespace MxIR
 				}
 			}
 		}
+
+		renameVar();
 	}
 
 	void SSAConstructor::preprocess()
@@ -159,24 +191,6 @@ namespace MxIR
 		});
 	}
 
-	DomTree SSAConstructor::getDomTree(bool postDom)
-	{
-		DomTree domTree(blocks.size());
-		func.inBlock->traverse([&domTree, postDom, this](Block *block) -> bool
-		{
-			size_t myID = mapBlock.find(block)->second;
-			if (block->brTrue)
-				postDom ? domTree.link(mapBlock.find(block->brTrue.get())->second, myID)
-						: domTree.link(myID, mapBlock.find(block->brTrue.get())->second);
-			if (block->brFalse)
-				postDom ? domTree.link(mapBlock.find(block->brFalse.get())->second, myID)
-						: domTree.link(myID, mapBlock.find(block->brFalse.get())->second);
-			return true;
-		});
-		domTree.buildTree(mapBlock.find(func.inBlock.get())->second);
-		return domTree;
-	}
-
 	void SSAConstructor::renameVar()
 	{
 		std::set<Block *> visited;
@@ -237,6 +251,19 @@ namespace MxIR
 			assert(block->ins.back().oper == Br);
 			block->ins.back() = IRJump();
 			block->brFalse.reset();
+			block->sigma.clear();
+		}
+
+		for (auto iter = block->sigma.begin(); iter != block->sigma.end(); )
+		{
+			const Operand &cur = varCurVersion[iter->first].top();
+			if (!cur.isReg())	//undefined on some path to this block
+			{
+				iter = block->sigma.erase(iter);
+				continue;
+			}
+			iter->second.src = cur.clone().setSize(iter->second.src.size());
+			++iter;
 		}
 
 		auto visitChild = [&block, &varCount, &varCurVersion, &visited](Block::block_ptr &child, Operand Block::SigmaIns::*sigmaDst)
@@ -272,7 +299,9 @@ namespace MxIR
 	{
 		for (auto &func : program->vFuncs)
 		{
-			SSAConstructor ssa(func.content);
+			IRArena::Scope scope(func.content.arena);
+			FunctionAnalysis analysis(func.content);
+			SSAConstructor ssa(func.content, analysis);
 			ssa.constructSSA();
 		}
 	}
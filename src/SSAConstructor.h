@@ -4,14 +4,14 @@
 #include "common.h"
 #include "IR.h"
 #include "MxProgram.h"
-#include "utils/DomTree.h"
+#include "FunctionAnalysis.h"
 
 namespace MxIR
 {
 	class SSAConstructor
 	{
 	public:
-		SSAConstructor(Function &func) : func(func) {}
+		SSAConstructor(Function &func, FunctionAnalysis &analysis) : func(func), analysis(analysis) {}
 
 	public:
 		struct varDefUse
@@ -21,14 +21,13 @@ namespace MxIR
 			varDefUse() : def({ nullptr, nullptr }) {}
 		};
 		void constructSSA();
-		void constructSSIFull();
+		void constructSSIFull();	//SSA with sigmas on the branches that a var is used below, for BoundsCheckElimination
 		std::map<Operand, varDefUse> calculateDefUse();
 
 		static void constructSSA(MxProgram *program);
 
 	protected:
 		void preprocess();
-		DomTree getDomTree(bool postDom);
 		void renameVar();
 		static void renameVar(Block *block, std::set<Block *> &visited, std::vector<size_t> &varCount, std::vector<std::stack<Operand>> &varCurVersion);
 
@@ -45,6 +44,7 @@ namespace MxIR
 		std::vector<Block *> blocks;		//id -> block
 		std::map<Block *, size_t> mapBlock;	//block -> id
 		Function &func;
+		FunctionAnalysis &analysis;
 	};
 }
 
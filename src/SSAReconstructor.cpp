@@ -5,25 +5,16 @@ namespace MxIR
 {
 	void SSAReconstructor::preprocess()
 	{
-		func.inBlock->traverse([this](Block *block) -> bool
-		{
-			property[block].idx = vBlock.size();
-			vBlock.push_back(block);
-			return true;
-		});
-		dtree = DomTree(vBlock.size());
-		for (Block *block : vBlock)
-			for (Block *next : { block->brTrue.get(), block->brFalse.get() })
-			{
-				if(next)
-					dtree.link(property[block].idx, property[next].idx);
-			}
-		assert(property[func.inBlock.get()].idx == 0);
-		dtree.buildTree(0);
+		const std::vector<Block *> &vBlock = analysis.blocks();
+		for (size_t i = 0; i < vBlock.size(); i++)
+			property[vBlock[i]].idx = i;
+		analysis.domTree();
 	}
 
 	void SSAReconstructor::calcIDF(Block *block)
 	{
+		const std::vector<Block *> &vBlock = analysis.blocks();
+		DomTree &dtree = analysis.domTree();
 		std::queue<Block *> Q;
 		for (size_t frontier : dtree.getDomFrontier(property[block].idx))
 		{
@@ -152,7 +143,7 @@ namespace MxIR
 			return phi.dst.ver;
 		}
 		else
-			return findDefFromBottom(var, vBlock[dtree.getIdom(property[block].idx)]);
+			return findDefFromBottom(var, analysis.blocks()[analysis.domTree().getIdom(property[block].idx)]);
 	}
 
 	void SSAReconstructor::reconstructAuto()
@@ -3,14 +3,14 @@
 
 #include "common.h"
 #include "IR.h"
-#include "utils/DomTree.h"
+#include "FunctionAnalysis.h"
 
 namespace MxIR
 {
 	class SSAReconstructor
 	{
 	public:
-		explicit SSAReconstructor(Function &func) : func(func) {}
+		SSAReconstructor(Function &func, FunctionAnalysis &analysis) : func(func), analysis(analysis) {}
 		void preprocess();
 		void reconstruct(const std::vector<size_t> &vars);	//assume all vreg in IR has no version information
 		void reconstructAuto();	//reconstruct ssa by all vars that have duplicated definitions
@@ -31,10 +31,9 @@ namespace MxIR
 			BlockProperty() : idx(size_t(-1)), visited(false) {}
 		};
 		std::map<Block *, BlockProperty> property;
-		std::vector<Block *> vBlock;
 
-		DomTree dtree;
 		Function &func;
+		FunctionAnalysis &analysis;
 
 		std::map<size_t, Operand> varOp;
 		std::map<size_t, size_t> curVer;
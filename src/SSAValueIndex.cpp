@@ -0,0 +1,66 @@
+#include "common_headers.h"
+#include "SSAValueIndex.h"
+
+namespace MxIR
+{
+	const size_t SSAValueIndex::npos;
+
+	void SSAValueIndex::build(Function &func)
+	{
+		std::vector<size_t> nVersion;	//register id -> max version + 1
+		auto visit = [&nVersion](const Operand &operand)
+		{
+			if (operand.val == Operand::InvalidID)
+				return;
+			if (operand.val >= nVersion.size())
+				nVersion.resize(operand.val + 1, 0);
+			nVersion[operand.val] = std::max<size_t>(nVersion[operand.val], operand.ver + 1);
+		};
+		for (auto &param : func.params)
+			if (param.isReg())
+				visit(param);
+		//every register operand is either an input or an output, so look at the fields directly
+		func.inBlock->traverse([&visit](Block *block) -> bool
+		{
+			for (auto &kv : block->phi)
+			{
+				visit(kv.second.dst);
+				for (auto &src : kv.second.srcs)
+					if (src.first.isReg())
+						visit(src.first);
+			}
+			for (auto &ins : block->ins)
+			{
+				for (const Operand *operand : { &ins.dst, &ins.src1, &ins.src2 })
+					if (operand->isReg())
+						visit(*operand);
+				for (auto &param : ins.paramExt)
+					if (param.isReg())
+						visit(param);
+			}
+			for (auto &kv : block->sigma)
+			{
+				visit(kv.second.src);
+				visit(kv.second.dstTrue);
+				visit(kv.second.dstFalse);
+			}
+			return true;
+		});
+
+		base.assign(nVersion.size() + 1, 0);
+		for (size_t i = 0; i < nVersion.size(); i++)
+			base[i + 1] = base[i] + nVersion[i];
+		nValue = base.back();
+		extra.clear();
+	}
+
+	size_t SSAValueIndex::add(const Operand &operand)
+	{
+		assert(operand.isReg() && operand.val != Operand::InvalidID);
+		size_t ret = id(operand);
+		if (ret != npos)
+			return ret;
+		extra[std::make_pair(operand.val, operand.ver)] = nValue;
+		return nValue++;
+	}
+}
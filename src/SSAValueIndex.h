@@ -0,0 +1,51 @@
+#ifndef MX_COMPILER_SSA_VALUE_INDEX_H
+#define MX_COMPILER_SSA_VALUE_INDEX_H
+
+#include "common.h"
+#include "IR.h"
+
+namespace MxIR
+{
+	//Dense ids for the SSA values (register id, version) of a function, so that passes can keep
+	//per-value data in flat vectors instead of std::map<Operand, ...>.
+	//Two register operands get the same id iff they compare equal under Operand::operator<,
+	//and the ids of the values seen by build() follow that order.
+	class SSAValueIndex
+	{
+	public:
+		static const size_t npos = size_t(-1);
+
+		SSAValueIndex() : base(1, 0), nValue(0) {}
+		explicit SSAValueIndex(Function &func) { build(func); }
+
+		void build(Function &func);
+
+		//number of ids handed out so far
+		size_t size() const { return nValue; }
+		//first register id not seen by build()
+		size_t regCount() const { return base.size() - 1; }
+
+		//id of a register operand, npos for non-register operands and unknown values
+		size_t id(const Operand &operand) const
+		{
+			if (!operand.isReg())
+				return npos;
+			if (operand.val < base.size() - 1 && base[operand.val] + operand.ver < base[operand.val + 1])
+				return base[operand.val] + operand.ver;
+			if (extra.empty())
+				return npos;
+			auto iter = extra.find(std::make_pair(operand.val, operand.ver));
+			return iter == extra.end() ? npos : iter->second;
+		}
+
+		//id of a value created after build(), allocated on first use
+		size_t add(const Operand &operand);
+
+	protected:
+		std::vector<size_t> base;		//values of register r use ids [base[r], base[r + 1])
+		std::map<std::pair<std::uint64_t, std::uint32_t>, size_t> extra;
+		size_t nValue;
+	};
+}
+
+#endif
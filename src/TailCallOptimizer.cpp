@@ -0,0 +1,142 @@
+#include "common_headers.h"
+#include "TailCallOptimizer.h"
+#include "MxBuiltin.h"
+#include "CompileStats.h"
+#include "utils/JoinIterator.h"
+
+namespace MxIR
+{
+	void TailCallOptimizer::work()
+	{
+		size_t nLoop = 0;
+		for (size_t i = 0; i < program->vFuncs.size(); i++)
+		{
+			if (program->vFuncs[i].disabled || (program->vFuncs[i].attribute & Builtin))
+				continue;
+			nLoop += eliminateTailRecursion(i);
+		}
+		CompileStats::count("tail_calls_to_loops", nLoop);
+	}
+
+	size_t TailCallOptimizer::eliminateTailRecursion(size_t funcIdx)
+	{
+		Function &func = program->vFuncs[funcIdx].content;
+		IRArena::Scope scope(func.arena);
+		struct TailCall
+		{
+			Block *block;
+			InsList::iterator call;
+			std::vector<Instruction> releases;
+		};
+		std::vector<TailCall> calls;
+		size_t nVar = 0;
+		for (auto &param : func.params)
+			nVar = std::max(nVar, param.val + 1);
+		func.inBlock->traverse([this, funcIdx, &func, &calls, &nVar](Block *block) -> bool
+		{
+			for (auto iter = block->ins.begin(); iter != block->ins.end(); ++iter)
+			{
+				for (Operand *operand : join<Operand *>(iter->getInputReg(), iter->getOutputReg()))
+					nVar = std::max(nVar, operand->val + 1);
+				if (iter->oper != Call || iter->src1.type != Operand::funcID || iter->src1.val != funcIdx)
+					continue;
+				TailCall tail{ block, iter, {} };
+				if (iter->paramExt.size() != func.params.size() || !findReturn(block, iter, tail.releases))
+					continue;
+				bool pointerArg = false;
+				for (auto &arg : iter->paramExt)
+					if (arg.isReg() && arg.size() == 8)
+						pointerArg = true;
+				if (!tail.releases.empty() && pointerArg)
+					continue;
+				calls.push_back(std::move(tail));
+			}
+			return true;
+		});
+		if (calls.empty())
+			return 0;
+
+		//the old entry becomes the loop header, the allocations stay in a new entry
+		std::shared_ptr<Block> header = func.inBlock;
+		std::shared_ptr<Block> entry = Block::construct();
+		for (auto iter = header->ins.begin(); iter != header->ins.end(); )
+		{
+			if (iter->oper == Allocate)
+			{
+				entry->ins.push_back(*iter);
+				iter = header->ins.erase(iter);
+			}
+			else
+				++iter;
+		}
+		entry->ins.push_back(IRJump());
+		entry->brTrue = header;
+		func.inBlock = entry;
+
+		for (TailCall &tail : calls)
+		{
+			Block *block = tail.block;
+			std::vector<Operand> args = tail.call->paramExt;
+			block->ins.erase(tail.call, block->ins.end());
+			for (auto &ins : tail.releases)
+				block->ins.push_back(ins);
+			std::vector<Operand> temps;
+			for (size_t i = 0; i < args.size(); i++)
+			{
+				temps.push_back(RegSize(nVar++, func.params[i].size()));
+				block->ins.push_back(IR(temps.back(), Move, args[i]));
+			}
+			for (size_t i = 0; i < args.size(); i++)
+				block->ins.push_back(IR(func.params[i], Move, temps[i]));
+			block->ins.push_back(IRJump());
+			block->brTrue = header;
+			block->brFalse.reset();
+		}
+		return calls.size();
+	}
+
+	bool TailCallOptimizer::isRelease(const Instruction &ins) const
+	{
+		typedef MxBuiltin::BuiltinFunc BuiltinFunc;
+		static const std::set<size_t> releaseFunc = {
+			size_t(BuiltinFunc::release_string), size_t(BuiltinFunc::release_array_internal), size_t(BuiltinFunc::release_array_string),
+			size_t(BuiltinFunc::release_array_object), size_t(BuiltinFunc::release_object),
+		};
+		return ins.oper == Call && ins.src1.type == Operand::funcID && releaseFunc.count(ins.src1.val);
+	}
+
+	bool TailCallOptimizer::findReturn(Block *block, InsList::iterator call, std::vector<Instruction> &releases) const
+	{
+		std::set<Block *> visited = { block };
+		auto iter = std::next(call);
+		while (true)
+		{
+			for (; iter != block->ins.end(); ++iter)
+			{
+				if (isRelease(*iter))
+				{
+					for (auto &operand : iter->paramExt)
+						if (operand.isReg() && call->dst.isReg() && operand.val == call->dst.val)
+							return false;
+					releases.push_back(*iter);
+				}
+				else if (iter->oper == Return)
+				{
+					if (iter->src1.type == Operand::empty)
+						return call->dst.type == Operand::empty;
+					return iter->src1.isReg() && call->dst.isReg() && iter->src1.val == call->dst.val;
+				}
+				else if (iter->oper == Jump)
+					break;
+				else
+					return false;
+			}
+			if (iter == block->ins.end() || block->brFalse || !block->brTrue)
+				return false;
+			block = block->brTrue.get();
+			if (!visited.insert(block).second)
+				return false;
+			iter = block->ins.begin();
+		}
+	}
+}
@@ -0,0 +1,31 @@
+#ifndef MX_COMPILER_TAIL_CALL_OPTIMIZER_H
+#define MX_COMPILER_TAIL_CALL_OPTIMIZER_H
+
+#include "common.h"
+#include "IR.h"
+#include "MxProgram.h"
+
+namespace MxIR
+{
+	//Turns the self tail calls into jumps back to the entry of the function, before SSA construction.
+	//A tail call may be followed by the release_* calls of the locals and the temporaries, which are moved before the jump
+	//when no argument may point to an object, since the released objects may be the only owners of what the arguments point to.
+	class TailCallOptimizer
+	{
+	public:
+		TailCallOptimizer() : program(MxProgram::getDefault()) {}
+		TailCallOptimizer(MxProgram *program) : program(program) {}
+		void work();
+
+	protected:
+		size_t eliminateTailRecursion(size_t funcIdx);		//return the number of calls turned into jumps
+		bool isRelease(const Instruction &ins) const;
+		//the releases between call and the return of its result, or false if something else runs in between
+		bool findReturn(Block *block, InsList::iterator call, std::vector<Instruction> &releases) const;
+
+	protected:
+		MxProgram *program;
+	};
+}
+
+#endif
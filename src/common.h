@@ -86,13 +86,24 @@ class CompileFlags
 public:
 	bool disable_access_protect = false;
 	bool optim_register_allocation = false;
+	bool reg_alloc_linear = false;		//use RegisterAllocatorLinear instead of RegisterAllocatorSSA
 	bool optim_inline = false;
 	bool optim_loop_invariant = false;
 	bool optim_dead_code = false;
 	bool optim_gvn = false;
-	bool gvn_strict_equal = false;
+	bool optim_ipra = false;		//interprocedural register allocation, with RegisterAllocatorSSA only
+	bool optim_tail_call = false;
+	bool optim_bounds_check = false;	//with access protection only
+	bool optim_sccp = false;
+	bool optim_refcount = false;
 	int inline_param = 1000, inline_param2 = 25;
+	int inline_growth = 300;		//percent of the program size the inliner may add
+	int jobs = 1;	//0 for one thread per core
+	bool time_passes = false;
+	std::string stats_file;		//write the compile statistics as JSON here if not empty
 
+	//flags are set once by the option parser and only read afterwards, 
+	//so passes running on several threads may share the instance
 	static CompileFlags * getInstance()
 	{
 		static CompileFlags instance;
@@ -13,10 +13,18 @@
 #include "SSAConstructor.h"
 #include "CodeGenerator.h"
 #include "InlineOptimizer.h"
+#include "ModRefAnalysis.h"
+#include "TailCallOptimizer.h"
+#include "RefCountOptimizer.h"
+#include "ParamOwnership.h"
+#include "BoundsCheckElimination.h"
 #include "LoopInvariantOptimizer.h"
 #include "DeadCodeElimination.h"
 #include "GVN.h"
+#include "SCCP.h"
 #include "LoadCombine.h"
+#include "PassManager.h"
+#include "CompileStats.h"
 using namespace std;
 
 int compile(const std::string &fileName, const std::string &output)
@@ -25,7 +33,11 @@ int compile(const std::string &fileName, const std::string &output)
 	MxLexer lexer(&fin);
 	antlr4::CommonTokenStream tokens(&lexer);
 	MxParser parser(&tokens);
-	auto prog = parser.prog();
+	MxParser::ProgContext *prog;
+	{
+		CompileStats::Scope stats("Parse");
+		prog = parser.prog();
+	}
 
 	if (lexer.getNumberOfSyntaxErrors() > 0 || parser.getNumberOfSyntaxErrors() > 0)
 		return 1;
@@ -45,74 +57,159 @@ int compile(const std::string &fileName, const std::string &output)
 		builtin.setDefault();
 		builtin.init();
 
-		std::unique_ptr<MxAST::ASTRoot> root(constructor.constructAST(prog, &symbol));
+		std::unique_ptr<MxAST::ASTRoot> root;
+		{
+			CompileStats::Scope stats("ASTConstructor");
+			root.reset(constructor.constructAST(prog, &symbol));
+		}
 		
 		StaticTypeChecker checker(&program, &symbol, &ic);
-		if (!checker.preCheck(root.get()))
-			return 2;
-		root->recursiveAccess(&checker);
+		{
+			CompileStats::Scope stats("StaticTypeChecker");
+			if (!checker.preCheck(root.get()))
+				return 2;
+			root->recursiveAccess(&checker);
+		}
 
 		if (ic.cntError > 0)
 			return 2;
 
-		ASTOptimizer::ConstantFold cfold;
-		root->recursiveAccess(&cfold);
+		{
+			CompileStats::Scope stats("ConstantFold");
+			ASTOptimizer::ConstantFold cfold;
+			root->recursiveAccess(&cfold);
+		}
 
-		IRGenerator irgen;
-		irgen.generateProgram(root.get());
+		{
+			CompileStats::Scope stats("IRGenerator", &program);
+			IRGenerator irgen;
+			irgen.generateProgram(root.get());
+		}
 
 		if (ic.cntError > 0)
 			return 2;
 
-		if (CompileFlags::getInstance()->optim_inline)
+		CompileFlags *flags = CompileFlags::getInstance();
+		MxIR::PassManager passManager(&program);
+		passManager.addProgramPass("ParamOwnership", [](MxProgram *)
 		{
-			MxIR::InlineOptimizer optim;
-			optim.work();
+			MxIR::ParamOwnership ownership;
+			ownership.work();
+		});
+		if (flags->optim_refcount)
+		{
+			passManager.addProgramPass("RefCountOptimizer", [](MxProgram *)
+			{
+				MxIR::RefCountOptimizer optim;
+				optim.work();
+			});
+		}
+		if (flags->optim_tail_call)
+		{
+			passManager.addProgramPass("TailCallOptimizer", [](MxProgram *)
+			{
+				MxIR::TailCallOptimizer optim;
+				optim.work();
+			});
+		}
+		if (flags->optim_inline)
+		{
+			passManager.addProgramPass("InlineOptimizer", [](MxProgram *)
+			{
+				MxIR::InlineOptimizer optim;
+				optim.work();
+			});
 		}
 
-		if (CompileFlags::getInstance()->optim_register_allocation)
+		if (flags->optim_register_allocation)
 		{
-			MxIR::SSAConstructor::constructSSA(&program);
-			if (CompileFlags::getInstance()->optim_gvn)
+			using MxIR::Function;
+			using MxIR::FunctionAnalysis;
+			if (flags->optim_gvn || flags->optim_dead_code || flags->optim_loop_invariant)
+			{
+				passManager.addProgramPass("ModRefAnalysis", [](MxProgram *)
+				{
+					MxIR::ModRefAnalysis analysis;
+					analysis.work();
+				});
+			}
+			bool checkElim = flags->optim_bounds_check && !flags->disable_access_protect;
+			bool buildSSI = checkElim || flags->optim_sccp;
+			passManager.addFunctionPass("SSAConstructor", [buildSSI](Function &func, FunctionAnalysis &analysis)
 			{
-				for (auto &func : program.vFuncs)
+				MxIR::SSAConstructor ssa(func, analysis);
+				if (buildSSI)
+					ssa.constructSSIFull();
+				else
+					ssa.constructSSA();
+			}, FunctionAnalysis::PreserveCFG);
+			if (flags->optim_sccp)
+			{
+				passManager.addFunctionPass("SCCP", [checkElim](Function &func, FunctionAnalysis &analysis)
 				{
-					MxIR::GVN optim(func.content);
+					MxIR::SCCP optim(func, analysis, checkElim);
 					optim.work();
-
-					MxIR::LoadCombine loadcombine(func.content);
+				});
+			}
+			if (checkElim)
+			{
+				passManager.addFunctionPass("BoundsCheckElimination", [](Function &func, FunctionAnalysis &analysis)
+				{
+					MxIR::BoundsCheckElimination optim(func, analysis);
+					optim.work();
+				});
+			}
+			if (flags->optim_gvn)
+			{
+				passManager.addFunctionPass("GVN", [](Function &func, FunctionAnalysis &analysis)
+				{
+					MxIR::GVN optim(func, analysis);
+					optim.work();
+				}, FunctionAnalysis::PreserveCFG);
+				passManager.addFunctionPass("LoadCombine", [](Function &func, FunctionAnalysis &)
+				{
+					MxIR::LoadCombine loadcombine(func);
 					loadcombine.work();
-
-					MxIR::GVN optim2(func.content);
-					optim2.work();
-				}
+				}, FunctionAnalysis::PreserveCFG);
+				passManager.addFunctionPass("GVN (2nd)", [](Function &func, FunctionAnalysis &analysis)
+				{
+					MxIR::GVN optim(func, analysis);
+					optim.work();
+				}, FunctionAnalysis::PreserveCFG);
 			}
-			if (CompileFlags::getInstance()->optim_dead_code)
+			if (flags->optim_dead_code)
 			{
-				for (auto &func : program.vFuncs)
+				passManager.addFunctionPass("DeadCodeElimination", [](Function &func, FunctionAnalysis &analysis)
 				{
-					MxIR::DeadCodeElimination optim(func.content);
+					MxIR::DeadCodeElimination optim(func, analysis);
 					optim.work();
-				}
+				});
 			}
-			if (CompileFlags::getInstance()->optim_loop_invariant)
+			if (flags->optim_loop_invariant)
 			{
-				for (auto &func : program.vFuncs)
+				passManager.addFunctionPass("LoopInvariantOptimizer", [](Function &func, FunctionAnalysis &analysis)
 				{
-					MxIR::LoopInvariantOptimizer optim(func.content);
+					MxIR::LoopInvariantOptimizer optim(func, analysis);
 					optim.work();
-				}
+				});
 			}
-			std::ofstream fout(output);
-			CodeGenerator codegen(fout);
-			codegen.generateProgram();
+			passManager.addProgramPass("CodeGenerator", [&output](MxProgram *)
+			{
+				std::ofstream fout(output);
+				CodeGenerator codegen(fout);
+				codegen.generateProgram();
+			});
 		}
 		else
 		{
-			std::ofstream fout(output);
-			CodeGeneratorBasic codegen(fout);
-			codegen.generateProgram();
+			passManager.addProgramPass("CodeGeneratorBasic", [&output](MxProgram *)
+			{
+				std::ofstream fout(output);
+				CodeGeneratorBasic codegen(fout);
+				codegen.generateProgram();
+			});
 		}
+		passManager.run(flags->jobs);
 	}
 	catch (IssueCollector::FatalErrorException &)
 	{
@@ -130,6 +227,24 @@ int main(int argc, char *argv[])
 	std::tie(ret, input, output) = ParseOptions(argc, argv);
 	if (input.empty() || output.empty())
 		return ret;
-	ret = compile(input, output);
+
+	CompileFlags *flags = CompileFlags::getInstance();
+	CompileStats *stats = CompileStats::getInstance();
+	if (flags->time_passes || !flags->stats_file.empty())
+		stats->enable();
+	{
+		CompileStats::Scope scope("Total");
+		ret = compile(input, output);
+	}
+	if (flags->time_passes)
+		stats->printReport(cerr);
+	if (!flags->stats_file.empty())
+	{
+		std::ofstream fout(flags->stats_file);
+		if (!fout)
+			cerr << argv[0] << ": cannot write " << flags->stats_file << endl;
+		else
+			stats->writeJSON(fout);
+	}
 	return ret;
 }
\ No newline at end of file
@@ -11,12 +11,22 @@ std::tuple<int, std::string, std::string> ParseOptions(int argc, char *argv[])
 		("output,o", value<std::string>()->value_name("file"), "Place the output into <file>")
 		("fdisable-access-protect", "Set the flag of disable access protect")
 		("optim-reg-alloc", "Optimize the register allocation")
+		("reg-alloc", value<std::string>()->value_name("basic|linear|ssa"), "select the register allocator: basic (the default), linear (linear scan, for quick builds) or ssa (same as --optim-reg-alloc)")
 		("optim-inline", "enable inline expansion")
 		("optim-loop-invariant", "enable loop invariant optimization")
 		("optim-dead-code", "enable dead code elimination")
 		("optim-gvn", "enable global value numbering")
+		("optim-ipra", "enable interprocedural register allocation (with the ssa register allocator)")
+		("optim-tail-call", "turn self tail calls into loops and emit sibling calls as jumps")
+		("optim-bounds-check", "remove the array bounds checks and null checks proven redundant (with --optim-reg-alloc)")
+		("optim-sccp", "propagate constants and value ranges, and fold the branches they decide (with --optim-reg-alloc)")
+		("optim-refcount", "remove the reference count calls that can not change when an object is freed")
 		("inline-param", value<int>()->value_name("param"), "the parameter for inline optimizer")
-		("inline-param2", value<int>()->value_name("param"), "the parameter 2 for inline optimizer");;
+		("inline-param2", value<int>()->value_name("param"), "the parameter 2 for inline optimizer")
+		("inline-growth", value<int>()->value_name("percent"), "let inlining grow the program by at most <percent> of its size")
+		("jobs,j", value<int>()->value_name("N"), "run per-function passes on N threads (0 for all cores)")
+		("time-passes", "print the time and memory used by each compiler stage")
+		("stats", value<std::string>()->value_name("file.json"), "write the time, memory and IR counters of each stage to <file.json>");
 
 	positional_options_description po;
 	po.add("input", 1);
@@ -44,18 +54,49 @@ std::tuple<int, std::string, std::string> ParseOptions(int argc, char *argv[])
 		CompileFlags::getInstance()->disable_access_protect = true;
 	if (vm.count("optim-reg-alloc"))
 		CompileFlags::getInstance()->optim_register_allocation = true;
+	if (vm.count("reg-alloc"))
+	{
+		std::string allocator = vm["reg-alloc"].as<std::string>();
+		if (allocator == "linear")
+			CompileFlags::getInstance()->optim_register_allocation = CompileFlags::getInstance()->reg_alloc_linear = true;
+		else if (allocator == "ssa")
+			CompileFlags::getInstance()->optim_register_allocation = true;
+		else if (allocator != "basic")
+		{
+			std::cerr << argv[0] << ": unknown register allocator '" << allocator << "'" << std::endl;
+			return std::make_tuple(1, "", "");
+		}
+	}
 	if (vm.count("optim-inline"))
 		CompileFlags::getInstance()->optim_inline = true;
 	if (vm.count("inline-param"))
 		CompileFlags::getInstance()->inline_param = vm["inline-param"].as<int>();
 	if (vm.count("inline-param2"))
 		CompileFlags::getInstance()->inline_param2 = vm["inline-param2"].as<int>();
+	if (vm.count("inline-growth"))
+		CompileFlags::getInstance()->inline_growth = std::max(vm["inline-growth"].as<int>(), 0);
+	if (vm.count("jobs"))
+		CompileFlags::getInstance()->jobs = std::max(vm["jobs"].as<int>(), 0);
+	if (vm.count("time-passes"))
+		CompileFlags::getInstance()->time_passes = true;
+	if (vm.count("stats"))
+		CompileFlags::getInstance()->stats_file = vm["stats"].as<std::string>();
 	if (vm.count("optim-loop-invariant"))
 		CompileFlags::getInstance()->optim_loop_invariant = true;
 	if (vm.count("optim-dead-code"))
 		CompileFlags::getInstance()->optim_dead_code = true;
 	if (vm.count("optim-gvn"))
 		CompileFlags::getInstance()->optim_gvn = true;
+	if (vm.count("optim-ipra"))
+		CompileFlags::getInstance()->optim_ipra = true;
+	if (vm.count("optim-tail-call"))
+		CompileFlags::getInstance()->optim_tail_call = true;
+	if (vm.count("optim-bounds-check"))
+		CompileFlags::getInstance()->optim_bounds_check = true;
+	if (vm.count("optim-sccp"))
+		CompileFlags::getInstance()->optim_sccp = true;
+	if (vm.count("optim-refcount"))
+		CompileFlags::getInstance()->optim_refcount = true;
 	if (!vm.count("input"))
 	{
 		std::cerr << argv[0] << ": no input file" << std::endl;
@@ -6,15 +6,15 @@ void CycleEquiv::dfs(size_t idx, size_t parent)
 	V[idx].visited = true;
 	V[idx].min_dfn = V[idx].dfn = dfv.size();
 	dfv.push_back(idx);
-	for (size_t i = 0; i < V[idx].to.size(); i++)
+	for (size_t i = V[idx].adjBegin; i < V[idx].adjEnd; i++)
 	{
-		size_t child = V[idx].to[i];
+		size_t child = adjTo[i];
 		if (child == parent)
 			continue;
 		if (V[child].visited)
 		{
-			E[V[idx].edges[i]].backward = true;
-			E[V[idx].edges[i]].min_dfn = std::min(V[idx].dfn, V[child].dfn);
+			E[adjEdge[i]].backward = true;
+			E[adjEdge[i]].min_dfn = std::min(V[idx].dfn, V[child].dfn);
 			V[idx].min_dfn = std::min(V[idx].min_dfn, V[child].dfn);
 			continue;
 		}
@@ -28,20 +28,20 @@ void CycleEquiv::dfs2(size_t idx, size_t upperEdge, std::list<size_t> &bracketLi
 {
 	V[idx].visited = true;
 	size_t nChild = 0;
-	for (size_t i = 0; i < V[idx].to.size(); i++)
+	for (size_t i = V[idx].adjBegin; i < V[idx].adjEnd; i++)
 	{
-		size_t child = V[idx].to[i];
+		size_t child = adjTo[i];
 		if (V[child].visited)
 			continue;
 		nChild++;
 		std::list<size_t> tmp;
-		dfs2(child, V[idx].edges[i], tmp);
+		dfs2(child, adjEdge[i], tmp);
 		bracketList.splice(bracketList.end(), tmp);
 	}
-	for (size_t e : V[idx].edges)
+	auto visitBackward = [this, idx, &bracketList](size_t e)
 	{
 		if (!E[e].backward)
-			continue;
+			return;
 		if (E[e].min_dfn == V[idx].dfn)
 			bracketList.erase(E[e].iter);
 		else
@@ -50,14 +50,18 @@ void CycleEquiv::dfs2(size_t idx, size_t upperEdge, std::list<size_t> &bracketLi
 			bracketList.push_front(e);
 			E[e].iter = bracketList.begin();
 		}
-	}
+	};
+	for (size_t i = V[idx].adjBegin; i < V[idx].adjEnd; i++)
+		visitBackward(adjEdge[i]);
+	for (size_t e : V[idx].capping)
+		visitBackward(e);
 	if (nChild > 1)
 	{
 		size_t min_dfn = SIZE_MAX, min_dfn2 = SIZE_MAX;
-		for (size_t i = 0; i < V[idx].to.size(); i++)
+		for (size_t i = V[idx].adjBegin; i < V[idx].adjEnd; i++)
 		{
-			size_t child = V[idx].to[i];
-			if (E[V[idx].edges[i]].backward || V[child].dfn < V[idx].dfn)
+			size_t child = adjTo[i];
+			if (E[adjEdge[i]].backward || V[child].dfn < V[idx].dfn)
 				continue;
 			if (V[child].min_dfn < min_dfn)
 				min_dfn2 = min_dfn, min_dfn = V[child].min_dfn;
@@ -68,7 +72,7 @@ void CycleEquiv::dfs2(size_t idx, size_t upperEdge, std::list<size_t> &bracketLi
 		{
 			size_t e = E.size();
 			E.push_back(edge{ true, min_dfn2 });
-			V[dfv[min_dfn2]].edges.push_back(e);
+			V[dfv[min_dfn2]].capping.push_back(e);
 			bracketList.push_front(e);
 			E[e].iter = bracketList.begin();
 		}
@@ -76,10 +80,35 @@ void CycleEquiv::dfs2(size_t idx, size_t upperEdge, std::list<size_t> &bracketLi
 	E[upperEdge].name = { bracketList.front(), bracketList.size() };
 }
 
-std::vector<std::set<size_t>> CycleEquiv::work()
+std::vector<std::vector<size_t>> CycleEquiv::work()
 {
 	nEdge = E.size();
+	//lay the adjacency lists out in one array, in the order the edges were added
+	std::vector<size_t> degree(V.size(), 0);
+	for (auto &e : ends)
+		if (e.first != e.second)
+			degree[e.first]++, degree[e.second]++;
+	size_t offset = 0;
+	for (size_t i = 0; i < V.size(); i++)
+	{
+		V[i].adjBegin = V[i].adjEnd = offset;
+		offset += degree[i];
+	}
+	adjTo.resize(offset);
+	adjEdge.resize(offset);
+	for (size_t i = 0; i < ends.size(); i++)
+	{
+		size_t u = ends[i].first, v = ends[i].second;
+		if (u == v)
+			continue;
+		adjTo[V[u].adjEnd] = v;
+		adjEdge[V[u].adjEnd++] = i;
+		adjTo[V[v].adjEnd] = u;
+		adjEdge[V[v].adjEnd++] = i;
+	}
+
 	dfv.clear();
+	dfv.reserve(V.size());
 	for (vertex &vtx : V)
 		vtx.visited = false;
 	dfs(0, SIZE_MAX);
@@ -87,25 +116,33 @@ std::vector<std::set<size_t>> CycleEquiv::work()
 		vtx.visited = false;
 	V[0].visited = true;
 	
-	for (size_t i = 0; i < V[0].to.size(); i++)
+	for (size_t i = V[0].adjBegin; i < V[0].adjEnd; i++)
 	{
-		if (V[V[0].to[i]].visited)
+		if (V[adjTo[i]].visited)
 			continue;
 		std::list<size_t> bracketList;
-		dfs2(V[0].to[i], V[0].edges[i], bracketList);
+		dfs2(adjTo[i], adjEdge[i], bracketList);
 	}
 
-	std::map<edge::compactName, std::set<size_t>> equClass;
+	//sorting by name and then by id puts the classes in the order of their names, each sorted by edge id
+	std::vector<std::pair<edge::compactName, size_t>> named(nEdge);
 	for (size_t i = 0; i < nEdge; i++)
+		named[i] = std::make_pair(E[i].backward ? edge::compactName{ i, 1 } : E[i].name, i);
+	std::sort(named.begin(), named.end(), [](const std::pair<edge::compactName, size_t> &a, const std::pair<edge::compactName, size_t> &b)
 	{
-		if (E[i].backward)
-			equClass[edge::compactName{ i, 1 }].insert(i);
-		else
-			equClass[E[i].name].insert(i);
-	}
+		if (a.first < b.first)
+			return true;
+		if (b.first < a.first)
+			return false;
+		return a.second < b.second;
+	});
 
-	std::vector<std::set<size_t>> ret;
-	for (auto &kv : equClass)
-		ret.emplace_back(std::move(kv.second));
+	std::vector<std::vector<size_t>> ret;
+	for (size_t i = 0; i < nEdge; i++)
+	{
+		if (i == 0 || named[i - 1].first < named[i].first)
+			ret.emplace_back();
+		ret.back().push_back(named[i].second);
+	}
 	return ret;
 }
\ No newline at end of file
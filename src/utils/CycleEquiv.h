@@ -6,20 +6,14 @@
 class CycleEquiv
 {
 public:
-	CycleEquiv(size_t nVertex) : V(nVertex), dfv(nVertex) {}
+	CycleEquiv(size_t nVertex) : V(nVertex) {}
 	size_t addEdge(size_t u, size_t v)
 	{
-		if (u != v)
-		{
-			V[u].to.push_back(v);
-			V[u].edges.push_back(E.size());
-			V[v].to.push_back(u);
-			V[v].edges.push_back(E.size());
-		}
+		ends.push_back(std::make_pair(u, v));
 		E.emplace_back();
 		return E.size() - 1;
 	}
-	std::vector<std::set<size_t>> work();
+	std::vector<std::vector<size_t>> work();		//the classes of equivalent edges, each sorted by edge id
 
 protected:
 	void dfs(size_t idx, size_t parent);
@@ -46,13 +40,15 @@ protected:
 	};
 	struct vertex
 	{
-		std::vector<size_t> edges;
-		std::vector<size_t> to;
+		size_t adjBegin, adjEnd;		//the range of the vertex in adjTo and adjEdge
+		std::vector<size_t> capping;	//backward edges added by dfs2, after the ones in adjEdge
 		size_t dfn;
 		size_t min_dfn;
 		bool visited;
 	};
 	std::vector<vertex> V;
+	std::vector<std::pair<size_t, size_t>> ends;	//edge id -> the vertices it links
+	std::vector<size_t> adjTo, adjEdge;		//the adjacent vertices and the edges leading to them, in the order of edge ids
 	std::vector<size_t> dfv;	//dfv[i]: vertex with dfn i
 	std::vector<edge> E;
 	std::list<size_t> bracketList;
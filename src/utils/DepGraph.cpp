@@ -4,8 +4,20 @@
 void DepGraph::work()
 {
 	std::stack<size_t> S;
-	trajan(0, S);
-	sort();
+	for (size_t i = 0; i < V.size(); i++)
+		if (!V[i].visited)
+			trajan(i, S);
+}
+
+bool DepGraph::isCyclic(size_t i) const
+{
+	const std::vector<size_t> &vtxs = VGroup.at(i).vtxs;
+	if (vtxs.size() > 1)
+		return true;
+	for (size_t next : V[vtxs[0]].to)
+		if (next == vtxs[0])
+			return true;
+	return false;
 }
 
 void DepGraph::trajan(size_t idx, std::stack<size_t> &S)
@@ -42,32 +54,3 @@ void DepGraph::trajan(size_t idx, std::stack<size_t> &S)
 		}
 	}
 }
-
-void DepGraph::sort()
-{
-	for (vertex &v : V)
-		for (size_t next : v.to)
-			VGroup[V[next].groupID].indegree++;
-
-	std::queue<size_t> worklist;
-	for (size_t i = 0; i < VGroup.size(); i++)
-		if (VGroup[i].indegree == 0)
-			worklist.push(i);
-
-	size_t sorted = 0;
-	while (!worklist.empty())
-	{
-		size_t cur = worklist.front();
-		worklist.pop();
-
-		for (size_t vtx : VGroup[cur].vtxs)
-			for (size_t next : V[vtx].to)
-			{
-				VGroup[V[next].groupID].indegree--;
-				if (VGroup[V[next].groupID].indegree == 0)
-					worklist.push(V[next].groupID);
-			}
-
-		std::swap(VGroup[sorted++], VGroup[cur]);
-	}
-}
\ No newline at end of file
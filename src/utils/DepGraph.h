@@ -1,23 +1,27 @@
 #ifndef MX_COMPILER_UTILS_DEP_GRAPH_H
 #define MX_COMPILER_UTILS_DEP_GRAPH_H
 
-#include "common.h"
+#include "../common.h"
 #include <vector>
 
+//Strongly connected components of a directed dependency graph (Tarjan).
+//The groups are numbered in dependency order: if u depends on v, getGroup(v) <= getGroup(u).
 class DepGraph
 {
 public:
-	DepGraph(size_t cntVertex) : V(cntVertex) {}
-	void link(size_t u, size_t v)
+	DepGraph(size_t cntVertex) : V(cntVertex), dfsclock(0) {}
+	void link(size_t u, size_t v)	//u depends on v
 	{
 		V.at(u).to.push_back(v);
-		V.at(v).to.push_back(u);
 	}
 	void work();
-	const std::vector<size_t> & getVertex(size_t i)
+	size_t getGroupCount() const { return VGroup.size(); }
+	const std::vector<size_t> & getVertex(size_t i) const
 	{
 		return VGroup.at(i).vtxs;
 	}
+	size_t getGroup(size_t vtx) const { return V.at(vtx).groupID; }
+	bool isCyclic(size_t i) const;		//more than one vertex or a vertex depending on itself
 
 protected:
 	struct vertex
@@ -31,12 +35,10 @@ protected:
 	struct vtxGroup
 	{
 		std::vector<size_t> vtxs;
-		size_t indegree = 0;
 	};
 
 protected:
 	void trajan(size_t idx, std::stack<size_t> &S);
-	void sort();
 
 protected:
 	std::vector<vertex> V;
@@ -45,4 +47,4 @@ protected:
 	std::vector<vtxGroup> VGroup;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -124,7 +124,7 @@ void DomTree::calcIdom()
 
 void DomTree::calcDomFrontier()
 {
-	std::vector<std::set<size_t>> frontier(V.size());
+	//idx is added to the frontiers in increasing order, so a frontier stays sorted and a repeat can only be its last element
 	for (size_t idx = 0; idx < V.size(); idx++)
 	{
 		for (size_t prev : V[idx].from)
@@ -132,13 +132,12 @@ void DomTree::calcDomFrontier()
 			size_t cur = prev;
 			while (cur != V[idx].idom)
 			{
-				frontier[cur].insert(idx);
+				if (V[cur].df.empty() || V[cur].df.back() != idx)
+					V[cur].df.push_back(idx);
 				cur = V[cur].idom;
 			}
 		}
 	}
-	for (size_t idx = 0; idx < V.size(); idx++)
-		std::copy(frontier[idx].begin(), frontier[idx].end(), std::back_inserter(V[idx].df));
 }
 
 void DomTree::verifyIdom()
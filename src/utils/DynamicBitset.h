@@ -0,0 +1,93 @@
+#ifndef MX_COMPILER_UTILS_DYNAMIC_BITSET_H
+#define MX_COMPILER_UTILS_DYNAMIC_BITSET_H
+
+#include "../common.h"
+
+//Set of small non-negative integers stored as a bit vector.
+//It grows on insert, and the bits past the end are zero, so sets of different sizes can be mixed.
+class DynamicBitset
+{
+public:
+	class const_iterator
+	{
+	public:
+		const_iterator(const std::vector<std::uint64_t> &words, size_t idx) : words(&words), idx(idx), cur(idx < words.size() ? words[idx] : 0) { skip(); }
+
+		size_t operator*() const { return idx * 64 + __builtin_ctzll(cur); }
+		const_iterator & operator++() { cur &= cur - 1; skip(); return *this; }
+		bool operator==(const const_iterator &rhs) const { return idx == rhs.idx && cur == rhs.cur; }
+		bool operator!=(const const_iterator &rhs) const { return !(*this == rhs); }
+
+	protected:
+		void skip()
+		{
+			while (!cur && idx < words->size())
+			{
+				idx++;
+				cur = idx < words->size() ? (*words)[idx] : 0;
+			}
+		}
+
+	protected:
+		const std::vector<std::uint64_t> *words;
+		size_t idx;
+		std::uint64_t cur;	//bits of words[idx] not visited yet
+	};
+
+public:
+	DynamicBitset() {}
+	explicit DynamicBitset(size_t size) : words((size + 63) / 64, 0) {}
+
+	bool count(size_t idx) const { return idx / 64 < words.size() && (words[idx / 64] >> (idx % 64) & 1); }
+	bool insert(size_t idx)		//return false if idx is already in the set
+	{
+		if (idx / 64 >= words.size())
+			words.resize(idx / 64 + 1, 0);
+		std::uint64_t mask = std::uint64_t(1) << (idx % 64);
+		if (words[idx / 64] & mask)
+			return false;
+		words[idx / 64] |= mask;
+		return true;
+	}
+	void erase(size_t idx)
+	{
+		if (idx / 64 < words.size())
+			words[idx / 64] &= ~(std::uint64_t(1) << (idx % 64));
+	}
+	void clear() { words.clear(); }
+	bool empty() const { return std::all_of(words.begin(), words.end(), [](std::uint64_t w) { return w == 0; }); }
+	size_t size() const
+	{
+		size_t ret = 0;
+		for (std::uint64_t w : words)
+			ret += __builtin_popcountll(w);
+		return ret;
+	}
+
+	bool unionWith(const DynamicBitset &rhs)	//return whether any element is added
+	{
+		if (rhs.words.size() > words.size())
+			words.resize(rhs.words.size(), 0);
+		std::uint64_t changed = 0;
+		for (size_t i = 0; i < rhs.words.size(); i++)
+		{
+			changed |= rhs.words[i] & ~words[i];
+			words[i] |= rhs.words[i];
+		}
+		return changed != 0;
+	}
+	void subtract(const DynamicBitset &rhs)
+	{
+		for (size_t i = 0; i < words.size() && i < rhs.words.size(); i++)
+			words[i] &= ~rhs.words[i];
+	}
+
+	//elements are visited in increasing order
+	const_iterator begin() const { return const_iterator(words, 0); }
+	const_iterator end() const { return const_iterator(words, words.size()); }
+
+protected:
+	std::vector<std::uint64_t> words;
+};
+
+#endif
@@ -5,6 +5,12 @@ bool MaxClique::BronKerbosch()
 {
 	if (P.empty() && X.empty())
 		return true;
+	if (stepsLeft == 0)
+	{
+		exhausted = true;
+		return false;
+	}
+	stepsLeft--, stepsUsed++;
 	size_t u = P.empty() ? *X.begin() : *P.begin();
 	
 	size_t j = 0;
@@ -24,6 +30,8 @@ bool MaxClique::BronKerbosch()
 		R.push_back(v);
 		if (BronKerbosch())
 			return true;
+		if (exhausted)
+			return false;
 		R.pop_back();
 		P = std::move(oldP), X = std::move(oldX);
 		assert(k == P.size() - 1 && P[k] == v);
@@ -31,4 +39,30 @@ bool MaxClique::BronKerbosch()
 		X.push_back(v);
 	}
 	return false;
+}
+
+void MaxClique::greedyClique()
+{
+	//repeatedly take the candidate with the most neighbors among the other candidates
+	R.clear();
+	P.resize(V.size());
+	std::iota(P.begin(), P.end(), 0);
+	while (!P.empty())
+	{
+		size_t best = 0, bestDegree = 0;
+		for (size_t i = 0; i < P.size(); i++)
+		{
+			size_t degree = std::count_if(P.begin(), P.end(), [this, &i](size_t t) { return V[P[i]].neighbor.count(t) != 0; });
+			if (i == 0 || degree > bestDegree)
+				best = i, bestDegree = degree;
+		}
+		size_t v = P[best];
+		R.push_back(v);
+		std::vector<size_t> oldP = std::move(P);
+		P.clear();
+		for (size_t t : oldP)
+			if (V[v].neighbor.count(t))
+				P.push_back(t);
+	}
+	X.clear();
 }
\ No newline at end of file
@@ -6,22 +6,31 @@
 class MaxClique
 {
 public:
-	MaxClique(size_t nVertex) : V(nVertex) {}
+	MaxClique(size_t nVertex) : V(nVertex), stepsLeft(0), stepsUsed(0), exhausted(false) {}
 	void link(size_t u, size_t v)
 	{
 		V.at(u).neighbor.insert(v);
 		V.at(v).neighbor.insert(u);
 	}
-	const std::vector<size_t> & findMaxClique()
+	//at most budget calls of BronKerbosch are made; if they are not enough,
+	//the clique is built greedily instead and isExhausted() returns true
+	const std::vector<size_t> & findMaxClique(size_t budget = size_t(-1))
 	{
 		R.clear();
 		X.clear();
 		P.resize(V.size());
 		std::iota(P.begin(), P.end(), 0);
-		BronKerbosch();
+		stepsLeft = budget;
+		stepsUsed = 0;
+		exhausted = false;
+		if (!BronKerbosch() && exhausted)
+			greedyClique();
 		return R;
 	}
 	bool BronKerbosch();
+	void greedyClique();
+	size_t getStepsUsed() const { return stepsUsed; }
+	bool isExhausted() const { return exhausted; }
 
 protected:
 	struct vertex
@@ -30,6 +39,8 @@ protected:
 	};
 	std::vector<size_t> R, P, X;
 	std::vector<vertex> V;
+	size_t stepsLeft, stepsUsed;
+	bool exhausted;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,85 @@
+#ifndef MX_COMPILER_UTILS_POINTER_MAP_H
+#define MX_COMPILER_UTILS_POINTER_MAP_H
+
+#include "../common.h"
+
+//Map from pointers to indices, stored in an open addressing table.
+//Keys are never erased, which keeps it much cheaper than std::unordered_map for the per-block bookkeeping of the passes.
+//An insert may move the values, so the pointers returned by find() and emplace() are valid until the next insert.
+template<typename T>
+class PointerMap
+{
+public:
+	PointerMap() { clear(); }
+
+	size_t size() const { return nKeys; }
+	void clear()
+	{
+		slots.assign(size_t(1) << minBits, Slot{ nullptr, 0 });
+		shift = 64 - minBits;
+		nKeys = 0;
+	}
+
+	size_t * find(const T *key)
+	{
+		Slot &slot = slots[locate(key)];
+		return slot.key ? &slot.value : nullptr;
+	}
+	const size_t * find(const T *key) const
+	{
+		const Slot &slot = slots[locate(key)];
+		return slot.key ? &slot.value : nullptr;
+	}
+	//return the value of key and whether key is new; the value of an old key is kept
+	std::pair<size_t *, bool> emplace(const T *key, size_t value)
+	{
+		assert(key);
+		size_t pos = locate(key);
+		if (slots[pos].key)
+			return std::make_pair(&slots[pos].value, false);
+		if ((nKeys + 1) * 2 > slots.size())
+		{
+			grow();
+			pos = locate(key);
+		}
+		slots[pos] = Slot{ key, value };
+		nKeys++;
+		return std::make_pair(&slots[pos].value, true);
+	}
+	bool insert(const T *key, size_t value = 0) { return emplace(key, value).second; }
+	size_t & operator[](const T *key) { return *emplace(key, 0).first; }
+
+protected:
+	struct Slot
+	{
+		const T *key;
+		size_t value;
+	};
+	size_t locate(const T *key) const
+	{
+		//Fibonacci hashing: the high bits of the product depend on all bits of the address
+		size_t mask = slots.size() - 1;
+		size_t pos = size_t((std::uint64_t(reinterpret_cast<std::uintptr_t>(key)) * 0x9E3779B97F4A7C15ull) >> shift);
+		while (slots[pos].key && slots[pos].key != key)
+			pos = (pos + 1) & mask;
+		return pos;
+	}
+	void grow()
+	{
+		std::vector<Slot> old(slots.size() * 2, Slot{ nullptr, 0 });
+		old.swap(slots);
+		shift--;
+		for (const Slot &slot : old)
+			if (slot.key)
+				slots[locate(slot.key)] = slot;
+	}
+
+protected:
+	std::vector<Slot> slots;
+	int shift;		//64 - log2 of the number of slots
+	size_t nKeys;
+
+	static const int minBits = 4;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "../common_headers.h"
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(size_t nThreads) : generation(0), exiting(false), remaining(0)
+{
+	nThreads = resolveThreads(nThreads);
+	for (size_t i = 0; i < nThreads; i++)
+		queues.emplace_back(new WorkQueue);
+	for (size_t i = 1; i < nThreads; i++)
+		workers.emplace_back([this, i]() { workerMain(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mtxPool);
+		exiting = true;
+	}
+	cvStart.notify_all();
+	for (auto &th : workers)
+		th.join();
+}
+
+size_t ThreadPool::resolveThreads(size_t nThreads)
+{
+	if (nThreads == 0)
+		nThreads = std::thread::hardware_concurrency();
+	return std::max<size_t>(nThreads, 1);
+}
+
+void ThreadPool::parallelFor(size_t n, const std::function<void(size_t)> &task)
+{
+	if (n == 0)
+		return;
+	if (workers.empty())
+	{
+		for (size_t i = 0; i < n; i++)
+			task(i);
+		return;
+	}
+
+	error = nullptr;
+	remaining = n;
+	//contiguous chunks for each queue; idle threads steal from the tail of others
+	size_t nQueue = queues.size();
+	for (size_t q = 0; q < nQueue; q++)
+	{
+		std::lock_guard<std::mutex> lock(queues[q]->mtx);
+		for (size_t i = n * q / nQueue; i < n * (q + 1) / nQueue; i++)
+			queues[q]->items.push_back(TaskItem{ &task, i });
+	}
+	{
+		std::lock_guard<std::mutex> lock(mtxPool);
+		generation++;
+	}
+	cvStart.notify_all();
+
+	runTasks(0);
+
+	{
+		std::unique_lock<std::mutex> lock(mtxPool);
+		cvDone.wait(lock, [this]() { return remaining == 0; });
+	}
+	if (error)
+		std::rethrow_exception(error);
+}
+
+void ThreadPool::workerMain(size_t id)
+{
+	size_t seen = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mtxPool);
+			cvStart.wait(lock, [this, seen]() { return exiting || generation != seen; });
+			if (exiting)
+				return;
+			seen = generation;
+		}
+		runTasks(id);
+	}
+}
+
+void ThreadPool::runTasks(size_t id)
+{
+	TaskItem item;
+	while (popLocal(id, item) || steal(id, item))
+	{
+		try
+		{
+			(*item.task)(item.idx);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(mtxError);
+			if (!error)
+				error = std::current_exception();
+		}
+		if (remaining.fetch_sub(1) == 1)
+		{
+			std::lock_guard<std::mutex> lock(mtxPool);
+			cvDone.notify_all();
+		}
+	}
+}
+
+bool ThreadPool::popLocal(size_t id, TaskItem &item)
+{
+	WorkQueue &q = *queues[id];
+	std::lock_guard<std::mutex> lock(q.mtx);
+	if (q.items.empty())
+		return false;
+	item = q.items.front();
+	q.items.pop_front();
+	return true;
+}
+
+bool ThreadPool::steal(size_t id, TaskItem &item)
+{
+	for (size_t k = 1; k < queues.size(); k++)
+	{
+		WorkQueue &q = *queues[(id + k) % queues.size()];
+		std::lock_guard<std::mutex> lock(q.mtx);
+		if (q.items.empty())
+			continue;
+		item = q.items.back();
+		q.items.pop_back();
+		return true;
+	}
+	return false;
+}
@@ -0,0 +1,60 @@
+#ifndef MX_COMPILER_UTILS_THREAD_POOL_H
+#define MX_COMPILER_UTILS_THREAD_POOL_H
+
+#include "../common.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <exception>
+
+//A small work-stealing thread pool. The calling thread takes part in the work,
+//so a pool of size 1 runs everything serially and in order.
+class ThreadPool
+{
+public:
+	ThreadPool(size_t nThreads);
+	~ThreadPool();
+
+	size_t size() const { return queues.size(); }
+
+	//run task(0) ... task(n-1) and wait for all of them to finish.
+	//The first exception thrown by a task is rethrown here.
+	void parallelFor(size_t n, const std::function<void(size_t)> &task);
+
+	//nThreads == 0 means one thread per hardware core
+	static size_t resolveThreads(size_t nThreads);
+
+protected:
+	struct TaskItem
+	{
+		const std::function<void(size_t)> *task;
+		size_t idx;
+	};
+	struct WorkQueue
+	{
+		std::mutex mtx;
+		std::deque<TaskItem> items;
+	};
+
+	void workerMain(size_t id);
+	void runTasks(size_t id);
+	bool popLocal(size_t id, TaskItem &item);
+	bool steal(size_t id, TaskItem &item);
+
+protected:
+	std::vector<std::unique_ptr<WorkQueue>> queues;
+	std::vector<std::thread> workers;
+
+	std::mutex mtxPool;
+	std::condition_variable cvStart, cvDone;
+	size_t generation;
+	bool exiting;
+
+	std::atomic<size_t> remaining;
+	std::mutex mtxError;
+	std::exception_ptr error;
+};
+
+#endif